@@ -26,7 +26,8 @@ ChCollisionInfo::ChCollisionInfo()
       vN(ChVector3d(1, 0, 0)),
       distance(0),
       eff_radius(default_eff_radius),
-      reaction_cache(nullptr) {}
+      reaction_cache(nullptr),
+      feature_id(0) {}
 
 ChCollisionInfo::ChCollisionInfo(const ChCollisionInfo& other, const bool swap) {
     if (!swap) {
@@ -50,6 +51,7 @@ ChCollisionInfo::ChCollisionInfo(const ChCollisionInfo& other, const bool swap)
     distance = other.distance;
     eff_radius = other.eff_radius;
     reaction_cache = other.reaction_cache;
+    feature_id = other.feature_id;
 }
 
 void ChCollisionInfo::SwapModels() {
@@ -13,6 +13,8 @@
 #ifndef CH_COLLISION_INFO_H
 #define CH_COLLISION_INFO_H
 
+#include <functional>
+
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChVector3.h"
@@ -25,16 +27,17 @@ namespace chrono {
 /// Class defining basic geometric information for collision pairs.
 class ChApi ChCollisionInfo {
   public:
-    ChCollisionModel* modelA;  ///< model A
-    ChCollisionModel* modelB;  ///< model B
-    ChCollisionShape* shapeA;  ///< collision shape in model A
-    ChCollisionShape* shapeB;  ///< collision shape in model B
-    ChVector3d vpA;            ///< coll.point on A, in abs coords
-    ChVector3d vpB;            ///< coll.point on B, in abs coords
-    ChVector3d vN;             ///< coll.normal, respect to A, in abs coords
-    double distance;           ///< distance (negative for penetration)
-    double eff_radius;         ///< effective radius of curvature at contact (SMC only)
-    float* reaction_cache;     ///< pointer to some persistent user cache of reactions
+    ChCollisionModel* modelA;       ///< model A
+    ChCollisionModel* modelB;       ///< model B
+    ChCollisionShape* shapeA;       ///< collision shape in model A
+    ChCollisionShape* shapeB;       ///< collision shape in model B
+    ChVector3d vpA;                 ///< coll.point on A, in abs coords
+    ChVector3d vpB;                 ///< coll.point on B, in abs coords
+    ChVector3d vN;                  ///< coll.normal, respect to A, in abs coords
+    double distance;                ///< distance (negative for penetration)
+    double eff_radius;              ///< effective radius of curvature at contact (SMC only)
+    float* reaction_cache;          ///< pointer to some persistent user cache of reactions
+    unsigned long long feature_id;  ///< persistent identifier of the contact between shapeA and shapeB (0 if none)
 
     /// Basic default constructor.
     ChCollisionInfo();
@@ -58,6 +61,29 @@ class ChApi ChCollisionInfo {
     static double GetDefaultEffectiveCurvatureRadius();
 };
 
+/// Key identifying a persistent contact across collision detection passes.
+/// A contact is identified by its pair of collision shapes and by a feature identifier, reported by the collision
+/// system, which distinguishes between multiple contacts of the same shape pair (see ChCollisionInfo::feature_id).
+struct ChContactKey {
+    const ChCollisionShape* shapeA;  ///< collision shape in model A
+    const ChCollisionShape* shapeB;  ///< collision shape in model B
+    unsigned long long feature_id;   ///< persistent contact feature identifier
+
+    bool operator==(const ChContactKey& other) const {
+        return shapeA == other.shapeA && shapeB == other.shapeB && feature_id == other.feature_id;
+    }
+};
+
+/// Hash function for persistent contact keys.
+struct ChContactKeyHash {
+    size_t operator()(const ChContactKey& key) const {
+        size_t h = std::hash<const void*>()(key.shapeA);
+        h ^= std::hash<const void*>()(key.shapeB) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        h ^= std::hash<unsigned long long>()(key.feature_id) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        return h;
+    }
+};
+
 /// @} chrono_collision
 
 }  // end namespace chrono
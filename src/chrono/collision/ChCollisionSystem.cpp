@@ -35,6 +35,18 @@ void ChCollisionSystem::Initialize() {
     m_initialized = true;
 }
 
+void ChCollisionSystem::RayHitMulti(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const {
+    int num_rays = (int)rays.size();
+    int nthreads = m_system ? m_system->GetNumThreadsCollision() : 1;
+
+    results.resize(num_rays);
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int i = 0; i < num_rays; i++) {
+        RayHit(rays[i].from, rays[i].to, results[i]);
+    }
+}
+
 void ChCollisionSystem::BindAll() {
     if (!m_system)
         return;
@@ -51,6 +63,11 @@ void ChCollisionSystem::UnbindItem(std::shared_ptr<ChPhysicsItem> item) {
     item->RemoveCollisionModelsFromSystem(this);
 }
 
+void ChCollisionSystem::RemoveBatch(const std::vector<std::shared_ptr<ChCollisionModel>>& models) {
+    for (const auto& model : models)
+        Remove(model);
+}
+
 void ChCollisionSystem::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChCollisionSystem>();
@@ -77,6 +77,11 @@ class ChApi ChCollisionSystem {
     /// Remove the specified collision model from the collision engine.
     virtual void Remove(std::shared_ptr<ChCollisionModel> model) = 0;
 
+    /// Remove the specified collision models from the collision engine.
+    /// The default implementation removes the models one at a time. Derived classes may override this function to
+    /// process the entire set at once.
+    virtual void RemoveBatch(const std::vector<std::shared_ptr<ChCollisionModel>>& models);
+
     /// Optional synchronization operations, invoked before running the collision detection.
     virtual void PreProcess() {}
 
@@ -186,6 +191,21 @@ class ChApi ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const = 0;
 
+    /// Ray definition for batched ray-hit tests.
+    struct ChRay {
+        ChVector3d from;  ///< ray start point
+        ChVector3d to;    ///< ray end point
+    };
+
+    /// Perform a batch of ray-hit tests with the collision models.
+    /// On return, `results` has the same size as `rays` and results[i] holds the closest hit of the i-th ray. Results
+    /// are written directly in their slots, so this function can be called with no synchronization on the caller side.
+    /// The ray tests are distributed over the number of collision threads of the associated system. For best
+    /// performance, spatially coherent rays (e.g., rays cast from neighboring grid nodes) should be adjacent in `rays`,
+    /// since implementations may process consecutive rays as packets with a single traversal of their acceleration
+    /// structure. The default implementation calls RayHit for each ray.
+    virtual void RayHitMulti(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const;
+
     /// Class to be used as a callback interface for user-defined visualization of collision shapes.
     class ChApi VisualizationCallback {
       public:
@@ -66,6 +66,7 @@ public:
 	{
 		// ***CHRONO***
 		reactions_cache[0]=reactions_cache[1]=reactions_cache[2]=reactions_cache[3]=reactions_cache[4]=reactions_cache[5]=0;
+		persistent_id = 0;
 	}
 
 	cbtManifoldPoint(const cbtVector3& pointA, const cbtVector3& pointB,
@@ -92,9 +93,11 @@ public:
 	{
 		// ***CHRONO***
 		reactions_cache[0]=reactions_cache[1]=reactions_cache[2]=reactions_cache[3]=reactions_cache[4]=reactions_cache[5]=0;
+		persistent_id = 0;
 	}
 
 	float reactions_cache[6]; // ***CHRONO***  cache here the three multipliers N,U,V for warm starting the NCP solver.
+	unsigned long long persistent_id; // ***CHRONO***  identifier of this point, kept as long as the point persists in its manifold.
 
 	cbtVector3 m_localPointA;
 	cbtVector3 m_localPointB;
@@ -38,6 +38,7 @@ cbtPersistentManifold::cbtPersistentManifold()
 	  m_body0(0),
 	  m_body1(0),
 	  m_cachedPoints(0),
+	  m_lastPointId(0),
 	  m_companionIdA(0),
 	  m_companionIdB(0),
 	  m_index1a(0)
@@ -240,6 +241,7 @@ int cbtPersistentManifold::addManifoldPoint(const cbtManifoldPoint& newPoint, bo
 
 	cbtAssert(m_pointCache[insertIndex].m_userPersistentData == 0);
 	m_pointCache[insertIndex] = newPoint;
+	m_pointCache[insertIndex].persistent_id = ++m_lastPointId;  // ***CHRONO***
 	return insertIndex;
 }
 
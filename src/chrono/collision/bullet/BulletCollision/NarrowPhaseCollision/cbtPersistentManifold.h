@@ -74,6 +74,8 @@ cbtPersistentManifold : public cbtTypedObject
 	cbtScalar m_contactBreakingThreshold;
 	cbtScalar m_contactProcessingThreshold;
 
+	unsigned long long m_lastPointId;  // ***CHRONO***  last persistent identifier assigned to a new point
+
 	/// sort cached points so most isolated points come first
 	int sortCachedPoints(const cbtManifoldPoint& pt);
 
@@ -96,6 +98,7 @@ public:
 		  m_cachedPoints(0),
 		  m_contactBreakingThreshold(contactBreakingThreshold),
 		  m_contactProcessingThreshold(contactProcessingThreshold),
+		  m_lastPointId(0),
 		  m_companionIdA(0),
 		  m_companionIdB(0),
 		  m_index1a(0)
@@ -184,6 +187,7 @@ public:
 			m_pointCache[lastUsedIndex].reactions_cache[3] = 0;
 			m_pointCache[lastUsedIndex].reactions_cache[4] = 0;
 			m_pointCache[lastUsedIndex].reactions_cache[5] = 0;
+			m_pointCache[lastUsedIndex].persistent_id = 0;
 		}
 
 		cbtAssert(m_pointCache[lastUsedIndex].m_userPersistentData == 0);
@@ -233,6 +237,7 @@ public:
 			float mf = m_pointCache[insertIndex].reactions_cache[3];
 			float mg = m_pointCache[insertIndex].reactions_cache[4];
 			float mh = m_pointCache[insertIndex].reactions_cache[5];
+			unsigned long long id = m_pointCache[insertIndex].persistent_id;
 
 			m_pointCache[insertIndex] = newPoint;
 			m_pointCache[insertIndex].m_userPersistentData = cache;
@@ -246,6 +251,7 @@ public:
 			m_pointCache[insertIndex].reactions_cache[3] = mf;
 			m_pointCache[insertIndex].reactions_cache[4] = mg;
 			m_pointCache[insertIndex].reactions_cache[5] = mh;
+			m_pointCache[insertIndex].persistent_id = id;
 		}
 
 		m_pointCache[insertIndex].m_lifeTime = lifeTime;
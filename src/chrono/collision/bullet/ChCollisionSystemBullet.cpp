@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include <algorithm>
+#include <unordered_set>
 
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChProximityContainer.h"
@@ -27,6 +28,7 @@
 #include "chrono/collision/gimpact/GIMPACT/Bullet/cbtGImpactCollisionAlgorithm.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionDispatch/cbtCollisionDispatcherMt.h"
 #include "chrono/collision/bullet/LinearMath/cbtIDebugDraw.h"
+#include "chrono/collision/bullet/LinearMath/cbtAabbUtil2.h"
 
 extern cbtScalar gContactBreakingThreshold;
 
@@ -180,6 +182,27 @@ void ChCollisionSystemBullet::Remove(ChCollisionModelBullet* bt_model, bool eras
     }
 }
 
+void ChCollisionSystemBullet::RemoveBatch(const std::vector<std::shared_ptr<ChCollisionModel>>& models) {
+    std::unordered_set<ChCollisionModelBullet*> removed;
+    for (const auto& model : models) {
+        if (!model->HasImplementation())
+            continue;
+        auto bt_model = (ChCollisionModelBullet*)model->GetImplementation();
+        Remove(bt_model, false);
+        removed.insert(bt_model);
+        model->RemoveImplementation();
+    }
+
+    if (removed.empty())
+        return;
+
+    bt_models.erase(std::remove_if(bt_models.begin(), bt_models.end(),
+                                   [&removed](const std::shared_ptr<ChCollisionModelBullet>& x) {
+                                       return removed.count(x.get()) > 0;
+                                   }),
+                    bt_models.end());
+}
+
 void ChCollisionSystemBullet::Run() {
     if (bt_collision_world) {
         bt_collision_world->performDiscreteCollisionDetection();
@@ -265,6 +288,7 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
                     icontact.distance = ptdist + envelopeA + envelopeB;
 
                     icontact.reaction_cache = pt.reactions_cache;
+                    icontact.feature_id = pt.persistent_id;
 
                     bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
                     bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
@@ -321,6 +345,28 @@ void ChCollisionSystemBullet::ReportProximities(ChProximityContainer* mproximity
     mproximitycontainer->EndAddProximities();
 }
 
+// Load the closest hit recorded by the given Bullet ray callback (if any) in a Chrono ray-hit result.
+bool ChCollisionSystemBullet::LoadRayhitResult(const cbtCollisionWorld::ClosestRayResultCallback& rayCallback,
+                                               ChRayhitResult& result) {
+    if (rayCallback.hasHit()) {
+        auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObject->getUserPointer());
+        result.hitModel = bt_model->model;
+        if (result.hitModel) {
+            result.hit = true;
+            result.abs_hitPoint.Set(rayCallback.m_hitPointWorld.x(), rayCallback.m_hitPointWorld.y(),
+                                    rayCallback.m_hitPointWorld.z());
+            result.abs_hitNormal.Set(rayCallback.m_hitNormalWorld.x(), rayCallback.m_hitNormalWorld.y(),
+                                     rayCallback.m_hitNormalWorld.z());
+            result.abs_hitNormal.Normalize();
+            result.dist_factor = rayCallback.m_closestHitFraction;
+            result.abs_hitPoint = result.abs_hitPoint - result.abs_hitNormal * result.hitModel->GetEnvelope();
+            return true;
+        }
+    }
+    result.hit = false;
+    return false;
+}
+
 bool ChCollisionSystemBullet::RayHit(const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const {
     return RayHit(from, to, result, cbtBroadphaseProxy::DefaultFilter, cbtBroadphaseProxy::AllFilter);
 }
@@ -339,23 +385,83 @@ bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
 
     this->bt_collision_world->rayTest(btfrom, btto, rayCallback);
 
-    if (rayCallback.hasHit()) {
-        auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObject->getUserPointer());
-        result.hitModel = bt_model->model;
-        if (result.hitModel) {
-            result.hit = true;
-            result.abs_hitPoint.Set(rayCallback.m_hitPointWorld.x(), rayCallback.m_hitPointWorld.y(),
-                                    rayCallback.m_hitPointWorld.z());
-            result.abs_hitNormal.Set(rayCallback.m_hitNormalWorld.x(), rayCallback.m_hitNormalWorld.y(),
-                                     rayCallback.m_hitNormalWorld.z());
-            result.abs_hitNormal.Normalize();
-            result.dist_factor = rayCallback.m_closestHitFraction;
-            result.abs_hitPoint = result.abs_hitPoint - result.abs_hitNormal * result.hitModel->GetEnvelope();
-            return true;
+    return LoadRayhitResult(rayCallback, result);
+}
+
+// Broadphase callback collecting all collision objects with AABB overlapping the AABB of a ray packet.
+class RayPacketCallback : public cbtBroadphaseAabbCallback {
+  public:
+    virtual bool process(const cbtBroadphaseProxy* proxy) override {
+        objects.push_back(static_cast<cbtCollisionObject*>(proxy->m_clientObject));
+        return true;
+    }
+
+    std::vector<cbtCollisionObject*> objects;
+};
+
+void ChCollisionSystemBullet::RayHitMulti(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const {
+    // Consecutive rays are processed as packets. For each packet, the broadphase tree is traversed only once, to
+    // collect the collision objects overlapping the AABB of the entire packet. Each ray in the packet is then tested
+    // against these candidates only.
+    static const int packet_size = 64;
+
+    int num_rays = (int)rays.size();
+    int num_packets = (num_rays + packet_size - 1) / packet_size;
+    int nthreads = m_system ? m_system->GetNumThreadsCollision() : 1;
+
+    results.resize(num_rays);
+
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+    for (int ip = 0; ip < num_packets; ip++) {
+        int start = ip * packet_size;
+        int end = std::min(start + packet_size, num_rays);
+
+        // AABB of the ray packet
+        cbtVector3 aabb_min(BT_LARGE_FLOAT, BT_LARGE_FLOAT, BT_LARGE_FLOAT);
+        cbtVector3 aabb_max(-BT_LARGE_FLOAT, -BT_LARGE_FLOAT, -BT_LARGE_FLOAT);
+        for (int i = start; i < end; i++) {
+            cbtVector3 btfrom((cbtScalar)rays[i].from.x(), (cbtScalar)rays[i].from.y(), (cbtScalar)rays[i].from.z());
+            cbtVector3 btto((cbtScalar)rays[i].to.x(), (cbtScalar)rays[i].to.y(), (cbtScalar)rays[i].to.z());
+            aabb_min.setMin(btfrom);
+            aabb_min.setMin(btto);
+            aabb_max.setMax(btfrom);
+            aabb_max.setMax(btto);
+        }
+
+        // Collect candidate collision objects
+        RayPacketCallback candidates;
+        bt_broadphase->aabbTest(aabb_min, aabb_max, candidates);
+
+        // Test each ray in the packet against the candidate objects
+        for (int i = start; i < end; i++) {
+            cbtVector3 btfrom((cbtScalar)rays[i].from.x(), (cbtScalar)rays[i].from.y(), (cbtScalar)rays[i].from.z());
+            cbtVector3 btto((cbtScalar)rays[i].to.x(), (cbtScalar)rays[i].to.y(), (cbtScalar)rays[i].to.z());
+            cbtTransform from_trans(cbtMatrix3x3::getIdentity(), btfrom);
+            cbtTransform to_trans(cbtMatrix3x3::getIdentity(), btto);
+
+            cbtCollisionWorld::ClosestRayResultCallback rayCallback(btfrom, btto);
+            rayCallback.m_collisionFilterGroup = cbtBroadphaseProxy::DefaultFilter;
+            rayCallback.m_collisionFilterMask = cbtBroadphaseProxy::AllFilter;
+
+            for (auto object : candidates.objects) {
+                // Terminate further ray tests once the closest hit fraction reached zero
+                if (rayCallback.m_closestHitFraction == cbtScalar(0))
+                    break;
+                cbtBroadphaseProxy* proxy = object->getBroadphaseHandle();
+                if (!rayCallback.needsCollision(proxy))
+                    continue;
+                // Quick rejection test against the object AABB
+                cbtScalar lambda = rayCallback.m_closestHitFraction;
+                cbtVector3 normal;
+                if (!cbtRayAabb(btfrom, btto, proxy->m_aabbMin, proxy->m_aabbMax, lambda, normal))
+                    continue;
+                cbtCollisionWorld::rayTestSingle(from_trans, to_trans, object, object->getCollisionShape(),
+                                                 object->getWorldTransform(), rayCallback);
+            }
+
+            LoadRayhitResult(rayCallback, results[i]);
         }
     }
-    result.hit = false;
-    return false;
 }
 
 bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
@@ -45,6 +45,10 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// Remove the specified collision model from the collision engine.
     virtual void Remove(std::shared_ptr<ChCollisionModel> model) override;
 
+    /// Remove the specified collision models from the collision engine.
+    /// The list of Bullet models is compacted only once for the entire set.
+    virtual void RemoveBatch(const std::vector<std::shared_ptr<ChCollisionModel>>& models) override;
+
     /// Removes all collision models from the collision
     /// engine (custom data may be deallocated).
     // virtual void RemoveAll();
@@ -95,6 +99,10 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform a batch of ray-hit tests with all collision models.
+    /// Consecutive rays are processed in packets, with a single traversal of the Bullet broadphase tree per packet.
+    virtual void RayHitMulti(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const override;
+
     /// Specify a callback object to be used for debug rendering of collision shapes.
     virtual void RegisterVisualizationCallback(std::shared_ptr<VisualizationCallback> callback) override;
 
@@ -136,6 +144,10 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                 short int filter_group,
                 short int filter_mask) const;
 
+    /// Load the closest hit recorded by the given Bullet ray callback (if any) in the provided ray-hit result.
+    static bool LoadRayhitResult(const cbtCollisionWorld::ClosestRayResultCallback& rayCallback,
+                                 ChRayhitResult& result);
+
     /// Remove the specified Bullet model from this collision system.
     /// If erase=true, also remove from the bt_models list.
     void Remove(ChCollisionModelBullet* bt_model, bool erase);
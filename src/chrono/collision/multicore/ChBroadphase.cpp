@@ -38,6 +38,9 @@ ChBroadphase::ChBroadphase()
       grid_resolution(vec3(10, 10, 10)),
       bin_size(real3(1, 1, 1)),
       grid_density(5),
+      persistent(false),
+      margin(0),
+      cache_valid(false),
       cd_data(nullptr) {}
 
 // -----------------------------------------------------------------------------
@@ -161,7 +164,27 @@ void ChBroadphase::DetermineBoundingBox() {
 
     cd_data->min_bounding_point = min_point;
     cd_data->max_bounding_point = max_point;
-    cd_data->global_origin = min_point;
+}
+
+// Set up a new grid over the current overall bounding box.
+// In persistent mode, the grid is inflated by the safety margin and the grid settings are cached.
+void ChBroadphase::SetupGrid() {
+    if (persistent) {
+        real m = GetMargin();
+        cd_data->min_bounding_point = cd_data->min_bounding_point - real3(m);
+        cd_data->max_bounding_point = cd_data->max_bounding_point + real3(m);
+    }
+
+    cd_data->global_origin = cd_data->min_bounding_point;
+
+    // Determine resolution of the top level grid
+    ComputeTopLevelResolution();
+
+    cache_grid_type = grid_type;
+    cache_grid_resolution = grid_resolution;
+    cache_bin_size = bin_size;
+    cache_grid_density = grid_density;
+    cache_max_point = cd_data->max_bounding_point;
 }
 
 void ChBroadphase::OffsetAABB() {
@@ -210,48 +233,50 @@ void ChBroadphase::ComputeTopLevelResolution() {
 
 // Use spatial subdivision to detect the list of POSSIBLE collisions
 void ChBroadphase::Process() {
-    // Compute overall AABB and then offset all AABBs
+    // Compute overall AABB
     DetermineBoundingBox();
-    OffsetAABB();
 
-    // Determine resolution of the top level grid
-    ComputeTopLevelResolution();
+    // Set up a new grid, unless the grid from the previous step can be reused (persistent mode only).
+    // Setting up a new grid invalidates all cached broadphase data.
+    if (!persistent || !CanReuseGrid()) {
+        cache_valid = false;
+        SetupGrid();
+    } else {
+        cd_data->min_bounding_point = cd_data->global_origin;
+        cd_data->max_bounding_point = cache_max_point;
+    }
+
+    // Offset all AABBs
+    OffsetAABB();
 
     if (cd_data->num_rigid_shapes != 0) {
-        OneLevelBroadphase();
+        if (persistent)
+            PersistentBroadphase();
+        else
+            OneLevelBroadphase(cd_data->aabb_min, cd_data->aabb_max);
         cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
     }
     return;
 }
 
-void ChBroadphase::OneLevelBroadphase() {
-    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
-    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+void ChBroadphase::OneLevelBroadphase(const std::vector<real3>& aabb_min, const std::vector<real3>& aabb_max) {
+    BinShapes(aabb_min, aabb_max);
+    FindPairs(aabb_min, aabb_max);
+}
 
-    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
-    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+// Bin all shape AABBs: generate the list of bin - shape AABB intersections, sorted by bin index.
+void ChBroadphase::BinShapes(const std::vector<real3>& aabb_min, const std::vector<real3>& aabb_max) {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
 
-    const std::vector<real3>& aabb_min = cd_data->aabb_min;
-    const std::vector<real3>& aabb_max = cd_data->aabb_max;
-    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
     std::vector<uint>& bin_intersections = cd_data->bin_intersections;
     std::vector<uint>& bin_number = cd_data->bin_number;
     std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
-    std::vector<uint>& bin_active = cd_data->bin_active;
-    std::vector<uint>& bin_start_index = cd_data->bin_start_index;
-    std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
-    std::vector<uint>& bin_num_contact = cd_data->bin_num_contact;
 
     const int num_shapes = cd_data->num_rigid_shapes;
 
     const vec3& bins_per_axis = cd_data->bins_per_axis;
     const real3& inv_bin_size = cd_data->inv_bin_size;
-    uint& num_bins = cd_data->num_bins;
-    uint& num_active_bins = cd_data->num_active_bins;
     uint& num_bin_aabb_intersections = cd_data->num_bin_aabb_intersections;
-    uint& num_possible_collisions = cd_data->num_possible_collisions;
-
-    num_bins = bins_per_axis.x * bins_per_axis.y * bins_per_axis.z;
 
     bin_intersections.resize(num_shapes + 1);
     bin_intersections[num_shapes] = 0;
@@ -272,8 +297,6 @@ void ChBroadphase::OneLevelBroadphase() {
 
     bin_number.resize(num_bin_aabb_intersections);
     bin_aabb_number.resize(num_bin_aabb_intersections);
-    bin_active.resize(num_bin_aabb_intersections);       // will be resized after calculation of num_active_bins
-    bin_start_index.resize(num_bin_aabb_intersections);  // will be resized after calculation of num_active_bins
 
     // For each shape, store the bin index and the shape ID for intersections with this shape
 #pragma omp parallel for
@@ -284,8 +307,38 @@ void ChBroadphase::OneLevelBroadphase() {
                                       bin_aabb_number);
     }
 
-    // Find the number of active bins (i.e. with at least one shape AABB intersection)
+    // Sort the bin - shape AABB intersections by bin index
     Thrust_Sort_By_Key(bin_number, bin_aabb_number);
+}
+
+// Find the pairs of shapes with overlapping AABBs, using the sorted list of bin - shape AABB intersections.
+void ChBroadphase::FindPairs(const std::vector<real3>& aabb_min, const std::vector<real3>& aabb_max) {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    const std::vector<uint>& bin_number = cd_data->bin_number;
+    const std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    std::vector<uint>& bin_active = cd_data->bin_active;
+    std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
+    std::vector<uint>& bin_num_contact = cd_data->bin_num_contact;
+
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+    uint& num_bins = cd_data->num_bins;
+    uint& num_active_bins = cd_data->num_active_bins;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    num_bins = bins_per_axis.x * bins_per_axis.y * bins_per_axis.z;
+
+    bin_active.resize(bin_number.size());       // will be resized after calculation of num_active_bins
+    bin_start_index.resize(bin_number.size());  // will be resized after calculation of num_active_bins
+
+    // Find the number of active bins (i.e. with at least one shape AABB intersection)
     num_active_bins = (int)(Run_Length_Encode(bin_number, bin_active, bin_start_index));
 
     if (num_active_bins <= 0) {
@@ -343,4 +396,221 @@ void ChBroadphase::OneLevelBroadphase() {
     }
 }
 
+// -----------------------------------------------------------------------------
+// Persistent (temporally coherent) broadphase
+
+real ChBroadphase::GetMargin() const {
+    return margin > 0 ? margin : cd_data->collision_envelope;
+}
+
+// Check whether the grid from the previous step can be reused.
+// This is the case if the grid settings and the set of shapes did not change and if the current overall bounding box
+// is contained in the cached grid.
+bool ChBroadphase::CanReuseGrid() const {
+    if (!cache_valid)
+        return false;
+
+    if (grid_type != cache_grid_type)
+        return false;
+    switch (grid_type) {
+        case GridType::FIXED_RESOLUTION:
+            if (grid_resolution.x != cache_grid_resolution.x || grid_resolution.y != cache_grid_resolution.y ||
+                grid_resolution.z != cache_grid_resolution.z)
+                return false;
+            break;
+        case GridType::FIXED_BIN_SIZE:
+            if (!(bin_size == cache_bin_size))
+                return false;
+            break;
+        case GridType::FIXED_DENSITY:
+            if (grid_density != cache_grid_density)
+                return false;
+            break;
+    }
+
+    if (cd_data->num_rigid_shapes != fat_min.size())
+        return false;
+    if (cd_data->shape_data.id_rigid != cache_id)
+        return false;
+
+    const real3& grid_min = cd_data->global_origin;
+    const real3& grid_max = cache_max_point;
+    const real3& box_min = cd_data->min_bounding_point;
+    const real3& box_max = cd_data->max_bounding_point;
+
+    return box_min.x >= grid_min.x && box_min.y >= grid_min.y && box_min.z >= grid_min.z &&  //
+           box_max.x <= grid_max.x && box_max.y <= grid_max.y && box_max.z <= grid_max.z;
+}
+
+// Set the cached AABB of the specified shape to its current AABB, inflated by the safety margin and clamped to the
+// grid extents.
+void ChBroadphase::InflateAABB(int index) {
+    real3 grid_size = cache_max_point - cd_data->global_origin;
+    real m = GetMargin();
+    fat_min[index] = Max(cd_data->aabb_min[index] - real3(m), real3(0));
+    fat_max[index] = Min(cd_data->aabb_max[index] + real3(m), grid_size);
+}
+
+// Cache the shape and body state information that affects the list of candidate pairs.
+void ChBroadphase::CacheState() {
+    cache_id = cd_data->shape_data.id_rigid;
+    cache_fam = cd_data->shape_data.fam_rigid;
+    cache_active = *cd_data->state_data.active_rigid;
+    cache_collide = *cd_data->state_data.collide_rigid;
+}
+
+// Check whether the shape and body state information that affects the list of candidate pairs is unchanged.
+bool ChBroadphase::SameState() const {
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+
+    if (*cd_data->state_data.active_rigid != cache_active || *cd_data->state_data.collide_rigid != cache_collide)
+        return false;
+
+    if (fam_data.size() != cache_fam.size())
+        return false;
+    for (size_t i = 0; i < fam_data.size(); i++) {
+        if (fam_data[i].x != cache_fam[i].x || fam_data[i].y != cache_fam[i].y)
+            return false;
+    }
+
+    return true;
+}
+
+// Update the list of bin - shape AABB intersections for the shapes flagged in 'shape_rebin'.
+// The entries of these shapes are removed from the sorted list and their new entries are merged in.
+void ChBroadphase::RebinShapes() {
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    std::vector<uint>& bin_number = cd_data->bin_number;
+    std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+
+    // Generate the new bin - shape AABB intersections for the rebinned shapes and sort them by bin index
+    rebin_number.clear();
+    rebin_aabb.clear();
+    for (int i = 0; i < num_shapes; i++) {
+        if (!shape_rebin[i])
+            continue;
+        vec3 gmin = HashMin(fat_min[i], inv_bin_size);
+        vec3 gmax = HashMax(fat_max[i], inv_bin_size);
+        for (int ix = gmin.x; ix <= gmax.x; ix++) {
+            for (int iy = gmin.y; iy <= gmax.y; iy++) {
+                for (int iz = gmin.z; iz <= gmax.z; iz++) {
+                    rebin_number.push_back(Hash_Index(vec3(ix, iy, iz), bins_per_axis));
+                    rebin_aabb.push_back(i);
+                }
+            }
+        }
+    }
+    Thrust_Sort_By_Key(rebin_number, rebin_aabb);
+
+    // Compact the retained intersections, then merge in the new ones (in place, starting from the back)
+    size_t num_old = bin_number.size();
+    size_t num_new = rebin_number.size();
+    size_t num_kept = 0;
+    for (size_t i = 0; i < num_old; i++) {
+        if (shape_rebin[bin_aabb_number[i]])
+            continue;
+        bin_number[num_kept] = bin_number[i];
+        bin_aabb_number[num_kept] = bin_aabb_number[i];
+        num_kept++;
+    }
+
+    size_t num_total = num_kept + num_new;
+    bin_number.resize(std::max(num_old, num_total));
+    bin_aabb_number.resize(std::max(num_old, num_total));
+
+    size_t i = num_kept;
+    size_t j = num_new;
+    size_t k = num_total;
+    while (j > 0) {
+        if (i > 0 && bin_number[i - 1] > rebin_number[j - 1]) {
+            --i;
+            --k;
+            bin_number[k] = bin_number[i];
+            bin_aabb_number[k] = bin_aabb_number[i];
+        } else {
+            --j;
+            --k;
+            bin_number[k] = rebin_number[j];
+            bin_aabb_number[k] = rebin_aabb[j];
+        }
+    }
+
+    bin_number.resize(num_total);
+    bin_aabb_number.resize(num_total);
+    cd_data->num_bin_aabb_intersections = (uint)num_total;
+}
+
+void ChBroadphase::PersistentBroadphase() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+
+    // If there is no valid cache, initialize the cached AABBs and bin all shapes
+    if (!cache_valid) {
+        fat_min.resize(num_shapes);
+        fat_max.resize(num_shapes);
+#pragma omp parallel for
+        for (int i = 0; i < num_shapes; i++) {
+            InflateAABB(i);
+        }
+        OneLevelBroadphase(fat_min, fat_max);
+        CacheState();
+        cache_valid = true;
+        return;
+    }
+
+    // Update the cached AABB of all shapes that moved outside of it.
+    // Flag shapes for which the updated cached AABB intersects a different set of bins.
+    shape_rebin.resize(num_shapes);
+    int num_updated = 0;
+    int num_rebin = 0;
+#pragma omp parallel for reduction(+ : num_updated, num_rebin)
+    for (int i = 0; i < num_shapes; i++) {
+        shape_rebin[i] = 0;
+        if (obj_data_id[i] == UINT_MAX)
+            continue;
+        const real3& Amin = aabb_min[i];
+        const real3& Amax = aabb_max[i];
+        const real3& Fmin = fat_min[i];
+        const real3& Fmax = fat_max[i];
+        if (Amin.x >= Fmin.x && Amin.y >= Fmin.y && Amin.z >= Fmin.z &&  //
+            Amax.x <= Fmax.x && Amax.y <= Fmax.y && Amax.z <= Fmax.z)
+            continue;
+
+        vec3 gmin = HashMin(Fmin, inv_bin_size);
+        vec3 gmax = HashMax(Fmax, inv_bin_size);
+        InflateAABB(i);
+        vec3 gmin_new = HashMin(fat_min[i], inv_bin_size);
+        vec3 gmax_new = HashMax(fat_max[i], inv_bin_size);
+
+        num_updated++;
+        if (gmin.x != gmin_new.x || gmin.y != gmin_new.y || gmin.z != gmin_new.z ||  //
+            gmax.x != gmax_new.x || gmax.y != gmax_new.y || gmax.z != gmax_new.z) {
+            shape_rebin[i] = 1;
+            num_rebin++;
+        }
+    }
+
+    // If no cached AABB changed and no shape changed its collision state, the candidate pairs from the previous step
+    // are still valid.
+    if (num_updated == 0 && SameState())
+        return;
+
+    // Rebin the flagged shapes. If a large fraction of the shapes must be rebinned, it is cheaper to rebin all shapes.
+    if (num_rebin > num_shapes / 4)
+        BinShapes(fat_min, fat_max);
+    else if (num_rebin > 0)
+        RebinShapes();
+
+    FindPairs(fat_min, fat_max);
+    CacheState();
+}
+
 }  // end namespace chrono
@@ -27,6 +27,11 @@ namespace chrono {
 /// @{
 
 /// Class for performing broad-phase collision detection.
+/// The broadphase bins all shape AABBs in a uniform grid and reports the pairs of shapes with overlapping AABBs.
+/// In persistent mode, the broadphase is temporally coherent: the grid and the shape AABBs used for binning (inflated
+/// by a safety margin) are cached and reused across steps. Only shapes that moved outside their cached AABB are
+/// updated, only shapes whose cached AABB crossed a bin boundary are rebinned, and the list of candidate pairs from the
+/// previous step is reused when no cached AABB changed.
 class ChApi ChBroadphase {
   public:
     /// Method for computing grid resolution
@@ -43,19 +48,49 @@ class ChApi ChBroadphase {
     void Process();
 
   private:
-    void OneLevelBroadphase();
+    void OneLevelBroadphase(const std::vector<real3>& aabb_min, const std::vector<real3>& aabb_max);
+    void BinShapes(const std::vector<real3>& aabb_min, const std::vector<real3>& aabb_max);
+    void FindPairs(const std::vector<real3>& aabb_min, const std::vector<real3>& aabb_max);
     void DetermineBoundingBox();
+    void SetupGrid();
     void OffsetAABB();
     void ComputeTopLevelResolution();
     void RigidBoundingBox();
     void FluidBoundingBox();
 
+    void PersistentBroadphase();
+    bool CanReuseGrid() const;
+    void RebinShapes();
+    void InflateAABB(int index);
+    void CacheState();
+    bool SameState() const;
+    real GetMargin() const;
+
     std::shared_ptr<ChCollisionData> cd_data;
 
     GridType grid_type;    ///< (input) method for setting grid resolution
     vec3 grid_resolution;  ///< (input) number of bins (used for GridType::FIXED_RESOLUTION)
     real3 bin_size;        ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
     real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY)
+    bool persistent;       ///< (input) enable temporally coherent broadphase
+    real margin;           ///< (input) inflation of cached AABBs (persistent mode; if not positive, use envelope)
+
+    // Cached data for the persistent broadphase
+    bool cache_valid;                 ///< true if the cached grid and shape AABBs can be reused
+    GridType cache_grid_type;         ///< grid settings used for the cached grid
+    vec3 cache_grid_resolution;       ///< grid settings used for the cached grid
+    real3 cache_bin_size;             ///< grid settings used for the cached grid
+    real cache_grid_density;          ///< grid settings used for the cached grid
+    real3 cache_max_point;            ///< upper corner of the cached grid
+    std::vector<real3> fat_min;       ///< inflated shape AABBs, lower corners (relative to grid origin)
+    std::vector<real3> fat_max;       ///< inflated shape AABBs, upper corners (relative to grid origin)
+    std::vector<uint> cache_id;       ///< shape body IDs at the time of the last pair search
+    std::vector<short2> cache_fam;    ///< shape collision families at the time of the last pair search
+    std::vector<char> cache_active;   ///< body activity flags at the time of the last pair search
+    std::vector<char> cache_collide;  ///< body collision flags at the time of the last pair search
+    std::vector<char> shape_rebin;    ///< flags for shapes that must be rebinned
+    std::vector<uint> rebin_number;   ///< bin index for bin-shape intersections of rebinned shapes
+    std::vector<uint> rebin_aabb;     ///< shape ID for bin-shape intersections of rebinned shapes
 
     friend class ChCollisionSystemMulticore;
     friend class ChCollisionSystemChronoMulticore;
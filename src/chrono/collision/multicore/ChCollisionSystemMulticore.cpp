@@ -24,6 +24,7 @@
 
 #include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
 #include "chrono/collision/multicore/ChRayTest.h"
+#include "chrono/collision/multicore/ChCollisionUtils.h"
 
 namespace chrono {
 
@@ -62,10 +63,19 @@ void ChCollisionSystemMulticore::SetBroadphaseGridDensity(double density) {
     broadphase.grid_type = ChBroadphase::GridType::FIXED_DENSITY;
 }
 
+void ChCollisionSystemMulticore::EnablePersistentBroadphase(bool val, double margin) {
+    broadphase.persistent = val;
+    broadphase.margin = real(margin);
+}
+
 void ChCollisionSystemMulticore::SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm) {
     narrowphase.algorithm = algorithm;
 }
 
+void ChCollisionSystemMulticore::EnableNarrowphaseBatching(bool val) {
+    narrowphase.EnableBatching(val);
+}
+
 void ChCollisionSystemMulticore::EnableActiveBoundingBox(const ChVector3d& aabb_min, const ChVector3d& aabb_max) {
     active_aabb_min = FromChVector(aabb_min);
     active_aabb_max = FromChVector(aabb_max);
@@ -579,18 +589,7 @@ bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d
     ChRayTest tester(cd_data);
     ChRayTest::RayHitInfo info;
     if (tester.Check(FromChVector(from), FromChVector(to), info)) {
-        // Hit point
-        result.hit = true;
-        result.abs_hitNormal = ToChVector(info.normal);
-        result.abs_hitPoint = ToChVector(info.point);
-        result.dist_factor = info.t;
-
-        // ID of the body carring the closest hit shape
-        uint bid = cd_data->shape_data.id_rigid[info.shapeID];
-
-        // Collision model of hit body
-        result.hitModel = m_system->GetBodies()[bid]->GetCollisionModel().get();
-
+        LoadRayhitResult(info, result);
         return true;
     }
 
@@ -598,6 +597,71 @@ bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d
     return false;
 }
 
+void ChCollisionSystemMulticore::RayHitMulti(const std::vector<ChRay>& rays,
+                                             std::vector<ChRayhitResult>& results) const {
+    static const int packet_size = 64;
+
+    int num_rays = (int)rays.size();
+    int num_packets = (num_rays + packet_size - 1) / packet_size;
+    int nthreads = m_system ? m_system->GetNumThreadsCollision() : 1;
+
+    results.resize(num_rays);
+
+    if (cd_data->num_active_bins == 0) {
+        for (auto& result : results)
+            result.hit = false;
+        return;
+    }
+
+    const real3& grid_min = cd_data->min_bounding_point;
+    const real3& grid_max = cd_data->max_bounding_point;
+
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+    for (int ip = 0; ip < num_packets; ip++) {
+        int start = ip * packet_size;
+        int end = std::min(start + packet_size, num_rays);
+
+        // AABB of the ray packet
+        real3 aabb_min(+C_REAL_MAX);
+        real3 aabb_max(-C_REAL_MAX);
+        for (int i = start; i < end; i++) {
+            aabb_min = Min(aabb_min, Min(FromChVector(rays[i].from), FromChVector(rays[i].to)));
+            aabb_max = Max(aabb_max, Max(FromChVector(rays[i].from), FromChVector(rays[i].to)));
+        }
+
+        // Reject the entire packet if it does not intersect the broadphase grid
+        if (!mc_utils::overlap(aabb_min, aabb_max, grid_min, grid_max)) {
+            for (int i = start; i < end; i++)
+                results[i].hit = false;
+            continue;
+        }
+
+        // Test the individual rays in the packet
+        ChRayTest tester(cd_data);
+        ChRayTest::RayHitInfo info;
+        for (int i = start; i < end; i++) {
+            if (tester.Check(FromChVector(rays[i].from), FromChVector(rays[i].to), info))
+                LoadRayhitResult(info, results[i]);
+            else
+                results[i].hit = false;
+        }
+    }
+}
+
+void ChCollisionSystemMulticore::LoadRayhitResult(const ChRayTest::RayHitInfo& info, ChRayhitResult& result) const {
+    // Hit point
+    result.hit = true;
+    result.abs_hitNormal = ToChVector(info.normal);
+    result.abs_hitPoint = ToChVector(info.point);
+    result.dist_factor = info.t;
+
+    // ID of the body carring the closest hit shape
+    uint bid = cd_data->shape_data.id_rigid[info.shapeID];
+
+    // Collision model of hit body
+    result.hitModel = m_system->GetBodies()[bid]->GetCollisionModel().get();
+}
+
 bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from,
                                         const ChVector3d& to,
                                         ChCollisionModel* model,
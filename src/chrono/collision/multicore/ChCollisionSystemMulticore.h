@@ -26,6 +26,7 @@
 #include "chrono/collision/multicore/ChCollisionModelMulticore.h"
 #include "chrono/collision/multicore/ChCollisionData.h"
 #include "chrono/collision/multicore/ChBroadphase.h"
+#include "chrono/collision/multicore/ChRayTest.h"
 #include "chrono/collision/multicore/ChNarrowphase.h"
 
 #include "chrono/multicore_math/ChMulticoreMath.h"
@@ -77,12 +78,26 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// By default, a fixed number of bins is used (see SetBroadphaseGridResolution).
     void SetBroadphaseGridDensity(double density);
 
+    /// Enable/disable the persistent (temporally coherent) broadphase (default: false).
+    /// If enabled, the broadphase grid and the shape AABBs used for binning are cached across steps. Cached AABBs are
+    /// inflated by the specified margin (if not positive, the collision envelope is used) and are updated only when a
+    /// shape moves outside its cached AABB. Only shapes whose cached AABB crosses a bin boundary are rebinned and, if no
+    /// cached AABB changed, the list of candidate pairs from the previous step is reused. This mode is beneficial for
+    /// systems in which most shapes move little between steps (e.g., settled granular material). Note that a larger
+    /// margin results in fewer updates, but in more candidate pairs being passed to the narrowphase.
+    void EnablePersistentBroadphase(bool val, double margin = 0);
+
     /// Set the narrowphase algorithm (default: ChNarrowphase::Algorithm::HYBRID).
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
     /// Minkovski Portal Refinement algorithm (see ChNarrowphaseMPR).
     void SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm);
 
+    /// Enable batched processing of candidate pairs in the narrowphase (default: true).
+    /// If enabled, the analytical narrowphase algorithms group candidate pairs by shape type combination and evaluate
+    /// sphere-sphere, box-sphere, and capsule-sphere pairs several at a time, using SIMD instructions if available.
+    void EnableNarrowphaseBatching(bool val);
+
     /// Enable monitoring of shapes outside active bounding box (default: false).
     /// If enabled, objects whose collision shapes exit the active bounding box are deactivated (frozen).
     /// The size of the bounding box is specified by its min and max extents.
@@ -136,6 +151,11 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform a batch of ray-hit tests with all collision models.
+    /// Consecutive rays are processed in packets; packets that do not intersect the broadphase grid are rejected
+    /// without testing the individual rays.
+    virtual void RayHitMulti(const std::vector<ChRay>& rays, std::vector<ChRayhitResult>& results) const override;
+
     /// Method to trigger debug visualization of collision shapes.
     /// The 'flags' argument can be any of the VisualizationModes enums, or a combination thereof (using bit-wise
     /// operators). The calling program must invoke this function from within the simulation loop. No-op if a
@@ -152,6 +172,9 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   protected:
+    /// Load the information from a multicore ray test in the provided ray-hit result.
+    void LoadRayhitResult(const ChRayTest::RayHitInfo& info, ChRayhitResult& result) const;
+
     /// Mark bodies whose AABB is contained within the specified box.
     virtual void GetOverlappingAABB(std::vector<char>& active_id, real3 Amin, real3 Amax);
 
@@ -37,6 +37,7 @@ using namespace chrono::mc_utils;
 
 ChNarrowphase::ChNarrowphase()
     : algorithm(Algorithm::HYBRID),
+      batching(true),
       num_potential_rigid_contacts(0),
       num_potential_fluid_contacts(0),
       num_potential_rigid_fluid_contacts(0),
@@ -351,10 +352,16 @@ void ChNarrowphase::ProcessRigidRigid() {
             DispatchMPR();
             break;
         case Algorithm::PRIMS:
-            DispatchPRIMS();
+            if (batching)
+                DispatchBatched(false);
+            else
+                DispatchPRIMS();
             break;
         case Algorithm::HYBRID:
-            DispatchHybridMPR();
+            if (batching)
+                DispatchBatched(true);
+            else
+                DispatchHybridMPR();
             break;
     }
 
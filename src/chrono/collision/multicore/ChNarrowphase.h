@@ -43,6 +43,11 @@ namespace chrono {
 /// rcyl     |                                              N        N
 /// trimesh  |                                                       N
 /// </pre>
+///
+/// With the analytical (PRIMS and HYBRID) algorithms, candidate pairs can optionally be grouped by the types of the
+/// two shapes before being processed. Sphere-sphere, box-sphere, and capsule-sphere pairs are then evaluated in
+/// batches, several pairs at a time (one per SIMD lane), while all other pairs are processed one at a time with the
+/// scalar routines. Batching only changes the order of operations; the generated contacts are the same.
 class ChApi ChNarrowphase {
   public:
     /// Narrowphase algorithm
@@ -102,6 +107,14 @@ class ChApi ChNarrowphase {
                                int& nC                    ///< [output] number of contacts found
     );
 
+    /// Enable grouping and batched evaluation of candidate pairs (default: true).
+    /// Only used with the PRIMS and HYBRID algorithms.
+    void EnableBatching(bool val) { batching = val; }
+
+    /// Return true if batched pairs are evaluated with SIMD instructions.
+    /// If false (SIMD disabled or not supported for the current precision), batched pairs are evaluated lane by lane.
+    static bool IsBatchingVectorized();
+
     /// Set the fictitious radius of curvature used for collision with a corner or an edge.
     static void SetDefaultEdgeRadius(real radius);
 
@@ -135,6 +148,15 @@ class ChApi ChNarrowphase {
     void Dispatch_Init(uint index, uint& icoll, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB);
     void Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC);
 
+    /// Group candidate pairs by shape type combination, then process them group by group.
+    /// The sphere-sphere, box-sphere, and capsule-sphere groups are processed with the SIMD batched kernels (see
+    /// ChNarrowphaseBatch.cpp). If 'mpr_fallback' is true, pairs not supported analytically are processed with MPR.
+    void DispatchBatched(bool mpr_fallback);
+    void SortPairsByType();
+    void DispatchSphereSphereBatch(uint start, uint end);
+    void DispatchBoxSphereBatch(uint start, uint end);
+    void DispatchCapsuleSphereBatch(uint start, uint end);
+
     std::shared_ptr<ChCollisionData> cd_data;
 
     std::vector<char> contact_rigid_active;
@@ -147,6 +169,11 @@ class ChApi ChNarrowphase {
     uint num_potential_rigid_fluid_contacts;
 
     Algorithm algorithm;
+    bool batching;
+
+    std::vector<char> pair_group;   ///< type combination group of each candidate pair
+    std::vector<uint> pair_order;   ///< candidate pair indices, sorted by group
+    std::vector<uint> group_start;  ///< start of each group in pair_order
 
     std::vector<uint> f_bin_intersections;
     std::vector<uint> f_bin_number;
@@ -0,0 +1,647 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Batched narrowphase dispatch. Candidate pairs are grouped by the types of the
+// two shapes. Pairs in the sphere-sphere, box-sphere, and capsule-sphere groups
+// are evaluated 4 at a time, with the shape data gathered in structure-of-arrays
+// form and processed in SIMD lanes, using the multicore_math SIMD layer (AVX for
+// double precision, SSE for single precision). If SIMD is not enabled, the same
+// kernels are evaluated lane by lane. All other pairs are processed one at a
+// time, with the scalar analytical (and optionally MPR) routines.
+//
+// The kernels implement the same algorithms as sphere_sphere, box_sphere, and
+// capsule_sphere in ChNarrowphasePRIMS.cpp and write their results in the same
+// slots of the contact arrays in ChCollisionData.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "chrono/multicore_math/simd.h"
+
+#include "chrono/collision/ChCollisionModel.h"
+#include "chrono/collision/ChCollisionInfo.h"
+
+#include "chrono/collision/multicore/ChNarrowphase.h"
+
+#if defined(USE_SSE)
+    #include "chrono/multicore_math/simd_sse.h"
+#elif defined(USE_AVX)
+    #include "chrono/multicore_math/simd_avx.h"
+#endif
+
+namespace chrono {
+
+// -----------------------------------------------------------------------------
+// Lane types
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// Number of candidate pairs processed together.
+const int num_lanes = 4;
+
+#if defined(USE_AVX) || defined(USE_SSE)
+
+    #if defined(USE_AVX)
+typedef __m256d simd_real;  // 4 doubles
+    #else
+typedef __m128 simd_real;  // 4 floats
+    #endif
+
+// Packed reals (one per lane).
+struct vreal {
+    vreal() {}
+    vreal(simd_real a) : v(a) {}
+    vreal(real a) : v(simd::Splat(a)) {}
+    simd_real v;
+};
+
+// Lane mask.
+struct vmask {
+    vmask(simd_real a) : m(a) {}
+    simd_real m;
+};
+
+inline vreal operator+(const vreal& a, const vreal& b) {
+    return simd::Add(a.v, b.v);
+}
+inline vreal operator-(const vreal& a, const vreal& b) {
+    return simd::Sub(a.v, b.v);
+}
+inline vreal operator*(const vreal& a, const vreal& b) {
+    return simd::Mul(a.v, b.v);
+}
+inline vreal operator/(const vreal& a, const vreal& b) {
+    return simd::Div(a.v, b.v);
+}
+inline vreal Sqrt(const vreal& a) {
+    return simd::SquareRoot(a.v);
+}
+inline vreal Min(const vreal& a, const vreal& b) {
+    return simd::Min(a.v, b.v);
+}
+inline vreal Max(const vreal& a, const vreal& b) {
+    return simd::Max(a.v, b.v);
+}
+inline vmask operator<(const vreal& a, const vreal& b) {
+    return simd::CmpLT(a.v, b.v);
+}
+inline vmask operator>(const vreal& a, const vreal& b) {
+    return simd::CmpGT(a.v, b.v);
+}
+inline vmask operator>=(const vreal& a, const vreal& b) {
+    return simd::CmpGE(a.v, b.v);
+}
+inline vmask And(const vmask& a, const vmask& b) {
+    return simd::And(a.m, b.m);
+}
+inline vreal Select(const vmask& mask, const vreal& a, const vreal& b) {
+    return simd::Select(mask.m, a.v, b.v);
+}
+inline int LaneBits(const vmask& mask) {
+    return simd::MoveMask(mask.m);
+}
+inline vreal Load(const real* p) {
+    return simd::LoadU(p);
+}
+inline void Store(const vreal& a, real* p) {
+    simd::StoreU(a.v, p);
+}
+
+#else
+// Packed reals (one per lane).
+struct vreal {
+    vreal() {}
+    vreal(real a) {
+        for (int i = 0; i < num_lanes; i++)
+            v[i] = a;
+    }
+    real v[num_lanes];
+};
+
+// Lane mask.
+struct vmask {
+    bool m[num_lanes];
+};
+
+template <typename F>
+inline vreal LaneMap(const vreal& a, const vreal& b, F f) {
+    vreal r;
+    for (int i = 0; i < num_lanes; i++)
+        r.v[i] = f(a.v[i], b.v[i]);
+    return r;
+}
+
+template <typename F>
+inline vmask LaneTest(const vreal& a, const vreal& b, F f) {
+    vmask r;
+    for (int i = 0; i < num_lanes; i++)
+        r.m[i] = f(a.v[i], b.v[i]);
+    return r;
+}
+
+inline vreal operator+(const vreal& a, const vreal& b) {
+    return LaneMap(a, b, [](real x, real y) { return x + y; });
+}
+inline vreal operator-(const vreal& a, const vreal& b) {
+    return LaneMap(a, b, [](real x, real y) { return x - y; });
+}
+inline vreal operator*(const vreal& a, const vreal& b) {
+    return LaneMap(a, b, [](real x, real y) { return x * y; });
+}
+inline vreal operator/(const vreal& a, const vreal& b) {
+    return LaneMap(a, b, [](real x, real y) { return x / y; });
+}
+inline vreal Sqrt(const vreal& a) {
+    return LaneMap(a, a, [](real x, real) { return std::sqrt(x); });
+}
+inline vreal Min(const vreal& a, const vreal& b) {
+    return LaneMap(a, b, [](real x, real y) { return std::min(x, y); });
+}
+inline vreal Max(const vreal& a, const vreal& b) {
+    return LaneMap(a, b, [](real x, real y) { return std::max(x, y); });
+}
+inline vmask operator<(const vreal& a, const vreal& b) {
+    return LaneTest(a, b, [](real x, real y) { return x < y; });
+}
+inline vmask operator>(const vreal& a, const vreal& b) {
+    return LaneTest(a, b, [](real x, real y) { return x > y; });
+}
+inline vmask operator>=(const vreal& a, const vreal& b) {
+    return LaneTest(a, b, [](real x, real y) { return x >= y; });
+}
+inline vmask And(const vmask& a, const vmask& b) {
+    vmask r;
+    for (int i = 0; i < num_lanes; i++)
+        r.m[i] = a.m[i] && b.m[i];
+    return r;
+}
+inline vreal Select(const vmask& mask, const vreal& a, const vreal& b) {
+    vreal r;
+    for (int i = 0; i < num_lanes; i++)
+        r.v[i] = mask.m[i] ? a.v[i] : b.v[i];
+    return r;
+}
+inline int LaneBits(const vmask& mask) {
+    int bits = 0;
+    for (int i = 0; i < num_lanes; i++)
+        bits |= (mask.m[i] ? 1 : 0) << i;
+    return bits;
+}
+inline vreal Load(const real* p) {
+    vreal r;
+    for (int i = 0; i < num_lanes; i++)
+        r.v[i] = p[i];
+    return r;
+}
+inline void Store(const vreal& a, real* p) {
+    for (int i = 0; i < num_lanes; i++)
+        p[i] = a.v[i];
+}
+
+#endif
+
+// Packed 3D vectors.
+struct vreal3 {
+    vreal3() {}
+    vreal3(const vreal& a, const vreal& b, const vreal& c) : x(a), y(b), z(c) {}
+    vreal x, y, z;
+};
+
+inline vreal3 operator+(const vreal3& a, const vreal3& b) {
+    return vreal3(a.x + b.x, a.y + b.y, a.z + b.z);
+}
+inline vreal3 operator-(const vreal3& a, const vreal3& b) {
+    return vreal3(a.x - b.x, a.y - b.y, a.z - b.z);
+}
+inline vreal3 operator-(const vreal3& a) {
+    return vreal3(vreal(0.0) - a.x, vreal(0.0) - a.y, vreal(0.0) - a.z);
+}
+inline vreal3 operator*(const vreal3& a, const vreal& s) {
+    return vreal3(a.x * s, a.y * s, a.z * s);
+}
+inline vreal3 operator/(const vreal3& a, const vreal& s) {
+    return vreal3(a.x / s, a.y / s, a.z / s);
+}
+inline vreal Dot(const vreal3& a, const vreal3& b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+inline vreal3 Cross(const vreal3& a, const vreal3& b) {
+    return vreal3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+
+// Rotate v by the unit quaternion (w, q). For the inverse rotation, pass the negated vector part.
+inline vreal3 Rotate(const vreal3& v, const vreal& w, const vreal3& q) {
+    vreal3 t = Cross(q, v) * vreal(2.0);
+    return v + t * w + Cross(q, t);
+}
+
+// Gather buffers for one batch, in structure-of-arrays layout.
+struct LaneData {
+    real posA[3][num_lanes];
+    real rotA[4][num_lanes];
+    real dimA[3][num_lanes];
+    real posB[3][num_lanes];
+    real radB[num_lanes];
+};
+
+// Output buffers for one batch.
+struct LaneOutput {
+    real norm[3][num_lanes];
+    real ptA[3][num_lanes];
+    real ptB[3][num_lanes];
+    real depth[num_lanes];
+    real eff_rad[num_lanes];
+    int active;
+};
+
+inline vreal3 Load3(const real (&a)[3][num_lanes]) {
+    return vreal3(Load(a[0]), Load(a[1]), Load(a[2]));
+}
+
+inline void Store3(const vreal3& v, real (&a)[3][num_lanes]) {
+    Store(v.x, a[0]);
+    Store(v.y, a[1]);
+    Store(v.z, a[2]);
+}
+
+// Sphere-sphere. Shape A: sphere (posA, radius in dimA[0]); shape B: sphere (posB, radB).
+void SphereSphereKernel(const LaneData& in, real separation, LaneOutput& out) {
+    vreal3 pos1 = Load3(in.posA);
+    vreal3 pos2 = Load3(in.posB);
+    vreal radius1 = Load(in.dimA[0]);
+    vreal radius2 = Load(in.radB);
+
+    vreal3 delta = pos2 - pos1;
+    vreal dist2 = Dot(delta, delta);
+    vreal radSum = radius1 + radius2;
+    vreal radSum_s = radSum + vreal(separation);
+
+    out.active = LaneBits(And(dist2 < radSum_s * radSum_s, dist2 >= vreal(1e-12)));
+    if (!out.active)
+        return;
+
+    vreal dist = Sqrt(dist2);
+    vreal3 norm = delta / dist;
+    Store3(norm, out.norm);
+    Store3(pos1 + norm * radius1, out.ptA);
+    Store3(pos2 - norm * radius2, out.ptB);
+    Store(dist - radSum, out.depth);
+    Store(radius1 * radius2 / radSum, out.eff_rad);
+}
+
+// Box-sphere. Shape A: box (posA, rotA, half-dimensions dimA); shape B: sphere (posB, radB).
+void BoxSphereKernel(const LaneData& in, real separation, real edge_radius, LaneOutput& out) {
+    vreal3 pos1 = Load3(in.posA);
+    vreal rot1_w = Load(in.rotA[0]);
+    vreal3 rot1_v(Load(in.rotA[1]), Load(in.rotA[2]), Load(in.rotA[3]));
+    vreal3 rot1_vc = -rot1_v;
+    vreal3 hdims1 = Load3(in.dimA);
+    vreal3 pos2 = Load3(in.posB);
+    vreal radius2 = Load(in.radB);
+
+    // Express the sphere position in the frame of the box and snap it to the surface of the box.
+    vreal3 spherePos = Rotate(pos2 - pos1, rot1_w, rot1_vc);
+    vreal3 minus_hdims = -hdims1;
+    vreal3 boxPos(Min(Max(spherePos.x, minus_hdims.x), hdims1.x),  //
+                  Min(Max(spherePos.y, minus_hdims.y), hdims1.y),  //
+                  Min(Max(spherePos.z, minus_hdims.z), hdims1.z));
+
+    vreal3 delta = spherePos - boxPos;
+    vreal dist2 = Dot(delta, delta);
+    vreal radius2_s = radius2 + vreal(separation);
+
+    out.active = LaneBits(And(dist2 < radius2_s * radius2_s, dist2 > vreal(1e-12f)));
+    if (!out.active)
+        return;
+
+    vreal dist = Sqrt(dist2);
+    vreal3 norm = Rotate(delta / dist, rot1_w, rot1_v);
+    Store3(norm, out.norm);
+    Store3(pos1 + Rotate(boxPos, rot1_w, rot1_v), out.ptA);
+    Store3(pos2 - norm * radius2, out.ptB);
+    Store(dist - radius2, out.depth);
+
+    // The closest point is on a face if the sphere center is outside the box along a single direction.
+    vreal one(1.0);
+    vreal zero(0.0);
+    vreal num_out = Select(Max(spherePos.x - hdims1.x, minus_hdims.x - spherePos.x) > zero, one, zero) +
+                    Select(Max(spherePos.y - hdims1.y, minus_hdims.y - spherePos.y) > zero, one, zero) +
+                    Select(Max(spherePos.z - hdims1.z, minus_hdims.z - spherePos.z) > zero, one, zero);
+    vreal edge_rad(edge_radius);
+    Store(Select(num_out > one, radius2 * edge_rad / (radius2 + edge_rad), radius2), out.eff_rad);
+}
+
+// Capsule-sphere. Shape A: capsule (posA, rotA, radius dimA[0], half-length dimA[1]); shape B: sphere (posB, radB).
+void CapsuleSphereKernel(const LaneData& in, real separation, LaneOutput& out) {
+    vreal3 pos1 = Load3(in.posA);
+    vreal e0 = Load(in.rotA[0]);
+    vreal e1 = Load(in.rotA[1]);
+    vreal e2 = Load(in.rotA[2]);
+    vreal e3 = Load(in.rotA[3]);
+    vreal radius1 = Load(in.dimA[0]);
+    vreal hlen1 = Load(in.dimA[1]);
+    vreal3 pos2 = Load3(in.posB);
+    vreal radius2 = Load(in.radB);
+
+    // Project the sphere center onto the capsule centerline (see AMatW) and clamp to the capsule length.
+    vreal two(2.0);
+    vreal3 W((e1 * e3 + e0 * e2) * two, (e2 * e3 - e0 * e1) * two, (e0 * e0 + e3 * e3) * two - vreal(1.0));
+    vreal alpha = Dot(pos2 - pos1, W);
+    alpha = Min(Max(alpha, vreal(0.0) - hlen1), hlen1);
+    vreal3 loc = pos1 + W * alpha;
+
+    vreal radSum = radius1 + radius2;
+    vreal radSum_s = radSum + vreal(separation);
+    vreal3 delta = pos2 - loc;
+    vreal dist2 = Dot(delta, delta);
+
+    out.active = LaneBits(And(dist2 < radSum_s * radSum_s, dist2 > vreal(1e-12f)));
+    if (!out.active)
+        return;
+
+    vreal dist = Sqrt(dist2);
+    vreal3 norm = delta / dist;
+    Store3(norm, out.norm);
+    Store3(loc + norm * radius1, out.ptA);
+    Store3(pos2 - norm * radius2, out.ptB);
+    Store(dist - radSum, out.depth);
+    Store(radius1 * radius2 / radSum, out.eff_rad);
+}
+
+// Groups of candidate pairs, in processing order.
+enum PairGroup {
+    SPHERE_SPHERE,   // sphere-sphere (batched)
+    BOX_SPHERE,      // box-sphere (batched)
+    CAPSULE_SPHERE,  // capsule-sphere (batched)
+    OTHER,           // all other type combinations (scalar)
+    NUM_GROUPS
+};
+
+}  // end anonymous namespace
+
+// -----------------------------------------------------------------------------
+
+bool ChNarrowphase::IsBatchingVectorized() {
+#if defined(USE_AVX) || defined(USE_SSE)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void ChNarrowphase::SortPairsByType() {
+    const shape_type* obj_data_T = cd_data->shape_data.typ_rigid.data();
+    const long long* pair_shapeIDs = cd_data->pair_shapeIDs.data();
+    const int num_pairs = (signed)num_potential_rigid_contacts;
+
+    pair_group.resize(num_pairs);
+    pair_order.resize(num_pairs);
+    group_start.assign(NUM_GROUPS + 1, 0);
+
+#pragma omp parallel for
+    for (int index = 0; index < num_pairs; index++) {
+        shape_type type1 = obj_data_T[int(pair_shapeIDs[index] >> 32)];
+        shape_type type2 = obj_data_T[int(pair_shapeIDs[index] & 0xffffffff)];
+        if (type1 > type2)
+            std::swap(type1, type2);  // sphere < box < capsule
+
+        char group = OTHER;
+        if (type1 == ChCollisionShape::Type::SPHERE) {
+            if (type2 == ChCollisionShape::Type::SPHERE)
+                group = SPHERE_SPHERE;
+            else if (type2 == ChCollisionShape::Type::BOX)
+                group = BOX_SPHERE;
+            else if (type2 == ChCollisionShape::Type::CAPSULE)
+                group = CAPSULE_SPHERE;
+        }
+        pair_group[index] = group;
+    }
+
+    // Counting sort (stable, so that pairs in each group are visited in the order of their contact slots)
+    for (int index = 0; index < num_pairs; index++)
+        group_start[pair_group[index] + 1]++;
+    for (int g = 0; g < NUM_GROUPS; g++)
+        group_start[g + 1] += group_start[g];
+    std::vector<uint> next(group_start.begin(), group_start.end() - 1);
+    for (int index = 0; index < num_pairs; index++)
+        pair_order[next[pair_group[index]]++] = index;
+}
+
+void ChNarrowphase::DispatchBatched(bool mpr_fallback) {
+    SortPairsByType();
+
+    DispatchSphereSphereBatch(group_start[SPHERE_SPHERE], group_start[SPHERE_SPHERE + 1]);
+    DispatchBoxSphereBatch(group_start[BOX_SPHERE], group_start[BOX_SPHERE + 1]);
+    DispatchCapsuleSphereBatch(group_start[CAPSULE_SPHERE], group_start[CAPSULE_SPHERE + 1]);
+
+    // Process all remaining pairs, one at a time
+    const real envelope = cd_data->collision_envelope;
+    real3* norm = cd_data->norm_rigid_rigid.data();
+    real3* ptA = cd_data->cpta_rigid_rigid.data();
+    real3* ptB = cd_data->cptb_rigid_rigid.data();
+    real* contactDepth = cd_data->dpth_rigid_rigid.data();
+    real* effective_radius = cd_data->erad_rigid_rigid.data();
+
+    ConvexShape shapeA;
+    ConvexShape shapeB;
+
+    double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
+
+    const int start = (signed)group_start[OTHER];
+    const int end = (signed)group_start[NUM_GROUPS];
+
+#pragma omp parallel for private(shapeA, shapeB)
+    for (int i = start; i < end; i++) {
+        uint index = pair_order[i];
+        uint ID_A, ID_B, icoll;
+
+        int nC;
+
+        Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
+
+        if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
+                           &effective_radius[icoll], nC)) {
+            Dispatch_Finalize(icoll, ID_A, ID_B, nC);
+        } else if (mpr_fallback &&
+                   MPRCollision(&shapeA, &shapeB, envelope, norm[icoll], ptA[icoll], ptB[icoll], contactDepth[icoll])) {
+            effective_radius[icoll] = default_eff_radius;
+            Dispatch_Finalize(icoll, ID_A, ID_B, 1);
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Gather the data for the pairs pair_order[first], ..., pair_order[first+num_lanes-1] of a group in which one of the
+// shapes is a sphere. Shape A is the non-sphere shape (or the first sphere, for a sphere-sphere pair). Lanes past the
+// end of the group replicate the last pair and are ignored. The function returns the number of valid lanes and sets
+// a flag for each lane in which the order of the two shapes in the candidate pair was swapped.
+static int GatherSphereBatch(const ChCollisionData& cd_data,
+                             const uint* pair_order,
+                             uint first,
+                             uint end,
+                             LaneData& in,
+                             uint (&pairs)[num_lanes],
+                             bool (&swapped)[num_lanes]) {
+    const shape_container& shapes = cd_data.shape_data;
+    int num_valid = std::min((int)(end - first), num_lanes);
+
+    for (int lane = 0; lane < num_lanes; lane++) {
+        uint index = pair_order[first + std::min(lane, num_valid - 1)];
+        long long p = cd_data.pair_shapeIDs[index];
+        int sA = int(p >> 32);
+        int sB = int(p & 0xffffffff);
+
+        // Make sure the sphere is the second shape
+        swapped[lane] = shapes.typ_rigid[sA] == ChCollisionShape::Type::SPHERE &&
+                        shapes.typ_rigid[sB] != ChCollisionShape::Type::SPHERE;
+        if (swapped[lane])
+            std::swap(sA, sB);
+        pairs[lane] = index;
+
+        const real3& posA = shapes.obj_data_A_global[sA];
+        const quaternion& rotA = shapes.obj_data_R_global[sA];
+        const real3& posB = shapes.obj_data_A_global[sB];
+        int startA = shapes.start_rigid[sA];
+
+        in.posA[0][lane] = posA.x;
+        in.posA[1][lane] = posA.y;
+        in.posA[2][lane] = posA.z;
+        in.rotA[0][lane] = rotA.w;
+        in.rotA[1][lane] = rotA.x;
+        in.rotA[2][lane] = rotA.y;
+        in.rotA[3][lane] = rotA.z;
+        in.posB[0][lane] = posB.x;
+        in.posB[1][lane] = posB.y;
+        in.posB[2][lane] = posB.z;
+        in.radB[lane] = shapes.sphere_rigid[shapes.start_rigid[sB]];
+
+        switch (shapes.typ_rigid[sA]) {
+            case ChCollisionShape::Type::SPHERE:
+                in.dimA[0][lane] = shapes.sphere_rigid[startA];
+                break;
+            case ChCollisionShape::Type::BOX: {
+                const real3& hdims = shapes.box_like_rigid[startA];
+                in.dimA[0][lane] = hdims.x;
+                in.dimA[1][lane] = hdims.y;
+                in.dimA[2][lane] = hdims.z;
+                break;
+            }
+            case ChCollisionShape::Type::CAPSULE: {
+                const real2& dims = shapes.capsule_rigid[startA];
+                in.dimA[0][lane] = dims.x;
+                in.dimA[1][lane] = dims.y;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    return num_valid;
+}
+
+// Scatter the contacts found in a batch to their slots in the contact arrays.
+// For pairs gathered in swapped order, the contact points are exchanged and the normal is flipped.
+static void ScatterSphereBatch(ChCollisionData& cd_data,
+                               const std::vector<uint>& contact_index,
+                               std::vector<char>& contact_active,
+                               int num_valid,
+                               const uint (&pairs)[num_lanes],
+                               const bool (&swapped)[num_lanes],
+                               const LaneOutput& out) {
+    for (int lane = 0; lane < num_valid; lane++) {
+        if (!(out.active & (1 << lane)))
+            continue;
+
+        uint index = pairs[lane];
+        uint icoll = contact_index[index];
+        long long p = cd_data.pair_shapeIDs[index];
+
+        real3 norm(out.norm[0][lane], out.norm[1][lane], out.norm[2][lane]);
+        real3 ptA(out.ptA[0][lane], out.ptA[1][lane], out.ptA[2][lane]);
+        real3 ptB(out.ptB[0][lane], out.ptB[1][lane], out.ptB[2][lane]);
+        if (swapped[lane]) {
+            norm = -norm;
+            std::swap(ptA, ptB);
+        }
+
+        cd_data.norm_rigid_rigid[icoll] = norm;
+        cd_data.cpta_rigid_rigid[icoll] = ptA;
+        cd_data.cptb_rigid_rigid[icoll] = ptB;
+        cd_data.dpth_rigid_rigid[icoll] = out.depth[lane];
+        cd_data.erad_rigid_rigid[icoll] = out.eff_rad[lane];
+
+        contact_active[icoll] = true;
+        cd_data.bids_rigid_rigid[icoll] = I2(cd_data.shape_data.id_rigid[int(p >> 32)],
+                                             cd_data.shape_data.id_rigid[int(p & 0xffffffff)]);
+    }
+}
+
+void ChNarrowphase::DispatchSphereSphereBatch(uint start, uint end) {
+    const real separation = 2 * cd_data->collision_envelope;
+    const int num_batches = (int)((end - start + num_lanes - 1) / num_lanes);
+
+#pragma omp parallel for
+    for (int ib = 0; ib < num_batches; ib++) {
+        LaneData in;
+        LaneOutput out;
+        uint pairs[num_lanes];
+        bool swapped[num_lanes];
+
+        int num_valid = GatherSphereBatch(*cd_data, pair_order.data(), start + ib * num_lanes, end, in, pairs, swapped);
+        SphereSphereKernel(in, separation, out);
+        ScatterSphereBatch(*cd_data, contact_index, contact_rigid_active, num_valid, pairs, swapped, out);
+    }
+}
+
+void ChNarrowphase::DispatchBoxSphereBatch(uint start, uint end) {
+    const real separation = 2 * cd_data->collision_envelope;
+    const real edge_radius = GetDefaultEdgeRadius();
+    const int num_batches = (int)((end - start + num_lanes - 1) / num_lanes);
+
+#pragma omp parallel for
+    for (int ib = 0; ib < num_batches; ib++) {
+        LaneData in;
+        LaneOutput out;
+        uint pairs[num_lanes];
+        bool swapped[num_lanes];
+
+        int num_valid = GatherSphereBatch(*cd_data, pair_order.data(), start + ib * num_lanes, end, in, pairs, swapped);
+        BoxSphereKernel(in, separation, edge_radius, out);
+        ScatterSphereBatch(*cd_data, contact_index, contact_rigid_active, num_valid, pairs, swapped, out);
+    }
+}
+
+void ChNarrowphase::DispatchCapsuleSphereBatch(uint start, uint end) {
+    const real separation = 2 * cd_data->collision_envelope;
+    const int num_batches = (int)((end - start + num_lanes - 1) / num_lanes);
+
+#pragma omp parallel for
+    for (int ib = 0; ib < num_batches; ib++) {
+        LaneData in;
+        LaneOutput out;
+        uint pairs[num_lanes];
+        bool swapped[num_lanes];
+
+        int num_valid = GatherSphereBatch(*cd_data, pair_order.data(), start + ib * num_lanes, end, in, pairs, swapped);
+        CapsuleSphereKernel(in, separation, out);
+        ScatterSphereBatch(*cd_data, contact_index, contact_rigid_active, num_valid, pairs, swapped, out);
+    }
+}
+
+}  // end namespace chrono
@@ -0,0 +1,198 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CHDUAL_H
+#define CHDUAL_H
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+
+/// Dual number for forward-mode automatic differentiation.
+/// A ChDual carries a value and its first derivatives with respect to N independent variables. Arithmetic operators
+/// and the elementary functions below propagate the derivatives through the chain rule, so that a function written
+/// generically over its scalar type (for example using ChVector3<Real> and ChQuaternion<Real>) and evaluated with
+/// ChDual<N> arguments returns its exact derivatives along all N directions in a single pass.
+/// Comparison operators only consider the value, so that branches follow the same path as a double evaluation.
+template <int N>
+class ChDual {
+  public:
+    typedef Eigen::Matrix<double, N, 1, Eigen::DontAlign> DerivativeVector;
+
+    /// Construct a constant (all derivatives zero).
+    ChDual() : m_val(0) { m_der.setZero(); }
+    ChDual(double val) : m_val(val) { m_der.setZero(); }
+
+    /// Construct an independent variable, with unit derivative in the specified direction.
+    ChDual(double val, int dir) : m_val(val) {
+        assert(dir >= 0 && dir < N);
+        m_der.setZero();
+        m_der(dir) = 1;
+    }
+
+    /// Construct from value and derivatives.
+    ChDual(double val, const DerivativeVector& der) : m_val(val), m_der(der) {}
+
+    /// Get the value.
+    double GetValue() const { return m_val; }
+
+    /// Get the derivative along the specified direction.
+    double GetDerivative(int dir) const { return m_der(dir); }
+
+    /// Get all derivatives.
+    const DerivativeVector& GetDerivatives() const { return m_der; }
+
+    /// Set the derivative along the specified direction.
+    void SetDerivative(int dir, double der) { m_der(dir) = der; }
+
+    // Arithmetic operators
+
+    ChDual operator+() const { return *this; }
+    ChDual operator-() const { return ChDual(-m_val, -m_der); }
+
+    ChDual& operator+=(const ChDual& b) {
+        m_val += b.m_val;
+        m_der += b.m_der;
+        return *this;
+    }
+    ChDual& operator-=(const ChDual& b) {
+        m_val -= b.m_val;
+        m_der -= b.m_der;
+        return *this;
+    }
+    ChDual& operator*=(const ChDual& b) {
+        m_der = m_der * b.m_val + b.m_der * m_val;
+        m_val *= b.m_val;
+        return *this;
+    }
+    ChDual& operator/=(const ChDual& b) {
+        double inv = 1 / b.m_val;
+        m_val *= inv;
+        m_der = (m_der - b.m_der * m_val) * inv;
+        return *this;
+    }
+
+    ChDual& operator+=(double b) {
+        m_val += b;
+        return *this;
+    }
+    ChDual& operator-=(double b) {
+        m_val -= b;
+        return *this;
+    }
+    ChDual& operator*=(double b) {
+        m_val *= b;
+        m_der *= b;
+        return *this;
+    }
+    ChDual& operator/=(double b) {
+        m_val /= b;
+        m_der /= b;
+        return *this;
+    }
+
+    friend ChDual operator+(ChDual a, const ChDual& b) { return a += b; }
+    friend ChDual operator-(ChDual a, const ChDual& b) { return a -= b; }
+    friend ChDual operator*(ChDual a, const ChDual& b) { return a *= b; }
+    friend ChDual operator/(ChDual a, const ChDual& b) { return a /= b; }
+
+    friend ChDual operator+(ChDual a, double b) { return a += b; }
+    friend ChDual operator-(ChDual a, double b) { return a -= b; }
+    friend ChDual operator*(ChDual a, double b) { return a *= b; }
+    friend ChDual operator/(ChDual a, double b) { return a /= b; }
+
+    friend ChDual operator+(double a, ChDual b) { return b += a; }
+    friend ChDual operator-(double a, const ChDual& b) { return ChDual(a - b.m_val, -b.m_der); }
+    friend ChDual operator*(double a, ChDual b) { return b *= a; }
+    friend ChDual operator/(double a, const ChDual& b) {
+        double val = a / b.m_val;
+        return ChDual(val, b.m_der * (-val / b.m_val));
+    }
+
+    // Comparison operators (on values only)
+
+    friend bool operator==(const ChDual& a, const ChDual& b) { return a.m_val == b.m_val; }
+    friend bool operator!=(const ChDual& a, const ChDual& b) { return a.m_val != b.m_val; }
+    friend bool operator<(const ChDual& a, const ChDual& b) { return a.m_val < b.m_val; }
+    friend bool operator>(const ChDual& a, const ChDual& b) { return a.m_val > b.m_val; }
+    friend bool operator<=(const ChDual& a, const ChDual& b) { return a.m_val <= b.m_val; }
+    friend bool operator>=(const ChDual& a, const ChDual& b) { return a.m_val >= b.m_val; }
+
+    friend bool operator==(const ChDual& a, double b) { return a.m_val == b; }
+    friend bool operator!=(const ChDual& a, double b) { return a.m_val != b; }
+    friend bool operator<(const ChDual& a, double b) { return a.m_val < b; }
+    friend bool operator>(const ChDual& a, double b) { return a.m_val > b; }
+    friend bool operator<=(const ChDual& a, double b) { return a.m_val <= b; }
+    friend bool operator>=(const ChDual& a, double b) { return a.m_val >= b; }
+
+    friend bool operator==(double a, const ChDual& b) { return a == b.m_val; }
+    friend bool operator!=(double a, const ChDual& b) { return a != b.m_val; }
+    friend bool operator<(double a, const ChDual& b) { return a < b.m_val; }
+    friend bool operator>(double a, const ChDual& b) { return a > b.m_val; }
+    friend bool operator<=(double a, const ChDual& b) { return a <= b.m_val; }
+    friend bool operator>=(double a, const ChDual& b) { return a >= b.m_val; }
+
+    // Elementary functions (found through argument-dependent lookup by generic code)
+
+    friend ChDual sqrt(const ChDual& a) {
+        double val = std::sqrt(a.m_val);
+        return ChDual(val, a.m_der * (0.5 / val));
+    }
+    friend ChDual abs(const ChDual& a) { return a.m_val < 0 ? -a : a; }
+    friend ChDual exp(const ChDual& a) {
+        double val = std::exp(a.m_val);
+        return ChDual(val, a.m_der * val);
+    }
+    friend ChDual log(const ChDual& a) { return ChDual(std::log(a.m_val), a.m_der / a.m_val); }
+    friend ChDual pow(const ChDual& a, double p) {
+        double val = std::pow(a.m_val, p);
+        return ChDual(val, a.m_der * (p * std::pow(a.m_val, p - 1)));
+    }
+    friend ChDual sin(const ChDual& a) { return ChDual(std::sin(a.m_val), a.m_der * std::cos(a.m_val)); }
+    friend ChDual cos(const ChDual& a) { return ChDual(std::cos(a.m_val), a.m_der * (-std::sin(a.m_val))); }
+    friend ChDual tan(const ChDual& a) {
+        double val = std::tan(a.m_val);
+        return ChDual(val, a.m_der * (1 + val * val));
+    }
+    friend ChDual acos(const ChDual& a) {
+        return ChDual(std::acos(a.m_val), a.m_der * (-1 / std::sqrt(1 - a.m_val * a.m_val)));
+    }
+    friend ChDual asin(const ChDual& a) {
+        return ChDual(std::asin(a.m_val), a.m_der * (1 / std::sqrt(1 - a.m_val * a.m_val)));
+    }
+    friend ChDual atan(const ChDual& a) {
+        return ChDual(std::atan(a.m_val), a.m_der * (1 / (1 + a.m_val * a.m_val)));
+    }
+    friend ChDual atan2(const ChDual& y, const ChDual& x) {
+        double den = 1 / (x.m_val * x.m_val + y.m_val * y.m_val);
+        return ChDual(std::atan2(y.m_val, x.m_val), (y.m_der * x.m_val - x.m_der * y.m_val) * den);
+    }
+
+    friend std::ostream& operator<<(std::ostream& out, const ChDual& a) {
+        out << a.m_val << " [" << a.m_der.transpose() << "]";
+        return out;
+    }
+
+  private:
+    double m_val;            ///< value
+    DerivativeVector m_der;  ///< derivatives along the N directions
+};
+
+}  // end namespace chrono
+
+#endif
@@ -24,15 +24,14 @@ void ChElementGeneric::EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c
     ComputeInternalForces(Fi);
     Fi *= c;
 
-    //// Attention: this is called from within a parallel OMP for loop.
-    //// Must use atomic increment when updating the global vector R.
+    // Note: this may be called from within a parallel OMP for loop, but only concurrently with elements of the same
+    // color (see ChMesh), i.e. elements that do not share nodes. As such, no two threads write to the same entries of R.
 
     unsigned int stride = 0;
     for (unsigned int in = 0; in < GetNumNodes(); in++) {
         unsigned int node_dofs = GetNodeNumCoordsPosLevelActive(in);
         if (!GetNode(in)->IsFixed()) {
             for (unsigned int j = 0; j < node_dofs; j++)
-#pragma omp atomic
                 R(GetNode(in)->NodeGetOffsetVelLevel() + j) += Fi(stride + j);
         }
         stride += GetNodeNumCoordsPosLevel(in);
@@ -88,15 +87,14 @@ void ChElementGeneric::EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const
     ComputeGravityForces(Fg, G_acc);
     Fg *= c;
 
-    //// Attention: this is called from within a parallel OMP for loop.
-    //// Must use atomic increment when updating the global vector R.
+    // Note: this may be called from within a parallel OMP for loop, but only concurrently with elements of the same
+    // color (see ChMesh), i.e. elements that do not share nodes. As such, no two threads write to the same entries of R.
 
     unsigned int stride = 0;
     for (unsigned int in = 0; in < GetNumNodes(); in++) {
         unsigned int node_dofs = GetNodeNumCoordsPosLevelActive(in);
         if (!GetNode(in)->IsFixed()) {
             for (unsigned int j = 0; j < node_dofs; j++)
-#pragma omp atomic
                 R(GetNode(in)->NodeGetOffsetVelLevel() + j) += Fg(stride + j);
         }
         stride += GetNodeNumCoordsPosLevel(in);
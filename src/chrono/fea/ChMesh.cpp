@@ -13,11 +13,13 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "chrono/core/ChFrame.h"
 #include "chrono/physics/ChLoad.h"
@@ -47,6 +49,10 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
 
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
+
+    m_color_elements = other.m_color_elements;
+    m_color_start = other.m_color_start;
+    m_serial_elements = other.m_serial_elements;
 }
 
 void ChMesh::SetupInitial() {
@@ -67,6 +73,95 @@ void ChMesh::SetupInitial() {
         // precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    // partition elements for parallel assembly of residuals
+    ComputeElementColoring();
+}
+
+// Greedy element coloring: each element is assigned the lowest color not already used by an element sharing one of its
+// nodes. Colors are tracked as a bit mask per node. Elements for which all 64 colors are taken (very unusual meshes)
+// are processed serially. Fixed nodes are also considered, so that the coloring remains valid if nodes are later fixed
+// or released.
+void ChMesh::ComputeElementColoring() {
+    static const unsigned int max_colors = 64;
+
+    std::unordered_map<const ChNodeFEAbase*, unsigned int> node_index;
+    for (unsigned int in = 0; in < vnodes.size(); in++)
+        node_index[vnodes[in].get()] = in;
+
+    std::vector<uint64_t> node_colors(vnodes.size(), 0);
+    std::vector<unsigned int> element_color(velements.size(), max_colors);
+    std::vector<unsigned int> color_count(max_colors, 0);
+    std::vector<unsigned int> element_nodes;
+
+    m_serial_elements.clear();
+
+    for (unsigned int ie = 0; ie < velements.size(); ie++) {
+        // collect the (indices of the) element nodes and the colors already used at these nodes
+        element_nodes.clear();
+        uint64_t used = 0;
+        for (unsigned int in = 0; in < velements[ie]->GetNumNodes(); in++) {
+            const ChNodeFEAbase* node = velements[ie]->GetNode(in).get();
+            auto it = node_index.find(node);
+            if (it == node_index.end()) {
+                // node not in this mesh
+                it = node_index.insert({node, (unsigned int)node_colors.size()}).first;
+                node_colors.push_back(0);
+            }
+            element_nodes.push_back(it->second);
+            used |= node_colors[it->second];
+        }
+
+        if (~used == 0) {
+            m_serial_elements.push_back(ie);
+            continue;
+        }
+
+        // lowest available color
+        unsigned int color = 0;
+        while (used & (uint64_t(1) << color))
+            color++;
+
+        element_color[ie] = color;
+        color_count[color]++;
+        for (auto in : element_nodes)
+            node_colors[in] |= uint64_t(1) << color;
+    }
+
+    // sort elements by color
+    unsigned int num_colors = 0;
+    while (num_colors < max_colors && color_count[num_colors] > 0)
+        num_colors++;
+
+    m_color_start.assign(num_colors + 1, 0);
+    for (unsigned int ic = 0; ic < num_colors; ic++)
+        m_color_start[ic + 1] = m_color_start[ic] + color_count[ic];
+
+    m_color_elements.resize(m_color_start[num_colors]);
+    std::vector<unsigned int> pos(m_color_start.begin(), m_color_start.end() - 1);
+    for (unsigned int ie = 0; ie < velements.size(); ie++) {
+        if (element_color[ie] < max_colors)
+            m_color_elements[pos[element_color[ie]]++] = ie;
+    }
+}
+
+template <class Func>
+void ChMesh::ForEachElementColored(int nthreads, Func func) {
+    // the coloring is out of date if elements were added or removed since the last setup
+    if (m_color_elements.size() + m_serial_elements.size() != velements.size())
+        ComputeElementColoring();
+
+    for (size_t ic = 0; ic + 1 < m_color_start.size(); ic++) {
+        int start = (int)m_color_start[ic];
+        int end = (int)m_color_start[ic + 1];
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+        for (int k = start; k < end; k++) {
+            func(velements[m_color_elements[k]].get());
+        }
+    }
+
+    for (auto ie : m_serial_elements)
+        func(velements[ie].get());
 }
 
 void ChMesh::Relax() {
@@ -91,6 +186,7 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> node) {
     if (system) {
         system->is_initialized = false;
         system->is_updated = false;
+        system->descriptor_dirty = true;
     }
 }
 
@@ -101,16 +197,21 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> elem) {
     if (system) {
         system->is_initialized = false;
         system->is_updated = false;
+        system->descriptor_dirty = true;
     }
 }
 
 void ChMesh::ClearElements() {
     velements.clear();
     vcontactsurfaces.clear();
+    m_color_elements.clear();
+    m_color_start.assign(1, 0);
+    m_serial_elements.clear();
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
         system->is_updated = false;
+        system->descriptor_dirty = true;
     }
 }
 
@@ -118,10 +219,14 @@ void ChMesh::ClearNodes() {
     velements.clear();
     vnodes.clear();
     vcontactsurfaces.clear();
+    m_color_elements.clear();
+    m_color_start.assign(1, 0);
+    m_serial_elements.clear();
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
         system->is_updated = false;
+        system->descriptor_dirty = true;
     }
 }
 
@@ -291,22 +396,18 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
     int nthreads = GetSystem()->nthreads_chrono;
 
     // elements internal forces
+    // (parallel over elements of the same color, no synchronization needed when writing to R)
     timer_internal_forces.start();
-    //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
-    }
+    ForEachElementColored(nthreads, [&R, c](ChElementBase* element) { element->EleIntLoadResidual_F(R, c); });
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->GetGravitationalAcceleration(), c);
-        }
+        const ChVector3d& G_acc = GetSystem()->GetGravitationalAcceleration();
+        ForEachElementColored(nthreads, [&R, &G_acc, c](ChElementBase* element) {
+            element->EleIntLoadResidual_F_gravity(R, G_acc, c);
+        });
     }
 
     // nodes gravity forces
@@ -416,9 +517,9 @@ void ChMesh::IntLoadResidual_Mv(const unsigned int off,      ///< offset in R re
     }
 
     // internal masses
-    for (unsigned int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_Mv(R, w, c);
-    }
+    // (parallel over elements of the same color, no synchronization needed when writing to R)
+    int nthreads = GetSystem()->nthreads_chrono;
+    ForEachElementColored(nthreads, [&R, &w, c](ChElementBase* element) { element->EleIntLoadResidual_Mv(R, w, c); });
 }
 
 void ChMesh::IntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md, double& err, const double c) {
@@ -44,7 +44,8 @@ class ChApi ChMesh : public ChIndexedNodes {
           automatic_gravity_load(true),
           num_points_gravity(1),
           ncalls_internal_forces(0),
-          ncalls_KRMload(0) {}
+          ncalls_KRMload(0),
+          m_color_start(1, 0) {}
     ChMesh(const ChMesh& other);
     ~ChMesh() {}
 
@@ -104,6 +105,11 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Get cumulative time for Jacobian load calls.
     double GetTimeJacobianLoad() { return timer_KRMload(); }
 
+    /// Get the number of element colors used for parallel residual assembly.
+    /// Elements of the same color do not share any node, so that their contributions to the global residual vector
+    /// can be loaded concurrently without synchronization. The coloring is computed at setup.
+    unsigned int GetNumElementColors() const { return (unsigned int)m_color_start.size() - 1; }
+
     /// Add a contact surface.
     void AddContactSurface(std::shared_ptr<ChContactSurface> m_surf);
 
@@ -276,6 +282,14 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// </pre>
     virtual void SetupInitial() override;
 
+    /// Partition the elements in colors, such that elements of the same color do not share any node.
+    void ComputeElementColoring();
+
+    /// Apply the given function to all elements, using the specified number of threads.
+    /// Elements of the same color are processed concurrently, while colors are processed in sequence.
+    template <class Func>
+    void ForEachElementColored(int nthreads, Func func);
+
     std::vector<std::shared_ptr<ChNodeFEAbase>> vnodes;     ///<  nodes
     std::vector<std::shared_ptr<ChElementBase>> velements;  ///<  elements
 
@@ -293,6 +307,10 @@ class ChApi ChMesh : public ChIndexedNodes {
     unsigned int ncalls_internal_forces;
     unsigned int ncalls_KRMload;
 
+    std::vector<unsigned int> m_color_elements;   ///< element indices, sorted by color
+    std::vector<unsigned int> m_color_start;      ///< start of each color in m_color_elements (size: num colors + 1)
+    std::vector<unsigned int> m_serial_elements;  ///< elements that could not be colored (processed serially)
+
     friend class chrono::ChSystem;
     friend class chrono::ChAssembly;
     friend class chrono::modal::ChModalAssembly;
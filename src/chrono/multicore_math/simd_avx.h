@@ -321,6 +321,47 @@ inline __m256d QuatMult(__m256d a, __m256d b) {
 #endif
 }
 
+// Lane-wise operations on 4 independent values (one per lane)
+//========================================================
+inline __m256d Splat(real a) {
+    return _mm256_set1_pd(a);
+}
+
+inline __m256d LoadU(const real* p) {
+    return _mm256_loadu_pd(p);
+}
+
+inline void StoreU(__m256d a, real* p) {
+    _mm256_storeu_pd(p, a);
+}
+
+// Comparisons return a mask with all bits set in the lanes where the condition holds
+inline __m256d CmpLT(__m256d a, __m256d b) {
+    return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+}
+
+inline __m256d CmpGT(__m256d a, __m256d b) {
+    return _mm256_cmp_pd(a, b, _CMP_GT_OQ);
+}
+
+inline __m256d CmpGE(__m256d a, __m256d b) {
+    return _mm256_cmp_pd(a, b, _CMP_GE_OQ);
+}
+
+inline __m256d And(__m256d a, __m256d b) {
+    return _mm256_and_pd(a, b);
+}
+
+// Select a in the lanes where the mask is set and b elsewhere
+inline __m256d Select(__m256d mask, __m256d a, __m256d b) {
+    return _mm256_blendv_pd(b, a, mask);
+}
+
+// Bit i of the result is set if lane i of the mask is set
+inline int MoveMask(__m256d mask) {
+    return _mm256_movemask_pd(mask);
+}
+
 inline __m128i Set(int x) {
     return _mm_set1_epi32(x);
 }
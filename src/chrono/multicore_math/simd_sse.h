@@ -216,6 +216,47 @@ inline bool IsZero(const real3& v, const real& a) {
     return chrono::Abs(v.x) < a && chrono::Abs(v.y) < a && chrono::Abs(v.z) < a;
 }
 
+// Lane-wise operations on 4 independent values (one per lane)
+//========================================================
+inline __m128 Splat(real a) {
+    return _mm_set1_ps(a);
+}
+
+inline __m128 LoadU(const real* p) {
+    return _mm_loadu_ps(p);
+}
+
+inline void StoreU(__m128 a, real* p) {
+    _mm_storeu_ps(p, a);
+}
+
+// Comparisons return a mask with all bits set in the lanes where the condition holds
+inline __m128 CmpLT(__m128 a, __m128 b) {
+    return _mm_cmplt_ps(a, b);
+}
+
+inline __m128 CmpGT(__m128 a, __m128 b) {
+    return _mm_cmpgt_ps(a, b);
+}
+
+inline __m128 CmpGE(__m128 a, __m128 b) {
+    return _mm_cmpge_ps(a, b);
+}
+
+inline __m128 And(__m128 a, __m128 b) {
+    return _mm_and_ps(a, b);
+}
+
+// Select a in the lanes where the mask is set and b elsewhere
+inline __m128 Select(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// Bit i of the result is set if lane i of the mask is set
+inline int MoveMask(__m128 mask) {
+    return _mm_movemask_ps(mask);
+}
+
 inline __m128i Set(int x) {
     return _mm_set1_epi32(x);
 }
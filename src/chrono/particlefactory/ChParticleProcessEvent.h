@@ -75,11 +75,13 @@ class ChParticleProcessEventRemove : public ChParticleProcessEvent {
     virtual void SetupPreProcess(ChSystem& msystem) override { to_delete.clear(); }
 
     virtual void SetupPostProcess(ChSystem& msystem) override {
+        // Remove all particles as a single batch
         std::list<std::shared_ptr<ChBody> >::iterator ibody = to_delete.begin();
         while (ibody != to_delete.end()) {
-            msystem.Remove((*ibody));
+            msystem.RemoveBatch((*ibody));
             ++ibody;
         }
+        msystem.FlushBatch();
     }
 };
 
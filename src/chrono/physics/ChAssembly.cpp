@@ -18,6 +18,7 @@
 #include "chrono/core/ChGlobal.h"
 #include "chrono/physics/ChAssembly.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/utils/ChProfiler.h"
 
 namespace chrono {
 
@@ -123,7 +124,8 @@ void ChAssembly::Clear() {
     m_num_coords_vel = 0;
 }
 
-// Note: removing items from the assembly incurs linear time cost
+// Note: removing items from the assembly incurs linear time cost, except for bodies which are removed in constant time
+// (the body index is used as the body's slot in the body list)
 
 void ChAssembly::AddBody(std::shared_ptr<ChBody> body) {
     assert(std::find(std::begin(bodylist), std::end(bodylist), body) == bodylist.end());
@@ -131,20 +133,28 @@ void ChAssembly::AddBody(std::shared_ptr<ChBody> body) {
 
     // set system and also add collision models to system
     body->SetSystem(system);
+    body->index = static_cast<unsigned int>(bodylist.size());
     bodylist.push_back(body);
 
     ////system->is_initialized = false;  // Not needed, unless/until ChBody::SetupInitial does something
     system->is_updated = false;
+    system->descriptor_dirty = true;
 }
 
 void ChAssembly::RemoveBody(std::shared_ptr<ChBody> body) {
-    auto itr = std::find(std::begin(bodylist), std::end(bodylist), body);
-    assert(itr != bodylist.end());
+    auto index = body->index;
+    assert(index < bodylist.size() && bodylist[index] == body);
 
-    bodylist.erase(itr);
+    // Move the last body in the removed body's slot
+    if (index + 1 < bodylist.size()) {
+        bodylist[index] = std::move(bodylist.back());
+        bodylist[index]->index = index;
+    }
+    bodylist.pop_back();
     body->SetSystem(nullptr);
 
     system->is_updated = false;
+    system->descriptor_dirty = true;
 }
 
 void ChAssembly::AddShaft(std::shared_ptr<ChShaft> shaft) {
@@ -156,6 +166,7 @@ void ChAssembly::AddShaft(std::shared_ptr<ChShaft> shaft) {
 
     ////system->is_initialized = false;  // Not needed, unless/until ChShaft::SetupInitial does something
     system->is_updated = false;
+    system->descriptor_dirty = true;
 }
 
 void ChAssembly::RemoveShaft(std::shared_ptr<ChShaft> shaft) {
@@ -166,6 +177,7 @@ void ChAssembly::RemoveShaft(std::shared_ptr<ChShaft> shaft) {
     shaft->SetSystem(nullptr);
 
     system->is_updated = false;
+    system->descriptor_dirty = true;
 }
 
 void ChAssembly::AddLink(std::shared_ptr<ChLinkBase> link) {
@@ -177,6 +189,7 @@ void ChAssembly::AddLink(std::shared_ptr<ChLinkBase> link) {
 
     ////system->is_initialized = false;  // Not needed, unless/until ChLink::SetupInitial does something
     system->is_updated = false;
+    system->descriptor_dirty = true;
 }
 
 void ChAssembly::RemoveLink(std::shared_ptr<ChLinkBase> link) {
@@ -187,6 +200,7 @@ void ChAssembly::RemoveLink(std::shared_ptr<ChLinkBase> link) {
     link->SetSystem(nullptr);
 
     system->is_updated = false;
+    system->descriptor_dirty = true;
 }
 
 void ChAssembly::AddMesh(std::shared_ptr<fea::ChMesh> mesh) {
@@ -197,6 +211,7 @@ void ChAssembly::AddMesh(std::shared_ptr<fea::ChMesh> mesh) {
 
     system->is_initialized = false;
     system->is_updated = false;
+    system->descriptor_dirty = true;
 }
 
 void ChAssembly::RemoveMesh(std::shared_ptr<fea::ChMesh> mesh) {
@@ -207,6 +222,7 @@ void ChAssembly::RemoveMesh(std::shared_ptr<fea::ChMesh> mesh) {
     mesh->SetSystem(nullptr);
 
     system->is_updated = false;
+    system->descriptor_dirty = true;
 }
 
 void ChAssembly::AddOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> item) {
@@ -223,6 +239,7 @@ void ChAssembly::AddOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> item) {
 
     ////system->is_initialized = false;  // Not needed, unless/until ChPhysicsItem::SetupInitial does something
     system->is_updated = false;
+    system->descriptor_dirty = true;
 }
 
 void ChAssembly::RemoveOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> item) {
@@ -233,6 +250,7 @@ void ChAssembly::RemoveOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> item) {
     item->SetSystem(nullptr);
 
     system->is_updated = false;
+    system->descriptor_dirty = true;
 }
 
 void ChAssembly::Add(std::shared_ptr<ChPhysicsItem> item) {
@@ -264,11 +282,57 @@ void ChAssembly::AddBatch(std::shared_ptr<ChPhysicsItem> item) {
 
     system->is_initialized = false;  // Needed, as the list may include a ChMesh
     system->is_updated = false;
+    system->descriptor_dirty = true;
+}
+
+void ChAssembly::RemoveBatch(std::shared_ptr<ChPhysicsItem> item) {
+    batch_to_remove.push_back(item);
+
+    if (system) {
+        system->is_updated = false;
+        system->descriptor_dirty = true;
+    }
 }
 
 void ChAssembly::FlushBatch() {
+    if (batch_to_insert.empty() && batch_to_remove.empty())
+        return;
+
+    auto coll_sys = system ? system->GetCollisionSystem() : nullptr;
+
+    if (!batch_to_remove.empty()) {
+        // Remove the collision models of all queued bodies at once
+        if (coll_sys) {
+            std::vector<std::shared_ptr<ChCollisionModel>> models;
+            for (auto& item : batch_to_remove) {
+                if (auto body = std::dynamic_pointer_cast<ChBody>(item)) {
+                    if (body->GetCollisionModel())
+                        models.push_back(body->GetCollisionModel());
+                } else {
+                    item->RemoveCollisionModelsFromSystem(coll_sys.get());
+                }
+            }
+            coll_sys->RemoveBatch(models);
+        }
+
+        for (auto& item : batch_to_remove) {
+            Remove(item);
+        }
+        batch_to_remove.clear();
+    }
+
     for (auto& item : batch_to_insert) {
         Add(item);
+
+        // Process the collision model of a new body, unless already done by the caller or left to the collision
+        // system initialization
+        if (coll_sys && coll_sys->IsInitialized()) {
+            if (auto body = std::dynamic_pointer_cast<ChBody>(item)) {
+                auto model = body->GetCollisionModel();
+                if (body->IsCollisionEnabled() && model && !model->HasImplementation())
+                    coll_sys->Add(model);
+            }
+        }
     }
     batch_to_insert.clear();
 }
@@ -303,8 +367,10 @@ void ChAssembly::RemoveAllBodies() {
     }
     bodylist.clear();
 
-    if (system)
+    if (system) {
         system->is_updated = false;
+        system->descriptor_dirty = true;
+    }
 }
 
 void ChAssembly::RemoveAllShafts() {
@@ -313,8 +379,10 @@ void ChAssembly::RemoveAllShafts() {
     }
     shaftlist.clear();
 
-    if (system)
+    if (system) {
         system->is_updated = false;
+        system->descriptor_dirty = true;
+    }
 }
 
 void ChAssembly::RemoveAllLinks() {
@@ -323,8 +391,10 @@ void ChAssembly::RemoveAllLinks() {
     }
     linklist.clear();
 
-    if (system)
+    if (system) {
         system->is_updated = false;
+        system->descriptor_dirty = true;
+    }
 }
 
 void ChAssembly::RemoveAllMeshes() {
@@ -333,8 +403,10 @@ void ChAssembly::RemoveAllMeshes() {
     }
     meshlist.clear();
 
-    if (system)
+    if (system) {
         system->is_updated = false;
+        system->descriptor_dirty = true;
+    }
 }
 
 void ChAssembly::RemoveAllOtherPhysicsItems() {
@@ -343,8 +415,10 @@ void ChAssembly::RemoveAllOtherPhysicsItems() {
     }
     otherphysicslist.clear();
 
-    if (system)
+    if (system) {
         system->is_updated = false;
+        system->descriptor_dirty = true;
+    }
 }
 
 std::shared_ptr<ChBody> ChAssembly::SearchBody(const std::string& name) const {
@@ -644,27 +718,71 @@ void ChAssembly::Update(double mytime, bool update_assets) {
     Update(update_assets);
 }
 
+// Minimum number of items in a list for a concurrent update.
+static const int min_parallel_update_items = 64;
+
+// Update all items in the given list.
+// If more than one thread is available, items that opted in are updated concurrently; the remaining items are then
+// updated sequentially, in their original order.
+template <class T>
+static void UpdateItems(std::vector<std::shared_ptr<T>>& list, double time, bool update_assets, int nthreads) {
+    int num_items = (int)list.size();
+
+    if (nthreads <= 1 || num_items < min_parallel_update_items) {
+        for (auto& item : list)
+            item->Update(time, update_assets);
+        return;
+    }
+
+    int num_sequential = 0;
+
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads) reduction(+ : num_sequential)
+    for (int i = 0; i < num_items; i++) {
+        if (list[i]->IsParallelUpdateEnabled())
+            list[i]->Update(time, update_assets);
+        else
+            num_sequential++;
+    }
+
+    if (num_sequential > 0) {
+        for (auto& item : list) {
+            if (!item->IsParallelUpdateEnabled())
+                item->Update(time, update_assets);
+        }
+    }
+}
+
 // Update all physical items (bodies, links, meshes, etc), including their auxiliary variables.
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
+// Bodies, shafts, meshes, and links that opted in are updated concurrently (see ChPhysicsItem::EnableParallelUpdate);
+// all other physics items are updated sequentially.
 void ChAssembly::Update(bool update_assets) {
-    //// NOTE: do not switch these to range for loops (may want to use OMP for)
-    for (auto& body : bodylist) {
-        body->Update(ChTime, update_assets);
+    int nthreads = system ? system->GetNumThreadsChrono() : 1;
+
+    {
+        CH_PROFILE_CATEGORY("Update", "bodies");
+        UpdateItems(bodylist, ChTime, update_assets, nthreads);
     }
-    for (auto& shaft : shaftlist) {
-        shaft->Update(ChTime, update_assets);
+    {
+        CH_PROFILE_CATEGORY("Update", "shafts");
+        UpdateItems(shaftlist, ChTime, update_assets, nthreads);
     }
-    for (auto& mesh : meshlist) {
-        mesh->Update(ChTime, update_assets);
+    {
+        CH_PROFILE_CATEGORY("Update", "FEA meshes");
+        UpdateItems(meshlist, ChTime, update_assets, nthreads);
     }
-    for (auto& otherphysics : otherphysicslist) {
-        otherphysics->Update(ChTime, update_assets);
+    {
+        CH_PROFILE_CATEGORY("Update", "other items");
+        for (auto& otherphysics : otherphysicslist) {
+            otherphysics->Update(ChTime, update_assets);
+        }
     }
     // The state of links depends on the bodylist,shaftlist,meshlist,otherphysicslist,
     // thus the update of linklist must be at the end.
-    for (auto& link : linklist) {
-        link->Update(ChTime, update_assets);
+    {
+        CH_PROFILE_CATEGORY("Update", "links");
+        UpdateItems(linklist, ChTime, update_assets, nthreads);
     }
 }
 
@@ -941,24 +1059,39 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
 {
     unsigned int displ_v = off - this->offset_w;
 
-    for (auto& body : bodylist) {
-        if (body->IsActive())
-            body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
+    {
+        CH_PROFILE_CATEGORY("Load forces", "bodies");
+        for (auto& body : bodylist) {
+            if (body->IsActive())
+                body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
+        }
     }
-    for (auto& shaft : shaftlist) {
-        if (shaft->IsActive())
-            shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c);
+    {
+        CH_PROFILE_CATEGORY("Load forces", "shafts");
+        for (auto& shaft : shaftlist) {
+            if (shaft->IsActive())
+                shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c);
+        }
     }
-    for (auto& link : linklist) {
-        if (link->IsActive())
-            link->IntLoadResidual_F(displ_v + link->GetOffset_w(), R, c);
+    {
+        CH_PROFILE_CATEGORY("Load forces", "links");
+        for (auto& link : linklist) {
+            if (link->IsActive())
+                link->IntLoadResidual_F(displ_v + link->GetOffset_w(), R, c);
+        }
     }
-    for (auto& mesh : meshlist) {
-        mesh->IntLoadResidual_F(displ_v + mesh->GetOffset_w(), R, c);
+    {
+        CH_PROFILE_CATEGORY("Load forces", "FEA meshes");
+        for (auto& mesh : meshlist) {
+            mesh->IntLoadResidual_F(displ_v + mesh->GetOffset_w(), R, c);
+        }
     }
-    for (auto& item : otherphysicslist) {
-        if (item->IsActive())
-            item->IntLoadResidual_F(displ_v + item->GetOffset_w(), R, c);
+    {
+        CH_PROFILE_CATEGORY("Load forces", "other items");
+        for (auto& item : otherphysicslist) {
+            if (item->IsActive())
+                item->IntLoadResidual_F(displ_v + item->GetOffset_w(), R, c);
+        }
     }
 }
 
@@ -1300,6 +1433,8 @@ void ChAssembly::InjectConstraints(ChSystemDescriptor& descriptor) {
         shaft->InjectConstraints(descriptor);
     }
     for (auto& link : linklist) {
+        if (m_num_bodies_sleep && link->IsSleeping())
+            continue;
         link->InjectConstraints(descriptor);
     }
     for (auto& mesh : meshlist) {
@@ -1401,20 +1536,35 @@ void ChAssembly::ConstraintsFbLoadForces(double factor) {
 }
 
 void ChAssembly::LoadConstraintJacobians() {
-    for (auto& body : bodylist) {
-        body->LoadConstraintJacobians();
+    {
+        CH_PROFILE_CATEGORY("Load Jacobians", "bodies");
+        for (auto& body : bodylist) {
+            body->LoadConstraintJacobians();
+        }
     }
-    for (auto& shaft : shaftlist) {
-        shaft->LoadConstraintJacobians();
+    {
+        CH_PROFILE_CATEGORY("Load Jacobians", "shafts");
+        for (auto& shaft : shaftlist) {
+            shaft->LoadConstraintJacobians();
+        }
     }
-    for (auto& link : linklist) {
-        link->LoadConstraintJacobians();
+    {
+        CH_PROFILE_CATEGORY("Load Jacobians", "links");
+        for (auto& link : linklist) {
+            link->LoadConstraintJacobians();
+        }
     }
-    for (auto& mesh : meshlist) {
-        mesh->LoadConstraintJacobians();
+    {
+        CH_PROFILE_CATEGORY("Load Jacobians", "FEA meshes");
+        for (auto& mesh : meshlist) {
+            mesh->LoadConstraintJacobians();
+        }
     }
-    for (auto& item : otherphysicslist) {
-        item->LoadConstraintJacobians();
+    {
+        CH_PROFILE_CATEGORY("Load Jacobians", "other items");
+        for (auto& item : otherphysicslist) {
+            item->LoadConstraintJacobians();
+        }
     }
 }
 
@@ -1455,20 +1605,35 @@ void ChAssembly::InjectKRMMatrices(ChSystemDescriptor& descriptor) {
 }
 
 void ChAssembly::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
-    for (auto& body : bodylist) {
-        body->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    {
+        CH_PROFILE_CATEGORY("Load KRM", "bodies");
+        for (auto& body : bodylist) {
+            body->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+        }
     }
-    for (auto& shaft : shaftlist) {
-        shaft->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    {
+        CH_PROFILE_CATEGORY("Load KRM", "shafts");
+        for (auto& shaft : shaftlist) {
+            shaft->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+        }
     }
-    for (auto& link : linklist) {
-        link->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    {
+        CH_PROFILE_CATEGORY("Load KRM", "links");
+        for (auto& link : linklist) {
+            link->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+        }
     }
-    for (auto& mesh : meshlist) {
-        mesh->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    {
+        CH_PROFILE_CATEGORY("Load KRM", "FEA meshes");
+        for (auto& mesh : meshlist) {
+            mesh->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+        }
     }
-    for (auto& item : otherphysicslist) {
-        item->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    {
+        CH_PROFILE_CATEGORY("Load KRM", "other items");
+        for (auto& item : otherphysicslist) {
+            item->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+        }
     }
 }
 
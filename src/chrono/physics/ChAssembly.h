@@ -75,11 +75,20 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// at the first Setup() call. This is thread safe.
     void AddBatch(std::shared_ptr<ChPhysicsItem> item);
 
-    /// If some items are queued for addition in the assembly, using AddBatch(), this will
-    /// effectively add them and clean the batch. Called automatically at each Setup().
+    /// Items removed in this way are removed like in the Remove() method, but not instantly,
+    /// they are simply queued in a batch of 'to remove' items, that are removed automatically
+    /// at the first Setup() call. The collision models of all queued bodies are removed from
+    /// the collision system at once, which is much faster when removing many bodies.
+    void RemoveBatch(std::shared_ptr<ChPhysicsItem> item);
+
+    /// If some items are queued for addition or removal in the assembly, using AddBatch() or
+    /// RemoveBatch(), this will effectively add/remove them and clean the batches. Removals are
+    /// processed first. Called automatically at each Setup().
     void FlushBatch();
 
     /// Remove a body from this assembly.
+    /// The removal takes constant time: the last body in the list is moved into the slot of the removed body. As a
+    /// result, the order of the remaining bodies (see GetBodies) is not preserved.
     void RemoveBody(std::shared_ptr<ChBody> body);
     /// Remove a shaft from this assembly.
     void RemoveShaft(std::shared_ptr<ChShaft> shaft);
@@ -104,6 +113,8 @@ class ChApi ChAssembly : public ChPhysicsItem {
     void RemoveAllOtherPhysicsItems();
 
     /// Get the list of bodies.
+    /// Bodies are listed in the order they were added, except that removing a body moves the last body in its place
+    /// (see RemoveBody).
     const std::vector<std::shared_ptr<ChBody>>& GetBodies() const { return bodylist; }
     /// Get the list of shafts.
     const std::vector<std::shared_ptr<ChShaft>>& GetShafts() const { return shaftlist; }
@@ -329,6 +340,7 @@ class ChApi ChAssembly : public ChPhysicsItem {
     std::vector<std::shared_ptr<fea::ChMesh>> meshlist;            ///< list of meshes
     std::vector<std::shared_ptr<ChPhysicsItem>> otherphysicslist;  ///< list of other physics objects
     std::vector<std::shared_ptr<ChPhysicsItem>> batch_to_insert;   ///< list of items to insert at once
+    std::vector<std::shared_ptr<ChPhysicsItem>> batch_to_remove;   ///< list of items to remove at once
 
     // Statistics:
     unsigned int m_num_bodies_active;             ///< number of active bodies
@@ -55,6 +55,9 @@ ChBody::ChBody()
     sleep_minwvel = 0.04f;
 
     variables.SetUserData((void*)this);
+
+    // Update() only modifies the body and its own markers and forces
+    EnableParallelUpdate(true);
 }
 
 ChBody::ChBody(const ChBody& other) : ChPhysicsItem(other), ChBodyFrame(other) {
@@ -234,7 +237,9 @@ void ChBody::IntFromDescriptor(const unsigned int off_v,  // offset in v
 void ChBody::InjectVariables(ChSystemDescriptor& descriptor) {
     variables.SetDisabled(!IsActive());
 
-    descriptor.InsertVariables(&variables);
+    // The (disabled) variables of a sleeping body are not needed by the solver
+    if (!is_sleeping)
+        descriptor.InsertVariables(&variables);
 }
 
 void ChBody::VariablesFbReset() {
@@ -613,6 +618,9 @@ bool ChBody::IsSleepingAllowed() const {
 }
 
 void ChBody::SetSleeping(bool state) {
+    // A change in the sleeping state changes the set of active variables
+    if (system && state != is_sleeping)
+        system->descriptor_dirty = true;
     is_sleeping = state;
 }
 
@@ -720,9 +728,8 @@ ChVector3d ChBody::GetContactPointSpeed(const ChVector3d& loc_point,
     ChCoordsys<> csys(state_x.segment(0, 7));
     ChVector3d abs_vel(state_w.segment(0, 3));
     ChVector3d loc_omg(state_w.segment(3, 3));
-    ChVector3d abs_omg = csys.TransformDirectionLocalToParent(loc_omg);
 
-    return abs_vel + Vcross(abs_omg, loc_point);
+    return abs_vel + csys.TransformDirectionLocalToParent(Vcross(loc_omg, loc_point));
 }
 
 ChVector3d ChBody::GetContactPointSpeed(const ChVector3d& abs_point) {
@@ -33,7 +33,8 @@ namespace chrono {
 /// Class representing a container of many contacts.
 class ChApi ChContactContainer : public ChPhysicsItem {
   public:
-    ChContactContainer() : add_contact_callback(nullptr), report_contact_callback(nullptr) {}
+    ChContactContainer()
+        : add_contact_callback(nullptr), report_contact_callback(nullptr), persistent_contacts(true) {}
     ChContactContainer(const ChContactContainer& other);
     virtual ~ChContactContainer() {}
 
@@ -64,6 +65,16 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     /// similar).
     virtual void EndAddContact() {}
 
+    /// Enable or disable the matching of persistent contacts across steps (default: true).
+    /// If enabled, and if the collision system reports persistent contact identifiers (ChCollisionInfo::feature_id),
+    /// the state of a contact at the previous step is used to initialize the same contact at the current step: the
+    /// contact reactions (used to warm start the solver) for NSC contacts, and the accumulated tangential displacement
+    /// (used with the MultiStep tangential displacement model) for SMC contacts.
+    void EnablePersistentContacts(bool val) { persistent_contacts = val; }
+
+    /// Return true if the matching of persistent contacts across steps is enabled.
+    bool IsPersistentContactsEnabled() const { return persistent_contacts; }
+
     /// Class to be used as a callback interface for some user defined action to be taken
     /// each time a contact is added to the container.
     /// It can be used to modify the composite material properties for the contact pair.
@@ -140,14 +151,16 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     std::shared_ptr<AddContactCallback> add_contact_callback;
     ReportContactCallback* report_contact_callback;
 
+    bool persistent_contacts;  ///< match persistent contacts across steps
+
     /// Utility function to accumulate contact forces from a specified list of contacts.
     /// This function is templated by the contact type (assumed to be derived from ChContactTuple).
     /// Contact forces are accumulated in a map keyed by the contactable objects.
     /// Derived ChContactContainer classes can use this utility (processing their various lists
     /// of contacts) to cache information used for reporting through GetContactableForce and
     /// GetContactableTorque.
-    template <class Tcont>
-    void SumAllContactForces(std::list<Tcont*>& contactlist,
+    template <class Tlist>
+    void SumAllContactForces(Tlist& contactlist,
                              std::unordered_map<ChContactable*, ForceTorque>& contactforces) {
         for (auto contact = contactlist.begin(); contact != contactlist.end(); ++contact) {
             // Extract information for current contact (expressed in global frame)
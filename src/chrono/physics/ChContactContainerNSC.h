@@ -15,9 +15,8 @@
 #ifndef CH_CONTACTCONTAINER_NSC_H
 #define CH_CONTACTCONTAINER_NSC_H
 
-#include <list>
-
 #include "chrono/physics/ChContactContainer.h"
+#include "chrono/physics/ChContactPool.h"
 #include "chrono/physics/ChContactNSC.h"
 #include "chrono/physics/ChContactNSCrolling.h"
 #include "chrono/physics/ChContactable.h"
@@ -25,9 +24,10 @@
 namespace chrono {
 
 /// Class representing a container of many non-smooth contacts.
-/// Implemented using linked lists of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
-/// reactions). It might also contain ChContactNSCrolling objects (extended versions of ChContactNSC, with 6 reactions,
-/// that account also for rolling and spinning resistance), but also for '6dof vs 6dof' contactables.
+/// Implemented using pools of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
+/// reactions), stored contiguously in memory and reused between steps (see ChContactPool). It might also contain
+/// ChContactNSCrolling objects (extended versions of ChContactNSC, with 6 reactions, that account also for rolling and
+/// spinning resistance), but also for '6dof vs 6dof' contactables.
 class ChApi ChContactContainerNSC : public ChContactContainer {
   public:
     typedef ChContactNSC<ChContactable_1vars<6>, ChContactable_1vars<6> > ChContactNSC_6_6;
@@ -53,17 +53,18 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     /// Report the number of added contacts.
     virtual unsigned int GetNumContacts() const override {
-        return n_added_3_3 + n_added_6_3 + n_added_6_6 + n_added_333_3 + n_added_333_6 + n_added_333_333 +
-               n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666 + n_added_6_6_rolling;
+        return (unsigned int)(contactlist_3_3.size() + contactlist_6_3.size() + contactlist_6_6.size() +
+                              contactlist_333_3.size() + contactlist_333_6.size() + contactlist_333_333.size() +
+                              contactlist_666_3.size() + contactlist_666_6.size() + contactlist_666_333.size() +
+                              contactlist_666_666.size() + contactlist_6_6_rolling.size());
     }
 
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
-    /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
-    /// allocation/deallocation.
+    /// similar). Instead of simply deleting all the previous contacts, this optimized implementation rewinds the contact
+    /// pools and reuses the previous contact objects until possible, to avoid allocation/deallocation.
     virtual void BeginAddContact() override;
 
     /// Add a contact between two collision shapes, storing it into this container.
@@ -78,8 +79,9 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// A composite contact material is created from their material properties.
     virtual void AddContact(const ChCollisionInfo& cinfo) override;
 
-    /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// The collision system will call EndAddContact() after adding all contacts (for example with AddContact() or
+    /// similar). Contact objects that were not reused (if any) are kept in their pools for subsequent steps, unless
+    /// a pool is much larger than the number of contacts in use (see ChContactPool::Trim).
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
@@ -119,11 +121,21 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// Report the number of scalar unilateral constraints.
     /// Note: friction constraints aren't exactly unilaterals, but they are still counted.
     virtual unsigned int GetNumConstraintsUnilateral() override {
-        return 3 * (n_added_3_3 + n_added_6_3 + n_added_6_6 + n_added_333_3 + n_added_333_6 + n_added_333_333 +
-                    n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666) +
-               6 * (n_added_6_6_rolling);
+        return (unsigned int)(3 * (contactlist_3_3.size() + contactlist_6_3.size() + contactlist_6_6.size() +
+                                   contactlist_333_3.size() + contactlist_333_6.size() + contactlist_333_333.size() +
+                                   contactlist_666_3.size() + contactlist_666_6.size() + contactlist_666_333.size() +
+                                   contactlist_666_666.size()) +
+                              6 * contactlist_6_6_rolling.size());
     }
 
+    /// Get the reactions of the specified persistent contact at the previous step (in the contact coordinate system).
+    /// Return false if the contact was not recorded at the previous step (see EnablePersistentContacts).
+    bool GetPersistentContactReactions(const ChContactKey& key, ChVector3d& force, ChVector3d& torque) const;
+
+    /// Get the reactions at the previous step of the contact described by the given collision info.
+    /// Return nullptr if the contact cannot be matched. Used to initialize new contacts (see ChContactPool::Insert).
+    const ChWrenchd* GetContactHistory(const ChCollisionInfo& cinfo) const;
+
     /// Objects will rebounce only if their relative colliding speed is above this threshold.
     double GetMinBounceSpeed() const { return min_bounce_speed; }
 
@@ -182,46 +194,24 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   protected:
-    std::list<ChContactNSC_6_6*> contactlist_6_6;
-    std::list<ChContactNSC_6_3*> contactlist_6_3;
-    std::list<ChContactNSC_3_3*> contactlist_3_3;
-    std::list<ChContactNSC_333_3*> contactlist_333_3;
-    std::list<ChContactNSC_333_6*> contactlist_333_6;
-    std::list<ChContactNSC_333_333*> contactlist_333_333;
-    std::list<ChContactNSC_666_3*> contactlist_666_3;
-    std::list<ChContactNSC_666_6*> contactlist_666_6;
-    std::list<ChContactNSC_666_333*> contactlist_666_333;
-    std::list<ChContactNSC_666_666*> contactlist_666_666;
-
-    std::list<ChContactNSCrolling_6_6*> contactlist_6_6_rolling;
-
-    int n_added_6_6;
-    int n_added_6_3;
-    int n_added_3_3;
-    int n_added_333_3;
-    int n_added_333_6;
-    int n_added_333_333;
-    int n_added_666_3;
-    int n_added_666_6;
-    int n_added_666_333;
-    int n_added_666_666;
-    int n_added_6_6_rolling;
-
-    std::list<ChContactNSC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactNSC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactNSC_3_3*>::iterator lastcontact_3_3;
-    std::list<ChContactNSC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactNSC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactNSC_333_333*>::iterator lastcontact_333_333;
-    std::list<ChContactNSC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactNSC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactNSC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactNSC_666_666*>::iterator lastcontact_666_666;
-
-    std::list<ChContactNSCrolling_6_6*>::iterator lastcontact_6_6_rolling;
+    ChContactPool<ChContactNSC_6_6> contactlist_6_6;
+    ChContactPool<ChContactNSC_6_3> contactlist_6_3;
+    ChContactPool<ChContactNSC_3_3> contactlist_3_3;
+    ChContactPool<ChContactNSC_333_3> contactlist_333_3;
+    ChContactPool<ChContactNSC_333_6> contactlist_333_6;
+    ChContactPool<ChContactNSC_333_333> contactlist_333_333;
+    ChContactPool<ChContactNSC_666_3> contactlist_666_3;
+    ChContactPool<ChContactNSC_666_6> contactlist_666_6;
+    ChContactPool<ChContactNSC_666_333> contactlist_666_333;
+    ChContactPool<ChContactNSC_666_666> contactlist_666_666;
+
+    ChContactPool<ChContactNSCrolling_6_6> contactlist_6_6_rolling;
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
+    /// Reactions of the persistent contacts at the previous step.
+    std::unordered_map<ChContactKey, ChWrenchd, ChContactKeyHash> persistent_reactions;
+
   private:
     void InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeNSC& cmat);
 
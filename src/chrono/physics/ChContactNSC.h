@@ -64,7 +64,8 @@ class ChContactNSC : public ChContactTuple<Ta, Tb> {
                  Ta* obj_A,                                 ///< contactable object A
                  Tb* obj_B,                                 ///< contactable object B
                  const ChCollisionInfo& cinfo,              ///< data for the collision pair
-                 const ChContactMaterialCompositeNSC& mat   ///< composite material
+                 const ChContactMaterialCompositeNSC& mat,  ///< composite material
+                 const ChWrenchd* reactions = nullptr       ///< reactions at previous step (if persistent)
                  )
         : ChContactTuple<Ta, Tb>(obj_A, obj_B), container(contact_container) {
         assert(contact_container);
@@ -72,16 +73,19 @@ class ChContactNSC : public ChContactTuple<Ta, Tb> {
         Nx.SetTangentialConstraintU(&Tu);
         Nx.SetTangentialConstraintV(&Tv);
 
-        Reset(obj_A, obj_B, cinfo, mat);
+        Reset(obj_A, obj_B, cinfo, mat, reactions);
     }
 
     ~ChContactNSC() {}
 
     /// Reinitialize this contact for reuse.
-    virtual void Reset(Ta* obj_A,                                ///< contactable object A
-                       Tb* obj_B,                                ///< contactable object B
-                       const ChCollisionInfo& cinfo,             ///< data for the collision pair
-                       const ChContactMaterialCompositeNSC& mat  ///< composite material
+    /// If provided, the reactions of the same contact at the previous step (matched by the contact container) are used
+    /// to warm start the solver.
+    virtual void Reset(Ta* obj_A,                                 ///< contactable object A
+                       Tb* obj_B,                                 ///< contactable object B
+                       const ChCollisionInfo& cinfo,              ///< data for the collision pair
+                       const ChContactMaterialCompositeNSC& mat,  ///< composite material
+                       const ChWrenchd* reactions = nullptr       ///< reactions at previous step (if persistent)
     ) {
         // Reset geometric information
         this->Reset_cinfo(obj_A, obj_B, cinfo);
@@ -114,12 +118,14 @@ class ChContactNSC : public ChContactTuple<Ta, Tb> {
         this->objB->ComputeJacobianForContactPart(this->p2, this->contact_plane, Nx.Get_tuple_b(), Tu.Get_tuple_b(),
                                                   Tv.Get_tuple_b(), true);
 
-        if (reactions_cache) {
+        // Initialize the reactions (used to warm start the solver) from the same contact at the previous step, if it
+        // was matched, or else from the reaction cache (if provided by the collision system)
+        if (reactions) {
+            react_force = reactions->force;
+        } else if (reactions_cache) {
             react_force.x() = reactions_cache[0];
             react_force.y() = reactions_cache[1];
             react_force.z() = reactions_cache[2];
-            // std::cout << "Reset Fn=" << (double)reactions_cache[0] << "  at cache address:" <<
-            // (int)this->reactions_cache << std::endl;
         } else {
             react_force = VNULL;
         }
@@ -56,26 +56,28 @@ class ChContactNSCrolling : public ChContactNSC<Ta, Tb> {
                         Ta* obj_A,                                 ///< contactable object A
                         Tb* obj_B,                                 ///< contactable object B
                         const ChCollisionInfo& cinfo,              ///< data for the collision pair
-                        const ChContactMaterialCompositeNSC& mat   ///< composite material
+                        const ChContactMaterialCompositeNSC& mat,  ///< composite material
+                        const ChWrenchd* reactions = nullptr       ///< reactions at previous step (if persistent)
                         )
-        : ChContactNSC<Ta, Tb>(contact_container, obj_A, obj_B, cinfo, mat) {
+        : ChContactNSC<Ta, Tb>(contact_container, obj_A, obj_B, cinfo, mat, reactions) {
         Rx.SetRollingConstraintU(&this->Ru);
         Rx.SetRollingConstraintV(&this->Rv);
         Rx.SetNormalConstraint(&this->Nx);
 
-        Reset(obj_A, obj_B, cinfo, mat);
+        Reset(obj_A, obj_B, cinfo, mat, reactions);
     }
 
     virtual ~ChContactNSCrolling() {}
 
     /// Reinitialize this contact for reuse.
-    virtual void Reset(Ta* obj_A,                                ///< contactable object A
-                       Tb* obj_B,                                ///< contactable object B
-                       const ChCollisionInfo& cinfo,             ///< data for the collision pair
-                       const ChContactMaterialCompositeNSC& mat  ///< composite material
+    virtual void Reset(Ta* obj_A,                                 ///< contactable object A
+                       Tb* obj_B,                                 ///< contactable object B
+                       const ChCollisionInfo& cinfo,              ///< data for the collision pair
+                       const ChContactMaterialCompositeNSC& mat,  ///< composite material
+                       const ChWrenchd* reactions = nullptr       ///< reactions at previous step (if persistent)
                        ) override {
         // Invoke base class method to reset normal and sliding constraints
-        ChContactNSC<Ta, Tb>::Reset(obj_A, obj_B, cinfo, mat);
+        ChContactNSC<Ta, Tb>::Reset(obj_A, obj_B, cinfo, mat, reactions);
 
         Rx.Get_tuple_a().SetVariables(*this->objA);
         Rx.Get_tuple_b().SetVariables(*this->objB);
@@ -101,7 +103,8 @@ class ChContactNSCrolling : public ChContactNSC<Ta, Tb> {
         this->objB->ComputeJacobianForRollingContactPart(this->p2, this->contact_plane, Rx.Get_tuple_b(),
                                                          Ru.Get_tuple_b(), Rv.Get_tuple_b(), true);
 
-        this->react_torque = VNULL;
+        // Initialize the rolling reactions from the same contact at the previous step, if it was matched
+        this->react_torque = reactions ? reactions->torque : VNULL;
     }
 
     /// Get the contact force, if computed, in contact coordinate system
@@ -0,0 +1,165 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#ifndef CH_CONTACT_POOL_H
+#define CH_CONTACT_POOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "chrono/collision/ChCollisionInfo.h"
+
+namespace chrono {
+
+/// Pooled storage for contacts of a given type, used by the NSC and SMC contact containers.
+/// Contact objects are constructed in place in fixed-size chunks of contiguous memory and, at each collision detection
+/// pass, the slots of the previous contacts are reused (through their Reset function) before new contact objects are
+/// constructed. Unused contacts are kept for subsequent passes; the pool is trimmed (see Trim) only when it becomes
+/// much larger than the number of contacts in use, e.g. after a transient peak in the number of contacts. As a result,
+/// the contacts of a given type are stored contiguously, are iterated without traversing a linked list, and their
+/// addresses remain valid while they are in use (the constraints of a contact hold pointers to each other, and
+/// pointers to contacts are passed to the reporting callbacks).
+///
+/// Dereferencing an iterator returns a pointer to a contact, so that the pool can be traversed with the same syntax as
+/// a container of contact pointers.
+template <class Tcont>
+class ChContactPool {
+  public:
+    static constexpr size_t chunk_size = 256;
+
+    ChContactPool() : m_num_used(0), m_num_constructed(0) {}
+    ~ChContactPool() { Clear(); }
+
+    // The contacts store pointers to their own members, so the pool cannot be copied.
+    ChContactPool(const ChContactPool&) = delete;
+    ChContactPool& operator=(const ChContactPool&) = delete;
+
+    /// Return the number of contacts currently in use.
+    size_t size() const { return m_num_used; }
+
+    /// Return true if no contacts are currently in use.
+    bool empty() const { return m_num_used == 0; }
+
+    /// Return the number of contact objects constructed in this pool (in use or available for reuse).
+    size_t capacity() const { return m_num_constructed; }
+
+    /// Access the i-th contact in use.
+    Tcont* operator[](size_t i) const {
+        return std::launder(reinterpret_cast<Tcont*>(&m_chunks[i / chunk_size][i % chunk_size]));
+    }
+
+    /// Mark all contacts as unused. Their slots will be reused by subsequent calls to Insert.
+    void Rewind() { m_num_used = 0; }
+
+    /// Add a contact, reusing the next available slot or constructing a new contact object if none is available.
+    /// The state of the same contact at the previous step, if it can be matched, is obtained from the container (see
+    /// GetContactHistory in the NSC and SMC contact containers) and passed to the contact.
+    /// Return a pointer to the (re)initialized contact.
+    template <class Tcontainer, class Ta, class Tb, class Tmat>
+    Tcont* Insert(Tcontainer* container, Ta* objA, Tb* objB, const ChCollisionInfo& cinfo, const Tmat& cmat) {
+        auto history = container->GetContactHistory(cinfo);
+        Tcont* contact;
+        if (m_num_used < m_num_constructed) {
+            // reuse old contact
+            contact = (*this)[m_num_used];
+            contact->Reset(objA, objB, cinfo, cmat, history);
+        } else {
+            // construct new contact (allocate a new chunk if needed)
+            if (m_num_constructed == m_chunks.size() * chunk_size)
+                m_chunks.push_back(std::unique_ptr<Slot[]>(new Slot[chunk_size]));
+            contact = new (&m_chunks[m_num_constructed / chunk_size][m_num_constructed % chunk_size])
+                Tcont(container, objA, objB, cinfo, cmat, history);
+            m_num_constructed++;
+        }
+        m_num_used++;
+        return contact;
+    }
+
+    /// Destroy the unused contact objects in excess of the specified reserve and release the corresponding chunks.
+    void Shrink(size_t reserve = 0) {
+        size_t keep = m_num_used + reserve;
+        if (keep >= m_num_constructed)
+            return;
+        for (size_t i = keep; i < m_num_constructed; i++)
+            (*this)[i]->~Tcont();
+        m_num_constructed = keep;
+        m_chunks.resize((keep + chunk_size - 1) / chunk_size);
+    }
+
+    /// Release the unused contact objects if their number is much larger than the number of contacts in use.
+    /// Trimming is triggered when more than 4 times the number of contacts in use (and at least 2 chunks) are
+    /// constructed; a reserve of unused contacts equal to the number of contacts in use (at least one chunk) is kept,
+    /// so that small fluctuations in the number of contacts do not cause repeated allocations.
+    void Trim() {
+        size_t reserve = std::max(m_num_used, chunk_size);
+        if (m_num_constructed > 2 * (m_num_used + reserve))
+            Shrink(reserve);
+    }
+
+    /// Destroy all contact objects and release all memory.
+    void Clear() {
+        m_num_used = 0;
+        Shrink(0);
+    }
+
+    /// Forward iterator over the contacts in use. Dereferencing returns a contact pointer.
+    class iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Tcont*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Tcont**;
+        using reference = Tcont*;
+
+        iterator(const ChContactPool* pool, size_t index) : m_pool(pool), m_index(index) {}
+
+        Tcont* operator*() const { return (*m_pool)[m_index]; }
+        iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator tmp(*this);
+            ++m_index;
+            return tmp;
+        }
+        bool operator==(const iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+      private:
+        const ChContactPool* m_pool;
+        size_t m_index;
+    };
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, m_num_used); }
+
+  private:
+    /// Uninitialized storage for one contact object, with proper alignment.
+    struct alignas(Tcont) Slot {
+        unsigned char data[sizeof(Tcont)];
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> m_chunks;  ///< chunks of contact slots
+    size_t m_num_used;                              ///< number of contacts currently in use
+    size_t m_num_constructed;                       ///< number of constructed contact objects
+};
+
+}  // end namespace chrono
+
+#endif
@@ -22,6 +22,7 @@
 #include <cmath>
 #include <algorithm>
 #include <limits>
+#include <typeinfo>
 
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/core/ChFrame.h"
@@ -36,14 +37,13 @@
 
 namespace chrono {
 
-class ChContactContainerSMC;
-
 /// Default implementation of the SMC normal and tangential force calculation.
 class ChDefaultContactForceTorqueSMC : public ChSystemSMC::ChContactForceTorqueSMC {
   public:
     /// Default SMC force calculation algorithm.
     /// This implementation depends on various settings specified at the ChSystemSMC level (such as normal force model,
     /// tangential force model, use of material physical properties, etc).
+    /// Without contact history, the MultiStep tangential displacement model reduces to the OneStep model.
     virtual ChWrenchd CalculateForceTorque(
         const ChSystemSMC& sys,                    ///< containing system
         const ChVector3d& normal_dir,              ///< normal contact direction (expressed in global frame)
@@ -58,6 +58,32 @@ class ChDefaultContactForceTorqueSMC : public ChSystemSMC::ChContactForceTorqueS
         double mass2,                              ///< mass of obj2
         ChContactable* objA,                       ///< pointer to contactable obj1
         ChContactable* objB                        ///< pointer to contactable obj2
+    ) const override {
+        ChVector3d tdispl(0);
+        return CalculateForceTorqueWithHistory(sys, normal_dir, p1, p2, vel1, vel2, mat, delta, eff_radius, mass1,
+                                               mass2, objA, objB, tdispl);
+    }
+
+    /// Default SMC force calculation algorithm, using the tangential displacement history.
+    /// With the MultiStep tangential displacement model, the accumulated tangential displacement is rotated onto the
+    /// current tangent plane and incremented with the relative tangential displacement over the current step. The
+    /// tangential force is limited by the Coulomb law, in which case the tangential displacement is scaled back
+    /// accordingly.
+    virtual ChWrenchd CalculateForceTorqueWithHistory(
+        const ChSystemSMC& sys,                    ///< containing system
+        const ChVector3d& normal_dir,              ///< normal contact direction (expressed in global frame)
+        const ChVector3d& p1,                      ///< most penetrated point on obj1 (expressed in global frame)
+        const ChVector3d& p2,                      ///< most penetrated point on obj2 (expressed in global frame)
+        const ChVector3d& vel1,                    ///< velocity of contact point on obj1 (expressed in global frame)
+        const ChVector3d& vel2,                    ///< velocity of contact point on obj2 (expressed in global frame)
+        const ChContactMaterialCompositeSMC& mat,  ///< composite material for contact pair
+        double delta,                              ///< overlap in normal direction
+        double eff_radius,                         ///< effective radius of curvature at contact
+        double mass1,                              ///< mass of obj1
+        double mass2,                              ///< mass of obj2
+        ChContactable* objA,                       ///< pointer to contactable obj1
+        ChContactable* objB,                       ///< pointer to contactable obj2
+        ChVector3d& tdispl                         ///< [in/out] accumulated tangential displacement
     ) const override {
         // Set contact force to zero if no penetration.
         if (delta <= 0) {
@@ -89,6 +115,8 @@ class ChDefaultContactForceTorqueSMC : public ChSystemSMC::ChContactForceTorqueS
         double kt = 0;
         double gn = 0;
         double gt = 0;
+        double pk = 0;
+        double pg = 0;
 
         double eps = std::numeric_limits<double>::epsilon();
 
@@ -96,44 +124,8 @@ class ChDefaultContactForceTorqueSMC : public ChSystemSMC::ChContactForceTorqueS
             case ChSystemSMC::Flores:
                 // Currently not implemented.  Fall through to Hooke.
             case ChSystemSMC::Hooke:
-                if (use_mat_props) {
-                    double tmp_k = (16.0 / 15) * std::sqrt(eff_radius) * mat.E_eff;
-                    double v2 = sys.GetCharacteristicImpactVelocity() * sys.GetCharacteristicImpactVelocity();
-                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
-                    loge = (mat.cr_eff > 1 - eps) ? std::log(1 - eps) : loge;
-                    double tmp_g = 1 + std::pow(CH_PI / loge, 2);
-                    kn = tmp_k * std::pow(eff_mass * v2 / tmp_k, 1.0 / 5);
-                    kt = kn;
-                    gn = std::sqrt(4 * eff_mass * kn / tmp_g);
-                    gt = gn;
-                } else {
-                    kn = mat.kn;
-                    kt = mat.kt;
-                    gn = eff_mass * mat.gn;
-                    gt = eff_mass * mat.gt;
-                }
-
-                break;
-
             case ChSystemSMC::Hertz:
-                if (use_mat_props) {
-                    double sqrt_Rd = std::sqrt(eff_radius * delta);
-                    double Sn = 2 * mat.E_eff * sqrt_Rd;
-                    double St = 8 * mat.G_eff * sqrt_Rd;
-                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
-                    double beta = loge / std::sqrt(loge * loge + CH_PI * CH_PI);
-                    kn = (2.0 / 3) * Sn;
-                    kt = St;
-                    gn = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * eff_mass);
-                    gt = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(St * eff_mass);
-                } else {
-                    double tmp = eff_radius * std::sqrt(delta);
-                    kn = tmp * mat.kn;
-                    kt = tmp * mat.kt;
-                    gn = tmp * eff_mass * mat.gn;
-                    gt = tmp * eff_mass * mat.gt;
-                }
-
+                CalculateCoefficients(sys, mat, delta, eff_radius, eff_mass, kn, kt, gn, gt, pk, pg);
                 break;
 
             case ChSystemSMC::PlainCoulomb:
@@ -182,10 +174,18 @@ class ChDefaultContactForceTorqueSMC : public ChSystemSMC::ChContactForceTorqueS
             case ChSystemSMC::OneStep:
                 delta_t = relvel_t_mag * dT;
                 break;
-            case ChSystemSMC::MultiStep:
-                //// TODO: implement proper MultiStep mode
-                delta_t = relvel_t_mag * dT;
+            case ChSystemSMC::MultiStep: {
+                // Rotate the accumulated displacement onto the current tangent plane (preserving its magnitude) and
+                // add the relative tangential displacement over the current step
+                double tdispl_mag = tdispl.Length();
+                tdispl -= tdispl.Dot(normal_dir) * normal_dir;
+                double tdispl_t_mag = tdispl.Length();
+                if (tdispl_t_mag > eps)
+                    tdispl *= tdispl_mag / tdispl_t_mag;
+                tdispl += relvel_t * dT;
+                delta_t = tdispl.Length();
                 break;
+            }
             default:
                 break;
         }
@@ -196,7 +196,8 @@ class ChDefaultContactForceTorqueSMC : public ChSystemSMC::ChContactForceTorqueS
 
         // If the resulting normal contact force is negative, the two shapes are moving
         // away from each other so fast that no contact force is generated.
-        if (forceN < 0) {
+        bool separating = forceN < 0;
+        if (separating) {
             forceN = 0;
             forceT = 0;
         }
@@ -213,6 +214,24 @@ class ChDefaultContactForceTorqueSMC : public ChSystemSMC::ChContactForceTorqueS
                 break;
         }
 
+        // Tangential force from the accumulated tangential displacement (MultiStep model)
+        if (tdispl_model == ChSystemSMC::MultiStep) {
+            ChVector3d forceT_vec(0);
+            if (!separating)
+                forceT_vec = -kt * tdispl - gt * relvel_t;
+
+            // Coulomb law (on sliding, scale back the accumulated displacement to match the limited force)
+            double forceT_max = mat.mu_eff * std::abs(forceN);
+            double forceT_mag = forceT_vec.Length();
+            if (forceT_mag > forceT_max) {
+                forceT_vec *= forceT_max / forceT_mag;
+                if (kt > eps)
+                    tdispl = -(forceT_vec + gt * relvel_t) / kt;
+            }
+
+            return {forceN * normal_dir + forceT_vec, VNULL};  // zero torque anyway
+        }
+
         // Coulomb law
         forceT = std::min<double>(forceT, mat.mu_eff * std::abs(forceN));
 
@@ -223,6 +242,246 @@ class ChDefaultContactForceTorqueSMC : public ChSystemSMC::ChContactForceTorqueS
 
         return {force, VNULL};  // zero torque anyway
     }
+
+    /// Jacobians of the default SMC contact force.
+    /// Closed-form Jacobians are provided for the Hooke, Hertz, and Flores normal force models (with any tangential
+    /// displacement and adhesion model). For the PlainCoulomb model, this function returns false (finite-difference
+    /// approximation). The closed-form Jacobians are used only if UseClosedFormJacobians returns true, so that classes
+    /// deriving from ChDefaultContactForceTorqueSMC and overriding only the force calculation fall back to finite
+    /// differences.
+    virtual bool CalculateForceJacobians(
+        const ChSystemSMC& sys,                    ///< containing system
+        const ChVector3d& normal_dir,              ///< normal contact direction (expressed in global frame)
+        const ChVector3d& p1,                      ///< most penetrated point on obj1 (expressed in global frame)
+        const ChVector3d& p2,                      ///< most penetrated point on obj2 (expressed in global frame)
+        const ChVector3d& vel1,                    ///< velocity of contact point on obj1 (expressed in global frame)
+        const ChVector3d& vel2,                    ///< velocity of contact point on obj2 (expressed in global frame)
+        const ChContactMaterialCompositeSMC& mat,  ///< composite material for contact pair
+        double delta,                              ///< overlap in normal direction
+        double eff_radius,                         ///< effective radius of curvature at contact
+        double mass1,                              ///< mass of obj1
+        double mass2,                              ///< mass of obj2
+        ChContactable* objA,                       ///< pointer to contactable obj1
+        ChContactable* objB,                       ///< pointer to contactable obj2
+        const ChVector3d& tdispl,                  ///< accumulated tangential displacement
+        ChMatrix33<>& dF_dp,                       ///< [out] Jacobian of contact force w.r.t. p1 - p2
+        ChMatrix33<>& dF_dv                        ///< [out] Jacobian of contact force w.r.t. vel2 - vel1
+    ) const override {
+        dF_dp.setZero();
+        dF_dv.setZero();
+
+        // The closed-form Jacobians may not match the force calculated by a derived class
+        if (!UseClosedFormJacobians())
+            return false;
+
+        // No contact force (and zero Jacobians) if no penetration.
+        if (delta <= 0)
+            return true;
+
+        ChSystemSMC::ContactForceModel contact_model = sys.GetContactForceModel();
+        if (contact_model == ChSystemSMC::PlainCoulomb)
+            return false;
+
+        // Extract parameters from containing system
+        double dT = sys.GetStep();
+        ChSystemSMC::AdhesionForceModel adhesion_model = sys.GetAdhesionForceModel();
+        ChSystemSMC::TangentialDisplacementModel tdispl_model = sys.GetTangentialDisplacementModel();
+
+        double eps = std::numeric_limits<double>::epsilon();
+        const ChVector3d& n = normal_dir;
+        ChMatrix33<> I(1.0);
+
+        // Relative velocity at contact
+        ChVector3d relvel = vel2 - vel1;
+        double relvel_n_mag = relvel.Dot(n);
+        ChVector3d relvel_t = relvel - relvel_n_mag * n;
+        double relvel_t_mag = relvel_t.Length();
+
+        // Stiffness and damping coefficients and their derivatives with respect to the overlap
+        double eff_mass = mass1 * mass2 / (mass1 + mass2);
+        double kn, kt, gn, gt, pk, pg;
+        CalculateCoefficients(sys, mat, delta, eff_radius, eff_mass, kn, kt, gn, gt, pk, pg);
+        double dkn = pk * kn / delta;
+        double dkt = pk * kt / delta;
+        double dgn = pg * gn / delta;
+        double dgt = pg * gt / delta;
+
+        // Derivatives of the normal direction and of the tangential relative velocity.
+        // With d = p1 - p2, we have delta = |d| and n = d / delta, so that ddelta/dd = n^T and dn/dd = P / delta,
+        // with P = I - n * n^T the projection onto the tangent plane.
+        ChMatrix33<> P = I - TensorProduct(n, n);
+        ChMatrix33<> dn_dp = P / delta;
+        ChMatrix33<> dvt_dp = -(TensorProduct(n, relvel_t) + relvel_n_mag * P) / delta;
+        const ChMatrix33<>& dvt_dv = P;
+
+        // Normal force magnitude and its gradients
+        double forceN = kn * delta - gn * relvel_n_mag;
+        ChVector3d dfN_dp(0);
+        ChVector3d dfN_dv(0);
+        bool separating = forceN < 0;
+        if (separating) {
+            forceN = 0;
+        } else {
+            dfN_dp = (dkn * delta + kn - dgn * relvel_n_mag) * n - (gn / delta) * relvel_t;
+            dfN_dv = -gn * n;
+        }
+
+        // Adhesion force (constant)
+        switch (adhesion_model) {
+            case ChSystemSMC::AdhesionForceModel::Perko:
+                // Currently not implemented.  Fall through to Constant.
+            case ChSystemSMC::AdhesionForceModel::Constant:
+                forceN -= mat.adhesion_eff;
+                break;
+            case ChSystemSMC::AdhesionForceModel::DMT:
+                forceN -= mat.adhesionMultDMT_eff * sqrt(eff_radius);
+                break;
+        }
+
+        // Normal force: F_n = forceN * n
+        dF_dp = TensorProduct(n, dfN_dp) + forceN * dn_dp;
+        dF_dv = TensorProduct(n, dfN_dv);
+
+        if (separating)
+            return true;
+
+        // Coulomb limit and its derivatives
+        double sign_N = (forceN < 0) ? -1.0 : 1.0;
+        double forceT_max = mat.mu_eff * std::abs(forceN);
+
+        // Tangential force from the accumulated tangential displacement (MultiStep model)
+        if (tdispl_model == ChSystemSMC::MultiStep) {
+            // Accumulated displacement, rotated onto the current tangent plane, and its derivatives
+            double tdispl_mag = tdispl.Length();
+            ChVector3d tdispl_t = tdispl - tdispl.Dot(n) * n;
+            double tdispl_t_mag = tdispl_t.Length();
+            ChMatrix33<> dtt_dn = -tdispl.Dot(n) * I - TensorProduct(n, tdispl);
+            ChMatrix33<> dtd_dp = dtt_dn * dn_dp;
+            ChVector3d td = tdispl_t;
+            if (tdispl_t_mag > eps) {
+                double scale = tdispl_mag / tdispl_t_mag;
+                ChVector3d u = tdispl_t / tdispl_t_mag;
+                td *= scale;
+                dtd_dp = scale * (I - TensorProduct(u, u)) * dtd_dp;
+            }
+            td += relvel_t * dT;
+            dtd_dp += dT * dvt_dp;
+            ChMatrix33<> dtd_dv = dT * dvt_dv;
+
+            // Tangential force: F_t = -kt * td - gt * v_t
+            ChVector3d forceT_vec = -kt * td - gt * relvel_t;
+            ChMatrix33<> dFt_dp = -kt * dtd_dp - dkt * TensorProduct(td, n) -  //
+                                  gt * dvt_dp - dgt * TensorProduct(relvel_t, n);
+            ChMatrix33<> dFt_dv = -kt * dtd_dv - gt * dvt_dv;
+
+            double forceT_mag = forceT_vec.Length();
+            if (forceT_mag > forceT_max) {
+                // Sliding: F_t = forceT_max * h, with h the unit vector along the unlimited tangential force
+                ChVector3d h = forceT_vec / forceT_mag;
+                ChMatrix33<> dh = (I - TensorProduct(h, h)) / forceT_mag;
+                dF_dp += mat.mu_eff * sign_N * TensorProduct(h, dfN_dp) + forceT_max * dh * dFt_dp;
+                dF_dv += mat.mu_eff * sign_N * TensorProduct(h, dfN_dv) + forceT_max * dh * dFt_dv;
+            } else {
+                dF_dp += dFt_dp;
+                dF_dv += dFt_dv;
+            }
+
+            return true;
+        }
+
+        // Tangential force: F_t = -c * v_t (with c = kt * dT + gt for the OneStep model and c = gt otherwise)
+        if (relvel_t_mag < sys.GetSlipVelocityThreshold())
+            return true;
+
+        double c = gt;
+        double dc = dgt;
+        if (tdispl_model == ChSystemSMC::OneStep) {
+            c += kt * dT;
+            dc += dkt * dT;
+        }
+
+        if (c * relvel_t_mag <= forceT_max) {
+            dF_dp -= dc * TensorProduct(relvel_t, n) + c * dvt_dp;
+            dF_dv -= c * dvt_dv;
+        } else {
+            // Sliding: F_t = -forceT_max * t, with t the unit vector along the tangential relative velocity
+            ChVector3d t = relvel_t / relvel_t_mag;
+            ChMatrix33<> dt = (I - TensorProduct(t, t)) / relvel_t_mag;
+            dF_dp -= mat.mu_eff * sign_N * TensorProduct(t, dfN_dp) + forceT_max * dt * dvt_dp;
+            dF_dv -= mat.mu_eff * sign_N * TensorProduct(t, dfN_dv) + forceT_max * dt * dvt_dv;
+        }
+
+        return true;
+    }
+
+  protected:
+    /// Return true if the closed-form Jacobians of the default force calculation can be used.
+    /// By default, this is true only for an object of exact type ChDefaultContactForceTorqueSMC. A derived class which
+    /// does not change the contact force (as calculated by CalculateForceTorqueWithHistory) can opt in by overriding
+    /// this function to return true.
+    virtual bool UseClosedFormJacobians() const { return typeid(*this) == typeid(ChDefaultContactForceTorqueSMC); }
+
+    /// Calculate the stiffness and damping coefficients for the Hooke (also used for Flores) and Hertz models.
+    /// The stiffness coefficients kn and kt vary with the overlap as delta^pk and the damping coefficients gn and gt
+    /// as delta^pg. The exponents are used in calculating the force Jacobians.
+    static void CalculateCoefficients(const ChSystemSMC& sys,
+                                      const ChContactMaterialCompositeSMC& mat,
+                                      double delta,
+                                      double eff_radius,
+                                      double eff_mass,
+                                      double& kn,
+                                      double& kt,
+                                      double& gn,
+                                      double& gt,
+                                      double& pk,
+                                      double& pg) {
+        bool use_mat_props = sys.UsingMaterialProperties();
+        double eps = std::numeric_limits<double>::epsilon();
+
+        if (sys.GetContactForceModel() == ChSystemSMC::Hertz) {
+            if (use_mat_props) {
+                double sqrt_Rd = std::sqrt(eff_radius * delta);
+                double Sn = 2 * mat.E_eff * sqrt_Rd;
+                double St = 8 * mat.G_eff * sqrt_Rd;
+                double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
+                double beta = loge / std::sqrt(loge * loge + CH_PI * CH_PI);
+                kn = (2.0 / 3) * Sn;
+                kt = St;
+                gn = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * eff_mass);
+                gt = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(St * eff_mass);
+                pk = 0.5;
+                pg = 0.25;
+            } else {
+                double tmp = eff_radius * std::sqrt(delta);
+                kn = tmp * mat.kn;
+                kt = tmp * mat.kt;
+                gn = tmp * eff_mass * mat.gn;
+                gt = tmp * eff_mass * mat.gt;
+                pk = 0.5;
+                pg = 0.5;
+            }
+            return;
+        }
+
+        if (use_mat_props) {
+            double tmp_k = (16.0 / 15) * std::sqrt(eff_radius) * mat.E_eff;
+            double v2 = sys.GetCharacteristicImpactVelocity() * sys.GetCharacteristicImpactVelocity();
+            double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
+            loge = (mat.cr_eff > 1 - eps) ? std::log(1 - eps) : loge;
+            double tmp_g = 1 + std::pow(CH_PI / loge, 2);
+            kn = tmp_k * std::pow(eff_mass * v2 / tmp_k, 1.0 / 5);
+            kt = kn;
+            gn = std::sqrt(4 * eff_mass * kn / tmp_g);
+            gt = gn;
+        } else {
+            kn = mat.kn;
+            kt = mat.kt;
+            gn = eff_mass * mat.gn;
+            gt = eff_mass * mat.gt;
+        }
+        pk = 0;
+        pg = 0;
+    }
 };
 
 /// Class for smooth (penalty-based) contact between two generic contactable objects.
@@ -240,25 +499,33 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         ChMatrixDynamic<double> m_R;  ///< R = dQ/dv
     };
 
-    ChContactContainerSMC* container;  ///< associated contact container
+    ChContactContainer* container;  ///< associated contact container
 
     ChVector3d m_force;        ///< contact force on objB
     ChVector3d m_torque;       ///< contact torque on objB
     ChContactJacobian* m_Jac;  ///< contact Jacobian data
 
+    ChVector3d m_tdispl;       ///< accumulated tangential displacement (expressed in global frame)
+    ChVector3d m_tdispl_prev;  ///< accumulated tangential displacement at the previous step
+
   public:
-    ChContactSMC() : m_Jac(NULL) {}
+    ChContactSMC() : m_Jac(NULL), m_tdispl(VNULL), m_tdispl_prev(VNULL) {}
 
-    ChContactSMC(ChContactContainerSMC* contact_container,  ///< contact container
+    ChContactSMC(ChContactContainer* contact_container,      ///< contact container
                  Ta* obj_A,                                 ///< contactable object A
                  Tb* obj_B,                                 ///< contactable object B
                  const ChCollisionInfo& cinfo,              ///< data for the collision pair
-                 const ChContactMaterialCompositeSMC& mat   ///< composite material
+                 const ChContactMaterialCompositeSMC& mat,  ///< composite material
+                 const ChVector3d* tdispl = nullptr         ///< tangential displacement at previous step
                  )
-        : ChContactTuple<Ta, Tb>(obj_A, obj_B), container(contact_container), m_Jac(NULL) {
+        : ChContactTuple<Ta, Tb>(obj_A, obj_B),
+          container(contact_container),
+          m_Jac(NULL),
+          m_tdispl(VNULL),
+          m_tdispl_prev(VNULL) {
         assert(contact_container);
 
-        Reset(obj_A, obj_B, cinfo, mat);
+        Reset(obj_A, obj_B, cinfo, mat, tdispl);
     }
 
     ~ChContactSMC() { delete m_Jac; }
@@ -278,16 +545,22 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
     /// Get the contact torque, expressed in the absolute frame
     ChVector3d GetContactTorqueAbs() const { return m_torque; }
 
+    /// Get the accumulated tangential displacement, expressed in the absolute frame (MultiStep model only).
+    const ChVector3d& GetTangentialDisplacement() const { return m_tdispl; }
+
     /// Access the proxy to the Jacobian.
     const ChKRMBlock* GetJacobianKRM() const { return m_Jac ? &(m_Jac->m_KRM) : NULL; }
     const ChMatrixDynamic<double>* GetJacobianK() const { return m_Jac ? &(m_Jac->m_K) : NULL; }
     const ChMatrixDynamic<double>* GetJacobianR() const { return m_Jac ? &(m_Jac->m_R) : NULL; }
 
     /// Reinitialize this contact for reuse.
-    void Reset(Ta* obj_A,                                ///< contactable object A
-               Tb* obj_B,                                ///< contactable object B
-               const ChCollisionInfo& cinfo,             ///< data for the collision pair
-               const ChContactMaterialCompositeSMC& mat  ///< composite material
+    /// If provided, the accumulated tangential displacement of the same contact at the previous step (matched by the
+    /// contact container) is used as contact history.
+    void Reset(Ta* obj_A,                                 ///< contactable object A
+               Tb* obj_B,                                 ///< contactable object B
+               const ChCollisionInfo& cinfo,              ///< data for the collision pair
+               const ChContactMaterialCompositeSMC& mat,  ///< composite material
+               const ChVector3d* tdispl = nullptr         ///< tangential displacement at previous step
     ) {
         // Reset geometric information
         this->Reset_cinfo(obj_A, obj_B, cinfo);
@@ -295,13 +568,18 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         // Note: cinfo.distance is the same as this->norm_dist.
         assert(cinfo.distance < 0);
 
-        // Calculate contact force.
+        // Tangential displacement history of a persistent contact (zero for a new contact)
+        m_tdispl_prev = tdispl ? *tdispl : VNULL;
+        m_tdispl = m_tdispl_prev;
+
+        // Calculate contact force (and update the tangential displacement history).
         auto wrench =
             CalculateForceTorque(-this->norm_dist,                            // overlap (here, always positive)
                                  this->normal,                                // normal contact direction
                                  this->objA->GetContactPointSpeed(this->p1),  // velocity of contact point on objA
                                  this->objB->GetContactPointSpeed(this->p2),  // velocity of contact point on objB
-                                 mat                                          // composite material for contact pair
+                                 mat,                                         // composite material for contact pair
+                                 m_tdispl                                     // accumulated tangential displacement
             );
         m_force = wrench.force;
         m_torque = wrench.torque;
@@ -315,11 +593,12 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
 
     /// Calculate contact force, and maybe torque too, expressed in absolute coordinates.
     ChWrenchd CalculateForceTorque(
-        double delta,                             ///< overlap in normal direction
-        const ChVector3d& normal_dir,             ///< normal contact direction (expressed in global frame)
-        const ChVector3d& vel1,                   ///< velocity of contact point on objA (expressed in global frame)
-        const ChVector3d& vel2,                   ///< velocity of contact point on objB (expressed in global frame)
-        const ChContactMaterialCompositeSMC& mat  ///< composite material for contact pair
+        double delta,                              ///< overlap in normal direction
+        const ChVector3d& normal_dir,              ///< normal contact direction (expressed in global frame)
+        const ChVector3d& vel1,                    ///< velocity of contact point on objA (expressed in global frame)
+        const ChVector3d& vel2,                    ///< velocity of contact point on objB (expressed in global frame)
+        const ChContactMaterialCompositeSMC& mat,  ///< composite material for contact pair
+        ChVector3d& tdispl                         ///< [in/out] accumulated tangential displacement
     ) {
         // Set contact force to zero if no penetration.
         if (delta <= 0) {
@@ -328,9 +607,9 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
 
         // Use current SMC algorithm to calculate the force
         ChSystemSMC* sys = static_cast<ChSystemSMC*>(this->container->GetSystem());
-        return sys->GetContactForceTorqueAlgorithm().CalculateForceTorque(
+        return sys->GetContactForceTorqueAlgorithm().CalculateForceTorqueWithHistory(
             *sys, normal_dir, this->p1, this->p2, vel1, vel2, mat, delta, this->eff_radius,
-            this->objA->GetContactableMass(), this->objB->GetContactableMass(), this->objA, this->objB);
+            this->objA->GetContactableMass(), this->objB->GetContactableMass(), this->objA, this->objB, tdispl);
     }
 
     /// Compute all forces in a contiguous array.
@@ -374,8 +653,9 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         ChVector3d vel1 = this->objA->GetContactPointSpeed(p1_loc, stateA_x, stateA_w);
         ChVector3d vel2 = this->objB->GetContactPointSpeed(p2_loc, stateB_x, stateB_w);
 
-        // Compute the contact force and torque
-        auto wrench = CalculateForceTorque(delta, normal_dir, vel1, vel2, mat);
+        // Compute the contact force and torque (starting from the tangential displacement at the previous step)
+        ChVector3d tdispl = m_tdispl_prev;
+        auto wrench = CalculateForceTorque(delta, normal_dir, vel1, vel2, mat, tdispl);
         auto force = wrench.force;
         auto torque = wrench.torque;
 
@@ -417,12 +697,70 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
     }
 
     /// Calculate Jacobian of generalized contact forces.
+    /// Use closed-form expressions if provided by the current SMC force algorithm and a finite-difference approximation
+    /// otherwise. Note that we only calculate these Jacobians whenever the contact force itself is calculated, that is
+    /// only once per step.  The Jacobian of generalized contact forces will therefore be constant over the time step.
     void CalculateJacobians(const ChContactMaterialCompositeSMC& mat) {
+        if (!CalculateJacobiansAnalytic(mat))
+            CalculateJacobiansFD(mat);
+    }
+
+    /// Calculate Jacobian of generalized contact forces from the Jacobians of the contact force.
+    /// With G = [dp1/dwA, -dp2/dwB] the Jacobian of the relative position of the contact points, the generalized
+    /// contact forces are Q = -G^T * F, so that K = G^T * dF/dp * G and R = -G^T * dF/dv * G. Here, the variation of
+    /// G itself (i.e., the geometric stiffness due to the change in the contact point moment arms) is neglected.
+    /// Return false if the force algorithm does not provide the contact force Jacobians.
+    bool CalculateJacobiansAnalytic(const ChContactMaterialCompositeSMC& mat) {
+        // Normal direction and penetration depth, consistent with CalculateQ.
+        ChVector3d d = this->p1 - this->p2;
+        double delta = d.Length();
+        if (delta < std::numeric_limits<double>::epsilon())
+            return false;
+        ChVector3d normal_dir = d / delta;
+
+        // If the normal direction flipped sign, there is no contact force (and K = R = 0).
+        if (Vdot(normal_dir, this->normal) < 0)
+            return true;
+
+        ChSystemSMC* sys = static_cast<ChSystemSMC*>(this->container->GetSystem());
+        ChMatrix33<> dF_dp;
+        ChMatrix33<> dF_dv;
+        if (!sys->GetContactForceTorqueAlgorithm().CalculateForceJacobians(
+                *sys, normal_dir, this->p1, this->p2, this->objA->GetContactPointSpeed(this->p1),
+                this->objB->GetContactPointSpeed(this->p2), mat, delta, this->eff_radius,
+                this->objA->GetContactableMass(), this->objB->GetContactableMass(), this->objA, this->objB,
+                m_tdispl_prev, dF_dp, dF_dv))
+            return false;
+
+        // Get states for objA and objB
+        int ndofA_w = this->objA->GetContactableNumCoordsVelLevel();
+        int ndofB_w = this->objB->GetContactableNumCoordsVelLevel();
+        ChState stateA_x(this->objA->GetContactableNumCoordsPosLevel(), NULL);
+        ChState stateB_x(this->objB->GetContactableNumCoordsPosLevel(), NULL);
+        this->objA->ContactableGetStateBlockPosLevel(stateA_x);
+        this->objB->ContactableGetStateBlockPosLevel(stateB_x);
+
+        // Load G row by row, as the generalized forces corresponding to unit contact forces
+        ChMatrixDynamic<double> G(3, ndofA_w + ndofB_w);
+        ChVectorDynamic<> Q(ndofA_w + ndofB_w);
+        for (int k = 0; k < 3; k++) {
+            ChVector3d e(0);
+            e[k] = 1;
+            this->objA->ContactComputeQ(e, VNULL, this->p1, stateA_x, Q, 0);
+            this->objB->ContactComputeQ(-e, VNULL, this->p2, stateB_x, Q, ndofA_w);
+            G.row(k) = Q.transpose();
+        }
+
+        m_Jac->m_K = G.transpose() * dF_dp * G;
+        m_Jac->m_R = -G.transpose() * dF_dv * G;
+
+        return true;
+    }
+
+    /// Calculate a finite-difference approximation of the Jacobian of generalized contact forces.
+    void CalculateJacobiansFD(const ChContactMaterialCompositeSMC& mat) {
         // Compute a finite-difference approximations to the Jacobians of the contact forces and
         // load dQ/dx into m_Jac->m_K and dQ/dw into m_Jac->m_R.
-        // Note that we only calculate these Jacobians whenever the contact force itself is calculated,
-        // that is only once per step.  The Jacobian of generalized contact forces will therefore be
-        // constant over the time step.
 
         // Get states for objA
         int ndofA_x = this->objA->GetContactableNumCoordsPosLevel();
@@ -445,14 +783,16 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         CalculateQ(stateA_x, stateA_w, stateB_x, stateB_w, mat, Q0);
 
         // Finite-difference approximation perturbation.
-        // Note that ChState and ChStateDelta are set to 0 on construction.
-        // To accommodate objects with quaternion states, use the method ContactableIncrementState while
-        // calculating Jacobian columns corresponding to position states.
+        // Note that ChState and ChStateDelta are not initialized on construction, so the perturbation vectors must be
+        // explicitly set to 0. To accommodate objects with quaternion states, use the method ContactableIncrementState
+        // while calculating Jacobian columns corresponding to position states.
         double perturbation = 1e-5;
         ChState stateA_x1(ndofA_x, NULL);
         ChState stateB_x1(ndofB_x, NULL);
         ChStateDelta prtrbA(ndofA_w, NULL);
         ChStateDelta prtrbB(ndofB_w, NULL);
+        prtrbA.setZero(ndofA_w, NULL);
+        prtrbB.setZero(ndofB_w, NULL);
 
         ChVectorDynamic<> Q1(ndofA_w + ndofB_w);
 
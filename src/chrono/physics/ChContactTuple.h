@@ -44,6 +44,8 @@ class ChContactTuple {
     double norm_dist;   ///< penetration distance (negative if going inside) after refining
     double eff_radius;  ///< effective radius of curvature at contact
 
+    ChContactKey key;  ///< persistent contact identifier (feature_id = 0 if not provided by the collision system)
+
   public:
     ChContactTuple() {}
 
@@ -71,6 +73,10 @@ class ChContactTuple {
         this->norm_dist = cinfo.distance;
         this->eff_radius = cinfo.eff_radius;
 
+        this->key.shapeA = cinfo.shapeA;
+        this->key.shapeB = cinfo.shapeB;
+        this->key.feature_id = cinfo.feature_id;
+
         // Contact plane
         contact_plane.SetFromAxisX(normal, VECT_Y);
     }
@@ -113,6 +119,13 @@ class ChContactTuple {
     /// Get the effective radius of curvature.
     double GetEffectiveCurvatureRadius() const { return eff_radius; }
 
+    /// Get the key identifying this contact across collision detection passes.
+    const ChContactKey& GetContactKey() const { return key; }
+
+    /// Return true if this contact can be matched across collision detection passes.
+    /// This requires a collision system which reports persistent contact identifiers (e.g., Bullet).
+    bool IsPersistent() const { return key.feature_id != 0; }
+
     /// Get the contact force, if computed, in contact coordinate system
     virtual ChVector3d GetContactForce() const { return ChVector3d(0); }
 
@@ -39,6 +39,16 @@ ChFramed ChLink::GetFrame2Abs() const {
     return GetFrame2Rel() >> *m_body2;
 }
 
+bool ChLink::IsSleeping() const {
+    auto body1 = dynamic_cast<ChBody*>(m_body1);
+    auto body2 = dynamic_cast<ChBody*>(m_body2);
+    if (!body1 || !body2)
+        return false;
+    if (!body1->IsSleeping() && !body2->IsSleeping())
+        return false;
+    return !body1->IsActive() && !body2->IsActive();
+}
+
 // -----------------------------------------------------------------------------
 
 // The default ChLink implementation assumes that react_force and react_torque represent the reaction wrench on the 2nd
@@ -54,6 +54,10 @@ class ChApi ChLink : public ChLinkBase {
     /// Get the link frame 2, on body 2, expressed in the absolute frame.
     virtual ChFramed GetFrame2Abs() const override;
 
+    /// Tells if both connected bodies are sleeping or fixed (with at least one sleeping body).
+    /// The constraints of a sleeping link are not included in the system descriptor.
+    virtual bool IsSleeping() const override;
+
     // The default ChLink implementation assumes that react_force and react_torque represent the reaction wrench on the
     // 2nd body, expressed in the link frame 2. A derived class may interpret react_force and react_torque differently,
     // in which case it must override GetReaction1() and GetReaction2().
@@ -61,6 +61,10 @@ class ChApi ChLinkBase : public ChPhysicsItem {
     /// child classes might return false for optimizing sleeping, in case no time-dependant.
     virtual bool IsRequiringWaking() { return true; }
 
+    /// Tells if all the objects connected by this link are sleeping or fixed (with at least one sleeping object).
+    /// The constraints of a sleeping link are not included in the system descriptor.
+    virtual bool IsSleeping() const { return false; }
+
     /// Get the link frame 1, on the 1st connected object, expressed in the absolute frame.
     virtual ChFramed GetFrame1Abs() const = 0;
 
@@ -32,6 +32,9 @@ ChLinkLock::ChLinkLock()
 
     // Note: the joint is not completely built at this time.
     // Requires definition of the mask (based on concrete joint type)
+
+    // Update() only reads the connected bodies and markers and modifies the joint itself
+    EnableParallelUpdate(true);
 }
 
 ChLinkLock::ChLinkLock(const ChLinkLock& other) : ChLinkMarkers(other) {
@@ -51,6 +51,9 @@ CH_FACTORY_REGISTER(ChLinkMateGeneric)
 ChLinkMateGeneric::ChLinkMateGeneric(bool mc_x, bool mc_y, bool mc_z, bool mc_rx, bool mc_ry, bool mc_rz)
     : c_x(mc_x), c_y(mc_y), c_z(mc_z), c_rx(mc_rx), c_ry(mc_ry), c_rz(mc_rz) {
     SetupLinkMask();
+
+    // Update() only reads the connected bodies and modifies the joint itself
+    EnableParallelUpdate(true);
 }
 
 ChLinkMateGeneric::ChLinkMateGeneric(const ChLinkMateGeneric& other) : ChLinkMate(other) {
@@ -92,6 +95,10 @@ void ChLinkMateGeneric::SetupLinkMask() {
 
     mask.SetNumConstraints(nc);
 
+    // the meaning of the mask constraints changed, even if their number did not: their Jacobians must be reloaded
+    if (system)
+        system->ForceDescriptorRebuild();
+
     C.setZero(nc);
 
     P = ChMatrix33<>(0.5);
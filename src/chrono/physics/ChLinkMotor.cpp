@@ -21,6 +21,9 @@ namespace chrono {
 
 ChLinkMotor::ChLinkMotor() {
     m_func = chrono_types::make_shared<ChFunctionConst>(0);  // defaults to no motion.
+
+    // Update() also updates the motor function, which may be shared with other motors
+    EnableParallelUpdate(false);
 }
 
 ChLinkMotor::ChLinkMotor(const ChLinkMotor& other) : ChLinkMateGeneric(other) {
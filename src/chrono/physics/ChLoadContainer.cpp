@@ -12,7 +12,11 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/physics/ChLoadContainer.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/utils/ChProfiler.h"
 
 namespace chrono {
 
@@ -31,9 +35,31 @@ void ChLoadContainer::Add(std::shared_ptr<ChLoadBase> newload) {
     // assert(std::find<std::vector<std::shared_ptr<ChLoadBase>>::iterator>(loadlist.begin(), loadlist.end(), newload)
     ///== loadlist.end());
     loadlist.push_back(newload);
+
+    // the KRM blocks of the new load must be injected in the system descriptor
+    if (system)
+        system->ForceDescriptorRebuild();
+}
+
+void ChLoadContainer::Remove(std::shared_ptr<ChLoadBase> load) {
+    auto itr = std::find(loadlist.begin(), loadlist.end(), load);
+    if (itr == loadlist.end())
+        return;
+    loadlist.erase(itr);
+
+    if (system)
+        system->ForceDescriptorRebuild();
+}
+
+void ChLoadContainer::Clear() {
+    loadlist.clear();
+
+    if (system)
+        system->ForceDescriptorRebuild();
 }
 
 void ChLoadContainer::Update(double mytime, bool update_assets) {
+    CH_PROFILE_CATEGORY("Update", "loads");
     for (size_t i = 0; i < loadlist.size(); ++i) {
         loadlist[i]->Update(mytime);
     }
@@ -45,6 +71,7 @@ void ChLoadContainer::IntLoadResidual_F(const unsigned int off,  // offset in R
                                         ChVectorDynamic<>& R,    // result: the R residual, R += c*F
                                         const double c           // a scaling factor
 ) {
+    CH_PROFILE_CATEGORY("Load forces", "loads");
     for (size_t i = 0; i < loadlist.size(); ++i) {
         loadlist[i]->LoadIntLoadResidual_F(R, c);
     }
@@ -78,6 +105,7 @@ void ChLoadContainer::InjectKRMMatrices(ChSystemDescriptor& descriptor) {
 }
 
 void ChLoadContainer::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
+    CH_PROFILE_CATEGORY("Load KRM", "loads");
     for (size_t i = 0; i < loadlist.size(); ++i) {
         loadlist[i]->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
     }
@@ -35,7 +35,15 @@ class ChApi ChLoadContainer : public ChPhysicsItem {
     /// Add a load to the container list of loads
     void Add(std::shared_ptr<ChLoadBase> newload);
 
+    /// Remove a load from the container list of loads.
+    void Remove(std::shared_ptr<ChLoadBase> load);
+
+    /// Remove all loads from the container.
+    void Clear();
+
     /// Direct access to the load vector.
+    /// If the list is modified directly and the incremental descriptor rebuild is enabled for the containing system,
+    /// ChSystem::ForceDescriptorRebuild must be called.
     std::vector<std::shared_ptr<ChLoadBase> >& GetLoadList() { return loadlist; }
 
     /// Return the number of loads in this container.
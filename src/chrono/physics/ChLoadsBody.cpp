@@ -12,6 +12,8 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <typeinfo>
+
 #include "chrono/physics/ChLoadsBody.h"
 
 namespace chrono {
@@ -353,6 +355,99 @@ void ChLoadBodyBody::ComputeQ(ChState* state_x, ChStateDelta* state_w) {
     load_Q.segment(9, 3) = (loc_ftorque + loc_torque).eigen();
 }
 
+void ChLoadBodyBody::ComputeJacobian(ChState* state_x, ChStateDelta* state_w) {
+    ChVector3<DualType> pos[2];
+    ChQuaternion<DualType> rot[2];
+    ChVector3<DualType> vel[2];
+    ChVector3<DualType> angvel[2];
+    DualType Q[12];
+
+    // First pass: derivatives with respect to the position-level state increments (K matrix).
+    // Rotations are perturbed in body local coordinates, as in ChBody::LoadableStateIncrement.
+    for (int i = 0; i < 2; i++) {
+        for (int j = 0; j < 3; j++) {
+            pos[i][j] = DualType((*state_x)(7 * i + j), 6 * i + j);
+            vel[i][j] = (*state_w)(6 * i + j);
+            angvel[i][j] = (*state_w)(6 * i + 3 + j);
+        }
+        ChQuaternion<DualType> drot(1.0, DualType(0.0, 6 * i + 3) * 0.5, DualType(0.0, 6 * i + 4) * 0.5,
+                                    DualType(0.0, 6 * i + 5) * 0.5);
+        rot[i] = ChQuaternion<DualType>(ChQuaterniond(state_x->segment(7 * i + 3, 4))) * drot;
+    }
+
+    if (!ComputeQDual(pos, rot, vel, angvel, Q)) {
+        ChLoadCustomMultiple::ComputeJacobian(state_x, state_w);
+        return;
+    }
+
+    for (int r = 0; r < 12; r++)
+        m_jacobians->K.row(r) = -Q[r].GetDerivatives().transpose();
+
+    // Second pass: derivatives with respect to the velocity-level state (R matrix)
+    for (int i = 0; i < 2; i++) {
+        for (int j = 0; j < 3; j++) {
+            pos[i][j] = (*state_x)(7 * i + j);
+            vel[i][j] = DualType((*state_w)(6 * i + j), 6 * i + j);
+            angvel[i][j] = DualType((*state_w)(6 * i + 3 + j), 6 * i + 3 + j);
+        }
+        rot[i] = ChQuaternion<DualType>(ChQuaterniond(state_x->segment(7 * i + 3, 4)));
+    }
+
+    ComputeQDual(pos, rot, vel, angvel, Q);
+
+    for (int r = 0; r < 12; r++)
+        m_jacobians->R.row(r) = -Q[r].GetDerivatives().transpose();
+}
+
+bool ChLoadBodyBody::ComputeQDual(const ChVector3<DualType> pos[2],
+                                  const ChQuaternion<DualType> rot[2],
+                                  const ChVector3<DualType> vel[2],
+                                  const ChVector3<DualType> angvel[2],
+                                  DualType Q[12]) {
+    const ChFrame<>* loc_application[2] = {&loc_application_A, &loc_application_B};
+
+    // Position, rotation, velocity, and angular velocity (all in absolute frame) of the two application frames
+    ChVector3<DualType> frame_pos[2];
+    ChQuaternion<DualType> frame_rot[2];
+    ChVector3<DualType> frame_vel[2];
+    ChVector3<DualType> frame_angvel[2];
+    for (int i = 0; i < 2; i++) {
+        ChVector3<DualType> loc_pos(loc_application[i]->GetPos());
+        frame_pos[i] = pos[i] + rot[i].Rotate(loc_pos);
+        frame_rot[i] = rot[i] * ChQuaternion<DualType>(loc_application[i]->GetRot());
+        frame_vel[i] = vel[i] + rot[i].Rotate(angvel[i] % loc_pos);
+        frame_angvel[i] = rot[i].Rotate(angvel[i]);
+    }
+
+    // Relative kinematics of frame A with respect to frame B, expressed in frame B
+    ChVector3<DualType> d = frame_pos[0] - frame_pos[1];
+    ChVector3<DualType> rel_pos = frame_rot[1].RotateBack(d);
+    ChQuaternion<DualType> rel_rot = frame_rot[1].GetConjugate() * frame_rot[0];
+    ChVector3<DualType> rel_vel = frame_rot[1].RotateBack(frame_vel[0] - frame_vel[1] - frame_angvel[1] % d);
+    ChVector3<DualType> rel_angvel = frame_rot[1].RotateBack(frame_angvel[0] - frame_angvel[1]);
+
+    ChVector3<DualType> loc_force;
+    ChVector3<DualType> loc_torque;
+    if (!ComputeBodyBodyForceTorqueDual(rel_pos, rel_rot, rel_vel, rel_angvel, loc_force, loc_torque))
+        return false;
+
+    ChVector3<DualType> abs_force = frame_rot[1].Rotate(loc_force);
+    ChVector3<DualType> abs_torque = frame_rot[1].Rotate(loc_torque);
+
+    // Generalized forces, as in ComputeQ
+    ChVector3<DualType> Q_force[2] = {-abs_force, abs_force};
+    ChVector3<DualType> Q_torque[2] = {-abs_torque, abs_torque};
+    for (int i = 0; i < 2; i++) {
+        ChVector3<DualType> loc_torque_i = rot[i].RotateBack((frame_pos[i] - pos[i]) % Q_force[i] + Q_torque[i]);
+        for (int j = 0; j < 3; j++) {
+            Q[6 * i + j] = Q_force[i][j];
+            Q[6 * i + 3 + j] = loc_torque_i[j];
+        }
+    }
+
+    return true;
+}
+
 std::shared_ptr<ChBody> ChLoadBodyBody::GetBodyA() const {
     return std::dynamic_pointer_cast<ChBody>(this->loadables[0]);
 }
@@ -408,9 +503,34 @@ ChLoadBodyBodyBushingSpherical::ChLoadBodyBodyBushingSpherical(std::shared_ptr<C
 void ChLoadBodyBodyBushingSpherical::ComputeBodyBodyForceTorque(const ChFrameMoving<>& rel_AB,
                                                                 ChVector3d& loc_force,
                                                                 ChVector3d& loc_torque) {
-    loc_force = rel_AB.GetPos() * stiffness     // element-wise product!
-                + rel_AB.GetPosDt() * damping;  // element-wise product!
-    loc_torque = VNULL;
+    BushingForceTorque(rel_AB.GetPos(), rel_AB.GetRot(), rel_AB.GetPosDt(), rel_AB.GetAngVelParent(), loc_force,
+                       loc_torque);
+}
+
+bool ChLoadBodyBodyBushingSpherical::ComputeBodyBodyForceTorqueDual(const ChVector3<DualType>& rel_pos,
+                                                                    const ChQuaternion<DualType>& rel_rot,
+                                                                    const ChVector3<DualType>& rel_vel,
+                                                                    const ChVector3<DualType>& rel_angvel,
+                                                                    ChVector3<DualType>& loc_force,
+                                                                    ChVector3<DualType>& loc_torque) {
+    // The dual force law is consistent with ComputeBodyBodyForceTorque only for this exact class
+    if (typeid(*this) != typeid(ChLoadBodyBodyBushingSpherical))
+        return false;
+
+    BushingForceTorque(rel_pos, rel_rot, rel_vel, rel_angvel, loc_force, loc_torque);
+    return true;
+}
+
+template <typename Real>
+void ChLoadBodyBodyBushingSpherical::BushingForceTorque(const ChVector3<Real>& rel_pos,
+                                                        const ChQuaternion<Real>& rel_rot,
+                                                        const ChVector3<Real>& rel_vel,
+                                                        const ChVector3<Real>& rel_angvel,
+                                                        ChVector3<Real>& loc_force,
+                                                        ChVector3<Real>& loc_torque) const {
+    loc_force = rel_pos * ChVector3<Real>(stiffness)   // element-wise product!
+                + rel_vel * ChVector3<Real>(damping);  // element-wise product!
+    loc_torque = ChVector3<Real>(0);
 }
 
 // -----------------------------------------------------------------------------
@@ -465,6 +585,31 @@ void ChLoadBodyBodyBushingPlastic::ComputeBodyBodyForceTorque(const ChFrameMovin
     loc_torque = VNULL;
 }
 
+bool ChLoadBodyBodyBushingPlastic::ComputeBodyBodyForceTorqueDual(const ChVector3<DualType>& rel_pos,
+                                                                  const ChQuaternion<DualType>& rel_rot,
+                                                                  const ChVector3<DualType>& rel_vel,
+                                                                  const ChVector3<DualType>& rel_angvel,
+                                                                  ChVector3<DualType>& loc_force,
+                                                                  ChVector3<DualType>& loc_torque) {
+    // The dual force law is consistent with ComputeBodyBodyForceTorque only for this exact class
+    if (typeid(*this) != typeid(ChLoadBodyBodyBushingPlastic))
+        return false;
+
+    loc_force = (rel_pos - ChVector3<DualType>(plastic_def)) * ChVector3<DualType>(stiffness)  // element-wise product!
+                + rel_vel * ChVector3<DualType>(damping);                                      // element-wise product!
+
+    // Capped components do not depend on the state
+    for (int i = 0; i < 3; i++) {
+        if (loc_force[i] > yield[i])
+            loc_force[i] = yield[i];
+        if (loc_force[i] < -yield[i])
+            loc_force[i] = -yield[i];
+    }
+
+    loc_torque = ChVector3<DualType>(0);
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // ChLoadBodyBodyBushingMate
 // -----------------------------------------------------------------------------
@@ -483,23 +628,39 @@ ChLoadBodyBodyBushingMate::ChLoadBodyBodyBushingMate(std::shared_ptr<ChBody> bod
 void ChLoadBodyBodyBushingMate::ComputeBodyBodyForceTorque(const ChFrameMoving<>& rel_AB,
                                                            ChVector3d& loc_force,
                                                            ChVector3d& loc_torque) {
-    // inherit parent to compute loc_force = ...
-    ChLoadBodyBodyBushingSpherical::ComputeBodyBodyForceTorque(rel_AB, loc_force, loc_torque);
+    BushingForceTorque(rel_AB.GetPos(), rel_AB.GetRot(), rel_AB.GetPosDt(), rel_AB.GetAngVelParent(), loc_force,
+                       loc_torque);
+}
 
-    // compute local torque using small rotations:
-    ChQuaternion<> rel_rot = rel_AB.GetRot();
+bool ChLoadBodyBodyBushingMate::ComputeBodyBodyForceTorqueDual(const ChVector3<DualType>& rel_pos,
+                                                               const ChQuaternion<DualType>& rel_rot,
+                                                               const ChVector3<DualType>& rel_vel,
+                                                               const ChVector3<DualType>& rel_angvel,
+                                                               ChVector3<DualType>& loc_force,
+                                                               ChVector3<DualType>& loc_torque) {
+    // The dual force law is consistent with ComputeBodyBodyForceTorque only for this exact class
+    if (typeid(*this) != typeid(ChLoadBodyBodyBushingMate))
+        return false;
+
+    BushingForceTorque(rel_pos, rel_rot, rel_vel, rel_angvel, loc_force, loc_torque);
+    return true;
+}
+
+template <typename Real>
+void ChLoadBodyBodyBushingMate::BushingForceTorque(const ChVector3<Real>& rel_pos,
+                                                   const ChQuaternion<Real>& rel_rot,
+                                                   const ChVector3<Real>& rel_vel,
+                                                   const ChVector3<Real>& rel_angvel,
+                                                   ChVector3<Real>& loc_force,
+                                                   ChVector3<Real>& loc_torque) const {
+    // inherit parent to compute loc_force = ...
+    ChLoadBodyBodyBushingSpherical::BushingForceTorque(rel_pos, rel_rot, rel_vel, rel_angvel, loc_force, loc_torque);
 
-    ChVector3d dir_rot;
-    double angle_rot;
-    rel_rot.GetAngleAxis(angle_rot, dir_rot);
-    if (angle_rot > CH_PI)
-        angle_rot -= CH_2PI;
-    if (angle_rot < -CH_PI)
-        angle_rot += CH_2PI;
-    ChVector3d vect_rot = dir_rot * angle_rot;
+    // compute local torque using small rotations (rotation vector with angle in [-PI, PI]):
+    ChVector3<Real> vect_rot = (rel_rot.e0() < 0 ? -rel_rot : rel_rot).GetRotVec();
 
-    loc_torque = vect_rot * rot_stiffness                   // element-wise product!
-                 + rel_AB.GetAngVelParent() * rot_damping;  // element-wise product!
+    loc_torque = vect_rot * ChVector3<Real>(rot_stiffness)      // element-wise product!
+                 + rel_angvel * ChVector3<Real>(rot_damping);  // element-wise product!
 }
 
 // -----------------------------------------------------------------------------
@@ -516,30 +677,48 @@ ChLoadBodyBodyBushingGeneric::ChLoadBodyBodyBushingGeneric(std::shared_ptr<ChBod
 void ChLoadBodyBodyBushingGeneric::ComputeBodyBodyForceTorque(const ChFrameMoving<>& rel_AB,
                                                               ChVector3d& loc_force,
                                                               ChVector3d& loc_torque) {
+    BushingForceTorque(rel_AB.GetPos(), rel_AB.GetRot(), rel_AB.GetPosDt(), rel_AB.GetAngVelParent(), loc_force,
+                       loc_torque);
+}
+
+bool ChLoadBodyBodyBushingGeneric::ComputeBodyBodyForceTorqueDual(const ChVector3<DualType>& rel_pos,
+                                                                  const ChQuaternion<DualType>& rel_rot,
+                                                                  const ChVector3<DualType>& rel_vel,
+                                                                  const ChVector3<DualType>& rel_angvel,
+                                                                  ChVector3<DualType>& loc_force,
+                                                                  ChVector3<DualType>& loc_torque) {
+    // The dual force law is consistent with ComputeBodyBodyForceTorque only for this exact class
+    if (typeid(*this) != typeid(ChLoadBodyBodyBushingGeneric))
+        return false;
+
+    BushingForceTorque(rel_pos, rel_rot, rel_vel, rel_angvel, loc_force, loc_torque);
+    return true;
+}
+
+template <typename Real>
+void ChLoadBodyBodyBushingGeneric::BushingForceTorque(const ChVector3<Real>& rel_pos,
+                                                      const ChQuaternion<Real>& rel_rot,
+                                                      const ChVector3<Real>& rel_vel,
+                                                      const ChVector3<Real>& rel_angvel,
+                                                      ChVector3<Real>& loc_force,
+                                                      ChVector3<Real>& loc_torque) const {
     // compute local force & torque (assuming small rotations):
-    ChVectorDynamic<> mF(6);
-    ChVectorDynamic<> mS(6);
-    ChVectorDynamic<> mSdt(6);
-    ChVector3d rel_pos = rel_AB.GetPos() + neutral_displacement.GetPos();
-    ChQuaternion<> rel_rot = rel_AB.GetRot() * neutral_displacement.GetRot();
-    ChVector3d dir_rot;
-    double angle_rot;
-    rel_rot.GetAngleAxis(angle_rot, dir_rot);
-    if (angle_rot > CH_PI)
-        angle_rot -= CH_2PI;
-    if (angle_rot < -CH_PI)
-        angle_rot += CH_2PI;
-    ChVector3d vect_rot = dir_rot * angle_rot;
-
-    mS.segment(0, 3) = rel_pos.eigen();
-    mS.segment(3, 3) = vect_rot.eigen();
-    mSdt.segment(0, 3) = rel_AB.GetPosDt().eigen();
-    mSdt.segment(3, 3) = rel_AB.GetAngVelParent().eigen();
-
-    mF = stiffness * mS + damping * mSdt;
-
-    loc_force = ChVector3d(mF.segment(0, 3)) - neutral_force;
-    loc_torque = ChVector3d(mF.segment(3, 3)) - neutral_torque;
+    ChVector3<Real> pos = rel_pos + ChVector3<Real>(neutral_displacement.GetPos());
+    ChQuaternion<Real> rot = rel_rot * ChQuaternion<Real>(neutral_displacement.GetRot());
+    ChVector3<Real> vect_rot = (rot.e0() < 0 ? -rot : rot).GetRotVec();
+
+    Real S[6] = {pos.x(), pos.y(), pos.z(), vect_rot.x(), vect_rot.y(), vect_rot.z()};
+    Real Sdt[6] = {rel_vel.x(), rel_vel.y(), rel_vel.z(), rel_angvel.x(), rel_angvel.y(), rel_angvel.z()};
+
+    Real F[6];
+    for (int i = 0; i < 6; i++) {
+        F[i] = 0.0;
+        for (int j = 0; j < 6; j++)
+            F[i] += S[j] * stiffness(i, j) + Sdt[j] * damping(i, j);
+    }
+
+    loc_force = ChVector3<Real>(F[0], F[1], F[2]) - ChVector3<Real>(neutral_force);
+    loc_torque = ChVector3<Real>(F[3], F[4], F[5]) - ChVector3<Real>(neutral_torque);
 }
 
 }  // end namespace chrono
@@ -36,6 +36,7 @@
 #ifndef CHLOADSBODY_H
 #define CHLOADSBODY_H
 
+#include "chrono/core/ChDual.h"
 #include "chrono/functions/ChFunction.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChLoad.h"
@@ -269,8 +270,33 @@ class ChApi ChLoadBodyBody : public ChLoadCustomMultiple {
                                             ChVector3d& loc_force,
                                             ChVector3d& loc_torque) = 0;
 
-    // Optional: inherited classes could implement this to avoid the default fineite difference approximation:
-    //   virtual void ComputeJacobian(...) // see ChLoad
+    /// Dual number type used for the forward-mode differentiation of the body-body force.
+    /// There is one derivative direction for each of the 12 velocity-level coordinates of the two bodies.
+    typedef ChDual<12> DualType;
+
+    /// Compute the force and torque as in ComputeBodyBodyForceTorque, with dual numbers.
+    /// The relative position, rotation, velocity, and angular velocity of loc_application_A with respect to
+    /// loc_application_B are all expressed in the loc_application_B frame.
+    /// Inherited classes can implement this (typically through a force law templated over the scalar type and shared
+    /// with ComputeBodyBodyForceTorque) to obtain exact Jacobians by automatic differentiation.
+    /// The default implementation returns false, in which case Jacobians are computed by finite differences.
+    /// An implementation should also return false when called for a derived class which may have overridden only
+    /// ComputeBodyBodyForceTorque (the bushing loads check that the dynamic type is their own class).
+    virtual bool ComputeBodyBodyForceTorqueDual(const ChVector3<DualType>& rel_pos,
+                                                const ChQuaternion<DualType>& rel_rot,
+                                                const ChVector3<DualType>& rel_vel,
+                                                const ChVector3<DualType>& rel_angvel,
+                                                ChVector3<DualType>& loc_force,
+                                                ChVector3<DualType>& loc_torque) {
+        return false;
+    }
+
+    /// Compute Jacobian matrices K=-dQ/dx and R=-dQ/dv.
+    /// If ComputeBodyBodyForceTorqueDual is implemented, the Jacobians are exact and obtained with two evaluations of
+    /// the load in dual numbers (one for K and one for R). Otherwise, finite differences are used.
+    virtual void ComputeJacobian(ChState* state_x,      ///< state position to evaluate Jacobians
+                                 ChStateDelta* state_w  ///< state speed to evaluate Jacobians
+                                 ) override;
 
     /// For diagnosis purposes, this can return the actual last computed value of
     /// the applied force, expressed in coordinate system of loc_application_B, assumed applied to body B
@@ -309,6 +335,15 @@ class ChApi ChLoadBodyBody : public ChLoadCustomMultiple {
     virtual void ComputeQ(ChState* state_x,      ///< state position to evaluate Q
                           ChStateDelta* state_w  ///< state speed to evaluate Q
                           ) override;
+
+    /// Compute the generalized load(s) in dual numbers, given the state of the two bodies.
+    /// Return false if ComputeBodyBodyForceTorqueDual is not implemented.
+    bool ComputeQDual(const ChVector3<DualType> pos[2],     ///< body positions
+                      const ChQuaternion<DualType> rot[2],  ///< body rotations
+                      const ChVector3<DualType> vel[2],     ///< body linear velocities
+                      const ChVector3<DualType> angvel[2],  ///< body angular velocities (local)
+                      DualType Q[12]                        ///< resulting generalized loads
+    );
 };
 
 //------------------------------------------------------------------------------------------------
@@ -389,6 +424,24 @@ class ChApi ChLoadBodyBodyBushingSpherical : public ChLoadBodyBody {
     virtual void ComputeBodyBodyForceTorque(const ChFrameMoving<>& rel_AB,
                                             ChVector3d& loc_force,
                                             ChVector3d& loc_torque) override;
+
+    /// Compute the bushing force with dual numbers, for exact Jacobians.
+    /// Returns false (finite-difference Jacobians) if called for a derived class.
+    virtual bool ComputeBodyBodyForceTorqueDual(const ChVector3<DualType>& rel_pos,
+                                                const ChQuaternion<DualType>& rel_rot,
+                                                const ChVector3<DualType>& rel_vel,
+                                                const ChVector3<DualType>& rel_angvel,
+                                                ChVector3<DualType>& loc_force,
+                                                ChVector3<DualType>& loc_torque) override;
+
+    /// Bushing force law, templated over the scalar type.
+    template <typename Real>
+    void BushingForceTorque(const ChVector3<Real>& rel_pos,
+                            const ChQuaternion<Real>& rel_rot,
+                            const ChVector3<Real>& rel_vel,
+                            const ChVector3<Real>& rel_angvel,
+                            ChVector3<Real>& loc_force,
+                            ChVector3<Real>& loc_torque) const;
 };
 
 //------------------------------------------------------------------------------------------------
@@ -427,6 +480,16 @@ class ChApi ChLoadBodyBodyBushingPlastic : public ChLoadBodyBodyBushingSpherical
     virtual void ComputeBodyBodyForceTorque(const ChFrameMoving<>& rel_AB,
                                             ChVector3d& loc_force,
                                             ChVector3d& loc_torque) override;
+
+    /// Compute the bushing force with dual numbers, for exact Jacobians.
+    /// Returns false (finite-difference Jacobians) if called for a derived class.
+    /// Capped force components have zero derivatives. The plastic deformation is not updated.
+    virtual bool ComputeBodyBodyForceTorqueDual(const ChVector3<DualType>& rel_pos,
+                                                const ChQuaternion<DualType>& rel_rot,
+                                                const ChVector3<DualType>& rel_vel,
+                                                const ChVector3<DualType>& rel_angvel,
+                                                ChVector3<DualType>& loc_force,
+                                                ChVector3<DualType>& loc_torque) override;
 };
 
 //------------------------------------------------------------------------------------------------
@@ -466,6 +529,24 @@ class ChApi ChLoadBodyBodyBushingMate : public ChLoadBodyBodyBushingSpherical {
     virtual void ComputeBodyBodyForceTorque(const ChFrameMoving<>& rel_AB,
                                             ChVector3d& loc_force,
                                             ChVector3d& loc_torque) override;
+
+    /// Compute the bushing force and torque with dual numbers, for exact Jacobians.
+    /// Returns false (finite-difference Jacobians) if called for a derived class.
+    virtual bool ComputeBodyBodyForceTorqueDual(const ChVector3<DualType>& rel_pos,
+                                                const ChQuaternion<DualType>& rel_rot,
+                                                const ChVector3<DualType>& rel_vel,
+                                                const ChVector3<DualType>& rel_angvel,
+                                                ChVector3<DualType>& loc_force,
+                                                ChVector3<DualType>& loc_torque) override;
+
+    /// Bushing force and torque law, templated over the scalar type.
+    template <typename Real>
+    void BushingForceTorque(const ChVector3<Real>& rel_pos,
+                            const ChQuaternion<Real>& rel_rot,
+                            const ChVector3<Real>& rel_vel,
+                            const ChVector3<Real>& rel_angvel,
+                            ChVector3<Real>& loc_force,
+                            ChVector3<Real>& loc_torque) const;
 };
 
 //------------------------------------------------------------------------------------------------
@@ -534,6 +615,24 @@ class ChApi ChLoadBodyBodyBushingGeneric : public ChLoadBodyBody {
                                             ChVector3d& loc_force,
                                             ChVector3d& loc_torque) override;
 
+    /// Compute the bushing force and torque with dual numbers, for exact Jacobians.
+    /// Returns false (finite-difference Jacobians) if called for a derived class.
+    virtual bool ComputeBodyBodyForceTorqueDual(const ChVector3<DualType>& rel_pos,
+                                                const ChQuaternion<DualType>& rel_rot,
+                                                const ChVector3<DualType>& rel_vel,
+                                                const ChVector3<DualType>& rel_angvel,
+                                                ChVector3<DualType>& loc_force,
+                                                ChVector3<DualType>& loc_torque) override;
+
+    /// Bushing force and torque law, templated over the scalar type.
+    template <typename Real>
+    void BushingForceTorque(const ChVector3<Real>& rel_pos,
+                            const ChQuaternion<Real>& rel_rot,
+                            const ChVector3<Real>& rel_vel,
+                            const ChVector3<Real>& rel_angvel,
+                            ChVector3<Real>& loc_force,
+                            ChVector3<Real>& loc_torque) const;
+
   public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
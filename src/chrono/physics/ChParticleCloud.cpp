@@ -14,6 +14,7 @@
 
 #include <cstdlib>
 #include <algorithm>
+#include <new>
 
 #include "chrono/core/ChGlobal.h"
 #include "chrono/physics/ChSystem.h"
@@ -90,9 +91,8 @@ ChVector3d ChParticle::GetContactPointSpeed(const ChVector3d& loc_point,
     ChCoordsys<> csys(state_x.segment(0, 7));
     ChVector3d abs_vel(state_w.segment(0, 3));
     ChVector3d loc_omg(state_w.segment(3, 3));
-    ChVector3d abs_omg = csys.TransformDirectionLocalToParent(loc_omg);
 
-    return abs_vel + Vcross(abs_omg, loc_point);
+    return abs_vel + csys.TransformDirectionLocalToParent(Vcross(loc_omg, loc_point));
 }
 
 ChVector3d ChParticle::GetContactPointSpeed(const ChVector3d& abs_point) {
@@ -229,7 +229,6 @@ ChParticleCloud::ChParticleCloud()
     SetInertiaXY(ChVector3d(0, 0, 0));
 
     particles.clear();
-    // ResizeNparticles(num_particles); // caused memory corruption.. why?
 }
 
 ChParticleCloud::ChParticleCloud(const ChParticleCloud& other) : ChIndexedParticles(other) {
@@ -257,7 +256,7 @@ ChParticleCloud::ChParticleCloud(const ChParticleCloud& other) : ChIndexedPartic
 }
 
 ChParticleCloud::~ChParticleCloud() {
-    ResizeNparticles(0);
+    DeleteParticles();
 }
 
 void ChParticleCloud::AddCollisionShape(std::shared_ptr<ChCollisionShape> shape, const ChFrame<>& frame) {
@@ -267,31 +266,48 @@ void ChParticleCloud::AddCollisionShape(std::shared_ptr<ChCollisionShape> shape,
     particle_collision_model->AddShape(shape, frame);
 }
 
-void ChParticleCloud::ResizeNparticles(int newsize) {
-    //// TODO REVISIT THIS
+ChParticle* ChParticleCloud::CreateParticle(const ChParticle* other) {
+    size_t index = particles.size();
+    if (index == particle_chunks.size() * particle_chunk_size)
+        particle_chunks.push_back(std::unique_ptr<ParticleSlot[]>(new ParticleSlot[particle_chunk_size]));
 
-    bool oldcoll = IsCollisionEnabled();
-    EnableCollision(false);
+    void* slot = &particle_chunks[index / particle_chunk_size][index % particle_chunk_size];
+    ChParticle* newp = other ? new (slot) ChParticle(*other) : new (slot) ChParticle;
 
-    for (unsigned int j = 0; j < particles.size(); j++) {
-        delete (particles[j]);
-        particles[j] = 0;
-    }
+    newp->SetContainer(this);
 
-    particles.resize(newsize);
+    newp->variables.SetSharedMass(&particle_mass);
+    newp->variables.SetUserData((void*)this);
 
-    for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j] = new ChParticle;
+    particles.push_back(newp);
+    return newp;
+}
+
+void ChParticleCloud::DeleteParticles() {
+    for (auto particle : particles)
+        particle->~ChParticle();
+    particles.clear();
+    particle_chunks.clear();
+}
+
+int ChParticleCloud::GetNumThreads() const {
+    return GetSystem() ? (int)GetSystem()->GetNumThreadsChrono() : 1;
+}
 
-        particles[j]->SetContainer(this);
+void ChParticleCloud::ResizeNparticles(int newsize) {
+    bool oldcoll = IsCollisionEnabled();
+    EnableCollision(false);
 
-        particles[j]->variables.SetSharedMass(&particle_mass);
-        particles[j]->variables.SetUserData((void*)this);
+    DeleteParticles();
+
+    particles.reserve(newsize);
+    for (int j = 0; j < newsize; j++) {
+        ChParticle* newp = CreateParticle();
 
         if (particle_collision_model) {
             auto collision_model = chrono_types::make_shared<ChCollisionModel>();
             collision_model->AddShapes(particle_collision_model);
-            particles[j]->AddCollisionModel(collision_model);
+            newp->AddCollisionModel(collision_model);
         }
     }
 
@@ -299,21 +315,14 @@ void ChParticleCloud::ResizeNparticles(int newsize) {
 }
 
 void ChParticleCloud::AddParticle(ChCoordsys<double> initial_state) {
-    ChParticle* newp = new ChParticle;
+    ChParticle* newp = CreateParticle();
     newp->SetCoordsys(initial_state);
 
-    newp->SetContainer(this);
-
-    newp->variables.SetSharedMass(&particle_mass);
-    newp->variables.SetUserData((void*)this);
-
     if (particle_collision_model) {
         auto collision_model = chrono_types::make_shared<ChCollisionModel>();
         collision_model->AddShapes(particle_collision_model);
         newp->AddCollisionModel(collision_model);
     }
-
-    particles.push_back(newp);
 }
 
 ChColor ChParticleCloud::GetVisualColor(unsigned int n) const {
@@ -334,15 +343,19 @@ void ChParticleCloud::IntStateGather(const unsigned int off_x,  // offset in x s
                                      ChStateDelta& v,           // state vector, speed part
                                      double& T                  // time
 ) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         x.segment(off_x + 7 * j + 0, 3) = particles[j]->GetPos().eigen();
         x.segment(off_x + 7 * j + 3, 4) = particles[j]->GetRot().eigen();
 
         v.segment(off_v + 6 * j + 0, 3) = particles[j]->GetPosDt().eigen();
         v.segment(off_v + 6 * j + 3, 3) = particles[j]->GetAngVelLocal().eigen();
-
-        T = GetChTime();
     }
+
+    T = GetChTime();
 }
 
 void ChParticleCloud::IntStateScatter(const unsigned int off_x,  // offset in x state vector
@@ -352,7 +365,11 @@ void ChParticleCloud::IntStateScatter(const unsigned int off_x,  // offset in x
                                       const double T,            // time
                                       bool full_update           // perform complete update
 ) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         particles[j]->SetCoordsys(x.segment(off_x + 7 * j, 7));
         particles[j]->SetPosDt(v.segment(off_v + 6 * j, 3));
         particles[j]->SetAngVelLocal(v.segment(off_v + 6 * j + 3, 3));
@@ -362,14 +379,22 @@ void ChParticleCloud::IntStateScatter(const unsigned int off_x,  // offset in x
 }
 
 void ChParticleCloud::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         a.segment(off_a + 6 * j + 0, 3) = particles[j]->GetPosDt2().eigen();
         a.segment(off_a + 6 * j + 3, 3) = particles[j]->GetAngAccLocal().eigen();
     }
 }
 
 void ChParticleCloud::IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         particles[j]->SetPosDt2(a.segment(off_a + 6 * j, 3));
         particles[j]->SetAngAccLocal(a.segment(off_a + 6 * j + 3, 3));
     }
@@ -381,7 +406,11 @@ void ChParticleCloud::IntStateIncrement(const unsigned int off_x,  // offset in
                                         const unsigned int off_v,  // offset in v state vector
                                         const ChStateDelta& Dv     // state vector, increment
 ) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         // ADVANCE POSITION:
         x_new(off_x + 7 * j) = x(off_x + 7 * j) + Dv(off_v + 6 * j);
         x_new(off_x + 7 * j + 1) = x(off_x + 7 * j + 1) + Dv(off_v + 6 * j + 1);
@@ -403,7 +432,11 @@ void ChParticleCloud::IntStateGetIncrement(const unsigned int off_x,  // offset
                                            const unsigned int off_v,  // offset in v state vector
                                            ChStateDelta& Dv           // state vector, increment
 ) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         // POSITION:
         Dv(off_v + 6 * j) = x_new(off_x + 7 * j) - x(off_x + 7 * j);
         Dv(off_v + 6 * j + 1) = x_new(off_x + 7 * j + 1) - x(off_x + 7 * j + 1);
@@ -426,7 +459,11 @@ void ChParticleCloud::IntLoadResidual_F(const unsigned int off,  // offset in R
     if (GetSystem())
         Gforce = GetSystem()->GetGravitationalAcceleration() * particle_mass.GetBodyMass();
 
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         // particle gyroscopic force:
         ChVector3d Wvel = particles[j]->GetAngVelLocal();
         ChVector3d gyro = Vcross(Wvel, particle_mass.GetBodyInertia() * Wvel);
@@ -442,16 +479,27 @@ void ChParticleCloud::IntLoadResidual_Mv(const unsigned int off,      // offset
                                          const ChVectorDynamic<>& w,  // the w vector
                                          const double c               // a scaling factor
 ) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
-        R(off + 6 * j + 0) += c * GetMass() * w(off + 6 * j + 0);
-        R(off + 6 * j + 1) += c * GetMass() * w(off + 6 * j + 1);
-        R(off + 6 * j + 2) += c * GetMass() * w(off + 6 * j + 2);
-        ChVector3d Iw = c * (particle_mass.GetBodyInertia() * ChVector3d(w.segment(off + 6 * j + 3, 3)));
+    double cmass = c * particle_mass.GetBodyMass();
+    const ChMatrix33<>& inertia = particle_mass.GetBodyInertia();
+
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
+        R(off + 6 * j + 0) += cmass * w(off + 6 * j + 0);
+        R(off + 6 * j + 1) += cmass * w(off + 6 * j + 1);
+        R(off + 6 * j + 2) += cmass * w(off + 6 * j + 2);
+        ChVector3d Iw = c * (inertia * ChVector3d(w.segment(off + 6 * j + 3, 3)));
         R.segment(off + 6 * j + 3, 3) += Iw.eigen();
     }
 }
 void ChParticleCloud::IntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md, double& err, const double c) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         Md(off + 6 * j + 0) += c * particle_mass.GetBodyMass();
         Md(off + 6 * j + 1) += c * particle_mass.GetBodyMass();
         Md(off + 6 * j + 2) += c * particle_mass.GetBodyMass();
@@ -470,7 +518,11 @@ void ChParticleCloud::IntToDescriptor(const unsigned int off_v,  // offset in v,
                                       const unsigned int off_L,  // offset in L, Qc
                                       const ChVectorDynamic<>& L,
                                       const ChVectorDynamic<>& Qc) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         particles[j]->variables.State() = v.segment(off_v + 6 * j, 6);
         particles[j]->variables.Force() = R.segment(off_v + 6 * j, 6);
     }
@@ -480,7 +532,11 @@ void ChParticleCloud::IntFromDescriptor(const unsigned int off_v,  // offset in
                                         ChStateDelta& v,
                                         const unsigned int off_L,  // offset in L
                                         ChVectorDynamic<>& L) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         v.segment(off_v + 6 * j, 6) = particles[j]->variables.State();
     }
 }
@@ -493,7 +549,11 @@ void ChParticleCloud::InjectVariables(ChSystemDescriptor& descriptor) {
 }
 
 void ChParticleCloud::VariablesFbReset() {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         particles[j]->variables.Force().setZero();
     }
 }
@@ -503,7 +563,11 @@ void ChParticleCloud::VariablesFbLoadForces(double factor) {
     if (GetSystem())
         Gforce = GetSystem()->GetGravitationalAcceleration() * particle_mass.GetBodyMass();
 
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         // particle gyroscopic force:
         ChVector3d Wvel = particles[j]->GetAngVelLocal();
         ChVector3d gyro = Vcross(Wvel, particle_mass.GetBodyInertia() * Wvel);
@@ -515,7 +579,11 @@ void ChParticleCloud::VariablesFbLoadForces(double factor) {
 }
 
 void ChParticleCloud::VariablesQbLoadSpeed() {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         // set current speed in 'qb', it can be used by the solver when working in incremental mode
         particles[j]->variables.State().segment(0, 3) = particles[j]->GetCoordsysDt().pos.eigen();
         particles[j]->variables.State().segment(3, 3) = particles[j]->GetAngVelLocal().eigen();
@@ -523,13 +591,21 @@ void ChParticleCloud::VariablesQbLoadSpeed() {
 }
 
 void ChParticleCloud::VariablesFbIncrementMq() {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         particles[j]->variables.AddMassTimesVector(particles[j]->variables.Force(), particles[j]->variables.State());
     }
 }
 
 void ChParticleCloud::VariablesQbSetSpeed(double step) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         ChCoordsys<> old_coord_dt = particles[j]->GetCoordsysDt();
 
         // from 'qb' vector, sets body speed, and updates auxiliary data
@@ -551,7 +627,11 @@ void ChParticleCloud::VariablesQbIncrementPosition(double dt_step) {
     if (!IsActive())
         return;
 
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         // Updates position with incremental action of speed contained in the
         // 'qb' vector:  pos' = pos + dt * speed   , like in an Euler step.
 
@@ -574,7 +654,11 @@ void ChParticleCloud::VariablesQbIncrementPosition(double dt_step) {
 }
 
 void ChParticleCloud::ForceToRest() {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int nthreads = GetNumThreads();
+    int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < num_particles; j++) {
         particles[j]->SetPosDt(VNULL);
         particles[j]->SetAngVelLocal(VNULL);
         particles[j]->SetPosDt2(VNULL);
@@ -584,7 +668,11 @@ void ChParticleCloud::ForceToRest() {
 
 void ChParticleCloud::ClampSpeed() {
     if (limit_speed) {
-        for (unsigned int j = 0; j < particles.size(); j++) {
+        int nthreads = GetNumThreads();
+        int num_particles = (int)particles.size();
+
+#pragma omp parallel for num_threads(nthreads)
+        for (int j = 0; j < num_particles; j++) {
             double w = 2.0 * particles[j]->GetRotDt().Length();
             if (w > max_wvel)
                 particles[j]->SetRotDt(particles[j]->GetRotDt() * max_wvel / w);
@@ -736,7 +824,8 @@ void ChParticleCloud::ArchiveIn(ChArchiveIn& archive_in) {
     ChIndexedParticles::ArchiveIn(archive_in);
 
     // deserialize all member data:
-    archive_in >> CHNVP(particles);
+    std::vector<ChParticle*> loaded_particles;
+    archive_in >> make_ChNameValue("particles", loaded_particles);
     // archive_in >> CHNVP(particle_mass); //// TODO
     archive_in >> CHNVP(particle_collision_model);
     archive_in >> CHNVP(collide);
@@ -748,8 +837,14 @@ void ChParticleCloud::ArchiveIn(ChArchiveIn& archive_in) {
     archive_in >> CHNVP(sleep_minwvel);
     archive_in >> CHNVP(sleep_starttime);
 
-    for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j]->SetContainer(this);
+    // move the loaded particles in the contiguous particle storage
+    DeleteParticles();
+    particles.reserve(loaded_particles.size());
+    for (auto loaded : loaded_particles) {
+        ChParticle* newp = CreateParticle(loaded);
+        if (loaded->GetCollisionModel())
+            newp->AddCollisionModel(loaded->GetCollisionModel());
+        delete loaded;
     }
 }
 
@@ -16,6 +16,8 @@
 #define CH_PARTICLE_CLOUD_H
 
 #include <cmath>
+#include <memory>
+#include <vector>
 
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/physics/ChContactable.h"
@@ -155,6 +157,10 @@ class ChApi ChParticle : public ChParticleBase, public ChContactable_1vars<6> {
 /// such as mass and collision shape. If you have N different families of shapes in your granular simulations (ex. 50%
 /// of particles are large spheres, 25% are small spheres and 25% are polyhedrons) you can simply add three
 /// ChParticleCloud objects to the ChSystem. This would be more efficient anyway than creating all shapes as ChBody.
+///
+/// Particles are constructed in place in contiguous storage (allocated in fixed-size chunks, so that particle addresses
+/// remain valid as particles are added). The per-particle state bookkeeping, residual, and solver functions are
+/// processed in parallel, using the number of Chrono threads of the owning system (see ChSystem::SetNumThreads).
 class ChApi ChParticleCloud : public ChIndexedParticles {
   public:
     ChParticleCloud();
@@ -367,8 +373,25 @@ class ChApi ChParticleCloud : public ChIndexedParticles {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   private:
-    std::vector<ChParticle*> particles;  ///< the particles
-    ChSharedMassBody particle_mass;      ///< shared mass of particles
+    /// Construct a new particle in the contiguous particle storage (optionally, as a copy of the given particle).
+    ChParticle* CreateParticle(const ChParticle* other = nullptr);
+
+    /// Destroy all particles and release the particle storage.
+    void DeleteParticles();
+
+    /// Get the number of threads for processing particles in parallel.
+    int GetNumThreads() const;
+
+    /// Uninitialized storage for one particle, with proper alignment.
+    struct alignas(ChParticle) ParticleSlot {
+        unsigned char data[sizeof(ChParticle)];
+    };
+
+    static constexpr size_t particle_chunk_size = 1024;  ///< number of particles in a storage chunk
+
+    std::vector<ChParticle*> particles;                            ///< the particles
+    std::vector<std::unique_ptr<ParticleSlot[]>> particle_chunks;  ///< contiguous particle storage
+    ChSharedMassBody particle_mass;                                ///< shared mass of particles
 
     std::shared_ptr<ColorCallback> m_color_fun;  ///< callback for dynamic coloring
 
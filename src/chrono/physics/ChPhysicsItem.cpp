@@ -25,6 +25,7 @@ ChPhysicsItem::ChPhysicsItem(const ChPhysicsItem& other) : ChObj(other) {
     offset_x = other.offset_x;
     offset_w = other.offset_w;
     offset_L = other.offset_L;
+    parallel_update = other.parallel_update;
 }
 
 ChPhysicsItem::~ChPhysicsItem() {
@@ -38,7 +38,7 @@ class ChModalAssembly;
 /// Such items (e.g., rigid bodies, joints, FEM meshes, etc.) can contain ChVariables or ChConstraints objects.
 class ChApi ChPhysicsItem : public ChObj {
   public:
-    ChPhysicsItem() : system(NULL), offset_x(0), offset_w(0), offset_L(0) {}
+    ChPhysicsItem() : system(NULL), offset_x(0), offset_w(0), offset_L(0), parallel_update(false) {}
     ChPhysicsItem(const ChPhysicsItem& other);
     virtual ~ChPhysicsItem();
 
@@ -155,6 +155,19 @@ class ChApi ChPhysicsItem : public ChObj {
     /// data. By default, calls Update(mytime) using item's current time.
     virtual void Update(bool update_assets = true) { Update(ChTime, update_assets); }
 
+    /// Enable/disable concurrent updates of this item.
+    /// If enabled, the owning assembly may call Update() on this item concurrently with the updates of other items of
+    /// the same kind (bodies, shafts, FEA meshes, or links), when the system uses more than one Chrono thread.
+    /// Only enable this flag if Update() does not modify data shared with other items. In particular, user-provided
+    /// objects (e.g., force functors, motor functions, visual shapes) are typically not thread-safe and may be shared
+    /// by several items. Items with this flag disabled are updated sequentially, after all other items of the same
+    /// kind. This flag is disabled by default, but enabled by ChBody, ChShaft, ChLinkLock, and ChLinkMateGeneric
+    /// (except for motors), whose Update() only modifies the item itself.
+    void EnableParallelUpdate(bool val) { parallel_update = val; }
+
+    /// Return true if this item can be updated concurrently with other items.
+    bool IsParallelUpdateEnabled() const { return parallel_update; }
+
     /// Set zero speed (and zero accelerations) in state, without changing the position.
     /// Child classes should implement this function if GetNumCoordsPosLevel() > 0.
     /// It is used by owner ChSystem for some static analysis.
@@ -430,6 +443,8 @@ class ChApi ChPhysicsItem : public ChObj {
     unsigned int offset_w;  ///< offset in vector of state (speed part)
     unsigned int offset_L;  ///< offset in vector of lagrangian multipliers
 
+    bool parallel_update;  ///< can Update() be called concurrently with other items?
+
   private:
     virtual void SetupInitial() {}
 
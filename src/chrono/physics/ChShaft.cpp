@@ -37,6 +37,9 @@ ChShaft::ChShaft()
       sleeping(false) {
     SetSleepingAllowed(true);
     variables.SetShaft(this);
+
+    // Update() only modifies the shaft itself
+    EnableParallelUpdate(true);
 }
 
 ChShaft::ChShaft(const ChShaft& other) : ChPhysicsItem(other) {
@@ -206,6 +209,13 @@ void ChShaft::ClampSpeed() {
     }
 }
 
+void ChShaft::SetSleeping(bool ms) {
+    // A change in the sleeping state changes the set of active variables
+    if (system && ms != sleeping)
+        system->ForceDescriptorRebuild();
+    sleeping = ms;
+}
+
 bool ChShaft::TrySleeping() {
     if (IsSleepingAllowed()) {
         if (IsSleeping())
@@ -119,7 +119,7 @@ class ChApi ChShaft : public ChPhysicsItem, public ChLoadable {
 
     /// Force the shaft in sleeping mode or not.
     /// Note: Usually this state change is not handled by users, because it is mostly automatic.
-    void SetSleeping(bool ms) { sleeping = ms; }
+    void SetSleeping(bool ms);
 
     /// Tell if the shaft is actually in sleeping state.
     bool IsSleeping() const { return sleeping; }
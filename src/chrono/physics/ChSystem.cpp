@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <iomanip>
 #include <fstream>
+#include <functional>
 
 #include "chrono/collision/bullet/ChCollisionSystemBullet.h"
 #ifdef CHRONO_COLLISION
@@ -29,10 +30,12 @@
 #include "chrono/solver/ChSolverPMINRES.h"
 #include "chrono/solver/ChSolverPSOR.h"
 #include "chrono/solver/ChSolverPSSOR.h"
+#include "chrono/solver/ChSolverPSORcolored.h"
 #include "chrono/solver/ChIterativeSolverLS.h"
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChMatrix.h"
 #include "chrono/utils/ChProfiler.h"
+#include "chrono/utils/ChUnionFind.h"
 #include "chrono/physics/ChLinkMate.h"
 
 namespace chrono {
@@ -45,6 +48,8 @@ ChSystem::ChSystem()
     : G_acc(ChVector3d(0, -9.8, 0)),
       is_initialized(false),
       is_updated(false),
+      descriptor_incremental(false),
+      descriptor_dirty(true),
       m_num_coords_pos(0),
       m_num_coords_vel(0),
       m_num_constr(0),
@@ -54,6 +59,8 @@ ChSystem::ChSystem()
       m_RTF(0),
       step(0.04),
       use_sleeping(false),
+      m_num_islands(0),
+      m_num_islands_sleeping(0),
       max_penetration_recovery_speed(0.6),
       stepcount(0),
       setupcount(0),
@@ -77,7 +84,8 @@ ChSystem::ChSystem()
     timestepper = chrono_types::make_shared<ChTimestepperEulerImplicitLinearized>(this);
 }
 
-ChSystem::ChSystem(const ChSystem& other) : m_RTF(0), collision_system(nullptr), visual_system(nullptr) {
+ChSystem::ChSystem(const ChSystem& other)
+    : m_num_islands(0), m_num_islands_sleeping(0), m_RTF(0), collision_system(nullptr), visual_system(nullptr) {
     // Required by ChAssembly
     assembly = other.assembly;
     assembly.system = this;
@@ -101,6 +109,8 @@ ChSystem::ChSystem(const ChSystem& other) : m_RTF(0), collision_system(nullptr),
     nthreads_collision = other.nthreads_collision;
     is_initialized = false;
     is_updated = false;
+    descriptor_incremental = other.descriptor_incremental;
+    descriptor_dirty = true;
     applied_forces_current = false;
 
     max_penetration_recovery_speed = other.max_penetration_recovery_speed;
@@ -130,7 +140,6 @@ void ChSystem::Clear() {
 // -----------------------------------------------------------------------------
 
 void ChSystem::AddBody(std::shared_ptr<ChBody> body) {
-    body->index = static_cast<unsigned int>(GetBodies().size());
     assembly.AddBody(body);
     body->SetSystem(this);
 }
@@ -260,6 +269,9 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
         case ChSolver::Type::PSSOR:
             solver = chrono_types::make_shared<ChSolverPSSOR>();
             break;
+        case ChSolver::Type::PSOR_COLORED:
+            solver = chrono_types::make_shared<ChSolverPSORcolored>();
+            break;
         case ChSolver::Type::PJACOBI:
             solver = chrono_types::make_shared<ChSolverPJacobi>();
             break;
@@ -287,8 +299,10 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
         default:
             std::cout << "Unknown solver type. No solver was set." << std::endl;
             std::cout << "Use SetSolver()." << std::endl;
-            break;
+            return;
     }
+
+    solver->SetNumThreads(nthreads_chrono);
 }
 
 void ChSystem::EnableSolverMatrixWrite(bool val, const std::string& out_dir) {
@@ -314,11 +328,18 @@ void ChSystem::UnregisterCustomCollisionCallback(std::shared_ptr<CustomCollision
 void ChSystem::SetSystemDescriptor(std::shared_ptr<ChSystemDescriptor> newdescriptor) {
     assert(newdescriptor);
     descriptor = newdescriptor;
+    descriptor_dirty = true;
+}
+
+void ChSystem::EnableIncrementalDescriptor(bool val) {
+    descriptor_incremental = val;
+    descriptor_dirty = true;
 }
 
 void ChSystem::SetSolver(std::shared_ptr<ChSolver> newsolver) {
     assert(newsolver);
     solver = newsolver;
+    solver->SetNumThreads(nthreads_chrono);
 }
 
 void ChSystem::SetCollisionSystemType(ChCollisionSystem::Type type) {
@@ -377,6 +398,8 @@ void ChSystem::SetNumThreads(int num_threads_chrono, int num_threads_collision,
 
     if (collision_system)
         collision_system->SetNumThreads(nthreads_collision);
+    if (solver)
+        solver->SetNumThreads(nthreads_chrono);
 }
 
 // -----------------------------------------------------------------------------
@@ -464,131 +487,131 @@ void ChSystem::SetTimestepperType(ChTimestepper::Type type) {
 }
 
 bool ChSystem::ManageSleepingBodies() {
+    m_num_islands = 0;
+    m_num_islands_sleeping = 0;
+
     if (!IsSleepingAllowed())
-        return 0;
+        return false;
 
-    // STEP 1:
-    // See if some body could change from no sleep to sleep
+    const auto& bodies = assembly.bodylist;
+    unsigned int nbodies = (unsigned int)bodies.size();
 
-    for (auto& body : assembly.bodylist) {
-        // mark as 'could sleep' candidate
+    // STEP 1:
+    // Mark as sleep candidates the awake bodies that came to rest.
+    // A body that is neither sleeping, nor a sleep candidate, nor fixed keeps its island awake.
+
+    std::unordered_map<const ChBody*, unsigned int> body_index;
+    body_index.reserve(nbodies);
+    std::vector<char> restless(nbodies);
+    for (unsigned int i = 0; i < nbodies; i++) {
+        const auto& body = bodies[i];
         body->TrySleeping();
+        body_index.emplace(body.get(), i);
+        restless[i] = !body->IsFixed() && !body->IsSleeping() && !body->candidate_sleeping;
     }
 
     // STEP 2:
-    // See if some sleeping or potential sleeping body is touching a non sleeping one; if so, set to no sleep.
-
-    // Make this class for iterating through contacts
-    class _wakeup_reporter_class : public ChContactContainer::ReportContactCallback {
-      public:
-        // Callback, used to report contact points already added to the container.
-        // If returns false, the contact scanning will be stopped.
-        virtual bool OnReportContact(
-            const ChVector3d& pA,             // get contact pA
-            const ChVector3d& pB,             // get contact pB
-            const ChMatrix33<>& plane_coord,  // get contact plane coordsystem (A column 'X' is contact normal)
-            const double& distance,           // get contact distance
-            const double& eff_radius,         // effective radius of curvature at contact
-            const ChVector3d& react_forces,   // get react.forces (if already computed). In coordsystem 'plane_coord'
-            const ChVector3d& react_torques,  // get react.torques, if rolling friction (if already computed).
-            ChContactable* contactobjA,  // get model A (note: some containers may not support it and could be zero!)
-            ChContactable* contactobjB   // get model B (note: some containers may not support it and could be zero!)
-            ) override {
-            if (!(contactobjA && contactobjB))
-                return true;
-            ChBody* b1 = dynamic_cast<ChBody*>(contactobjA);
-            ChBody* b2 = dynamic_cast<ChBody*>(contactobjB);
-            if (!(b1 && b2))
-                return true;
-            bool sleep1 = b1->IsSleeping();
-            bool sleep2 = b2->IsSleeping();
-            bool could_sleep1 = b1->candidate_sleeping;
-            bool could_sleep2 = b2->candidate_sleeping;
-            bool ground1 = b1->IsFixed();
-            bool ground2 = b2->IsFixed();
-            if (sleep1 && !(sleep2 || could_sleep2) && !ground2) {
-                b1->SetSleeping(false);
-                need_Setup_A = true;
-            }
-            if (sleep2 && !(sleep1 || could_sleep1) && !ground1) {
-                b2->SetSleeping(false);
-                need_Setup_A = true;
-            }
-            if (could_sleep1 && !(sleep2 || could_sleep2) && !ground2) {
-                b1->candidate_sleeping = false;
-            }
-            if (could_sleep2 && !(sleep1 || could_sleep1) && !ground1) {
-                b2->candidate_sleeping = false;
-            }
-            someone_sleeps = someone_sleeps || sleep1 || sleep2;
+    // Partition the non-fixed bodies in islands, connected through links and contacts.
+    // Fixed bodies do not propagate motion and therefore do not connect islands.
 
-            return true;  // to continue scanning contacts
-        }
+    ChUnionFind islands(nbodies);
 
-        // Data
-        bool someone_sleeps;
-        bool need_Setup_A;
+    auto connect = [&](const ChBody* b1, const ChBody* b2) {
+        if (!b1 || !b2 || b1->IsFixed() || b2->IsFixed())
+            return;
+        auto i1 = body_index.find(b1);
+        auto i2 = body_index.find(b2);
+        if (i1 != body_index.end() && i2 != body_index.end())
+            islands.Union(i1->second, i2->second);
     };
 
-    auto my_waker = chrono_types::make_shared<_wakeup_reporter_class>();
-    my_waker->need_Setup_A = false;
+    // Contacts between two sleeping bodies are not generated, so bodies put to sleep together stay in the same island
+    std::unordered_map<unsigned int, unsigned int> label_body;
+    for (unsigned int i = 0; i < nbodies; i++) {
+        if (!bodies[i]->IsSleeping())
+            continue;
+        auto label = sleeping_islands.find(bodies[i].get());
+        if (label == sleeping_islands.end())
+            continue;
+        auto first = label_body.emplace(label->second, i);
+        if (!first.second)
+            islands.Union(i, first.first->second);
+    }
 
-    bool need_Setup_L = false;
+    // Links (only those which require connected bodies to be woken up)
+    for (auto& link : assembly.linklist) {
+        if (auto Lpointer = std::dynamic_pointer_cast<ChLink>(link)) {
+            if (Lpointer->IsActive() && Lpointer->IsRequiringWaking())
+                connect(dynamic_cast<ChBody*>(Lpointer->GetBody1()), dynamic_cast<ChBody*>(Lpointer->GetBody2()));
+        }
+    }
 
-    for (int i = 0; i < 1; i++)  //// TODO  reconfigurable number of wakeup cycles
-    {
-        my_waker->someone_sleeps = false;
-
-        // scan all links and wake connected bodies
-        for (auto& link : assembly.linklist) {
-            if (auto Lpointer = std::dynamic_pointer_cast<ChLink>(link)) {
-                if (Lpointer->IsRequiringWaking()) {
-                    ChBody* b1 = dynamic_cast<ChBody*>(Lpointer->GetBody1());
-                    ChBody* b2 = dynamic_cast<ChBody*>(Lpointer->GetBody2());
-                    if (b1 && b2) {
-                        bool sleep1 = b1->IsSleeping();
-                        bool sleep2 = b2->IsSleeping();
-                        bool could_sleep1 = b1->candidate_sleeping;
-                        bool could_sleep2 = b2->candidate_sleeping;
-                        if (sleep1 && !(sleep2 || could_sleep2)) {
-                            b1->SetSleeping(false);
-                            need_Setup_L = true;
-                        }
-                        if (sleep2 && !(sleep1 || could_sleep1)) {
-                            b2->SetSleeping(false);
-                            need_Setup_L = true;
-                        }
-                        if (could_sleep1 && !(sleep2 || could_sleep2)) {
-                            b1->candidate_sleeping = false;
-                        }
-                        if (could_sleep2 && !(sleep1 || could_sleep1)) {
-                            b2->candidate_sleeping = false;
-                        }
-                    }
-                }
-            }
+    // Contacts
+    class _island_reporter_class : public ChContactContainer::ReportContactCallback {
+      public:
+        _island_reporter_class(const std::function<void(const ChBody*, const ChBody*)>& f) : connect(f) {}
+
+        virtual bool OnReportContact(const ChVector3d& pA,
+                                     const ChVector3d& pB,
+                                     const ChMatrix33<>& plane_coord,
+                                     const double& distance,
+                                     const double& eff_radius,
+                                     const ChVector3d& react_forces,
+                                     const ChVector3d& react_torques,
+                                     ChContactable* contactobjA,
+                                     ChContactable* contactobjB) override {
+            connect(dynamic_cast<ChBody*>(contactobjA), dynamic_cast<ChBody*>(contactobjB));
+            return true;  // to continue scanning contacts
         }
 
-        // scan all contacts and wake neighboring bodies
-        contact_container->ReportAllContacts(my_waker);
+        std::function<void(const ChBody*, const ChBody*)> connect;
+    };
 
-        // bailout wakeup cycle prematurely, if all bodies are not sleeping
-        if (!my_waker->someone_sleeps)
-            break;
+    auto island_reporter = chrono_types::make_shared<_island_reporter_class>(connect);
+    contact_container->ReportAllContacts(island_reporter);
+
+    // STEP 3:
+    // Put to sleep the islands where all bodies came to rest and wake up all other islands.
+
+    std::vector<char> island_awake(nbodies, 0);
+    std::vector<char> island_root(nbodies, 0);
+    for (unsigned int i = 0; i < nbodies; i++) {
+        if (bodies[i]->IsFixed())
+            continue;
+        auto root = islands.Find(i);
+        island_root[root] = 1;
+        if (restless[i])
+            island_awake[root] = 1;
+    }
+
+    bool changed = false;
+    std::unordered_map<const ChBody*, unsigned int> labels;
+    for (unsigned int i = 0; i < nbodies; i++) {
+        const auto& body = bodies[i];
+        if (body->IsFixed())
+            continue;
+        auto root = islands.Find(i);
+        bool sleep = !island_awake[root];
+        if (sleep != body->IsSleeping()) {
+            body->SetSleeping(sleep);
+            changed = true;
+        }
+        if (sleep)
+            labels.emplace(body.get(), root);
     }
+    sleeping_islands.swap(labels);
 
-    /// If some body still must change from no sleep-> sleep, do it
-    int need_Setup_B = 0;
-    for (auto& body : assembly.bodylist) {
-        if (body->candidate_sleeping) {
-            body->SetSleeping(true);
-            ++need_Setup_B;
+    for (unsigned int i = 0; i < nbodies; i++) {
+        if (island_root[i]) {
+            m_num_islands++;
+            if (!island_awake[i])
+                m_num_islands_sleeping++;
         }
     }
 
-    // if some body has been activated/deactivated because of sleep state changes,
+    // If some body has been activated/deactivated because of sleep state changes,
     // the offsets and DOF counts must be updated:
-    if (my_waker->need_Setup_A || need_Setup_B || need_Setup_L) {
+    if (changed) {
         Setup();
         return true;
     }
@@ -599,12 +622,53 @@ bool ChSystem::ManageSleepingBodies() {
 //  DESCRIPTOR BOOKKEEPING
 // -----------------------------------------------------------------------------
 
+// Counters (as set in ChAssembly::Setup) used to detect changes in the assembly section of the system descriptor.
+static std::array<unsigned int, 12> GetAssemblySizes(ChAssembly& assembly) {
+    return {assembly.GetNumBodiesActive(),
+            assembly.GetNumBodiesSleeping(),
+            assembly.GetNumBodiesFixed(),
+            assembly.GetNumShafts(),
+            assembly.GetNumShaftsSleeping(),
+            assembly.GetNumShaftsFixed(),
+            assembly.GetNumLinksActive(),
+            assembly.GetNumMeshes(),
+            assembly.GetNumOtherPhysicsItemsActive(),
+            assembly.GetNumCoordsVelLevel(),
+            assembly.GetNumConstraintsBilateral(),
+            assembly.GetNumConstraintsUnilateral()};
+}
+
 void ChSystem::DescriptorPrepareInject(ChSystemDescriptor& sys_descriptor) {
-    sys_descriptor.BeginInsertion();  // This resets the vectors of constr. and var. pointers.
+    if (!descriptor_incremental) {
+        sys_descriptor.BeginInsertion();  // This resets the vectors of constr. and var. pointers.
 
-    InjectConstraints(sys_descriptor);
-    InjectVariables(sys_descriptor);
-    InjectKRMMatrices(sys_descriptor);
+        InjectConstraints(sys_descriptor);
+        InjectVariables(sys_descriptor);
+        InjectKRMMatrices(sys_descriptor);
+
+        sys_descriptor.EndInsertion();
+        return;
+    }
+
+    // Incremental rebuild: if the assembly is unchanged since the last full rebuild, keep its (persistent) items in
+    // the descriptor and only re-inject the items of the contact container.
+    auto sizes = GetAssemblySizes(assembly);
+    if (!descriptor_dirty && &sys_descriptor == descriptor.get() && sizes == descriptor_sizes) {
+        sys_descriptor.BeginIncrementalInsertion();
+    } else {
+        sys_descriptor.BeginInsertion();
+        assembly.InjectConstraints(sys_descriptor);
+        assembly.InjectVariables(sys_descriptor);
+        assembly.InjectKRMMatrices(sys_descriptor);
+        sys_descriptor.MarkPersistentItems();
+
+        descriptor_dirty = (&sys_descriptor != descriptor.get());
+        descriptor_sizes = sizes;
+    }
+
+    contact_container->InjectConstraints(sys_descriptor);
+    contact_container->InjectVariables(sys_descriptor);
+    contact_container->InjectKRMMatrices(sys_descriptor);
 
     sys_descriptor.EndInsertion();
 }
@@ -708,7 +772,10 @@ void ChSystem::Update(bool update_assets) {
     assembly.Update(update_assets);
 
     // Update all contacts, if any
-    contact_container->Update(ch_time, update_assets);
+    {
+        CH_PROFILE_CATEGORY("Update", "contacts");
+        contact_container->Update(ch_time, update_assets);
+    }
 
     // Update any attached visualization system only when also updating assets
     if (visual_system && update_assets)
@@ -862,7 +929,10 @@ void ChSystem::LoadConstraintJacobians() {
     assembly.LoadConstraintJacobians();
 
     // Use also on contact container:
-    contact_container->LoadConstraintJacobians();
+    {
+        CH_PROFILE_CATEGORY("Load Jacobians", "contacts");
+        contact_container->LoadConstraintJacobians();
+    }
 }
 
 void ChSystem::ConstraintsFetch_react(double factor) {
@@ -886,7 +956,10 @@ void ChSystem::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
     assembly.LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
 
     // Use also on contact container:
-    contact_container->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    {
+        CH_PROFILE_CATEGORY("Load KRM", "contacts");
+        contact_container->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -1027,14 +1100,19 @@ bool ChSystem::StateSolveCorrection(
     // R and Qc vectors  --> solver sparse solver structures  (also sets Dl and Dv to warmstart)
     IntToDescriptor(0, Dv, R, 0, Dl, Qc);
 
+    // Cq matrix.
+    // Always load the constraint Jacobians, even if the solver matrix is reused, since they are also used in the
+    // calculation of the residual (Cq'*l) at the next Newton iteration.
+    timer_jacobian.start();
+    LoadConstraintJacobians();
+    timer_jacobian.stop();
+
     // If the solver's Setup() must be called or if the solver's Solve() requires it,
-    // fill the sparse system structures with information in G and Cq.
+    // fill the sparse system structures with information in G.
     if (force_setup || GetSolver()->SolveRequiresMatrix()) {
+        CH_PROFILE("Jacobians");
         timer_jacobian.start();
 
-        // Cq  matrix
-        LoadConstraintJacobians();
-
         // G matrix: M, K, R components
         if (c_a || c_v || c_x)
             LoadKRMMatrices(-c_x, -c_v, c_a);
@@ -1070,6 +1148,7 @@ bool ChSystem::StateSolveCorrection(
     // If indicated, first perform a solver setup.
     // Return 'false' if the setup phase fails.
     if (force_setup) {
+        CH_PROFILE("LS setup");
         timer_ls_setup.start();
         bool success = GetSolver()->Setup(*descriptor);
         timer_ls_setup.stop();
@@ -1080,9 +1159,12 @@ bool ChSystem::StateSolveCorrection(
 
     // Solve the problem
     // The solution is scattered in the provided system descriptor
-    timer_ls_solve.start();
-    GetSolver()->Solve(*descriptor);
-    timer_ls_solve.stop();
+    {
+        CH_PROFILE("LS solve");
+        timer_ls_solve.start();
+        SolveDescriptor();
+        timer_ls_solve.stop();
+    }
 
     // Dv and Dl vectors  <-- sparse solver structures
     IntFromDescriptor(0, Dv, 0, Dl);
@@ -1114,6 +1196,10 @@ bool ChSystem::StateSolveCorrection(
     return true;
 }
 
+void ChSystem::SolveDescriptor() {
+    GetSolver()->Solve(*descriptor);
+}
+
 ChVector3d ChSystem::GetBodyAppliedForce(ChBody* body) {
     if (!is_initialized)
         return ChVector3d(0, 0, 0);
@@ -1148,7 +1234,10 @@ void ChSystem::LoadResidual_F(ChVectorDynamic<>& R, const double c) {
 
     // Use also on contact container:
     unsigned int displ_v = off - assembly.offset_w;
-    contact_container->IntLoadResidual_F(displ_v + contact_container->GetOffset_w(), R, c);
+    {
+        CH_PROFILE_CATEGORY("Load forces", "contacts");
+        contact_container->IntLoadResidual_F(displ_v + contact_container->GetOffset_w(), R, c);
+    }
 }
 
 // Increment a vector R with a term that has M multiplied a given vector w:
@@ -15,6 +15,7 @@
 #ifndef CHSYSTEM_H
 #define CHSYSTEM_H
 
+#include <array>
 #include <cfloat>
 #include <memory>
 #include <cstdlib>
@@ -22,6 +23,7 @@
 #include <cstring>
 #include <iostream>
 #include <list>
+#include <unordered_map>
 
 #include "chrono/core/ChGlobal.h"
 #include "chrono/core/ChFrame.h"
@@ -144,6 +146,24 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Access directly the 'system descriptor'.
     std::shared_ptr<ChSystemDescriptor> GetSystemDescriptor() { return descriptor; }
 
+    /// Enable/disable incremental rebuild of the system descriptor (default: false).
+    /// If enabled, the variables, constraints, and KRM blocks of the assembly are kept in the system descriptor from
+    /// one step to the next and only the contact section of the descriptor is rebuilt at each step. The assembly
+    /// section is re-injected only if items were added to or removed from the system, or if the number of active
+    /// items, coordinates, or constraints in the assembly changed.
+    /// Loads added to or removed from a ChLoadContainer and constraints re-created by ChLinkMateGeneric also trigger a
+    /// full rebuild. Any other item that replaces the constraints or KRM blocks it injects (even if their number is
+    /// unchanged), or that activates some constraints while deactivating others, must call ForceDescriptorRebuild.
+    void EnableIncrementalDescriptor(bool val);
+
+    /// Force a full rebuild of the system descriptor at the next step.
+    /// The system is also marked out of date, so that the Jacobians of re-created constraints are loaded before the
+    /// next solve. The rebuild itself is only relevant if incremental descriptor rebuild is enabled.
+    void ForceDescriptorRebuild() {
+        descriptor_dirty = true;
+        is_updated = false;
+    }
+
     /// Set the gravitational acceleration vector.
     void SetGravitationalAcceleration(const ChVector3d& gacc) { G_acc = gacc; }
 
@@ -302,8 +322,15 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// at the first Setup() call. This is thread safe.
     void AddBatch(std::shared_ptr<ChPhysicsItem> item) { assembly.AddBatch(item); }
 
-    /// If some items are queued for addition in the assembly, using AddBatch(), this will
-    /// effectively add them and clean the batch. Called automatically at each Setup().
+    /// Items removed in this way are removed like in the Remove() method, but not instantly,
+    /// they are simply queued in a batch of 'to remove' items, that are removed automatically
+    /// at the first Setup() call. The collision models of all queued bodies are removed from
+    /// the collision system at once, which is much faster when removing many bodies.
+    void RemoveBatch(std::shared_ptr<ChPhysicsItem> item) { assembly.RemoveBatch(item); }
+
+    /// If some items are queued for addition or removal in the assembly, using AddBatch() or
+    /// RemoveBatch(), this will effectively add/remove them and clean the batches. Removals are
+    /// processed first. Called automatically at each Setup().
     void FlushBatch() { assembly.FlushBatch(); }
 
     /// Remove a body from this assembly.
@@ -381,6 +408,12 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Get the number of bodies fixed to ground.
     virtual unsigned int GetNumBodiesFixed() const { return assembly.GetNumBodiesFixed(); }
 
+    /// Get the number of body islands found at the last sleeping check (see SetSleepingAllowed).
+    unsigned int GetNumIslands() const { return m_num_islands; }
+
+    /// Get the number of sleeping body islands found at the last sleeping check (see SetSleepingAllowed).
+    unsigned int GetNumIslandsSleeping() const { return m_num_islands_sleeping; }
+
     /// Get the number of shafts.
     virtual unsigned int GetNumShafts() const { return assembly.GetNumShafts(); }
 
@@ -465,7 +498,12 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Turn on this feature to let the system put to sleep the bodies whose
     /// motion has almost come to a rest. This feature will allow faster simulation
     /// of large scenarios for real-time purposes, but it will affect the precision!
-    /// This functionality can be turned off selectively for specific ChBodies.
+    /// This functionality can be turned off selectively for specific ChBodies.\n
+    /// Sleeping is managed per island: the non-fixed bodies are partitioned in islands of bodies connected (directly
+    /// or indirectly) through links and contacts, and an island is put to sleep only when all its bodies came to rest.
+    /// Conversely, a sleeping island is woken up as a whole as soon as one of its bodies is connected to a moving body.
+    /// Fixed bodies do not connect islands. The constraints of links between sleeping (or fixed) bodies are not
+    /// included in the system descriptor.
     void SetSleepingAllowed(bool ms) { use_sleeping = ms; }
 
     /// Tell if the system will put to sleep the bodies whose motion has almost come to a rest.
@@ -754,6 +792,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
   protected:
     /// Pushes all ChConstraints and ChVariables contained in links, bodies, etc. into the system descriptor.
+    /// If incremental descriptor rebuild is enabled and the assembly did not change since the last full rebuild, only
+    /// the items of the contact container are pushed again (see EnableIncrementalDescriptor).
     virtual void DescriptorPrepareInject(ChSystemDescriptor& sys_descriptor);
 
     /// Initial system setup before analysis.
@@ -776,11 +816,16 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     virtual ChVector3d GetBodyAppliedTorque(ChBody* body);
 
     /// Put bodies to sleep if possible. Also awakens sleeping bodies, if needed.
+    /// Bodies are put to sleep and awakened by islands (see SetSleepingAllowed).
     /// Returns true if some body changed from sleep to no sleep or viceversa,
     /// returns false if nothing changed. In the former case also performs Setup()
     /// since the system changed.
     bool ManageSleepingBodies();
 
+    /// Solve the problem currently loaded in the system descriptor, using the current solver.
+    /// Called by StateSolveCorrection after the solver setup (if any).
+    virtual void SolveDescriptor();
+
     /// Performs a single dynamics simulation step, advancing the system state by the current step size.
     virtual bool AdvanceDynamics();
 
@@ -793,6 +838,10 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     bool is_initialized;  ///< if false, an initial setup is required (i.e. a call to Initialize)
     bool is_updated;      ///< if false, a new update is required (i.e. a call to Update)
 
+    bool descriptor_incremental;                    ///< rebuild only the contact section of the descriptor if possible
+    bool descriptor_dirty;                          ///< if true, a full rebuild of the descriptor is required
+    std::array<unsigned int, 12> descriptor_sizes;  ///< assembly counters at the last full rebuild of the descriptor
+
     unsigned int m_num_coords_pos;  ///< num of scalar coordinates at position level for all active bodies
     unsigned int m_num_coords_vel;  ///< num of scalar coordinates at velocity level for all active bodies
     unsigned int m_num_constr;      ///< num of scalar constraints (at velocity level) for all active constraints
@@ -804,6 +853,10 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     bool use_sleeping;  ///< if true, put to sleep objects that come to rest
 
+    std::unordered_map<const ChBody*, unsigned int> sleeping_islands;  ///< island labels of sleeping bodies
+    unsigned int m_num_islands;                                        ///< number of body islands
+    unsigned int m_num_islands_sleeping;                               ///< number of sleeping body islands
+
     std::shared_ptr<ChSystemDescriptor> descriptor;  ///< system descriptor
     std::shared_ptr<ChSolver> solver;                ///< solver for DVI or DAE problem
 
@@ -18,18 +18,27 @@
 // =============================================================================
 
 #include <algorithm>
+#include <typeinfo>
 
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChContactContainerNSC.h"
 #include "chrono/physics/ChProximityContainer.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/solver/ChSolverAPGD.h"
+#include "chrono/solver/ChSolverBB.h"
+#include "chrono/solver/ChSolverPJacobi.h"
+#include "chrono/solver/ChSolverPMINRES.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSORcolored.h"
+#include "chrono/solver/ChSolverPSSOR.h"
+#include "chrono/utils/ChUnionFind.h"
 
 namespace chrono {
 
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChSystemNSC)
 
-ChSystemNSC::ChSystemNSC() : ChSystem() {
+ChSystemNSC::ChSystemNSC() : ChSystem(), m_island_solver(false) {
     // Set the system descriptor
     descriptor = chrono_types::make_shared<ChSystemDescriptor>();
 
@@ -45,7 +54,7 @@ ChSystemNSC::ChSystemNSC() : ChSystem() {
     ChCollisionModel::SetDefaultSuggestedMargin(0.01);
 }
 
-ChSystemNSC::ChSystemNSC(const ChSystemNSC& other) : ChSystem(other) {}
+ChSystemNSC::ChSystemNSC(const ChSystemNSC& other) : ChSystem(other), m_island_solver(other.m_island_solver) {}
 
 void ChSystemNSC::SetContactContainer(std::shared_ptr<ChContactContainer> container) {
     if (std::dynamic_pointer_cast<ChContactContainerNSC>(container))
@@ -56,6 +65,205 @@ void ChSystemNSC::SetMinBounceSpeed(double value) {
     std::static_pointer_cast<ChContactContainerNSC>(contact_container)->min_bounce_speed = value;
 }
 
+// -----------------------------------------------------------------------------
+// Solution of independent islands
+
+void ChSystemNSC::SolveDescriptor() {
+    m_island_order.clear();
+
+    if (!m_island_solver || !SetupIslandSolvers() || !PartitionIslands()) {
+        m_island_order.clear();
+        ChSystem::SolveDescriptor();
+        return;
+    }
+
+    // Solve the islands concurrently, each with the solver of the executing thread.
+    // Islands do not share active variables, so that the solvers never update the same data.
+    int nislands = (int)m_island_order.size();
+    std::vector<int> iterations(nislands);
+    std::vector<double> errors(nislands);
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads_chrono)
+    for (int i = 0; i < nislands; i++) {
+        auto& island_solver = m_island_solvers[ChOMP::GetThreadNum()];
+        island_solver->Solve(*m_island_descriptors[m_island_order[i]]);
+        iterations[i] = island_solver->GetIterations();
+        errors[i] = island_solver->GetError();
+    }
+
+    // Report the statistics of the worst island through the system solver
+    std::static_pointer_cast<ChIterativeSolverVI>(solver)->SetSolveStatistics(
+        *std::max_element(iterations.begin(), iterations.end()), *std::max_element(errors.begin(), errors.end()));
+
+    // The island descriptors overwrote the offsets of variables and constraints; restore the global offsets
+    descriptor->UpdateCountsAndOffsets();
+}
+
+static std::shared_ptr<ChIterativeSolverVI> CreateIslandSolver(ChSolver::Type type) {
+    switch (type) {
+        case ChSolver::Type::PSOR:
+            return chrono_types::make_shared<ChSolverPSOR>();
+        case ChSolver::Type::PSSOR:
+            return chrono_types::make_shared<ChSolverPSSOR>();
+        case ChSolver::Type::PSOR_COLORED:
+            return chrono_types::make_shared<ChSolverPSORcolored>();
+        case ChSolver::Type::PJACOBI:
+            return chrono_types::make_shared<ChSolverPJacobi>();
+        case ChSolver::Type::PMINRES:
+            return chrono_types::make_shared<ChSolverPMINRES>();
+        case ChSolver::Type::BARZILAIBORWEIN:
+            return chrono_types::make_shared<ChSolverBB>();
+        case ChSolver::Type::APGD:
+            return chrono_types::make_shared<ChSolverAPGD>();
+        default:
+            return nullptr;
+    }
+}
+
+bool ChSystemNSC::SetupIslandSolvers() {
+    auto solver_vi = std::dynamic_pointer_cast<ChIterativeSolverVI>(solver);
+    if (!solver_vi)
+        return false;
+
+    size_t nthreads = (size_t)std::max(1, nthreads_chrono);
+    if (m_island_solvers.size() != nthreads || m_island_solvers[0]->GetType() != solver->GetType()) {
+        m_island_solvers.clear();
+        for (size_t i = 0; i < nthreads; i++) {
+            auto island_solver = CreateIslandSolver(solver->GetType());
+            if (!island_solver)
+                return false;
+            m_island_solvers.push_back(island_solver);
+        }
+    }
+
+    for (auto& island_solver : m_island_solvers) {
+        island_solver->SetMaxIterations(solver_vi->GetMaxIterations());
+        island_solver->SetTolerance(solver_vi->GetTolerance());
+        island_solver->EnableDiagonalPreconditioner(solver_vi->IsDiagonalPreconditionerEnabled());
+        island_solver->EnableWarmStart(solver_vi->IsWarmStartEnabled());
+        island_solver->SetOmega(solver_vi->GetOmega());
+        island_solver->SetSharpnessLambda(solver_vi->GetSharpnessLambda());
+        island_solver->SetNumThreads(1);
+    }
+
+    return true;
+}
+
+bool ChSystemNSC::PartitionIslands() {
+    if (typeid(*descriptor) != typeid(ChSystemDescriptor))
+        return false;
+
+    auto& variables = descriptor->GetVariables();
+    auto& constraints = descriptor->GetConstraints();
+    auto& krm_blocks = descriptor->GetKRMBlocks();
+
+    // Index the active variables by their offset in the global state vector
+    unsigned int n_q = descriptor->CountActiveVariables();
+    std::vector<unsigned int> var_index(n_q);
+    std::vector<ChVariables*> active_vars;
+    for (auto var : variables) {
+        if (var->IsActive() && var->GetDOF() > 0) {
+            var_index[var->GetOffset()] = (unsigned int)active_vars.size();
+            active_vars.push_back(var);
+        }
+    }
+    unsigned int nvars = (unsigned int)active_vars.size();
+
+    // Merge the variables coupled by a constraint or a KRM block.
+    // Return the index of one of the coupled active variables (or -1 if none).
+    ChUnionFind islands(nvars);
+    bool consistent = true;
+    auto join = [&](const std::vector<ChVariables*>& vars) {
+        int first = -1;
+        for (auto var : vars) {
+            if (!var || !var->IsActive() || var->GetDOF() == 0)
+                continue;
+            if (var->GetOffset() >= n_q || active_vars[var_index[var->GetOffset()]] != var) {
+                consistent = false;  // active variable not included in the system descriptor
+                continue;
+            }
+            int k = (int)var_index[var->GetOffset()];
+            if (first < 0)
+                first = k;
+            else
+                islands.Union(first, k);
+        }
+        return first;
+    };
+
+    std::vector<ChVariables*> vars;
+    std::vector<int> constraint_var(constraints.size(), -1);
+    for (size_t ic = 0; ic < constraints.size(); ic++) {
+        if (!constraints[ic]->IsActive())
+            continue;
+        vars.clear();
+        if (!constraints[ic]->CollectVariables(vars))
+            return false;
+        constraint_var[ic] = join(vars);
+    }
+
+    std::vector<int> krm_var(krm_blocks.size(), -1);
+    for (size_t ik = 0; ik < krm_blocks.size(); ik++) {
+        vars.clear();
+        for (unsigned int m = 0; m < krm_blocks[ik]->GetNumVariables(); m++)
+            vars.push_back(krm_blocks[ik]->GetVariable(m));
+        krm_var[ik] = join(vars);
+    }
+    if (!consistent)
+        return false;
+
+    // Number the islands with at least one constraint or KRM block.
+    // All remaining (unconstrained) variables are collected in one additional descriptor.
+    std::vector<int> island_id(nvars, -1);
+    unsigned int nislands = 0;
+    for (auto k : constraint_var) {
+        if (k >= 0 && island_id[islands.Find(k)] < 0)
+            island_id[islands.Find(k)] = (int)nislands++;
+    }
+    for (auto k : krm_var) {
+        if (k >= 0 && island_id[islands.Find(k)] < 0)
+            island_id[islands.Find(k)] = (int)nislands++;
+    }
+    if (nislands < 2)
+        return false;
+
+    while (m_island_descriptors.size() < nislands + 1)
+        m_island_descriptors.push_back(chrono_types::make_unique<ChSystemDescriptor>());
+    for (unsigned int i = 0; i <= nislands; i++) {
+        m_island_descriptors[i]->BeginInsertion();
+        m_island_descriptors[i]->SetMassFactor(descriptor->GetMassFactor());
+    }
+
+    // Load the island descriptors, preserving the order of the items in the system descriptor
+    // (in particular, the normal and tangential components of a frictional contact remain consecutive)
+    for (unsigned int k = 0; k < nvars; k++) {
+        int id = island_id[islands.Find(k)];
+        m_island_descriptors[id < 0 ? nislands : id]->InsertVariables(active_vars[k]);
+    }
+    for (size_t ic = 0; ic < constraints.size(); ic++) {
+        if (constraint_var[ic] >= 0)
+            m_island_descriptors[island_id[islands.Find(constraint_var[ic])]]->InsertConstraint(constraints[ic]);
+    }
+    for (size_t ik = 0; ik < krm_blocks.size(); ik++) {
+        if (krm_var[ik] >= 0)
+            m_island_descriptors[island_id[islands.Find(krm_var[ik])]]->InsertKRMBlock(krm_blocks[ik]);
+    }
+
+    for (unsigned int i = 0; i <= nislands; i++) {
+        m_island_descriptors[i]->EndInsertion();
+        if (i < nislands || !m_island_descriptors[i]->GetVariables().empty())
+            m_island_order.push_back(i);
+    }
+
+    // Schedule the largest islands first
+    std::stable_sort(m_island_order.begin(), m_island_order.end(), [this](unsigned int a, unsigned int b) {
+        return m_island_descriptors[a]->GetConstraints().size() > m_island_descriptors[b]->GetConstraints().size();
+    });
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
 void ChSystemNSC::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChSystemNSC>();
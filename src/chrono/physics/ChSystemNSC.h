@@ -20,7 +20,11 @@
 #ifndef CH_SYSTEM_NSC_H
 #define CH_SYSTEM_NSC_H
 
+#include <memory>
+#include <vector>
+
 #include "chrono/physics/ChSystem.h"
+#include "chrono/solver/ChIterativeSolverVI.h"
 
 namespace chrono {
 
@@ -52,6 +56,28 @@ class ChApi ChSystemNSC : public ChSystem {
     /// happen with small high frequency rebounces and settling to static stacking might be more difficult.
     void SetMinBounceSpeed(double value);
 
+    /// Enable/disable the concurrent solution of independent islands (default: false).
+    /// If enabled, at each solver call the active variables in the system descriptor are partitioned in islands of
+    /// variables coupled (directly or indirectly) through constraints or KRM blocks. Each island is loaded in its own
+    /// descriptor and solved with its own instance of the system solver, with the islands processed concurrently using
+    /// the number of Chrono threads (see SetNumThreads). Each island is iterated until its own convergence, using the
+    /// settings of the system solver (maximum iterations, tolerance, overrelaxation, sharpness, preconditioning, and
+    /// warm start). Active constraints which do not act on any active variable are not solved. The number of iterations
+    /// and the error reported by the system solver (see ChIterativeSolver) are the maximum over all islands.\n
+    /// Island solving is available only with the iterative VI solvers PSOR, PSSOR, PSOR_COLORED, PJACOBI, PMINRES,
+    /// BARZILAIBORWEIN, and APGD. With any other solver, with a custom system descriptor, if some constraint does not
+    /// report its variables (see ChConstraint::CollectVariables), or if there is a single island, the full system
+    /// descriptor is passed to the system solver.
+    void EnableIslandSolver(bool val) { m_island_solver = val; }
+
+    /// Return true if the concurrent solution of independent islands is enabled.
+    bool IsIslandSolverEnabled() const { return m_island_solver; }
+
+    /// Return the number of island descriptors solved concurrently at the last solver call.
+    /// This includes a descriptor collecting all unconstrained variables (if any). A return value of 0 indicates that
+    /// the full system descriptor was passed to the system solver.
+    unsigned int GetNumIslandsSolved() const { return (unsigned int)m_island_order.size(); }
+
     // SERIALIZATION
 
     /// Method to allow serialization of transient data to archives.
@@ -59,6 +85,25 @@ class ChApi ChSystemNSC : public ChSystem {
 
     /// Method to allow deserialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
+
+  protected:
+    /// Solve the problem currently loaded in the system descriptor.
+    /// If enabled and possible, the independent islands are solved concurrently (see EnableIslandSolver).
+    virtual void SolveDescriptor() override;
+
+  private:
+    /// Create (if needed) one solver per Chrono thread, of the same type as the system solver, and copy the settings
+    /// of the system solver. Return false if the system solver does not support island solving.
+    bool SetupIslandSolvers();
+
+    /// Partition the system descriptor in island descriptors.
+    /// Return false if the system descriptor cannot be partitioned or if it contains a single island.
+    bool PartitionIslands();
+
+    bool m_island_solver;                                                   ///< solve islands concurrently
+    std::vector<std::shared_ptr<ChIterativeSolverVI>> m_island_solvers;     ///< island solvers (one per thread)
+    std::vector<std::unique_ptr<ChSystemDescriptor>> m_island_descriptors;  ///< pool of island descriptors
+    std::vector<unsigned int> m_island_order;                               ///< islands in use, largest first
 };
 
 CH_CLASS_VERSION(ChSystemNSC, 0)
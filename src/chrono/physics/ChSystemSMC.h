@@ -97,7 +97,9 @@ class ChApi ChSystemSMC : public ChSystem {
     TangentialDisplacementModel GetTangentialDisplacementModel() const { return m_tdispl_model; }
 
     /// Declare the contact forces as stiff.
-    /// If true, this enables calculation of contact force Jacobians.
+    /// If true, this enables calculation of contact force Jacobians. These are evaluated in closed form if supported
+    /// by the contact force algorithm (as is the case for the default algorithm with the Hooke, Hertz, and Flores
+    /// models) and approximated with finite differences otherwise.
     void SetStiffContact(bool val) { m_stiff_contact = val; }
     bool GetStiffContact() const { return m_stiff_contact; }
 
@@ -136,6 +138,59 @@ class ChApi ChSystemSMC : public ChSystem {
             ChContactable* objA,                       ///< pointer to contactable obj1
             ChContactable* objB                        ///< pointer to contactable obj2
         ) const = 0;
+
+        /// Calculate contact force and torque for a contact with tangential displacement history.
+        /// The accumulated tangential displacement (expressed in global frame) is carried over from the previous step
+        /// for persistent contacts and is zero for new contacts (see ChContactContainer::EnablePersistentContacts).
+        /// An implementation supporting the MultiStep tangential displacement model should update it. The default
+        /// implementation ignores the contact history and calls CalculateForceTorque.
+        virtual ChWrenchd CalculateForceTorqueWithHistory(
+            const ChSystemSMC& sys,        ///< containing system
+            const ChVector3d& normal_dir,  ///< normal contact direction (expressed in global frame)
+            const ChVector3d& p1,          ///< most penetrated point on obj1 (expressed in global frame)
+            const ChVector3d& p2,          ///< most penetrated point on obj2 (expressed in global frame)
+            const ChVector3d& vel1,        ///< velocity of contact point on obj1 (expressed in global frame)
+            const ChVector3d& vel2,        ///< velocity of contact point on obj2 (expressed in global frame)
+            const ChContactMaterialCompositeSMC& mat,  ///< composite material for contact pair
+            double delta,                              ///< overlap in normal direction
+            double eff_radius,                         ///< effective radius of curvature at contact
+            double mass1,                              ///< mass of obj1
+            double mass2,                              ///< mass of obj2
+            ChContactable* objA,                       ///< pointer to contactable obj1
+            ChContactable* objB,                       ///< pointer to contactable obj2
+            ChVector3d& tdispl                         ///< [in/out] accumulated tangential displacement
+        ) const {
+            return CalculateForceTorque(sys, normal_dir, p1, p2, vel1, vel2, mat, delta, eff_radius, mass1, mass2, objA,
+                                        objB);
+        }
+
+        /// Calculate the Jacobians of the contact force (as returned by CalculateForceTorqueWithHistory) with respect
+        /// to the relative position p1 - p2 and the relative velocity vel2 - vel1 of the two contact points.
+        /// These are used for stiff contacts with implicit integrators (see SetStiffContact). The normal direction
+        /// and overlap are assumed to vary with the contact points as normal_dir = (p1 - p2) / delta and
+        /// delta = |p1 - p2|; any contact torque is ignored. The provided tangential displacement is the one at the
+        /// start of the step. Return false if not implemented, in which case the contact Jacobians are approximated
+        /// with finite differences. The default implementation returns false.
+        virtual bool CalculateForceJacobians(
+            const ChSystemSMC& sys,        ///< containing system
+            const ChVector3d& normal_dir,  ///< normal contact direction (expressed in global frame)
+            const ChVector3d& p1,          ///< most penetrated point on obj1 (expressed in global frame)
+            const ChVector3d& p2,          ///< most penetrated point on obj2 (expressed in global frame)
+            const ChVector3d& vel1,        ///< velocity of contact point on obj1 (expressed in global frame)
+            const ChVector3d& vel2,        ///< velocity of contact point on obj2 (expressed in global frame)
+            const ChContactMaterialCompositeSMC& mat,  ///< composite material for contact pair
+            double delta,                              ///< overlap in normal direction
+            double eff_radius,                         ///< effective radius of curvature at contact
+            double mass1,                              ///< mass of obj1
+            double mass2,                              ///< mass of obj2
+            ChContactable* objA,                       ///< pointer to contactable obj1
+            ChContactable* objB,                       ///< pointer to contactable obj2
+            const ChVector3d& tdispl,                  ///< accumulated tangential displacement
+            ChMatrix33<>& dF_dp,                       ///< [out] Jacobian of contact force w.r.t. p1 - p2
+            ChMatrix33<>& dF_dv                        ///< [out] Jacobian of contact force w.r.t. vel2 - vel1
+        ) const {
+            return false;
+        }
     };
 
     /// Change the default SMC contact force calculation (and torque, too, if needed).
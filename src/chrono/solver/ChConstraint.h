@@ -15,12 +15,16 @@
 #ifndef CHCONSTRAINT_H
 #define CHCONSTRAINT_H
 
+#include <vector>
+
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChClassFactory.h"
 #include "chrono/core/ChMatrix.h"
 
 namespace chrono {
 
+class ChVariables;
+
 /// Base class for representing constraints (bilateral or unilateral).
 /// These constraints are used with variational inequality or DAE solvers for problems including equalities,
 /// inequalities, nonlinearities, etc.
@@ -226,6 +230,12 @@ class ChApi ChConstraint {
                                              unsigned int start_row,
                                              unsigned int start_col) const = 0;
 
+    /// Append to the provided list the ChVariables objects referenced by this constraint.
+    /// This connectivity information is used by solvers that process independent constraints concurrently (e.g.,
+    /// ChSolverPSORcolored). Return false if the constraint does not provide this information, in which case such
+    /// solvers must assume the constraint is coupled to all others.
+    virtual bool CollectVariables(std::vector<ChVariables*>& vars) const { return false; }
+
     /// Set offset in global q vector (set automatically by ChSystemDescriptor)
     void SetOffset(unsigned int off) { offset = off; }
 
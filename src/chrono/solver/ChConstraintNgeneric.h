@@ -48,6 +48,12 @@ class ChApi ChConstraintNgeneric : public ChConstraint {
     /// Set references to the constrained ChVariables objects,automatically creating/resizing Jacobians as needed.
     void SetVariables(std::vector<ChVariables*> mvars);
 
+    /// Append all constrained variable objects to the provided list.
+    virtual bool CollectVariables(std::vector<ChVariables*>& vars) const override {
+        vars.insert(vars.end(), variables.begin(), variables.end());
+        return true;
+    }
+
     /// This function updates the following auxiliary data:
     ///  - the Eq_a and Eq_b matrices
     ///  - the g_i product
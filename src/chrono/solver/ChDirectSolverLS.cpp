@@ -26,6 +26,8 @@ ChDirectSolverLS::ChDirectSolverLS()
     : m_lock(false),
       m_use_learner(true),
       m_force_update(true),
+      m_use_map(true),
+      m_nthreads(1),
       m_null_pivot_detection(false),
       m_use_rhs_sparsity(false),
       m_use_perm(false),
@@ -67,6 +69,7 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         std::cout << "  pattern locked? " << m_lock << std::endl;
         std::cout << "  CALL learner:   " << call_learner << std::endl;
         std::cout << "  CALL reserve:   " << call_reserve << std::endl;
+        std::cout << "  use map?        " << m_use_map << std::endl;
     }
 
     if (call_learner) {
@@ -80,8 +83,14 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         m_mat.reserve(Eigen::VectorXi::Constant(m_dim, static_cast<int>(m_dim * density)));
     }
 
-    // Let the system descriptor load the current matrix
-    sysd.BuildSystemMatrix(&m_mat, nullptr);
+    // With a locked sparsity pattern, fill in the matrix values using the cached assembly map (created at the first
+    // call with the final pattern). Otherwise, or if the map is out of date, let the system descriptor load the
+    // current matrix.
+    bool use_map = m_use_map && m_lock && !call_learner && !call_reserve && m_setup_call > 0;
+    if (!use_map || !sysd.BuildSystemMatrixMapped(m_mat, m_nthreads)) {
+        sysd.ResetSystemMatrixMap();
+        sysd.BuildSystemMatrix(&m_mat, nullptr);
+    }
 
     // Allow the matrix to be compressed
     m_mat.makeCompressed();
@@ -92,6 +92,15 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// or structure occurred. This function has no effect if the sparsity pattern learner is disabled.
     void ForceSparsityPatternUpdate() { m_force_update = true; }
 
+    /// Enable/disable use of a cached assembly map when the sparsity pattern is locked (default: enabled).\n
+    /// If enabled, the locations in the sparse matrix of all entries pasted by the system descriptor are computed once
+    /// and reused in subsequent calls, so that the matrix values are filled in parallel without insertions or searches.
+    /// The map is recomputed whenever the sparsity pattern is updated. See ChSystemDescriptor::BuildSystemMatrixMapped.
+    void UseAssemblyMap(bool val) { m_use_map = val; }
+
+    /// Set the number of OpenMP threads used for matrix assembly with a cached assembly map.
+    virtual void SetNumThreads(int nthreads) override { m_nthreads = nthreads; }
+
     /// Set estimate for matrix sparsity, a value in [0,1], with 0 indicating a fully dense matrix (default: 0.9).\n
     /// Only used if the sparsity pattern learner is disabled.
     void SetSparsityEstimate(double sparsity) { m_sparsity = sparsity; }
@@ -204,6 +213,8 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     bool m_lock;          ///< is the matrix sparsity pattern locked?
     bool m_use_learner;   ///< use the sparsity pattern learner?
     bool m_force_update;  ///< force a call to the sparsity pattern learner?
+    bool m_use_map;       ///< use a cached assembly map if the sparsity pattern is locked?
+    int m_nthreads;       ///< number of threads for mapped matrix assembly
 
     bool m_use_perm;              ///< use of the permutation vector?
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
@@ -54,6 +54,12 @@ class ChApi ChIterativeSolver {
     /// Get the current tolerance value.
     double GetTolerance() const { return m_tolerance; }
 
+    /// Return true if diagonal preconditioning is enabled.
+    bool IsDiagonalPreconditionerEnabled() const { return m_use_precond; }
+
+    /// Return true if warm starting is enabled.
+    bool IsWarmStartEnabled() const { return m_warm_start; }
+
     /// Return the number of iterations performed during the last solve.
     virtual int GetIterations() const = 0;
 
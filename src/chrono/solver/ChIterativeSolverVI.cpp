@@ -12,6 +12,8 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/solver/ChIterativeSolverVI.h"
 
 namespace chrono {
@@ -25,6 +27,8 @@ ChIterativeSolverVI::ChIterativeSolverVI()
       m_omega(1.0),
       m_shlambda(1.0),
       m_iterations(0),
+      m_nthreads(1),
+      m_use_sparse_schur(false),
       record_violation_history(false) {}
 
 void ChIterativeSolverVI::SetOmega(double mval) {
@@ -37,6 +41,14 @@ void ChIterativeSolverVI::SetSharpnessLambda(double mval) {
         m_shlambda = mval;
 }
 
+void ChIterativeSolverVI::SetNumThreads(int nthreads) {
+    m_nthreads = std::max(1, nthreads);
+}
+
+bool ChIterativeSolverVI::BuildSchurComplement(ChSystemDescriptor& sysd) {
+    return m_use_sparse_schur && sysd.BuildSchurComplement(m_nthreads);
+}
+
 void ChIterativeSolverVI::AtIterationEnd(double mmaxviolation, double mdeltalambda, unsigned int iternum) {
     if (!record_violation_history)
         return;
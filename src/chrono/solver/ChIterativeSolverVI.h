@@ -73,6 +73,17 @@ class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
     /// GetViolationHistory).
     void SetRecordViolation(bool mval) { record_violation_history = mval; }
 
+    /// Enable/disable use of an assembled sparse Schur complement operator (default: false).\n
+    /// If enabled, solvers based on Schur complement products (APGD, BB, PMINRES) assemble the constraint Jacobian and
+    /// the product [M^(-1)][Cq'] once per solve (see ChSystemDescriptor::BuildSchurComplement), so that each product
+    /// reduces to two sparse matrix-vector products evaluated in parallel. This trades memory and a setup cost for
+    /// faster iterations and is most beneficial for large problems requiring many iterations.
+    void EnableSparseSchurComplement(bool val) { m_use_sparse_schur = val; }
+
+    /// Set the number of OpenMP threads used by the solver (default: 1).
+    /// A ChSystem passes its number of Chrono threads to the current solver (see ChSystem::SetNumThreads).
+    virtual void SetNumThreads(int nthreads) override;
+
     /// Return the current value of the overrelaxation factor.
     double GetOmega() const { return m_omega; }
 
@@ -90,6 +101,14 @@ class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
     /// Note that collection of constraint violations must be enabled through SetRecordViolation.
     const std::vector<double>& GetDeltalambdaHistory() const { return dlambda_history; }
 
+    /// Set the number of iterations and the error reported for the last solve.
+    /// Used when the problem was split in independent parts, each solved by a separate solver instance (see
+    /// ChSystemNSC::EnableIslandSolver); the reported values are then the maximum over all parts.
+    void SetSolveStatistics(int iterations, double error) {
+        m_iterations = iterations;
+        SetError(error);
+    }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive_out) override;
 
@@ -107,15 +126,25 @@ class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
     /// Note: 'iternum' starts at 0 for the first iteration.
     void AtIterationEnd(double mmaxviolation, double mdeltalambda, unsigned int iternum);
 
+    /// Overwrite the error reported by GetError (see SetSolveStatistics).
+    virtual void SetError(double error) {}
+
   protected:
     /// Indicate whether ot not the Solve() phase requires an up-to-date problem matrix.
     /// Typically, this is the case for iterative solvers (as the matrix is needed for
     /// the matrix-vector operations).
     virtual bool SolveRequiresMatrix() const override { return true; }
 
-    int m_iterations;   ///< total number of iterations performed by the solver
-    double m_omega;     ///< over-relaxation factor
-    double m_shlambda;  ///< sharpness factor
+    /// Assemble the sparse Schur complement operator in the given system descriptor, if enabled.
+    /// Return true if the operator was assembled (it must then be discarded with ResetSchurComplement at the end of
+    /// the solve).
+    bool BuildSchurComplement(ChSystemDescriptor& sysd);
+
+    int m_iterations;         ///< total number of iterations performed by the solver
+    double m_omega;           ///< over-relaxation factor
+    double m_shlambda;        ///< sharpness factor
+    int m_nthreads;           ///< number of OpenMP threads
+    bool m_use_sparse_schur;  ///< use an assembled sparse Schur complement operator
 
     bool record_violation_history;
     std::vector<double> violation_history;
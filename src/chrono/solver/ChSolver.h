@@ -44,6 +44,7 @@ class ChApi ChSolver {
         BARZILAIBORWEIN,  ///< Barzilai-Borwein
         APGD,             ///< Accelerated Projected Gradient Descent
         ADMM,             ///< Alternating Direction Method of Multipliers
+        PSOR_COLORED,     ///< Projected SOR with multithreaded sweeps over graph-colored constraint sets
         // Direct linear solvers
         SPARSE_LU,    ///< Sparse supernodal LU factorization
         SPARSE_QR,    ///< Sparse left-looking rank-revealing QR factorization
@@ -91,6 +92,11 @@ class ChApi ChSolver {
     /// that it is appropriate to perform the setup phase.
     virtual bool Setup(ChSystemDescriptor& sysd) { return true; }
 
+    /// Set the number of OpenMP threads used by the solver.
+    /// The default implementation does nothing. Derived classes implement this function as applicable.
+    /// A ChSystem passes its number of Chrono threads to the current solver (see ChSystem::SetNumThreads).
+    virtual void SetNumThreads(int nthreads) {}
+
     /// Set verbose output from solver.
     void SetVerbose(bool mv) { verbose = mv; }
 
@@ -123,6 +123,8 @@ class ChApi ChSolverADMM : public ChIterativeSolverVI {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   private:
+    virtual void SetError(double error) override { r_dual = error; }
+
     double r_prim;
     double r_dual;
     bool precond;
@@ -113,6 +113,9 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
         return 0;
     }
 
+    // Optionally, assemble the sparse Schur complement operator
+    bool schur_assembled = BuildSchurComplement(sysd);
+
     // Optimization: backup the  q  sparse data computed above,
     // because   (M^-1)*k   will be needed at the end when computing primals.
     ChVectorDynamic<> Minvk;
@@ -246,6 +249,9 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
             mconstraints[ic]->IncrementState(mconstraints[ic]->GetLagrangeMultiplier());
     }
 
+    if (schur_assembled)
+        sysd.ResetSchurComplement();
+
     return residual;
 }
 
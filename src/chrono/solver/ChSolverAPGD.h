@@ -45,6 +45,8 @@ class ChApi ChSolverAPGD : public ChIterativeSolverVI {
     void Dump_Lambda(std::vector<double>& temp);
 
   private:
+    virtual void SetError(double error) override { residual = error; }
+
     void SchurBvectorCompute(ChSystemDescriptor& sysd);
     double Res4(ChSystemDescriptor& sysd);
 
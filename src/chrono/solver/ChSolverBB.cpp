@@ -71,6 +71,9 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         mconstraints[ic]->Update_auxiliary();
 
+    // Optionally, assemble the sparse Schur complement operator
+    bool schur_assembled = BuildSchurComplement(sysd);
+
     // Average all g_i for the triplet of contact constraints n,u,v.
     //  Can be used for the fixed point phase and/or by preconditioner.
     int j_friction_comp = 0;
@@ -341,6 +344,9 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
             mconstraints[ic]->IncrementState(mconstraints[ic]->GetLagrangeMultiplier());
     }
 
+    if (schur_assembled)
+        sysd.ResetSchurComplement();
+
     if (verbose)
         std::cout << "-----" << std::endl;
 
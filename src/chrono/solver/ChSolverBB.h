@@ -60,6 +60,8 @@ class ChApi ChSolverBB : public ChIterativeSolverVI {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   private:
+    virtual void SetError(double error) override { lastgoodres = error; }
+
     int n_armijo;
     int max_armijo_backtrace;
     double lastgoodres;
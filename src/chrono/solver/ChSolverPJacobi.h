@@ -45,6 +45,8 @@ class ChApi ChSolverPJacobi : public ChIterativeSolverVI {
     virtual double GetError() const override { return maxviolation; }
 
   private:
+    virtual void SetError(double error) override { maxviolation = error; }
+
     double maxviolation;
 };
 
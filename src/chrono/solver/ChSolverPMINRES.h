@@ -80,6 +80,8 @@ CH_DEPRECATED("deprecated. Use ChSolverMINRES instead.")
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   private:
+    virtual void SetError(double error) override { r_proj_resid = error; }
+
     double grad_diffstep;
     double rel_tolerance;
     double r_proj_resid;
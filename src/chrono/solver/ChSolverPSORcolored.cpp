@@ -0,0 +1,362 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#include "chrono/solver/ChSolverPSORcolored.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSolverPSORcolored)
+CH_UPCASTING(ChSolverPSORcolored, ChIterativeSolverVI)
+
+ChSolverPSORcolored::ChSolverPSORcolored()
+    : m_symmetric(false), m_min_color_size(32), maxviolation(0) {}
+
+void ChSolverPSORcolored::ColorConstraints(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
+
+    m_block_constr.clear();
+    m_block_start.clear();
+    m_color_blocks.clear();
+    m_color_start.clear();
+    m_serial_blocks.clear();
+
+    // Group the active constraints in blocks: a triplet for the n,u,v components of friction constraints, a single
+    // constraint otherwise. This is the same grouping as in the sequential PSOR solver.
+    int i_friction_comp = 0;
+    for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
+        if (!mconstraints[ic]->IsActive())
+            continue;
+        if (mconstraints[ic]->GetMode() == ChConstraint::Mode::FRICTION) {
+            if (i_friction_comp == 0)
+                m_block_start.push_back((unsigned int)m_block_constr.size());
+            i_friction_comp = (i_friction_comp + 1) % 3;
+        } else {
+            m_block_start.push_back((unsigned int)m_block_constr.size());
+        }
+        m_block_constr.push_back(ic);
+    }
+    unsigned int nblocks = (unsigned int)m_block_start.size();
+    m_block_start.push_back((unsigned int)m_block_constr.size());
+
+    m_color_start.push_back(0);
+
+    // With a single thread, simply process all blocks serially, in their original order
+    if (m_nthreads <= 1) {
+        m_serial_blocks.resize(nblocks);
+        for (unsigned int ib = 0; ib < nblocks; ib++)
+            m_serial_blocks[ib] = ib;
+        return;
+    }
+
+    // Collect the (active) variables of each block, identified by their offset in the global state vector.
+    // Inactive variables are never modified by the constraints and do not couple blocks.
+    unsigned int n_q = sysd.CountActiveVariables();
+
+    std::vector<unsigned int> block_vars;
+    std::vector<unsigned int> block_vars_start(nblocks + 1);
+    std::vector<unsigned int> pending;
+    std::vector<unsigned int> unknown;
+    std::vector<ChVariables*> vars;
+
+    pending.reserve(nblocks);
+    for (unsigned int ib = 0; ib < nblocks; ib++) {
+        block_vars_start[ib] = (unsigned int)block_vars.size();
+        bool known = true;
+        for (unsigned int k = m_block_start[ib]; k < m_block_start[ib + 1]; k++) {
+            vars.clear();
+            if (!mconstraints[m_block_constr[k]]->CollectVariables(vars)) {
+                known = false;
+                break;
+            }
+            for (auto var : vars) {
+                if (var && var->IsActive())
+                    block_vars.push_back(var->GetOffset());
+            }
+        }
+        if (known) {
+            pending.push_back(ib);
+        } else {
+            block_vars.resize(block_vars_start[ib]);
+            unknown.push_back(ib);
+        }
+    }
+    block_vars_start[nblocks] = (unsigned int)block_vars.size();
+
+    // Greedy coloring: at each round, assign to the current color all pending blocks that do not share a variable
+    // with a block already in this color. Stop when a color becomes too small to be worth a parallel sweep.
+    std::vector<int> stamp(n_q, -1);
+    std::vector<unsigned int> remaining;
+    remaining.reserve(nblocks);
+    int color = 0;
+
+    while (!pending.empty()) {
+        size_t first = m_color_blocks.size();
+        remaining.clear();
+
+        for (auto ib : pending) {
+            bool available = true;
+            for (unsigned int k = block_vars_start[ib]; k < block_vars_start[ib + 1]; k++) {
+                if (stamp[block_vars[k]] == color) {
+                    available = false;
+                    break;
+                }
+            }
+            if (available) {
+                for (unsigned int k = block_vars_start[ib]; k < block_vars_start[ib + 1]; k++)
+                    stamp[block_vars[k]] = color;
+                m_color_blocks.push_back(ib);
+            } else {
+                remaining.push_back(ib);
+            }
+        }
+
+        if (m_color_blocks.size() - first < (size_t)m_min_color_size) {
+            m_color_blocks.resize(first);
+            m_serial_blocks.insert(m_serial_blocks.end(), pending.begin(), pending.end());
+            break;
+        }
+
+        m_color_start.push_back((unsigned int)m_color_blocks.size());
+        pending.swap(remaining);
+        color++;
+    }
+
+    m_serial_blocks.insert(m_serial_blocks.end(), unknown.begin(), unknown.end());
+}
+
+void ChSolverPSORcolored::SweepBlock(std::vector<ChConstraint*>& mconstraints,
+                                     unsigned int ib,
+                                     double& max_violation,
+                                     double& max_deltalambda) const {
+    unsigned int start = m_block_start[ib];
+    unsigned int size = m_block_start[ib + 1] - start;
+    ChConstraint* constr = mconstraints[m_block_constr[start]];
+
+    if (constr->GetMode() == ChConstraint::Mode::FRICTION && size == 3) {
+        ChConstraint* triplet[3] = {constr, mconstraints[m_block_constr[start + 1]],
+                                    mconstraints[m_block_constr[start + 2]]};
+        double old_lambda[3];
+        double new_lambda[3];
+
+        for (int k = 0; k < 3; k++) {
+            // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+            double mresidual = triplet[k]->ComputeJacobianTimesState() + triplet[k]->GetRightHandSide() +
+                               triplet[k]->GetComplianceTerm() * triplet[k]->GetLagrangeMultiplier();
+
+            // only the normal component contributes to the constraint violation
+            if (k == 0)
+                max_violation = std::max(max_violation, std::abs(std::min(0.0, mresidual)));
+
+            // update:   lambda += delta_lambda, with delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+            double deltal = (m_omega / triplet[k]->GetSchurComplement()) * (-mresidual);
+            old_lambda[k] = triplet[k]->GetLagrangeMultiplier();
+            triplet[k]->SetLagrangeMultiplier(old_lambda[k] + deltal);
+        }
+
+        triplet[0]->Project();  // the N normal component will take care of N,U,V
+
+        for (int k = 0; k < 3; k++) {
+            new_lambda[k] = triplet[k]->GetLagrangeMultiplier();
+            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+            if (m_shlambda != 1.0) {
+                new_lambda[k] = m_shlambda * new_lambda[k] + (1.0 - m_shlambda) * old_lambda[k];
+                triplet[k]->SetLagrangeMultiplier(new_lambda[k]);
+            }
+        }
+
+        for (int k = 0; k < 3; k++) {
+            double true_delta = new_lambda[k] - old_lambda[k];
+            triplet[k]->IncrementState(true_delta);
+            max_deltalambda = std::max(max_deltalambda, std::abs(true_delta));
+        }
+
+        return;
+    }
+
+    for (unsigned int k = start; k < start + size; k++) {
+        constr = mconstraints[m_block_constr[k]];
+
+        // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+        double mresidual = constr->ComputeJacobianTimesState() + constr->GetRightHandSide() +
+                           constr->GetComplianceTerm() * constr->GetLagrangeMultiplier();
+
+        // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+        double candidate_violation = (constr->GetMode() == ChConstraint::Mode::UNILATERAL)
+                                         ? std::abs(std::min(0.0, mresidual))
+                                         : std::abs(constr->Violation(mresidual));
+
+        // update:   lambda += delta_lambda, with delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+        double deltal = (m_omega / constr->GetSchurComplement()) * (-mresidual);
+        double old_lambda = constr->GetLagrangeMultiplier();
+        constr->SetLagrangeMultiplier(old_lambda + deltal);
+
+        // If new lagrangian multiplier does not satisfy inequalities, project
+        // it into an admissible orthant (or, in general, onto an admissible set)
+        constr->Project();
+        double new_lambda = constr->GetLagrangeMultiplier();
+
+        // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+        if (m_shlambda != 1.0) {
+            new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+            constr->SetLagrangeMultiplier(new_lambda);
+        }
+
+        // For all items with variables, add the effect of incremented (and projected) lagrangian reactions
+        double true_delta = new_lambda - old_lambda;
+        constr->IncrementState(true_delta);
+
+        max_violation = std::max(max_violation, candidate_violation);
+        max_deltalambda = std::max(max_deltalambda, std::abs(true_delta));
+    }
+}
+
+void ChSolverPSORcolored::SweepColors(std::vector<ChConstraint*>& mconstraints,
+                                      bool backward,
+                                      double& max_violation,
+                                      double& max_deltalambda) const {
+    int ncolors = GetNumColors();
+    if (ncolors == 0)
+        return;
+
+    // A single parallel region for all colors; the implicit barrier at the end of each 'omp for' guarantees that a
+    // color is completed before the next one is started.
+#pragma omp parallel num_threads(m_nthreads)
+    {
+        double t_violation = 0;
+        double t_deltalambda = 0;
+
+        for (int i = 0; i < ncolors; i++) {
+            int color = backward ? ncolors - 1 - i : i;
+            int start = (int)m_color_start[color];
+            int end = (int)m_color_start[color + 1];
+#pragma omp for schedule(static)
+            for (int j = start; j < end; j++) {
+                SweepBlock(mconstraints, m_color_blocks[j], t_violation, t_deltalambda);
+            }
+        }
+
+#pragma omp critical(ChSolverPSORcolored_reduction)
+        {
+            max_violation = std::max(max_violation, t_violation);
+            max_deltalambda = std::max(max_deltalambda, t_deltalambda);
+        }
+    }
+}
+
+double ChSolverPSORcolored::Solve(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariables();
+
+    m_iterations = 0;
+    maxviolation = 0;
+    double maxdeltalambda = 0.;
+    const int nConstr = (int)mconstraints.size();
+    const int nVars = (int)mvariables.size();
+
+    // 1)  Update auxiliary data in all constraints before starting,
+    //     that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
+#pragma omp parallel for schedule(static) num_threads(m_nthreads)
+    for (int ic = 0; ic < nConstr; ic++)
+        mconstraints[ic]->Update_auxiliary();
+
+    // Partition the constraints in independent sets
+    ColorConstraints(sysd);
+    const int nBlocks = (int)m_block_start.size() - 1;
+
+    // Average all g_i for the triplet of contact constraints n,u,v.
+#pragma omp parallel for schedule(static) num_threads(m_nthreads)
+    for (int ib = 0; ib < nBlocks; ib++) {
+        unsigned int start = m_block_start[ib];
+        if (m_block_start[ib + 1] - start != 3)
+            continue;
+        ChConstraint* c0 = mconstraints[m_block_constr[start + 0]];
+        ChConstraint* c1 = mconstraints[m_block_constr[start + 1]];
+        ChConstraint* c2 = mconstraints[m_block_constr[start + 2]];
+        if (c0->GetMode() != ChConstraint::Mode::FRICTION)
+            continue;
+        double average_g_i = (c0->GetSchurComplement() + c1->GetSchurComplement() + c2->GetSchurComplement()) / 3.0;
+        c0->SetSchurComplement(average_g_i);
+        c1->SetSchurComplement(average_g_i);
+        c2->SetSchurComplement(average_g_i);
+    }
+
+    // 2)  Compute, for all items with variables, the initial guess for
+    //     still unconstrained system:
+#pragma omp parallel for schedule(static) num_threads(m_nthreads)
+    for (int iv = 0; iv < nVars; iv++) {
+        if (mvariables[iv]->IsActive())
+            mvariables[iv]->ComputeMassInverseTimesVector(mvariables[iv]->State(), mvariables[iv]->Force());  // q = [M]'*fb
+    }
+
+    // 3)  For all items with variables, add the effect of initial (guessed)
+    //     lagrangian reactions of constraints, if a warm start is desired.
+    //     Otherwise, if no warm start, simply resets initial lagrangians to zero.
+    //     The increments are applied color by color, to avoid concurrent updates of the same variables.
+    if (m_warm_start) {
+        for (int color = 0; color < GetNumColors(); color++) {
+            int start = (int)m_color_start[color];
+            int end = (int)m_color_start[color + 1];
+#pragma omp parallel for schedule(static) num_threads(m_nthreads)
+            for (int j = start; j < end; j++) {
+                unsigned int ib = m_color_blocks[j];
+                for (unsigned int k = m_block_start[ib]; k < m_block_start[ib + 1]; k++) {
+                    ChConstraint* constr = mconstraints[m_block_constr[k]];
+                    constr->IncrementState(constr->GetLagrangeMultiplier());
+                }
+            }
+        }
+        for (auto ib : m_serial_blocks) {
+            for (unsigned int k = m_block_start[ib]; k < m_block_start[ib + 1]; k++) {
+                ChConstraint* constr = mconstraints[m_block_constr[k]];
+                constr->IncrementState(constr->GetLagrangeMultiplier());
+            }
+        }
+    } else {
+        for (int ic = 0; ic < nConstr; ic++)
+            mconstraints[ic]->SetLagrangeMultiplier(0.);
+    }
+
+    // 4)  Perform the iteration loops
+    for (int iter = 0; iter < m_max_iterations; iter++) {
+        maxviolation = 0;
+        maxdeltalambda = 0;
+
+        // Forward sweep: colors in parallel, then the serial blocks
+        SweepColors(mconstraints, false, maxviolation, maxdeltalambda);
+        for (auto ib : m_serial_blocks)
+            SweepBlock(mconstraints, ib, maxviolation, maxdeltalambda);
+
+        // Backward sweep: serial blocks in reverse order, then the colors in reverse order
+        if (m_symmetric) {
+            for (auto it = m_serial_blocks.rbegin(); it != m_serial_blocks.rend(); ++it)
+                SweepBlock(mconstraints, *it, maxviolation, maxdeltalambda);
+            SweepColors(mconstraints, true, maxviolation, maxdeltalambda);
+        }
+
+        // For recording into violation history, if debugging
+        if (this->record_violation_history)
+            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+        m_iterations++;
+
+        // Terminate the loop if violation in constraints has been successfully limited.
+        if (maxviolation < m_tolerance)
+            break;
+    }
+
+    return maxviolation;
+}
+
+}  // end namespace chrono
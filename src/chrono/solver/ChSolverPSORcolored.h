@@ -0,0 +1,103 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Alessandro Tasora, Radu Serban
+// =============================================================================
+
+#ifndef CHSOLVER_PSOR_COLORED_H
+#define CHSOLVER_PSOR_COLORED_H
+
+#include <algorithm>
+
+#include "chrono/solver/ChIterativeSolverVI.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// A multithreaded iterative solver based on the projective fixed point method, with overrelaxation and immediate
+/// variable update as in SOR methods.\n
+/// Before each solve, the constraints are partitioned with a greedy graph coloring so that no two constraints of the
+/// same color act on a common ChVariables object. The constraints of each color are then processed concurrently,
+/// while the colors themselves are swept in sequence. Friction constraints are always treated as (n,u,v) triplets.
+/// Constraints that do not report their connectivity (see ChConstraint::CollectVariables), as well as the tail of
+/// very small colors, are processed serially at the end of each sweep.\n
+/// The number of threads is set automatically by the owning ChSystem (see ChSystem::SetNumThreads).\n
+/// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
+/// solver.
+class ChApi ChSolverPSORcolored : public ChIterativeSolverVI {
+  public:
+    ChSolverPSORcolored();
+
+    ~ChSolverPSORcolored() {}
+
+    virtual Type GetType() const override { return Type::PSOR_COLORED; }
+
+    /// Enable/disable symmetric sweeps (default: false).
+    /// If enabled, each iteration performs a forward sweep over the colors followed by a backward sweep, as in PSSOR.
+    void SetSymmetric(bool val) { m_symmetric = val; }
+
+    /// Set the minimum number of constraint blocks in a color (default: 32).
+    /// Once the coloring produces a color smaller than this, all remaining constraints are processed serially.
+    void SetMinColorSize(int val) { m_min_color_size = std::max(1, val); }
+
+    /// Performs the solution of the problem.
+    /// \return  the maximum constraint violation after termination.
+    virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
+                         ) override;
+
+    /// Return the tolerance error reached during the last solve.
+    /// For the PSOR solver, this is the maximum constraint violation.
+    virtual double GetError() const override { return maxviolation; }
+
+    /// Return the number of parallel colors generated during the last solve.
+    int GetNumColors() const { return (int)m_color_start.size() - 1; }
+
+    /// Return the number of constraint blocks processed serially during the last solve.
+    int GetNumSerialBlocks() const { return (int)m_serial_blocks.size(); }
+
+  private:
+    virtual void SetError(double error) override { maxviolation = error; }
+
+    /// Partition the active constraints in blocks and color the blocks.
+    void ColorConstraints(ChSystemDescriptor& sysd);
+
+    /// Perform one projected SOR update on the constraints in the specified block.
+    /// Accumulate the maximum constraint violation and the maximum change in the Lagrange multipliers.
+    void SweepBlock(std::vector<ChConstraint*>& mconstraints,
+                    unsigned int ib,
+                    double& max_violation,
+                    double& max_deltalambda) const;
+
+    /// Process all colors in sequence (in reverse order if 'backward' is true) and the blocks of each color in
+    /// parallel.
+    void SweepColors(std::vector<ChConstraint*>& mconstraints,
+                     bool backward,
+                     double& max_violation,
+                     double& max_deltalambda) const;
+
+    bool m_symmetric;
+    int m_min_color_size;
+    double maxviolation;
+
+    std::vector<unsigned int> m_block_constr;   ///< indices of constraints, grouped in blocks
+    std::vector<unsigned int> m_block_start;    ///< start of each block in m_block_constr (size: num blocks + 1)
+    std::vector<unsigned int> m_color_blocks;   ///< block indices, sorted by color
+    std::vector<unsigned int> m_color_start;    ///< start of each color in m_color_blocks (size: num colors + 1)
+    std::vector<unsigned int> m_serial_blocks;  ///< blocks processed serially
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
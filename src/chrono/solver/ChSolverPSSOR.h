@@ -50,6 +50,8 @@ CH_DEPRECATED("deprecated. Use ChSolverPSOR, ChSolverBB, or ChSolverAPGD instead
     virtual double GetError() const override { return maxviolation; }
 
   private:
+    virtual void SetError(double error) override { maxviolation = error; }
+
     double maxviolation;
 };
 
@@ -12,12 +12,14 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <iomanip>
 
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
 #include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
 #include "chrono/core/ChMatrix.h"
+#include "chrono/utils/ChOpenMP.h"
 
 namespace chrono {
 
@@ -27,7 +29,20 @@ CH_FACTORY_REGISTER(ChSystemDescriptor)
 
 #define CH_SPINLOCK_HASHSIZE 203
 
-ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), freeze_count(false) {
+ChSystemDescriptor::ChSystemDescriptor()
+    : n_q(0),
+      n_c(0),
+      c_a(1.0),
+      m_num_persistent_constraints(0),
+      m_num_persistent_variables(0),
+      m_num_persistent_KRMblocks(0),
+      freeze_count(false),
+      m_map_valid(false),
+      m_map_num_variables(0),
+      m_map_num_KRMblocks(0),
+      m_map_num_constraints(0),
+      m_schur_valid(false),
+      m_schur_nthreads(1) {
     m_constraints.clear();
     m_variables.clear();
     m_KRMblocks.clear();
@@ -181,6 +196,215 @@ void ChSystemDescriptor::BuildSystemMatrix(ChSparseMatrix* Z, ChVectorDynamic<>*
     }
 }
 
+// -----------------------------------------------------------------------------
+
+// Sparse matrix proxies used by the system matrix map.
+// SetElement calls are not applied to an actual matrix. Instead, their locations are recorded (when creating the map)
+// or their values are stored sequentially in a buffer (when assembling with an existing map).
+
+class ChSparseEntryRecorder : public ChSparseMatrix {
+  public:
+    ChSparseEntryRecorder(int nrows, int ncols) : ChSparseMatrix(nrows, ncols) {}
+
+    virtual void SetElement(int row, int col, double val, bool overwrite = true) override {
+        rows.push_back(row);
+        cols.push_back(col);
+        overwrites.push_back(overwrite ? 1 : 0);
+    }
+
+    std::vector<int> rows;
+    std::vector<int> cols;
+    std::vector<char> overwrites;
+};
+
+class ChSparseEntryWriter : public ChSparseMatrix {
+  public:
+    ChSparseEntryWriter(int nrows, int ncols)
+        : ChSparseMatrix(nrows, ncols),
+          values(nullptr),
+          rows(nullptr),
+          cols(nullptr),
+          count(0),
+          capacity(0),
+          mismatch(false) {}
+
+    void Reset(double* buffer, const int* map_rows, const int* map_cols, int size) {
+        values = buffer;
+        rows = map_rows;
+        cols = map_cols;
+        count = 0;
+        capacity = size;
+        mismatch = false;
+    }
+
+    // The location of each entry is checked against the one recorded in the map, as a contributor may paste the
+    // same number of entries at different locations (e.g. a constraint or KRM block re-created on other variables).
+    virtual void SetElement(int row, int col, double val, bool overwrite = true) override {
+        if (count < capacity) {
+            values[count] = val;
+            mismatch |= (rows[count] != row || cols[count] != col);
+        }
+        count++;
+    }
+
+    bool Valid() const { return count == capacity && !mismatch; }
+
+    double* values;
+    const int* rows;
+    const int* cols;
+    int count;
+    int capacity;
+    bool mismatch;
+};
+
+void ChSystemDescriptor::PasteContributorInto(ChSparseMatrix& Z, size_t i) const {
+    if (i < m_variables.size()) {
+        auto var = m_variables[i];
+        if (var->IsActive())
+            var->PasteMassInto(Z, 0, 0, c_a);
+        return;
+    }
+
+    i -= m_variables.size();
+    if (i < m_KRMblocks.size()) {
+        m_KRMblocks[i]->PasteMatrixInto(Z, 0, 0, false);
+        return;
+    }
+
+    i -= m_KRMblocks.size();
+    auto constr = m_constraints[i];
+    if (constr->IsActive()) {
+        unsigned int offset = constr->GetOffset();
+        constr->PasteJacobianInto(Z, n_q + offset, 0);
+        constr->PasteJacobianTransposedInto(Z, 0, n_q + offset);
+        Z.SetElement(n_q + offset, n_q + offset, constr->GetComplianceTerm());
+    }
+}
+
+bool ChSystemDescriptor::CreateSystemMatrixMap(const ChSparseMatrix& Z) {
+    m_map_valid = false;
+
+    m_map_num_variables = m_variables.size();
+    m_map_num_KRMblocks = m_KRMblocks.size();
+    m_map_num_constraints = m_constraints.size();
+    size_t num_contributors = m_map_num_variables + m_map_num_KRMblocks + m_map_num_constraints;
+
+    // Record the locations of all entries pasted by each contributor
+    ChSparseEntryRecorder recorder((int)Z.rows(), (int)Z.cols());
+    m_map_contributor_start.resize(num_contributors + 1);
+    for (size_t i = 0; i < num_contributors; i++) {
+        m_map_contributor_start[i] = (int)recorder.rows.size();
+        PasteContributorInto(recorder, i);
+    }
+    m_map_contributor_start[num_contributors] = (int)recorder.rows.size();
+
+    // Locate each entry in the array of nonzeros (binary search in the sorted inner indices of its outer vector)
+    int num_entries = (int)recorder.rows.size();
+    int nnz = (int)Z.nonZeros();
+    const int* outer_index = Z.outerIndexPtr();
+    const int* inner_index = Z.innerIndexPtr();
+
+    m_map_entry_slot.resize(num_entries);
+    for (int e = 0; e < num_entries; e++) {
+        int outer = ChSparseMatrix::IsRowMajor ? recorder.rows[e] : recorder.cols[e];
+        int inner = ChSparseMatrix::IsRowMajor ? recorder.cols[e] : recorder.rows[e];
+        const int* begin = inner_index + outer_index[outer];
+        const int* end = inner_index + outer_index[outer + 1];
+        const int* it = std::lower_bound(begin, end, inner);
+        if (it == end || *it != inner)
+            return false;
+        m_map_entry_slot[e] = (int)(it - inner_index);
+    }
+    m_map_entry_rows = std::move(recorder.rows);
+    m_map_entry_cols = std::move(recorder.cols);
+    m_map_entry_overwrite = std::move(recorder.overwrites);
+
+    // Invert the map: list of entries for each nonzero, in the order in which they were pasted
+    m_map_slot_start.assign(nnz + 1, 0);
+    for (int e = 0; e < num_entries; e++)
+        m_map_slot_start[m_map_entry_slot[e] + 1]++;
+    for (int k = 0; k < nnz; k++)
+        m_map_slot_start[k + 1] += m_map_slot_start[k];
+
+    std::vector<int> pos(m_map_slot_start.begin(), m_map_slot_start.end() - 1);
+    m_map_slot_entries.resize(num_entries);
+    for (int e = 0; e < num_entries; e++)
+        m_map_slot_entries[pos[m_map_entry_slot[e]]++] = e;
+
+    m_map_entry_values.resize(num_entries);
+
+    m_map_valid = true;
+    return true;
+}
+
+bool ChSystemDescriptor::EvaluateSystemMatrixMap(const ChSparseMatrix& Z, int nthreads) {
+    int num_contributors = (int)m_map_contributor_start.size() - 1;
+    int num_failed = 0;
+
+#pragma omp parallel num_threads(nthreads) reduction(+ : num_failed)
+    {
+        ChSparseEntryWriter writer((int)Z.rows(), (int)Z.cols());
+#pragma omp for schedule(dynamic, 16)
+        for (int i = 0; i < num_contributors; i++) {
+            int start = m_map_contributor_start[i];
+            writer.Reset(m_map_entry_values.data() + start, m_map_entry_rows.data() + start,
+                         m_map_entry_cols.data() + start, m_map_contributor_start[i + 1] - start);
+            PasteContributorInto(writer, i);
+            if (!writer.Valid())
+                num_failed++;
+        }
+    }
+
+    return num_failed == 0;
+}
+
+bool ChSystemDescriptor::BuildSystemMatrixMapped(ChSparseMatrix& Z, int nthreads) {
+    n_q = CountActiveVariables();
+    n_c = CountActiveConstraints();
+
+    if (Z.rows() != n_q + n_c || Z.cols() != n_q + n_c || !Z.isCompressed()) {
+        m_map_valid = false;
+        return false;
+    }
+
+    // (Re)create the map if needed
+    bool map_current = m_map_valid && m_map_num_variables == m_variables.size() &&
+                       m_map_num_KRMblocks == m_KRMblocks.size() && m_map_num_constraints == m_constraints.size() &&
+                       m_map_slot_start.size() == Z.nonZeros() + 1;
+    if (!map_current && !CreateSystemMatrixMap(Z))
+        return false;
+
+    // Evaluate all contributions in parallel, each in its own range of the buffer of entry values.
+    // A contributor pasting a different number of entries, or entries at different locations, than when the map was
+    // created indicates a structure change. In that case, the map is created anew (if the new entries are in the
+    // pattern of Z) and the contributions are evaluated again.
+    if (!EvaluateSystemMatrixMap(Z, nthreads)) {
+        if (!map_current || !CreateSystemMatrixMap(Z) || !EvaluateSystemMatrixMap(Z, nthreads)) {
+            m_map_valid = false;
+            return false;
+        }
+    }
+
+    // Gather the entry values into the array of nonzeros, in the same order as the serial assembly.
+    // Each nonzero is written by a single thread.
+    int nnz = (int)Z.nonZeros();
+    double* Z_values = Z.valuePtr();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int k = 0; k < nnz; k++) {
+        double val = 0;
+        for (int j = m_map_slot_start[k]; j < m_map_slot_start[k + 1]; j++) {
+            int e = m_map_slot_entries[j];
+            val = m_map_entry_overwrite[e] ? m_map_entry_values[e] : val + m_map_entry_values[e];
+        }
+        Z_values[k] = val;
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
 unsigned int ChSystemDescriptor::BuildFbVector(ChVectorDynamic<>& Fvector, unsigned int start_row) const {
     n_q = CountActiveVariables();
     Fvector.setZero(n_q);
@@ -369,6 +593,129 @@ unsigned int ChSystemDescriptor::FromVectorToUnknowns(const ChVectorDynamic<>& m
     return n_q + n_c;
 }
 
+// -----------------------------------------------------------------------------
+
+// Sparse matrix proxy used to assemble the constraint Jacobian.
+// SetElement calls are collected as triplets. Duplicate entries are summed (as in the matrix-free Schur complement
+// product), regardless of the 'overwrite' flag.
+class ChSparseTripletCollector : public ChSparseMatrix {
+  public:
+    ChSparseTripletCollector(int nrows, int ncols) : ChSparseMatrix(nrows, ncols) {}
+
+    virtual void SetElement(int row, int col, double val, bool overwrite = true) override {
+        triplets.push_back(Eigen::Triplet<double>(row, col, val));
+    }
+
+    std::vector<Eigen::Triplet<double>> triplets;
+};
+
+// Sparse matrix-vector product y = A*x for a compressed row-major matrix, parallelized over rows.
+static void SparseMatrixTimesVector(const ChSparseMatrix& A,
+                                    const ChVectorDynamic<>& x,
+                                    ChVectorDynamic<>& y,
+                                    int nthreads) {
+    int nrows = (int)A.rows();
+    const int* outer_index = A.outerIndexPtr();
+    const int* inner_index = A.innerIndexPtr();
+    const double* values = A.valuePtr();
+
+    y.resize(nrows);
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < nrows; i++) {
+        double sum = 0;
+        for (int k = outer_index[i]; k < outer_index[i + 1]; k++)
+            sum += values[k] * x(inner_index[k]);
+        y(i) = sum;
+    }
+}
+
+bool ChSystemDescriptor::BuildSchurComplement(int nthreads) {
+    m_schur_valid = false;
+
+    // Only a (block-)diagonal M is supported, no K
+    if (m_KRMblocks.size() > 0)
+        return false;
+
+    n_q = CountActiveVariables();
+    n_c = CountActiveConstraints();
+    m_schur_nthreads = std::max(1, nthreads);
+
+    // Jacobian of the active constraints and compliance terms
+    ChSparseTripletCollector collector((int)n_c, (int)n_q);
+    m_schur_E.resize(n_c);
+    for (const auto& constr : m_constraints) {
+        if (constr->IsActive()) {
+            constr->PasteJacobianInto(collector, constr->GetOffset(), 0);
+            m_schur_E(constr->GetOffset()) = constr->GetComplianceTerm();
+        }
+    }
+    m_schur_Cq.resize(n_c, n_q);
+    m_schur_Cq.setFromTriplets(collector.triplets.begin(), collector.triplets.end());
+    collector.triplets.clear();
+
+    // [M^(-1)][Cq'], one variable block at a time.
+    // The rows of [Cq'] associated with a variable are gathered in a dense block over the union of their nonzero
+    // columns, multiplied by the inverse of the variable mass matrix, and scattered back with the same pattern.
+    ChSparseMatrix CqT = m_schur_Cq.transpose();
+    const int* outer_index = CqT.outerIndexPtr();
+    const int* inner_index = CqT.innerIndexPtr();
+    const double* values = CqT.valuePtr();
+
+    int num_variables = (int)m_variables.size();
+    std::vector<std::vector<Eigen::Triplet<double>>> thread_triplets(m_schur_nthreads);
+
+#pragma omp parallel num_threads(m_schur_nthreads)
+    {
+        auto& triplets = thread_triplets[ChOMP::GetThreadNum()];
+        std::vector<int> cols;
+        ChMatrixDynamic<> block;
+        ChVectorDynamic<> minv_col;
+
+#pragma omp for schedule(dynamic, 16)
+        for (int iv = 0; iv < num_variables; iv++) {
+            auto var = m_variables[iv];
+            if (!var->IsActive() || var->GetDOF() == 0)
+                continue;
+            int offset = (int)var->GetOffset();
+            int dof = (int)var->GetDOF();
+
+            cols.clear();
+            for (int i = offset; i < offset + dof; i++)
+                cols.insert(cols.end(), inner_index + outer_index[i], inner_index + outer_index[i + 1]);
+            std::sort(cols.begin(), cols.end());
+            cols.erase(std::unique(cols.begin(), cols.end()), cols.end());
+            if (cols.empty())
+                continue;
+
+            block.setZero(dof, cols.size());
+            for (int i = 0; i < dof; i++) {
+                for (int k = outer_index[offset + i]; k < outer_index[offset + i + 1]; k++) {
+                    auto j = std::lower_bound(cols.begin(), cols.end(), inner_index[k]) - cols.begin();
+                    block(i, j) = values[k];
+                }
+            }
+
+            minv_col.resize(dof);
+            for (int j = 0; j < (int)cols.size(); j++) {
+                var->ComputeMassInverseTimesVector(minv_col, block.col(j));
+                for (int i = 0; i < dof; i++)
+                    triplets.push_back(Eigen::Triplet<double>(offset + i, cols[j], minv_col(i)));
+            }
+        }
+    }
+
+    for (int t = 1; t < m_schur_nthreads; t++) {
+        thread_triplets[0].insert(thread_triplets[0].end(), thread_triplets[t].begin(), thread_triplets[t].end());
+        thread_triplets[t].clear();
+    }
+    m_schur_MinvCq.resize(n_q, n_c);
+    m_schur_MinvCq.setFromTriplets(thread_triplets[0].begin(), thread_triplets[0].end());
+
+    m_schur_valid = true;
+    return true;
+}
+
 void ChSystemDescriptor::SchurComplementProduct(ChVectorDynamic<>& result,
                                                 const ChVectorDynamic<>& lvector,
                                                 std::vector<bool>* enabled) {
@@ -376,6 +723,31 @@ void ChSystemDescriptor::SchurComplementProduct(ChVectorDynamic<>& result,
     assert(m_KRMblocks.size() == 0);
     assert(lvector.size() == CountActiveConstraints());
 
+    // Use the assembled operators if available:   result = [Cq] * ([M^(-1)][Cq'] * l) + [E]*l
+    if (m_schur_valid) {
+        const ChVectorDynamic<>* l = &lvector;
+        if (enabled) {
+            m_schur_l = lvector;
+            for (unsigned int i = 0; i < n_c; i++) {
+                if (!(*enabled)[i])
+                    m_schur_l(i) = 0;
+            }
+            l = &m_schur_l;
+        }
+
+        SparseMatrixTimesVector(m_schur_MinvCq, *l, m_schur_q, m_schur_nthreads);
+        SparseMatrixTimesVector(m_schur_Cq, m_schur_q, result, m_schur_nthreads);
+        result += m_schur_E.cwiseProduct(*l);
+
+        if (enabled) {
+            for (unsigned int i = 0; i < n_c; i++) {
+                if (!(*enabled)[i])
+                    result(i) = 0;
+            }
+        }
+        return;
+    }
+
     result.setZero(n_c);
 
     // Performs the sparse product    result = [N]*l = [ [Cq][M^(-1)][Cq'] - [E] ] *l
@@ -88,6 +88,28 @@ class ChApi ChSystemDescriptor {
         m_constraints.clear();
         m_variables.clear();
         m_KRMblocks.clear();
+        m_num_persistent_constraints = 0;
+        m_num_persistent_variables = 0;
+        m_num_persistent_KRMblocks = 0;
+        ResetSchurComplement();
+    }
+
+    /// Mark all items inserted so far as persistent.
+    /// Persistent items are kept by BeginIncrementalInsertion, so that only the remaining items must be re-inserted.
+    void MarkPersistentItems() {
+        m_num_persistent_constraints = m_constraints.size();
+        m_num_persistent_variables = m_variables.size();
+        m_num_persistent_KRMblocks = m_KRMblocks.size();
+    }
+
+    /// Begin insertion of items, keeping the items marked as persistent (see MarkPersistentItems).
+    /// All items inserted after the persistent ones are removed and must be inserted again. As with BeginInsertion,
+    /// the insertion must be completed with a call to EndInsertion.
+    virtual void BeginIncrementalInsertion() {
+        m_constraints.resize(m_num_persistent_constraints);
+        m_variables.resize(m_num_persistent_variables);
+        m_KRMblocks.resize(m_num_persistent_KRMblocks);
+        ResetSchurComplement();
     }
 
     /// Insert reference to a ChConstraint object.
@@ -101,7 +123,10 @@ class ChApi ChSystemDescriptor {
 
     /// End insertion of items.
     /// A derived class should always call UpdateCountsAndOffsets.
-    virtual void EndInsertion() { UpdateCountsAndOffsets(); }
+    virtual void EndInsertion() {
+        UpdateCountsAndOffsets();
+        ResetSchurComplement();
+    }
 
     /// Count & returns the scalar variables in the system.
     /// This excludes ChVariable object that are set as inactive.
@@ -228,7 +253,8 @@ class ChApi ChSystemDescriptor {
     /// where [Cq] are the jacobians, [M] is the mass matrix, [E] is the matrix
     /// of the optional cfm 'constraint force mixing' terms for compliant constraints.
     /// The N matrix is not built explicitly, to exploit sparsity, it is described by the
-    /// inserted constraints and inserted variables.
+    /// inserted constraints and inserted variables (or, if BuildSchurComplement was called, by the assembled sparse
+    /// factors [Cq] and [M^(-1)][Cq']).
     /// Optionally, you can pass an 'enabled' vector of bools, that must have the same
     /// length of the l_i reactions vector; constraints with enabled=false are not handled.
     /// NOTE! the 'q' data in the ChVariables of the system descriptor is changed by this
@@ -242,6 +268,22 @@ class ChApi ChSystemDescriptor {
         std::vector<bool>* enabled = nullptr  ///< optional: vector of "enabled" flags, one per scalar constraint.
     );
 
+    /// Assemble the operators used by SchurComplementProduct in compressed row storage.
+    /// The Jacobian [Cq] of the active constraints and the product [M^(-1)][Cq'] are assembled from the current
+    /// constraint Jacobians and masses, so that subsequent calls to SchurComplementProduct reduce to two sparse
+    /// matrix-vector products, evaluated with the specified number of OpenMP threads. In this mode, the 'q' data in the
+    /// ChVariables objects is not changed by SchurComplementProduct.
+    /// The assembled operators must be rebuilt (or discarded with ResetSchurComplement) whenever the Jacobians, masses,
+    /// or compliance terms change; they are discarded automatically by BeginInsertion and EndInsertion.
+    /// Return false, and keep using the matrix-free product, if the system includes ChKRMBlock objects.
+    virtual bool BuildSchurComplement(int nthreads = 1);
+
+    /// Discard the assembled operators and revert SchurComplementProduct to the matrix-free product.
+    void ResetSchurComplement() { m_schur_valid = false; }
+
+    /// Return true if SchurComplementProduct currently uses the assembled operators (see BuildSchurComplement).
+    bool IsSchurComplementAssembled() const { return m_schur_valid; }
+
     /// Performs the product of the entire system matrix (KKT matrix), by a vector x ={q,l}.
     /// Note that the 'q' data in the ChVariables of the system descriptor is changed by this
     /// operation, so thay may need to be backed up via FromVariablesToVector()
@@ -321,6 +363,22 @@ class ChApi ChSystemDescriptor {
                                    ChVectorDynamic<>* rhs  ///< [out] assembled RHS vector
     ) const;
 
+    /// Assemble the system matrix into a matrix with locked sparsity pattern, using a cached map.
+    /// The map stores, for each entry pasted by the variable masses, KRM blocks, constraint Jacobians, and compliance
+    /// terms, its location in the array of nonzero values of Z (which must be compressed). The map is created at the
+    /// first call after a reset; subsequent calls evaluate all contributions in parallel and fill in the values of Z
+    /// without any insertion or search. The location of each entry is verified against the map, which is created anew
+    /// if the coupling changed even though the number of variables, KRM blocks, and constraints did not. Return false,
+    /// leaving Z unchanged and invalidating the map, if the map cannot be created (an entry is not in the pattern of
+    /// Z), in which case use BuildSystemMatrix.
+    virtual bool BuildSystemMatrixMapped(ChSparseMatrix& Z,  ///< [out] assembled system matrix
+                                         int nthreads = 1    ///< number of OpenMP threads
+    );
+
+    /// Invalidate the cached map used by BuildSystemMatrixMapped.
+    /// Must be called if the sparsity pattern of the target matrix changed.
+    void ResetSystemMatrixMap() { m_map_valid = false; }
+
     /// Write the current system matrix blocks and right-hand side components.
     /// The system matrix is formed by calling BuildSystemMatrix() as used with direct linear solvers.
     /// The following files are written in the directory specified by [path]:
@@ -371,10 +429,45 @@ class ChApi ChSystemDescriptor {
 
     double c_a;  ///< coefficient form M mass matrices in m_variables
 
+    size_t m_num_persistent_constraints;  ///< number of persistent constraints (see MarkPersistentItems)
+    size_t m_num_persistent_variables;    ///< number of persistent variables (see MarkPersistentItems)
+    size_t m_num_persistent_KRMblocks;    ///< number of persistent KRM blocks (see MarkPersistentItems)
+
   private:
+    /// Paste all contributions of the i-th matrix contributor (in order: variables, KRM blocks, constraints).
+    void PasteContributorInto(ChSparseMatrix& Z, size_t i) const;
+
+    /// Create the cached map used by BuildSystemMatrixMapped. Return false if an entry is not in the pattern of Z.
+    bool CreateSystemMatrixMap(const ChSparseMatrix& Z);
+
+    /// Evaluate all entries of the cached map. Return false if any contributor pastes entries at other locations than
+    /// those recorded in the map.
+    bool EvaluateSystemMatrixMap(const ChSparseMatrix& Z, int nthreads);
+
     mutable unsigned int n_q;  ///< number of active variables
     mutable unsigned int n_c;  ///< number of active constraints
     bool freeze_count;         ///< cache the number of active variables and constraints
+
+    bool m_map_valid;                          ///< is the system matrix map up to date?
+    size_t m_map_num_variables;                ///< number of variables when the map was created
+    size_t m_map_num_KRMblocks;                ///< number of KRM blocks when the map was created
+    size_t m_map_num_constraints;              ///< number of constraints when the map was created
+    std::vector<int> m_map_contributor_start;  ///< start of the entries of each contributor
+    std::vector<int> m_map_entry_rows;         ///< row of each pasted entry
+    std::vector<int> m_map_entry_cols;         ///< column of each pasted entry
+    std::vector<int> m_map_entry_slot;         ///< location in the array of nonzeros of each pasted entry
+    std::vector<char> m_map_entry_overwrite;   ///< overwrite (1) or accumulate (0) each pasted entry
+    std::vector<int> m_map_slot_start;         ///< start of the list of entries of each nonzero
+    std::vector<int> m_map_slot_entries;       ///< entries contributing to each nonzero, in assembly order
+    std::vector<double> m_map_entry_values;    ///< current values of all pasted entries
+
+    bool m_schur_valid;             ///< are the assembled Schur complement operators up to date?
+    int m_schur_nthreads;           ///< number of OpenMP threads for the assembled Schur complement product
+    ChSparseMatrix m_schur_Cq;      ///< assembled Jacobian of the active constraints (n_c x n_q)
+    ChSparseMatrix m_schur_MinvCq;  ///< assembled product [M^(-1)][Cq'] (n_q x n_c)
+    ChVectorDynamic<> m_schur_E;    ///< compliance terms of the active constraints
+    ChVectorDynamic<> m_schur_l;    ///< work vector for masked multipliers (n_c)
+    ChVectorDynamic<> m_schur_q;    ///< work vector for [M^(-1)][Cq']*l (n_q)
 };
 
 CH_CLASS_VERSION(ChSystemDescriptor, 0)
@@ -68,6 +68,67 @@ void ChTimestepper::ArchiveIn(ChArchiveIn& archive) {
 
 // -----------------------------------------------------------------------------
 
+void ChImplicitIterativeTimestepper::SetJacobianUpdateMethod(JacobianUpdate method) {
+    jacobian_update_method = method;
+    jacobian_valid = false;
+}
+
+void ChImplicitIterativeTimestepper::InitializeJacobianUpdate(double h, unsigned int n) {
+    solve_h = h;
+    solve_n = n;
+    solve_iter = 0;
+    correction_norm = 0;
+    jacobian_current = false;
+
+    switch (jacobian_update_method) {
+        case JacobianUpdate::EVERY_ITERATION:
+        case JacobianUpdate::EVERY_STEP:
+            call_setup = true;
+            break;
+        case JacobianUpdate::AUTOMATIC:
+            // The Newton matrix depends on the step size (through the coefficients of the stiffness and damping
+            // terms) and its factorization cannot be reused if the problem size changed.
+            call_setup = call_setup || !jacobian_valid || h != jacobian_h || n != jacobian_n;
+            break;
+    }
+}
+
+void ChImplicitIterativeTimestepper::ProcessNewtonIteration(double norm) {
+    numiters++;
+    numsolves++;
+    if (call_setup) {
+        numsetups++;
+        jacobian_valid = true;
+        jacobian_current = true;
+        jacobian_h = solve_h;
+        jacobian_n = solve_n;
+    }
+
+    // Estimate the contraction rate from the last two corrections
+    contraction_rate = (solve_iter > 0 && correction_norm > 0) ? norm / correction_norm : 0;
+    correction_norm = norm;
+    solve_iter++;
+
+    switch (jacobian_update_method) {
+        case JacobianUpdate::EVERY_ITERATION:
+            call_setup = true;
+            break;
+        case JacobianUpdate::EVERY_STEP:
+            call_setup = false;
+            break;
+        case JacobianUpdate::AUTOMATIC:
+            call_setup = contraction_rate > jacobian_update_rate;
+            break;
+    }
+}
+
+void ChImplicitIterativeTimestepper::InvalidateJacobian() {
+    jacobian_valid = false;
+    call_setup = true;
+}
+
+// -----------------------------------------------------------------------------
+
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChTimestepperEulerExpl)
 CH_UPCASTING(ChTimestepperEulerExpl, ChTimestepperIorder)
@@ -444,6 +505,7 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
     numiters = 0;
     numsetups = 0;
     numsolves = 0;
+    InitializeJacobianUpdate(dt, mintegrable->GetNumCoordsVelLevel() + mintegrable->GetNumConstraints());
 
     for (int i = 0; i < this->GetMaxIters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
@@ -470,12 +532,10 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always call the solver's Setup
+            call_setup                      // call the solver's Setup, depending on the Jacobian update strategy
         );
 
-        numiters++;
-        numsetups++;
-        numsolves++;
+        ProcessNewtonIteration(Dv.lpNorm<Eigen::Infinity>());
 
         Dl *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
@@ -762,6 +822,7 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
     numiters = 0;
     numsetups = 0;
     numsolves = 0;
+    InitializeJacobianUpdate(dt, mintegrable->GetNumCoordsVelLevel() + mintegrable->GetNumConstraints());
 
     for (int i = 0; i < this->GetMaxIters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
@@ -788,12 +849,10 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always force a call to the solver's Setup() function
+            call_setup                      // call the solver's Setup, depending on the Jacobian update strategy
         );
 
-        numiters++;
-        numsetups++;
-        numsolves++;
+        ProcessNewtonIteration(Dv.lpNorm<Eigen::Infinity>());
 
         Dl *= (2.0 / dt);  // Note it is not -(2.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
@@ -1077,7 +1136,7 @@ void ChTimestepperNewmark::Advance(const double dt) {
     numiters = 0;
     numsetups = 0;
     numsolves = 0;
-    bool call_setup = true;
+    InitializeJacobianUpdate(dt, mintegrable->GetNumCoordsVelLevel() + mintegrable->GetNumConstraints());
 
     for (int i = 0; i < this->GetMaxIters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
@@ -1103,7 +1162,7 @@ void ChTimestepperNewmark::Advance(const double dt) {
             break;
         }
 
-        if (verbose && modified_Newton && call_setup)
+        if (verbose && jacobian_update_method != JacobianUpdate::EVERY_ITERATION && call_setup)
             std::cout << " Newmark call Setup." << std::endl;
 
         mintegrable->StateSolveCorrection(  //
@@ -1117,14 +1176,7 @@ void ChTimestepperNewmark::Advance(const double dt) {
             call_setup                      // force a call to the solver's Setup() function
         );
 
-        numiters++;
-        numsolves++;
-        if (call_setup) {
-            numsetups++;
-        }
-
-        // If using modified Newton, do not call Setup again
-        call_setup = !modified_Newton;
+        ProcessNewtonIteration(Da.lpNorm<Eigen::Infinity>());
 
         L += Dl;  // Note it is not -= Dl because we assume StateSolveCorrection flips sign of Dl
         Anew += Da;
@@ -232,6 +232,16 @@ class ChApi ChImplicitTimestepper {};
 /// using an iterative process, up to a desired tolerance. At each iteration,
 /// a linear system must be solved.
 class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
+  public:
+    /// Strategy for updating the Newton matrix (Jacobian) in the nonlinear solver.
+    /// An update implies re-evaluating the Newton matrix and calling the linear solver's Setup function (which, for a
+    /// direct solver, performs the matrix factorization).
+    enum class JacobianUpdate {
+        EVERY_ITERATION,  ///< update at every Newton iteration (full Newton)
+        EVERY_STEP,       ///< update at the first iteration of each step (modified Newton)
+        AUTOMATIC         ///< keep across steps and update only if the Newton contraction rate degrades
+    };
+
   protected:
     unsigned int maxiters;  ///< maximum number of iterations
     double reltol;          ///< relative tolerance
@@ -242,9 +252,54 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     unsigned int numsetups;  ///< number of calls to the solver's Setup function
     unsigned int numsolves;  ///< number of calls to the solver's Solve function
 
+    JacobianUpdate jacobian_update_method;  ///< Newton matrix update strategy
+    double jacobian_update_rate;            ///< contraction rate above which the Newton matrix is updated (AUTOMATIC)
+    bool call_setup;                        ///< should the solver's Setup function be called at the next iteration?
+    bool jacobian_valid;                    ///< is there a Newton matrix factorization that can be reused?
+    bool jacobian_current;                  ///< was the Newton matrix updated during the current nonlinear solve?
+    double jacobian_h;                      ///< step size at the last Newton matrix update
+    unsigned int jacobian_n;                ///< problem size at the last Newton matrix update
+    double solve_h;                         ///< step size for the current nonlinear solve
+    unsigned int solve_n;                   ///< problem size for the current nonlinear solve
+    unsigned int solve_iter;                ///< iteration counter for the current nonlinear solve
+    double correction_norm;                 ///< norm of the last Newton correction
+    double contraction_rate;                ///< ratio of the last two Newton correction norms
+
+    /// Initialize the Newton matrix update policy for a nonlinear solve with step size h and problem size n.
+    /// With the AUTOMATIC strategy, the Newton matrix is kept from a previous solve if it is still valid and if
+    /// neither the step size nor the problem size changed.
+    void InitializeJacobianUpdate(double h, unsigned int n);
+
+    /// Process a completed Newton iteration, given the norm of the computed correction.
+    /// Updates the iteration counters, estimates the contraction rate, and decides whether the solver's Setup function
+    /// must be called at the next iteration.
+    void ProcessNewtonIteration(double norm);
+
+    /// Invalidate the current Newton matrix and force an update at the next iteration.
+    /// To be called by derived classes if the nonlinear solver fails to converge.
+    void InvalidateJacobian();
+
   public:
     ChImplicitIterativeTimestepper()
-        : maxiters(6), reltol(1e-4), abstolS(1e-10), abstolL(1e-10), numiters(0), numsetups(0), numsolves(0) {}
+        : maxiters(6),
+          reltol(1e-4),
+          abstolS(1e-10),
+          abstolL(1e-10),
+          numiters(0),
+          numsetups(0),
+          numsolves(0),
+          jacobian_update_method(JacobianUpdate::EVERY_ITERATION),
+          jacobian_update_rate(0.5),
+          call_setup(true),
+          jacobian_valid(false),
+          jacobian_current(false),
+          jacobian_h(0),
+          jacobian_n(0),
+          solve_h(0),
+          solve_n(0),
+          solve_iter(0),
+          correction_norm(0),
+          contraction_rate(0) {}
     virtual ~ChImplicitIterativeTimestepper() {}
 
     /// Set the max number of iterations using the Newton Raphson procedure
@@ -284,6 +339,25 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     /// Return the number of calls to the solver's Solve function.
     unsigned int GetNumSolveCalls() const { return numsolves; }
 
+    /// Set the strategy for updating the Newton matrix.
+    /// With EVERY_ITERATION, the Newton matrix is re-evaluated and factorized at each iteration of the nonlinear
+    /// solver. With EVERY_STEP (modified Newton), this happens only at the first iteration of a step. With AUTOMATIC,
+    /// the factorization is kept across steps and is updated only if the Newton iteration converges too slowly (see
+    /// SetJacobianUpdateRate), if the nonlinear solver fails, or if the step size or the problem size change.
+    /// The default strategy depends on the integrator.
+    void SetJacobianUpdateMethod(JacobianUpdate method);
+
+    /// Return the current strategy for updating the Newton matrix.
+    JacobianUpdate GetJacobianUpdateMethod() const { return jacobian_update_method; }
+
+    /// Set the contraction rate threshold used with the AUTOMATIC Jacobian update strategy (default: 0.5).
+    /// The contraction rate is estimated as the ratio of the norms of two successive Newton corrections. If it
+    /// exceeds this threshold, the Newton matrix is updated at the next iteration.
+    void SetJacobianUpdateRate(double rate) { jacobian_update_rate = rate; }
+
+    /// Return the last estimate of the Newton contraction rate.
+    double GetContractionRate() const { return contraction_rate; }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive) {
         // version number
@@ -637,14 +711,13 @@ class ChApi ChTimestepperNewmark : public ChTimestepperIIorder, public ChImplici
     ChVectorDynamic<> R;
     ChVectorDynamic<> Rold;
     ChVectorDynamic<> Qc;
-    bool modified_Newton;
 
   public:
     /// Constructors (default empty)
     ChTimestepperNewmark(ChIntegrableIIorder* intgr = nullptr)
         : ChTimestepperIIorder(intgr), ChImplicitIterativeTimestepper() {
         SetGammaBeta(0.6, 0.3);  // default values with some damping, and that works also with DAE constraints
-        modified_Newton = true;  // default use modified Newton with jacobian factorization only at beginning
+        jacobian_update_method = JacobianUpdate::EVERY_STEP;  // default use modified Newton
     }
 
     virtual Type GetType() const override { return Type::NEWMARK; }
@@ -667,7 +740,10 @@ class ChApi ChTimestepperNewmark : public ChTimestepperIIorder, public ChImplici
     /// If enabled, the Newton matrix is evaluated, assembled, and factorized only once per step.
     /// If disabled, the Newton matrix is evaluated at every iteration of the nonlinear solver.
     /// Modified Newton iteration is enabled by default.
-    void SetModifiedNewton(bool val) { modified_Newton = val; }
+    /// This is equivalent to setting the Jacobian update strategy to EVERY_STEP or EVERY_ITERATION, respectively.
+    void SetModifiedNewton(bool val) {
+        SetJacobianUpdateMethod(val ? JacobianUpdate::EVERY_STEP : JacobianUpdate::EVERY_ITERATION);
+    }
 
     /// Performs an integration timestep
     virtual void Advance(const double dt  ///< timestep to advance
@@ -33,9 +33,9 @@ ChTimestepperHHT::ChTimestepperHHT(ChIntegrableIIorder* intgr)
       step_decrease_factor(0.5),
       h_min(1e-10),
       h(1e6),
-      num_successful_steps(0),
-      modified_Newton(true) {
-    SetAlpha(-0.2);  // default: some dissipation
+      num_successful_steps(0) {
+    SetAlpha(-0.2);                                       // default: some dissipation
+    jacobian_update_method = JacobianUpdate::EVERY_STEP;  // default: modified Newton
 }
 
 void ChTimestepperHHT::SetAlpha(double val) {
@@ -97,19 +97,25 @@ void ChTimestepperHHT::Advance(const double dt) {
         h = std::min(h, dt);
     }
 
-    // Monitor flags controlling whther or not the Newton matrix must be updated.
-    // If using modified Newton, a matrix update occurs:
+    // The Newton matrix update policy depends on the selected strategy (see ChImplicitIterativeTimestepper).
+    // If using modified Newton (EVERY_STEP), a matrix update occurs:
     //   - at the beginning of a step
     //   - on a stepsize decrease
+    // If using the AUTOMATIC strategy, the matrix is kept across steps and an update occurs:
+    //   - if the Newton contraction rate degrades
+    //   - on a stepsize change
     //   - if the Newton iteration does not converge with an out-of-date matrix
     // Otherwise, the matrix is updated at each iteration.
-    matrix_is_current = false;
-    call_setup = true;
+    unsigned int n = mintegrable->GetNumCoordsVelLevel() + mintegrable->GetNumConstraints();
+    unsigned int num_attempts = 0;
 
     // Loop until reaching final time
     while (true) {
         Prepare(mintegrable);
 
+        if (num_attempts++ == 0 || jacobian_update_method == JacobianUpdate::AUTOMATIC)
+            InitializeJacobianUpdate(h, n);
+
         // Newton for state at T+h
         Da_nrm_hist.fill(0.0);
         Dl_nrm_hist.fill(0.0);
@@ -117,21 +123,14 @@ void ChTimestepperHHT::Advance(const double dt) {
         unsigned int it;
 
         for (it = 0; it < maxiters; it++) {
-            if (verbose && modified_Newton && call_setup)
+            if (verbose && jacobian_update_method != JacobianUpdate::EVERY_ITERATION && call_setup)
                 std::cout << " HHT call Setup." << std::endl;
 
             // Solve linear system and increment state
             Increment(mintegrable);
 
-            // Increment counters
-            numiters++;
-            numsolves++;
-            if (call_setup) {
-                numsetups++;
-            }
-
-            // If using modified Newton, do not call Setup again
-            call_setup = !modified_Newton;
+            // Increment counters and decide whether to call Setup at the next iteration
+            ProcessNewtonIteration(Da.norm());
 
             // Check convergence
             converged = CheckConvergence(it);
@@ -166,20 +165,18 @@ void ChTimestepperHHT::Advance(const double dt) {
             A = Anew;
             L = Lnew;
 
-            /*
-            } else if (!matrix_is_current) {
-                // ------ NR did not converge but the matrix was out-of-date
+        } else if (jacobian_update_method == JacobianUpdate::AUTOMATIC && !jacobian_current) {
+            // ------ NR did not converge but the matrix was out-of-date
 
-                // reset the count of successive successful steps
-                num_successful_steps = 0;
+            // reset the count of successive successful steps
+            num_successful_steps = 0;
 
-                // re-attempt step with updated matrix
-                if (verbose) {
-                    std::cout << " HHT re-attempt step with updated matrix." << std::endl;
-                }
+            // re-attempt step with updated matrix
+            if (verbose) {
+                std::cout << " HHT re-attempt step with updated matrix." << std::endl;
+            }
 
-                call_setup = true;
-            */
+            InvalidateJacobian();
 
         } else if (!step_control) {
             // ------ NR did not converge and we do not control stepsize
@@ -219,7 +216,7 @@ void ChTimestepperHHT::Advance(const double dt) {
             }
 
             // force a matrix re-evaluation (due to change in stepsize)
-            call_setup = true;
+            InvalidateJacobian();
         }
 
         if (T >= tfinal) {
@@ -307,8 +304,6 @@ void ChTimestepperHHT::Increment(ChIntegrableIIorder* integrable) {
     Xnew = X + V * h + A * (h * h * (0.5 - beta)) + Anew * (h * h * beta);
     Vnew = V + A * (h * (1.0 - gamma)) + Anew * (h * gamma);
 
-    // If Setup was called at this iteration, mark the Newton matrix as up-to-date
-    matrix_is_current = call_setup;
 }
 
 // Convergence test
@@ -70,10 +70,14 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
 
     /// Enable/disable modified Newton.
     /// If enabled, the Newton matrix is evaluated, assembled, and factorized only once
-    /// per step or if the Newton iteration does not converge with an out-of-date matrix.
+    /// per step or on a stepsize decrease.
     /// If disabled, the Newton matrix is evaluated at every iteration of the nonlinear solver.
+    /// This is equivalent to setting the Jacobian update strategy to EVERY_STEP or EVERY_ITERATION, respectively.
+    /// See SetJacobianUpdateMethod for reusing the Newton matrix across steps.
     /// Default: true.
-    void SetModifiedNewton(bool enable) { modified_Newton = enable; }
+    void SetModifiedNewton(bool enable) {
+        SetJacobianUpdateMethod(enable ? JacobianUpdate::EVERY_STEP : JacobianUpdate::EVERY_ITERATION);
+    }
 
     /// Perform an integration timestep, by advancing the state by the specified time step.
     virtual void Advance(const double dt) override;
@@ -123,10 +127,6 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     double h;                           ///< internal stepsize
     unsigned int num_successful_steps;  ///< number of successful steps
 
-    bool modified_Newton;    ///< use modified Newton?
-    bool matrix_is_current;  ///< is the Newton matrix up-to-date?
-    bool call_setup;         ///< should the solver's Setup function be called?
-
     ChVectorDynamic<> ewtS;  ///< vector of error weights (states)
     ChVectorDynamic<> ewtL;  ///< vector of error weights (Lagrange multipliers)
 };
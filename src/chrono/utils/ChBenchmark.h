@@ -20,8 +20,12 @@
 #ifndef CH_BENCHMARK_H
 #define CH_BENCHMARK_H
 
+#include <string>
+#include <vector>
+
 #include "chrono_thirdparty/googlebenchmark/include/benchmark/benchmark.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/utils/ChProfiler.h"
 
 namespace chrono {
 namespace utils {
@@ -34,6 +38,7 @@ namespace utils {
 /// GetSystem (to return a pointer to the underlying Chrono system) and ExecuteStep (to perform
 /// all operations required to advance the system state by one time step).
 /// Timing information for various phases of the simulation is collected for a sequence of steps.
+/// Optionally, the profile zones recorded during a sequence of steps can also be collected (see EnableProfiling).
 class ChBenchmarkTest {
   public:
     ChBenchmarkTest();
@@ -45,6 +50,11 @@ class ChBenchmarkTest {
     void Simulate(int num_steps);
     void ResetTimers();
 
+    /// Enable/disable collection of profile zones during Simulate (default: false).
+    /// If a trace file name is provided, the zone timeline of the last call to Simulate is written to that file, in
+    /// the Chrome trace format.
+    void EnableProfiling(bool val, const std::string& trace_file = "");
+
     double m_timer_step;              ///< time for performing simulation
     double m_timer_advance;           ///< time for integration
     double m_timer_jacobian;          ///< time for evaluating/loading Jacobian data
@@ -55,6 +65,10 @@ class ChBenchmarkTest {
     double m_timer_collision_narrow;  ///< time for narrow-phase collision
     double m_timer_setup;             ///< time for system update
     double m_timer_update;            ///< time for system update
+
+    bool m_profile;                                ///< collect profile zones?
+    std::string m_trace_file;                      ///< output file for the zone timeline
+    std::vector<ChProfileZoneStats> m_zone_stats;  ///< profile zones collected during last call to Simulate
 };
 
 inline ChBenchmarkTest::ChBenchmarkTest()
@@ -67,11 +81,22 @@ inline ChBenchmarkTest::ChBenchmarkTest()
       m_timer_collision_broad(0),
       m_timer_collision_narrow(0),
       m_timer_setup(0),
-      m_timer_update(0) {}
+      m_timer_update(0),
+      m_profile(false) {}
+
+inline void ChBenchmarkTest::EnableProfiling(bool val, const std::string& trace_file) {
+    m_profile = val;
+    m_trace_file = trace_file;
+}
 
 inline void ChBenchmarkTest::Simulate(int num_steps) {
     ////std::cout << "  simulate from t=" << GetSystem()->GetChTime() << " for steps=" << num_steps << std::endl;
     ResetTimers();
+    if (m_profile) {
+        ChProfiler::Reset();
+        ChProfiler::EnableTrace(!m_trace_file.empty());
+        ChProfiler::Enable(true);
+    }
     for (int i = 0; i < num_steps; i++) {
         ExecuteStep();
         m_timer_step += GetSystem()->GetTimerStep();
@@ -85,6 +110,13 @@ inline void ChBenchmarkTest::Simulate(int num_steps) {
         m_timer_setup += GetSystem()->GetTimerSetup();
         m_timer_update += GetSystem()->GetTimerUpdate();
     }
+    if (m_profile) {
+        ChProfiler::Enable(false);
+        ChProfiler::EnableTrace(false);
+        m_zone_stats = ChProfiler::GetZoneStats();
+        if (!m_trace_file.empty())
+            ChProfiler::WriteChromeTrace(m_trace_file);
+    }
 }
 
 inline void ChBenchmarkTest::ResetTimers() {
@@ -171,6 +203,17 @@ class ChBenchmarkFixture : public ::benchmark::Fixture {
         st.counters["CD_Total"] = m_test->m_timer_collision * 1e3;
         st.counters["CD_Broad"] = m_test->m_timer_collision_broad * 1e3;
         st.counters["CD_Narrow"] = m_test->m_timer_collision_narrow * 1e3;
+
+        // Report the top two levels of profile zones, if collected
+        // (zones with same name and category under different parents are accumulated)
+        for (const auto& zone : m_test->m_zone_stats) {
+            if (zone.depth > 1)
+                continue;
+            std::string name = "Zone_" + zone.name;
+            if (!zone.category.empty())
+                name += "_" + zone.category;
+            st.counters[name].value += zone.total_time * 1e3;
+        }
     }
 
     void Reset(int num_init_steps) {
@@ -9,312 +9,305 @@
 // http://projectchrono.org/license-chrono.txt.
 //
 // =============================================================================
-// Authors: Alessandro Tasora
-// =============================================================================
-// =============================================================================
-// CODE MODIFIED FROM: profile.cpp
-// Real-Time Hierarchical Profiling for Game Programming Gems 3
-// by Greg Hjelstrom & Byon Garrabrant
-//
-// Credits: The Clock class was inspired by the Timer classes in  Ogre
-// (www.ogre3d.org).
+// Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
-#include "chrono/core/ChTimer.h"
-#include "chrono/utils/ChProfiler.h"
-
-#include <ctime>
-#include <ratio>
+#include <atomic>
 #include <chrono>
-#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+
+#include "chrono/utils/ChProfiler.h"
 
 namespace chrono {
 namespace utils {
 
-#ifndef CH_NO_PROFILE
-
-static ChTimer gProfileClock;
-
-    #define mymin(a, b) (a > b ? a : b)
-
-inline void Profile_Get_Ticks(unsigned long int* ticks) {
-    *ticks = (unsigned long)gProfileClock.GetTimeMicroseconds();
+namespace {
+
+using ProfileClock = std::chrono::steady_clock;
+
+// Node in the zone hierarchy of one thread (or in the merged hierarchy).
+struct ZoneNode {
+    const char* name;
+    const char* category;
+    int parent;
+    std::vector<int> children;
+    unsigned long calls;
+    int64_t total_ns;
+    int64_t child_ns;
+};
+
+// Zone recorded in the timeline of one thread.
+// A zone still open has end_ns < 0.
+struct ZoneEvent {
+    const char* name;
+    const char* category;
+    int64_t start_ns;
+    int64_t end_ns;
+};
+
+// Zone currently open on one thread.
+struct OpenZone {
+    int node;
+    int event;
+    int64_t start_ns;
+};
+
+// Profiling data of one thread. Only accessed by the owning thread while recording.
+struct ThreadProfile {
+    int index;
+    std::vector<ZoneNode> nodes;
+    std::vector<int> roots;
+    std::vector<OpenZone> stack;
+    std::vector<ZoneEvent> events;
+};
+
+// Global profiler state.
+struct ProfilerState {
+    std::atomic<bool> enabled{false};
+    std::atomic<bool> trace{false};
+    size_t max_events = 1000000;
+    ProfileClock::time_point epoch = ProfileClock::now();
+    std::mutex mutex;  // protects the list of thread profiles
+    std::vector<std::unique_ptr<ThreadProfile>> threads;
+};
+
+ProfilerState& GetState() {
+    static ProfilerState state;
+    return state;
 }
 
-inline float Profile_Get_Tick_Rate(void) {
-    //	return 1000000.f;
-    return 1000.f;
-}
-
-/***************************************************************************************************
-**
-** ChProfileNode
-**
-***************************************************************************************************/
-
-/***********************************************************************************************
- * INPUT:                                                                                      *
- * name - pointer to a static string which is the name of this profile node                    *
- * parent - parent pointer                                                                     *
- *                                                                                             *
- * WARNINGS:                                                                                   *
- * The name is assumed to be a static pointer, only the pointer is stored and compared for     *
- * efficiency reasons.                                                                         *
- *=============================================================================================*/
-ChProfileNode::ChProfileNode(const char* name, ChProfileNode* parent)
-    : Name(name),
-      TotalCalls(0),
-      TotalTime(0),
-      StartTime(0),
-      RecursionCounter(0),
-      Parent(parent),
-      Child(NULL),
-      Sibling(NULL) {
-    Reset();
+ThreadProfile& GetThreadProfile() {
+    thread_local ThreadProfile* profile = nullptr;
+    if (!profile) {
+        auto& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.threads.push_back(std::unique_ptr<ThreadProfile>(new ThreadProfile));
+        profile = state.threads.back().get();
+        profile->index = (int)state.threads.size() - 1;
+    }
+    return *profile;
 }
 
-void ChProfileNode::CleanupMemory() {
-    delete (Child);
-    Child = NULL;
-    delete (Sibling);
-    Sibling = NULL;
+int64_t GetTimeNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(ProfileClock::now() - GetState().epoch).count();
 }
 
-ChProfileNode::~ChProfileNode(void) {
-    delete (Child);
-    delete (Sibling);
+bool SameZone(const ZoneNode& node, const char* name, const char* category) {
+    return (node.name == name || std::strcmp(node.name, name) == 0) &&
+           (node.category == category || std::strcmp(node.category, category) == 0);
 }
 
-/***********************************************************************************************
- * INPUT:                                                                                      *
- * name - static string pointer to the name of the node we are searching for                   *
- *                                                                                             *
- * WARNINGS:                                                                                   *
- * All profile names are assumed to be static strings so this function uses pointer compares   *
- * to find the named node.                                                                     *
- *=============================================================================================*/
-ChProfileNode* ChProfileNode::Get_Sub_Node(const char* name) {
-    // Try to find this sub node
-    ChProfileNode* child = Child;
-    while (child) {
-        if (child->Name == name) {
-            return child;
-        }
-        child = child->Sibling;
+// Find the child of 'parent' (or the root if parent = -1) with given name and category. Create it if needed.
+int FindOrAddNode(std::vector<ZoneNode>& nodes,
+                  std::vector<int>& roots,
+                  int parent,
+                  const char* name,
+                  const char* category) {
+    auto& siblings = (parent < 0) ? roots : nodes[parent].children;
+    for (int i : siblings) {
+        if (SameZone(nodes[i], name, category))
+            return i;
     }
 
-    // We didn't find it, so add it
-
-    ChProfileNode* node = new ChProfileNode(name, this);
-    node->Sibling = Child;
-    Child = node;
-    return node;
+    int index = (int)nodes.size();
+    (parent < 0 ? roots : nodes[parent].children).push_back(index);
+    nodes.push_back({name, category, parent, {}, 0, 0, 0});
+    return index;
 }
 
-void ChProfileNode::Reset(void) {
-    TotalCalls = 0;
-    TotalTime = 0.0f;
-
-    if (Child) {
-        Child->Reset();
-    }
-    if (Sibling) {
-        Sibling->Reset();
-    }
+// Merge the subtree of a thread profile node into the merged hierarchy.
+void MergeNode(const ThreadProfile& profile,
+               int node,
+               int merged_parent,
+               std::vector<ZoneNode>& merged,
+               std::vector<int>& merged_roots) {
+    const auto& src = profile.nodes[node];
+    int dst = FindOrAddNode(merged, merged_roots, merged_parent, src.name, src.category);
+    merged[dst].calls += src.calls;
+    merged[dst].total_ns += src.total_ns;
+    merged[dst].child_ns += src.child_ns;
+    for (int child : src.children)
+        MergeNode(profile, child, dst, merged, merged_roots);
 }
 
-void ChProfileNode::Call(void) {
-    TotalCalls++;
-    if (RecursionCounter++ == 0) {
-        Profile_Get_Ticks(&StartTime);
-    }
+// Append the subtree of a merged node to the list of zone statistics, in depth-first order.
+void CollectStats(const std::vector<ZoneNode>& merged,
+                  int node,
+                  int parent,
+                  int depth,
+                  std::vector<ChProfileZoneStats>& stats) {
+    const auto& src = merged[node];
+    int index = (int)stats.size();
+    stats.push_back({src.name, src.category, parent, depth, src.calls, src.total_ns * 1e-9,
+                     (src.total_ns - src.child_ns) * 1e-9});
+    for (int child : src.children)
+        CollectStats(merged, child, index, depth + 1, stats);
 }
 
-bool ChProfileNode::Return(void) {
-    if (--RecursionCounter == 0 && TotalCalls != 0) {
-        unsigned long int time;
-        Profile_Get_Ticks(&time);
-        time -= StartTime;
-        TotalTime += (float)time / Profile_Get_Tick_Rate();
+void WriteEscaped(std::ostream& os, const char* str) {
+    for (const char* c = str; *c; c++) {
+        if (*c == '"' || *c == '\\')
+            os << '\\';
+        os << *c;
     }
-    return (RecursionCounter == 0);
 }
 
-/***************************************************************************************************
-**
-** ChProfileIterator
-**
-***************************************************************************************************/
-ChProfileIterator::ChProfileIterator(ChProfileNode* start) {
-    CurrentParent = start;
-    CurrentChild = CurrentParent->Get_Child();
-}
+}  // end anonymous namespace
 
-void ChProfileIterator::First(void) {
-    CurrentChild = CurrentParent->Get_Child();
-}
+// -----------------------------------------------------------------------------
 
-void ChProfileIterator::Next(void) {
-    CurrentChild = CurrentChild->Get_Sibling();
+void ChProfiler::Enable(bool val) {
+    GetState().enabled = val;
 }
 
-bool ChProfileIterator::Is_Done(void) {
-    return CurrentChild == NULL;
+bool ChProfiler::IsEnabled() {
+    return GetState().enabled;
 }
 
-void ChProfileIterator::Enter_Child(int index) {
-    CurrentChild = CurrentParent->Get_Child();
-    while ((CurrentChild != NULL) && (index != 0)) {
-        index--;
-        CurrentChild = CurrentChild->Get_Sibling();
-    }
-
-    if (CurrentChild != NULL) {
-        CurrentParent = CurrentChild;
-        CurrentChild = CurrentParent->Get_Child();
-    }
+void ChProfiler::EnableTrace(bool val, size_t max_events) {
+    auto& state = GetState();
+    state.max_events = max_events;
+    state.trace = val;
 }
 
-void ChProfileIterator::Enter_Parent(void) {
-    if (CurrentParent->Get_Parent() != NULL) {
-        CurrentParent = CurrentParent->Get_Parent();
+void ChProfiler::Reset() {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (auto& profile : state.threads) {
+        profile->nodes.clear();
+        profile->roots.clear();
+        profile->stack.clear();
+        profile->events.clear();
     }
-    CurrentChild = CurrentParent->Get_Child();
+    state.epoch = ProfileClock::now();
 }
 
-/***************************************************************************************************
-**
-** ChProfileManager
-**
-***************************************************************************************************/
-
-ChProfileNode ChProfileManager::Root("Root", NULL);
-ChProfileNode* ChProfileManager::CurrentNode = &ChProfileManager::Root;
-int ChProfileManager::FrameCounter = 0;
-unsigned long int ChProfileManager::ResetTime = 0;
-
-/***********************************************************************************************
- * ChProfileManager::Start_Profile -- Begin a named profile                                    *
- *                                                                                             *
- * Steps one level deeper into the tree, if a child already exists with the specified name     *
- * then it accumulates the profiling; otherwise a new child node is added to the profile tree. *
- *                                                                                             *
- * INPUT:                                                                                      *
- * name - name of this profiling record                                                        *
- *                                                                                             *
- * WARNINGS:                                                                                   *
- * The string used is assumed to be a static string; pointer compares are used throughout      *
- * the profiling code for efficiency.                                                          *
- *=============================================================================================*/
-void ChProfileManager::Start_Profile(const char* name) {
-    if (name != CurrentNode->Get_Name()) {
-        CurrentNode = CurrentNode->Get_Sub_Node(name);
-    }
+bool ChProfiler::BeginZone(const char* name, const char* category) {
+    auto& state = GetState();
+    if (!state.enabled.load(std::memory_order_relaxed))
+        return false;
 
-    CurrentNode->Call();
-}
+    auto& profile = GetThreadProfile();
+    int parent = profile.stack.empty() ? -1 : profile.stack.back().node;
+    int node = FindOrAddNode(profile.nodes, profile.roots, parent, name, category);
 
-/***********************************************************************************************
- * ChProfileManager::Stop_Profile -- Stop timing and record the results.                       *
- *=============================================================================================*/
-void ChProfileManager::Stop_Profile(void) {
-    // Return will indicate whether we should back up to our parent (we may
-    // be profiling a recursive function)
-    if (CurrentNode->Return()) {
-        CurrentNode = CurrentNode->Get_Parent();
+    int event = -1;
+    if (state.trace.load(std::memory_order_relaxed) && profile.events.size() < state.max_events) {
+        event = (int)profile.events.size();
+        profile.events.push_back({name, category, 0, -1});
     }
-}
 
-/***********************************************************************************************
- * ChProfileManager::Reset -- Reset the contents of the profiling system                       *
- *                                                                                             *
- *    This resets everything except for the tree structure.  All of the timing data is reset.  *
- *=============================================================================================*/
-void ChProfileManager::Reset(void) {
-    gProfileClock.reset();
-    gProfileClock.start();
-    Root.Reset();
-    Root.Call();
-    FrameCounter = 0;
-    Profile_Get_Ticks(&ResetTime);
+    int64_t start = GetTimeNanoseconds();
+    if (event >= 0)
+        profile.events[event].start_ns = start;
+    profile.stack.push_back({node, event, start});
+
+    return true;
 }
 
-/***********************************************************************************************
- * ChProfileManager::Increment_Frame_Counter -- Increment the frame counter                    *
- *=============================================================================================*/
-void ChProfileManager::Increment_Frame_Counter(void) {
-    FrameCounter++;
+void ChProfiler::EndZone() {
+    int64_t end = GetTimeNanoseconds();
+
+    auto& profile = GetThreadProfile();
+    if (profile.stack.empty())
+        return;
+
+    OpenZone zone = profile.stack.back();
+    profile.stack.pop_back();
+
+    int64_t duration = end - zone.start_ns;
+    auto& node = profile.nodes[zone.node];
+    node.calls++;
+    node.total_ns += duration;
+    if (node.parent >= 0)
+        profile.nodes[node.parent].child_ns += duration;
+
+    if (zone.event >= 0)
+        profile.events[zone.event].end_ns = end;
 }
 
-/***********************************************************************************************
- * ChProfileManager::Get_Time_Since_Reset -- returns the elapsed time since last reset         *
- *=============================================================================================*/
-float ChProfileManager::Get_Time_Since_Reset(void) {
-    unsigned long int time;
-    Profile_Get_Ticks(&time);
-    time -= ResetTime;
-    return (float)time / Profile_Get_Tick_Rate();
+double ChProfiler::GetTimeSinceReset() {
+    return GetTimeNanoseconds() * 1e-9;
 }
 
-void ChProfileManager::dumpRecursive(ChProfileIterator* profileIterator, int spacing) {
-    profileIterator->First();
-    if (profileIterator->Is_Done())
-        return;
+std::vector<ChProfileZoneStats> ChProfiler::GetZoneStats() {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
 
-    float accumulated_time = 0, parent_time = profileIterator->Is_Root()
-                                                  ? ChProfileManager::Get_Time_Since_Reset()
-                                                  : profileIterator->Get_Current_Parent_Total_Time();
-    int frames_since_reset = ChProfileManager::Get_Frame_Count_Since_Reset();
-    for (int i = 0; i < spacing; i++)
-        printf(".");
-    printf("----------------------------------\n");
-    for (int i = 0; i < spacing; i++)
-        printf(".");
-    printf("Profiling: %s (total running time: %.3f ms) ---\n", profileIterator->Get_Current_Parent_Name(),
-           parent_time);
-    float totalTime = 0.f;
-
-    int numChildren = 0;
-
-    for (int i = 0; !profileIterator->Is_Done(); i++, profileIterator->Next()) {
-        numChildren++;
-        float current_total_time = profileIterator->Get_Current_Total_Time();
-        accumulated_time += current_total_time;
-        float fraction = parent_time > FLT_EPSILON ? (current_total_time / parent_time) * 100 : 0.f;
-        for (int j = 0; j < spacing; j++)
-            printf(".");
-        printf("%d -- %s (%.2f %%) :: %.3f ms / frame (%d calls)\n", i, profileIterator->Get_Current_Name(), fraction,
-               (current_total_time / (double)frames_since_reset), profileIterator->Get_Current_Total_Calls());
-        totalTime += current_total_time;
-        // recurse into children
+    std::vector<ZoneNode> merged;
+    std::vector<int> merged_roots;
+    for (const auto& profile : state.threads) {
+        for (int root : profile->roots)
+            MergeNode(*profile, root, -1, merged, merged_roots);
     }
 
-    if (parent_time < accumulated_time) {
-        printf("what's wrong\n");
-    }
-    for (int i = 0; i < spacing; i++)
-        printf(".");
-    printf("%s (%.3f %%) :: %.3f ms\n",
-           "Unaccounted:", parent_time > FLT_EPSILON ? ((parent_time - accumulated_time) / parent_time) * 100 : 0.f,
-           parent_time - accumulated_time);
-
-    for (int i = 0; i < numChildren; i++) {
-        profileIterator->Enter_Child(i);
-        dumpRecursive(profileIterator, spacing + 3);
-        profileIterator->Enter_Parent();
+    std::vector<ChProfileZoneStats> stats;
+    stats.reserve(merged.size());
+    for (int root : merged_roots)
+        CollectStats(merged, root, -1, 0, stats);
+
+    return stats;
+}
+
+void ChProfiler::PrintZoneStats(std::ostream& os) {
+    auto stats = GetZoneStats();
+
+    os << "Profile (" << std::fixed << std::setprecision(3) << GetTimeSinceReset() * 1e3 << " ms since reset)\n";
+    for (const auto& zone : stats) {
+        double parent_time = (zone.parent >= 0) ? stats[zone.parent].total_time : 0;
+        os << std::string(2 * zone.depth, ' ') << zone.name;
+        if (!zone.category.empty())
+            os << " [" << zone.category << "]";
+        os << "  calls: " << zone.calls << "  total: " << zone.total_time * 1e3 << " ms"
+           << "  self: " << zone.self_time * 1e3 << " ms";
+        if (parent_time > 0)
+            os << "  (" << std::setprecision(1) << 100 * zone.total_time / parent_time << "% of parent)"
+               << std::setprecision(3);
+        os << "\n";
     }
+    os << std::defaultfloat << std::flush;
 }
 
-void ChProfileManager::dumpAll() {
-    ChProfileIterator* profileIterator = 0;
-    profileIterator = ChProfileManager::Get_Iterator();
+bool ChProfiler::WriteChromeTrace(const std::string& filename) {
+    std::ofstream ofile(filename);
+    if (!ofile.is_open())
+        return false;
+
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    ofile << "{\"traceEvents\":[\n";
+    ofile << std::fixed << std::setprecision(3);
+
+    bool first = true;
+    for (const auto& profile : state.threads) {
+        // thread name (metadata event)
+        ofile << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << profile->index
+              << ",\"args\":{\"name\":\"thread " << profile->index << "\"}}";
+        first = false;
+
+        // complete events for all closed zones (timestamps in microseconds)
+        for (const auto& event : profile->events) {
+            if (event.end_ns < 0)
+                continue;
+            ofile << ",\n{\"name\":\"";
+            WriteEscaped(ofile, event.name);
+            ofile << "\",\"cat\":\"";
+            WriteEscaped(ofile, event.category);
+            ofile << "\",\"ph\":\"X\",\"ts\":" << event.start_ns * 1e-3 << ",\"dur\":"
+                  << (event.end_ns - event.start_ns) * 1e-3 << ",\"pid\":0,\"tid\":" << profile->index << "}";
+        }
+    }
 
-    dumpRecursive(profileIterator, 0);
+    ofile << "\n],\"displayTimeUnit\":\"ms\"}\n";
 
-    ChProfileManager::Release_Iterator(profileIterator);
+    return true;
 }
 
-#endif  // CH_NO_PROFILE
-
 }  // end namespace utils
 }  // end namespace chrono
@@ -9,14 +9,11 @@
 // http://projectchrono.org/license-chrono.txt.
 //
 // =============================================================================
-// Authors: Alessandro Tasora
+// Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
-// CODE MODIFIED FROM: profile.cpp
-// Real-Time Hierarchical Profiling for Game Programming Gems 3
-// by Greg Hjelstrom & Byon Garrabrant
 //
-// Credits: The Clock class was inspired by the Timer classes in  Ogre
-// (www.ogre3d.org).
+// Thread-aware hierarchical profiler based on scoped zones.
+//
 // =============================================================================
 
 #ifndef CHPROFILER_H
@@ -25,127 +22,116 @@
 // To disable built-in profiling, please comment out next line
 // #define CH_NO_PROFILE 1
 
-#ifndef CH_NO_PROFILE
+#include <iostream>
+#include <string>
+#include <vector>
 
-    #include <cstdio>
-    #include <new>
-    #include <cfloat>
-    #include <cfloat>
-    #include <ctime>
-    #include <ratio>
-    #include <chrono>
-    #include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChApiCE.h"
 
 namespace chrono {
 namespace utils {
 
-/// A node in the Profile Hierarchy Tree.
-class ChApi ChProfileNode {
-  public:
-    ChProfileNode(const char* name, ChProfileNode* parent);
-    ~ChProfileNode(void);
-
-    ChProfileNode* Get_Sub_Node(const char* name);
-
-    ChProfileNode* Get_Parent(void) { return Parent; }
-    ChProfileNode* Get_Sibling(void) { return Sibling; }
-    ChProfileNode* Get_Child(void) { return Child; }
-
-    void CleanupMemory();
-    void Reset(void);
-    void Call(void);
-    bool Return(void);
-
-    const char* Get_Name(void) { return Name; }
-    int Get_Total_Calls(void) { return TotalCalls; }
-    float Get_Total_Time(void) { return TotalTime; }
-
-  protected:
-    const char* Name;
-    int TotalCalls;
-    float TotalTime;
-    unsigned long int StartTime;
-    int RecursionCounter;
-
-    ChProfileNode* Parent;
-    ChProfileNode* Child;
-    ChProfileNode* Sibling;
+/// @addtogroup chrono_utils
+/// @{
+
+/// Aggregated timing information for one node in the hierarchy of profile zones.
+struct ChProfileZoneStats {
+    std::string name;      ///< zone name
+    std::string category;  ///< zone category (e.g., type of processed physics items)
+    int parent;            ///< index of the parent node (-1 for a top-level zone)
+    int depth;             ///< nesting level (0 for a top-level zone)
+    unsigned long calls;   ///< number of times the zone was entered (over all threads)
+    double total_time;     ///< time spent in the zone, summed over all threads [s]
+    double self_time;      ///< time spent in the zone, excluding nested zones [s]
 };
 
-/// An iterator to navigate through the tree.
-class ChApi ChProfileIterator {
+/// Thread-aware hierarchical profiler.
+/// Code regions are profiled by opening scoped zones (see ChProfileZone and the CH_PROFILE macros). Zones can be
+/// nested, and each zone can be assigned a category (for example, to break down the cost of a phase by type of physics
+/// item: bodies, links, contacts, FEA elements, loads). Each thread records its zones in its own buffer, so that zones
+/// can be opened from within parallel regions without any synchronization.
+///
+/// Profiling is disabled by default, in which case opening a zone has negligible cost. When enabled, the profiler:
+/// - accumulates call counts and times for each node in the zone hierarchy (see GetZoneStats and PrintZoneStats);
+/// - optionally records a timeline of all zones, which can be exported in the Chrome trace JSON format (see
+///   WriteChromeTrace) and visualized with chrome://tracing or https://ui.perfetto.dev.
+///
+/// Zone names and categories must be string literals (only the pointers are stored while recording).
+/// Query and reset functions must not be called while zones are open on other threads (for example, call them
+/// between simulation steps).
+class ChApi ChProfiler {
   public:
-    // Access all the children of the current parent
-    void First(void);
-    void Next(void);
-    bool Is_Done(void);
-    bool Is_Root(void) { return (CurrentParent->Get_Parent() == 0); }
-
-    void Enter_Child(int index);     // make the given child the new parent
-    void Enter_Largest_Child(void);  // make the largest child the new parent
-    void Enter_Parent(void);         // make the current parent's parent the new parent
-
-    // Access the current child
-    const char* Get_Current_Name(void) { return CurrentChild->Get_Name(); }
-    int Get_Current_Total_Calls(void) { return CurrentChild->Get_Total_Calls(); }
-    float Get_Current_Total_Time(void) { return CurrentChild->Get_Total_Time(); }
-
-    // Access the current parent
-    const char* Get_Current_Parent_Name(void) { return CurrentParent->Get_Name(); }
-    int Get_Current_Parent_Total_Calls(void) { return CurrentParent->Get_Total_Calls(); }
-    float Get_Current_Parent_Total_Time(void) { return CurrentParent->Get_Total_Time(); }
-
-  protected:
-    ChProfileNode* CurrentParent;
-    ChProfileNode* CurrentChild;
-
-    ChProfileIterator(ChProfileNode* start);
-    friend class ChProfileManager;
-};
+    /// Enable/disable profiling (default: false).
+    static void Enable(bool val);
 
-/// The Manager for the Profile system.
-class ChApi ChProfileManager {
-  public:
-    static void Start_Profile(const char* name);
-    static void Stop_Profile(void);
+    /// Return true if profiling is enabled.
+    static bool IsEnabled();
 
-    static void CleanupMemory(void) { Root.CleanupMemory(); }
+    /// Enable/disable recording of the zone timeline for trace output (default: false).
+    /// At most 'max_events' zones are recorded per thread; zones beyond this limit are only accumulated in the
+    /// aggregated statistics.
+    static void EnableTrace(bool val, size_t max_events = 1000000);
 
-    static void Reset(void);
-    static void Increment_Frame_Counter(void);
-    static int Get_Frame_Count_Since_Reset(void) { return FrameCounter; }
-    static float Get_Time_Since_Reset(void);
+    /// Clear all profiling information and restart the profiler clock.
+    static void Reset();
 
-    static ChProfileIterator* Get_Iterator(void) { return new ChProfileIterator(&Root); }
-    static void Release_Iterator(ChProfileIterator* iterator) { delete (iterator); }
+    /// Open a zone with given name and category on the calling thread.
+    /// Return false if profiling is disabled (in which case EndZone must not be called).
+    static bool BeginZone(const char* name, const char* category = "");
 
-    static void dumpRecursive(ChProfileIterator* profileIterator, int spacing);
+    /// Close the last zone opened on the calling thread.
+    static void EndZone();
 
-    static void dumpAll();
+    /// Return the time elapsed since the last reset [s].
+    static double GetTimeSinceReset();
 
-  private:
-    static ChProfileNode Root;
-    static ChProfileNode* CurrentNode;
-    static int FrameCounter;
-    static unsigned long int ResetTime;
+    /// Return the aggregated statistics for all zones, merged over all threads.
+    /// Nodes are returned in depth-first order, so that all children of a node follow their parent.
+    static std::vector<ChProfileZoneStats> GetZoneStats();
+
+    /// Print the aggregated zone statistics as an indented tree.
+    static void PrintZoneStats(std::ostream& os = std::cout);
+
+    /// Write the recorded zone timeline in the Chrome trace event (JSON) format.
+    /// Return false if the file cannot be opened.
+    static bool WriteChromeTrace(const std::string& filename);
 };
 
-/// Simple way to profile a function's scope.
-class ChApi ChProfileSample {
+/// Utility class for profiling a scope.
+/// A zone is opened at construction and closed at destruction.
+class ChProfileZone {
   public:
-    ChProfileSample(const char* name) { ChProfileManager::Start_Profile(name); }
+    ChProfileZone(const char* name, const char* category = "") : m_active(ChProfiler::BeginZone(name, category)) {}
+    ~ChProfileZone() {
+        if (m_active)
+            ChProfiler::EndZone();
+    }
 
-    ~ChProfileSample(void) { ChProfileManager::Stop_Profile(); }
+  private:
+    bool m_active;
 };
 
+/// @} chrono_utils
+
 }  // end namespace utils
 }  // end namespace chrono
 
-    #define CH_PROFILE(name) chrono::utils::ChProfileSample __ch_profile(name)
+#define CH_PROFILE_CONCAT_IMPL(a, b) a##b
+#define CH_PROFILE_CONCAT(a, b) CH_PROFILE_CONCAT_IMPL(a, b)
+
+#ifndef CH_NO_PROFILE
+
+    /// Profile the enclosing scope, using the given zone name.
+    #define CH_PROFILE(name) chrono::utils::ChProfileZone CH_PROFILE_CONCAT(__ch_profile_, __LINE__)(name)
+
+    /// Profile the enclosing scope, using the given zone name and category.
+    #define CH_PROFILE_CATEGORY(name, category) \
+        chrono::utils::ChProfileZone CH_PROFILE_CONCAT(__ch_profile_, __LINE__)(name, category)
 
 #else
 
     #define CH_PROFILE(name)
+    #define CH_PROFILE_CATEGORY(name, category)
 
 #endif  // #ifndef CH_NO_PROFILE
 
@@ -0,0 +1,73 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CH_UNION_FIND_H
+#define CH_UNION_FIND_H
+
+#include <numeric>
+#include <vector>
+
+namespace chrono {
+
+/// Disjoint-set forest (union-find) over the elements 0,1,...,n-1.
+/// Uses union by size and path halving, so that a sequence of operations runs in almost linear time. Used to partition
+/// a set of items (e.g., bodies or solver variables) into connected components.
+class ChUnionFind {
+  public:
+    ChUnionFind(unsigned int n = 0) { Reset(n); }
+
+    /// Reset to n singleton sets.
+    void Reset(unsigned int n) {
+        m_parent.resize(n);
+        std::iota(m_parent.begin(), m_parent.end(), 0u);
+        m_size.assign(n, 1);
+    }
+
+    /// Return the number of elements.
+    unsigned int GetNumElements() const { return (unsigned int)m_parent.size(); }
+
+    /// Return the representative element of the set containing element i.
+    unsigned int Find(unsigned int i) {
+        while (m_parent[i] != i) {
+            m_parent[i] = m_parent[m_parent[i]];
+            i = m_parent[i];
+        }
+        return i;
+    }
+
+    /// Merge the sets containing elements i and j.
+    /// Return false if the two elements were already in the same set.
+    bool Union(unsigned int i, unsigned int j) {
+        i = Find(i);
+        j = Find(j);
+        if (i == j)
+            return false;
+        if (m_size[i] < m_size[j])
+            std::swap(i, j);
+        m_parent[j] = i;
+        m_size[i] += m_size[j];
+        return true;
+    }
+
+    /// Return the number of elements in the set containing element i.
+    unsigned int GetSetSize(unsigned int i) { return m_size[Find(i)]; }
+
+  private:
+    std::vector<unsigned int> m_parent;
+    std::vector<unsigned int> m_size;
+};
+
+}  // end namespace chrono
+
+#endif
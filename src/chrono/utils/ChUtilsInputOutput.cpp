@@ -14,6 +14,9 @@
 //
 // =============================================================================
 
+#include <cstring>
+#include <vector>
+
 #include "chrono/assets/ChVisualShapeBox.h"
 #include "chrono/assets/ChVisualShapeCapsule.h"
 #include "chrono/assets/ChVisualShapeCone.h"
@@ -350,6 +353,150 @@ void ReadCheckpoint(ChSystem* system, const std::string& filename) {
     }
 }
 
+// -----------------------------------------------------------------------------
+// WriteCheckpointBinary / ReadCheckpointBinary
+//
+// Binary snapshot of the system state. The file contains a fixed-size header
+// followed by the raw arrays of generalized coordinates (x), velocities (v),
+// accelerations (a), and Lagrange multipliers (L), in native byte order.
+// The contact multipliers are stored at the end of L.
+// -----------------------------------------------------------------------------
+
+static const char checkpoint_magic[8] = {'C', 'H', 'S', 'T', 'A', 'T', 'E', '\0'};
+static const uint32_t checkpoint_version = 1;
+
+struct CheckpointHeader {
+    char magic[8];
+    uint32_t version;
+    int32_t contact_method;
+    double time;
+    uint64_t num_coords_pos;
+    uint64_t num_coords_vel;
+    uint64_t num_constr;
+    uint64_t num_constr_contacts;
+};
+
+bool WriteCheckpointBinary(ChSystem* system, const std::string& filename) {
+    // Make sure the state offsets are up to date
+    system->Setup();
+
+    CheckpointHeader header;
+    std::memcpy(header.magic, checkpoint_magic, sizeof(header.magic));
+    header.version = checkpoint_version;
+    header.contact_method = (system->GetContactMethod() == ChContactMethod::NSC) ? 0 : 1;
+    header.num_coords_pos = system->GetNumCoordsPosLevel();
+    header.num_coords_vel = system->GetNumCoordsVelLevel();
+    header.num_constr = system->GetNumConstraints();
+    header.num_constr_contacts = system->GetContactContainer()->GetNumConstraints();
+
+    ChState x(header.num_coords_pos, system);
+    ChStateDelta v(header.num_coords_vel, system);
+    ChStateDelta a(header.num_coords_vel, system);
+    ChVectorDynamic<> L(header.num_constr);
+    system->StateGather(x, v, header.time);
+    system->StateGatherAcceleration(a);
+    system->StateGatherReactions(L);
+
+    // Pack header and state arrays in a contiguous buffer and write it with a single call
+    size_t num_doubles = x.size() + v.size() + a.size() + L.size();
+    std::vector<char> buffer(sizeof(CheckpointHeader) + num_doubles * sizeof(double));
+    char* ptr = buffer.data();
+    std::memcpy(ptr, &header, sizeof(CheckpointHeader));
+    ptr += sizeof(CheckpointHeader);
+    auto pack = [&ptr](const ChVectorDynamic<>& vec) {
+        std::memcpy(ptr, vec.data(), vec.size() * sizeof(double));
+        ptr += vec.size() * sizeof(double);
+    };
+    pack(x);
+    pack(v);
+    pack(a);
+    pack(L);
+
+    std::ofstream ofile(filename, std::ios::binary);
+    if (!ofile.is_open()) {
+        std::cout << "utils::WriteCheckpointBinary ERROR: cannot open file " << filename << "\n";
+        return false;
+    }
+    ofile.write(buffer.data(), buffer.size());
+
+    return ofile.good();
+}
+
+bool ReadCheckpointBinary(ChSystem* system, const std::string& filename) {
+    // Read the entire file with a single call
+    std::ifstream ifile(filename, std::ios::binary | std::ios::ate);
+    if (!ifile.is_open()) {
+        std::cout << "utils::ReadCheckpointBinary ERROR: cannot open file " << filename << "\n";
+        return false;
+    }
+    std::vector<char> buffer((size_t)ifile.tellg());
+    ifile.seekg(0);
+    ifile.read(buffer.data(), buffer.size());
+
+    CheckpointHeader header;
+    if (!ifile || buffer.size() < sizeof(CheckpointHeader)) {
+        std::cout << "utils::ReadCheckpointBinary ERROR: cannot read file " << filename << "\n";
+        return false;
+    }
+    std::memcpy(&header, buffer.data(), sizeof(CheckpointHeader));
+
+    size_t num_doubles = header.num_coords_pos + 2 * header.num_coords_vel + header.num_constr;
+    if (std::memcmp(header.magic, checkpoint_magic, sizeof(header.magic)) != 0 ||
+        header.version != checkpoint_version ||
+        buffer.size() != sizeof(CheckpointHeader) + num_doubles * sizeof(double)) {
+        std::cout << "utils::ReadCheckpointBinary ERROR: " << filename << " is not a valid binary checkpoint\n";
+        return false;
+    }
+
+    // Initialize the system (if needed) and set up the state offsets
+    system->Update(false);
+    system->Setup();
+
+    // Check consistency with the current system
+    int ctype = (system->GetContactMethod() == ChContactMethod::NSC) ? 0 : 1;
+    if (header.contact_method != ctype || header.num_coords_pos != system->GetNumCoordsPosLevel() ||
+        header.num_coords_vel != system->GetNumCoordsVelLevel()) {
+        std::cout << "utils::ReadCheckpointBinary ERROR: checkpoint data file inconsistent with the Chrono system\n";
+        std::cout << "    Number of coordinates in data file: " << header.num_coords_pos << " / "
+                  << header.num_coords_vel << "\n";
+        std::cout << "    Number of coordinates in system:    " << system->GetNumCoordsPosLevel() << " / "
+                  << system->GetNumCoordsVelLevel() << "\n";
+        return false;
+    }
+
+    const double* data = reinterpret_cast<const double*>(buffer.data() + sizeof(CheckpointHeader));
+    ChState x(ChVectorDynamic<>::Map(data, header.num_coords_pos), system);
+    data += header.num_coords_pos;
+    ChStateDelta v(ChVectorDynamic<>::Map(data, header.num_coords_vel), system);
+    data += header.num_coords_vel;
+    ChStateDelta a(ChVectorDynamic<>::Map(data, header.num_coords_vel), system);
+    data += header.num_coords_vel;
+    auto L_data = ChVectorDynamic<>::Map(data, header.num_constr);
+
+    system->StateScatter(x, v, header.time, true);
+    system->StateScatterAcceleration(a);
+
+    // Regenerate the contacts at the restored configuration. Only the multipliers of the assembly constraints (stored
+    // first) are restored. The regenerated contacts are not necessarily the same, or in the same order, as those
+    // present when the checkpoint was written, so their multipliers are set to zero.
+    system->ComputeCollisions();
+    system->Setup();
+
+    size_t num_constr_assembly = header.num_constr - header.num_constr_contacts;
+    unsigned int num_constr = system->GetNumConstraints();
+    if (num_constr - system->GetContactContainer()->GetNumConstraints() == num_constr_assembly) {
+        ChVectorDynamic<> L(num_constr);
+        L.setZero();
+        L.head(num_constr_assembly) = L_data.head(num_constr_assembly);
+        system->StateScatterReactions(L);
+    } else {
+        std::cout << "utils::ReadCheckpointBinary WARNING: inconsistent number of constraints\n";
+        std::cout << "    Lagrange multipliers not restored\n";
+    }
+
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // Write CSV output file with current camera information
 // -----------------------------------------------------------------------------
@@ -25,6 +25,11 @@
 //      contact geometry.
 //    - only a subset of contact shapes are currently supported
 //
+// WriteCheckpointBinary and ReadCheckpointBinary
+//  these functions write and read, respectively, a binary snapshot of the
+//  system state (positions, velocities, accelerations, Lagrange multipliers)
+//  which can be restored on an identically constructed system.
+//
 // WriteVisualizationAssets
 //  this function writes a CSV file appropriate for processing with a POV-Ray
 //  script.
@@ -143,6 +148,19 @@ ChApi bool WriteCheckpoint(ChSystem* system, const std::string& filename);
 /// Read a CSV file with a checkpoint.
 ChApi void ReadCheckpoint(ChSystem* system, const std::string& filename);
 
+/// Write a binary checkpoint file with the current system state.
+/// The file contains the arrays of generalized coordinates, velocities, accelerations, and Lagrange multipliers (the
+/// latter used for warm starting), written in native byte order with a single call. Unlike WriteCheckpoint, no
+/// information about the system topology is saved.
+ChApi bool WriteCheckpointBinary(ChSystem* system, const std::string& filename);
+
+/// Read a binary checkpoint file and restore the system state.
+/// The checkpoint can only be restored on a system constructed identically to the one used to generate it (same
+/// items, added in the same order). Contacts are regenerated at the restored configuration; only the multipliers of
+/// the assembly constraints are restored, while the contact multipliers are set to zero. Returns false if the data
+/// file is inconsistent with the current system.
+ChApi bool ReadCheckpointBinary(ChSystem* system, const std::string& filename);
+
 /// Write CSV output file with camera information for off-line visualization.
 /// The output file includes three vectors, one per line, for camera position, camera target (look-at point), and camera
 /// up vector, respectively.
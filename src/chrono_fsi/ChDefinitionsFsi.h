@@ -25,6 +25,12 @@ namespace fsi {
 /// @addtogroup fsi_physics
 /// @{
 
+/// Computational backend for the SPH solver of ChSystemFsi
+enum class SPHBackend {
+    CUDA,  ///< GPU solver (default)
+    CPU    ///< multithreaded CPU solver (ChSystemFsiCPU); explicit SPH only, no FEA coupling
+};
+
 /// Approach to handle BCE particles
 enum class BceVersion { ADAMI = 0, ORIGINAL = 1 };
 
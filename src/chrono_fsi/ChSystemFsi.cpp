@@ -30,6 +30,7 @@
 #include "chrono/fea/ChNodeFEAxyzD.h"
 
 #include "chrono_fsi/ChSystemFsi.h"
+#include "chrono_fsi/ChSystemFsiCPU.h"
 #include "chrono_fsi/physics/ChParams.h"
 #include "chrono_fsi/physics/ChSystemFsi_impl.cuh"
 #include "chrono_fsi/physics/ChFsiInterface.h"
@@ -61,7 +62,8 @@ ChSystemFsi::ChSystemFsi(ChSystem* sysMBS)
       m_is_initialized(false),
       m_integrate_SPH(true),
       m_time(0),
-      m_write_mode(OutpuMode::NONE) {
+      m_write_mode(OutpuMode::NONE),
+      m_backend(SPHBackend::CUDA) {
     m_paramsH = chrono_types::make_shared<SimParams>();
     m_sysFSI = chrono_types::make_unique<ChSystemFsi_impl>(m_paramsH);
     InitParams();
@@ -506,6 +508,12 @@ void ChSystemFsi::SetVerbose(bool verbose) {
     m_fsi_interface->m_verbose = verbose;
 }
 
+void ChSystemFsi::SetBackend(SPHBackend backend) {
+    if (m_is_initialized)
+        throw std::runtime_error("ChSystemFsi: the SPH backend must be set before initialization.");
+    m_backend = backend;
+}
+
 void ChSystemFsi::SetSPHLinearSolver(SolverType lin_solver) {
     m_paramsH->LinearSolver = lin_solver;
 }
@@ -797,6 +805,13 @@ void ChSystemFsi::Initialize() {
         cout << "  cMax: " << m_paramsH->cMax.x << " " << m_paramsH->cMax.y << " " << m_paramsH->cMax.z << endl;
     }
 
+    // The CPU solver works directly with the host data
+    if (m_backend == SPHBackend::CPU) {
+        InitializeCPU();
+        m_is_initialized = true;
+        return;
+    }
+
     // Resize worker data
     m_fsi_interface->ResizeChronoCablesData(m_fea_cable_nodes);
     m_fsi_interface->ResizeChronoShellsData(m_fea_shell_nodes);
@@ -867,6 +882,123 @@ void ChSystemFsi::Initialize() {
     m_is_initialized = true;
 }
 
+void ChSystemFsi::InitializeCPU() {
+    if (m_fsi_interface->m_fsi_mesh)
+        throw std::runtime_error("ChSystemFsi: FEA meshes are not supported by the CPU backend.");
+    if (m_paramsH->fluid_dynamic_type != FluidDynamics::WCSPH)
+        throw std::runtime_error("ChSystemFsi: the CPU backend only supports explicit SPH (WCSPH).");
+
+    // Set the reference array and count the number of various objects.
+    // The CPU solver stores fluid particles first, followed by BCE markers in the order they were added, so markers
+    // must be grouped by type (fluid, boundary, rigid) for the output and visualization layouts to remain valid.
+    m_sysFSI->ConstructReferenceArray();
+    m_sysFSI->CalcNumObjects();
+    const auto& refArray = m_sysFSI->fsiGeneralData->referenceArray;
+    for (size_t i = 0; i < refArray.size(); i++) {
+        if (refArray[i].z < -1 || refArray[i].z > 1)
+            throw std::runtime_error("ChSystemFsi: helper, ghost, and flexible markers are not supported on the CPU.");
+        if (i > 0 && refArray[i].z < refArray[i - 1].z)
+            throw std::runtime_error("ChSystemFsi: SPH particles and BCE markers must be added grouped by type.");
+    }
+
+    m_sysCPU = chrono_types::make_unique<ChSystemFsiCPU>(m_sysMBS);
+    m_sysCPU->SetInitialSpacing(m_paramsH->INITSPACE);
+    m_sysCPU->SetKernelLength(m_paramsH->HSML);
+    m_sysCPU->SetNumBoundaryLayers(m_paramsH->NUM_BOUNDARY_LAYERS);
+    m_sysCPU->SetDensity(m_paramsH->rho0);
+    m_sysCPU->SetViscosity(m_paramsH->mu0);
+    m_sysCPU->SetSoundSpeed(m_paramsH->Cs);
+    m_sysCPU->SetArtificialViscosity(m_paramsH->Ar_vis_alpha);
+    m_sysCPU->SetXSPHCoefficient(m_paramsH->EPS_XSPH);
+    m_sysCPU->SetShiftingCoefficient(m_paramsH->beta_shifting);
+    m_sysCPU->SetGravitationalAcceleration(utils::ToChVector(m_paramsH->gravity));
+    m_sysCPU->SetBodyForce(utils::ToChVector(m_paramsH->bodyForce3));
+    m_sysCPU->SetStepSize(m_paramsH->dT, m_paramsH->dT_Flex);
+    if (m_paramsH->use_init_pressure)
+        m_sysCPU->SetInitPressure(m_paramsH->pressure_height);
+
+    if (m_paramsH->elastic_SPH) {
+        ChSystemFsiCPU::ElasticMaterialProperties mat_props;
+        mat_props.Young_modulus = m_paramsH->E_young;
+        mat_props.Poisson_ratio = m_paramsH->Nu_poisson;
+        mat_props.mu_I0 = m_paramsH->mu_I0;
+        mat_props.mu_fric_s = m_paramsH->mu_fric_s;
+        mat_props.mu_fric_2 = m_paramsH->mu_fric_2;
+        mat_props.average_diam = m_paramsH->ave_diam;
+        mat_props.cohesion_coeff = m_paramsH->Coh_coeff;
+        mat_props.kernel_threshold = m_paramsH->C_Wi;
+        m_sysCPU->SetElasticSPH(mat_props);
+    }
+
+    const auto& posRadH = m_sysFSI->sphMarkersH->posRadH;
+    const auto& velMasH = m_sysFSI->sphMarkersH->velMasH;
+    const auto& tauXxYyZzH = m_sysFSI->sphMarkersH->tauXxYyZzH;
+    const auto& tauXyXzYzH = m_sysFSI->sphMarkersH->tauXyXzYzH;
+
+    // Fluid (or granular) SPH particles
+    size_t num_fluid = m_num_objectsH->numFluidMarkers;
+    for (size_t i = 0; i < num_fluid; i++) {
+        m_sysCPU->AddSPHParticle(utils::ToChVector(posRadH[i]), utils::ToChVector(velMasH[i]),
+                                 utils::ToChVector(tauXxYyZzH[i]), utils::ToChVector(tauXyXzYzH[i]));
+    }
+
+    // Boundary BCE markers (expressed in the global frame) are attached to a fixed body at the origin
+    size_t start = num_fluid;
+    size_t num_bndry = m_num_objectsH->numBoundaryMarkers;
+    if (num_bndry > 0) {
+        m_cpu_ground = chrono_types::make_shared<ChBody>();
+        m_cpu_ground->SetFixed(true);
+        std::vector<ChVector3d> points(num_bndry);
+        for (size_t i = 0; i < num_bndry; i++)
+            points[i] = utils::ToChVector(posRadH[start + i]);
+        m_sysCPU->AddPointsBCE(m_cpu_ground, points, ChFrame<>());
+        start += num_bndry;
+    }
+
+    // Rigid BCE markers; as with the GPU solver, the i-th group of solid BCE markers belongs to the i-th FSI body
+    const auto& fsi_bodies = m_fsi_interface->m_fsi_bodies;
+    if (m_fsi_bodies_bce_num.size() > fsi_bodies.size())
+        throw std::runtime_error("ChSystemFsi: solid BCE markers were added for bodies not registered as FSI bodies.");
+    for (size_t ib = 0; ib < m_fsi_bodies_bce_num.size(); ib++) {
+        std::vector<ChVector3d> points(m_fsi_bodies_bce_num[ib]);
+        for (size_t i = 0; i < points.size(); i++)
+            points[i] = utils::ToChVector(posRadH[start + i]);
+        m_sysCPU->AddPointsBCE(fsi_bodies[ib], points, fsi_bodies[ib]->GetFrameRefToAbs().GetInverse());
+        start += points.size();
+    }
+
+    for (const auto& body : fsi_bodies)
+        m_sysCPU->AddFsiBody(body);
+
+    m_sysCPU->Initialize();
+}
+
+void ChSystemFsi::GetCPUParticleData(thrust::host_vector<Real4>& posRadH,
+                                     thrust::host_vector<Real3>& velMasH,
+                                     thrust::host_vector<Real4>& rhoPresMuH,
+                                     thrust::host_vector<Real4>& derivVelRhoH) const {
+    const auto& pos = m_sysCPU->GetParticlePositions();
+    const auto& vel = m_sysCPU->GetParticleVelocities();
+    const auto& acc = m_sysCPU->GetParticleAccelerations();
+    auto props = m_sysCPU->GetParticleFluidProperties();
+
+    size_t num_fluid = m_num_objectsH->numFluidMarkers;
+    size_t num_bndry = m_num_objectsH->numBoundaryMarkers;
+    size_t n = pos.size();
+
+    posRadH.resize(n);
+    velMasH.resize(n);
+    rhoPresMuH.resize(n);
+    derivVelRhoH.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        Real type = (i < num_fluid) ? -1 : ((i < num_fluid + num_bndry) ? 0 : 1);
+        posRadH[i] = utils::ToReal4(pos[i], m_paramsH->HSML);
+        velMasH[i] = utils::ToReal3(vel[i]);
+        rhoPresMuH[i] = mR4(utils::ToReal3(props[i]), type);
+        derivVelRhoH[i] = utils::ToReal4(acc[i], 0);
+    }
+}
+
 //--------------------------------------------------------------------------------------------------------------------------------
 
 void ChSystemFsi::CopyDeviceDataToHalfStep() {
@@ -893,7 +1025,10 @@ void ChSystemFsi::DoStepDynamics_FSI() {
     m_timer_step.reset();
     m_timer_step.start();
 
-    if (m_fluid_dynamics->GetIntegratorType() == TimeIntegrator::EXPLICITSPH) {
+    if (m_backend == SPHBackend::CPU) {
+        // The CPU solver also advances the associated MBS system
+        m_sysCPU->DoStepDynamics_FSI();
+    } else if (m_fluid_dynamics->GetIntegratorType() == TimeIntegrator::EXPLICITSPH) {
         // The following is used to execute the Explicit WCSPH
         CopyDeviceDataToHalfStep();
         thrust::copy(m_sysFSI->fsiGeneralData->derivVelRhoD.begin(), m_sysFSI->fsiGeneralData->derivVelRhoD.end(),
@@ -973,6 +1108,21 @@ void ChSystemFsi::DoStepDynamics_FSI() {
 //--------------------------------------------------------------------------------------------------------------------------------
 
 void ChSystemFsi::WriteParticleFile(const std::string& outfilename) const {
+    if (m_backend == SPHBackend::CPU) {
+        thrust::host_vector<Real4> posRadH;
+        thrust::host_vector<Real3> velMasH;
+        thrust::host_vector<Real4> rhoPresMuH;
+        thrust::host_vector<Real4> derivVelRhoH;
+        GetCPUParticleData(posRadH, velMasH, rhoPresMuH, derivVelRhoH);
+        if (m_write_mode == OutpuMode::CSV) {
+            utils::WriteCsvParticlesToFile(posRadH, velMasH, rhoPresMuH, m_sysFSI->fsiGeneralData->referenceArray,
+                                           outfilename);
+        } else if (m_write_mode == OutpuMode::CHPF) {
+            utils::WriteChPFParticlesToFile(posRadH, m_sysFSI->fsiGeneralData->referenceArray, outfilename);
+        }
+        return;
+    }
+
     if (m_write_mode == OutpuMode::CSV) {
         utils::WriteCsvParticlesToFile(m_sysFSI->sphMarkersD2->posRadD, m_sysFSI->sphMarkersD2->velMasD,
                                        m_sysFSI->sphMarkersD2->rhoPresMuD, m_sysFSI->fsiGeneralData->referenceArray,
@@ -984,6 +1134,19 @@ void ChSystemFsi::WriteParticleFile(const std::string& outfilename) const {
 }
 
 void ChSystemFsi::PrintParticleToFile(const std::string& dir) const {
+    if (m_backend == SPHBackend::CPU) {
+        thrust::host_vector<Real4> posRadH;
+        thrust::host_vector<Real3> velMasH;
+        thrust::host_vector<Real4> rhoPresMuH;
+        thrust::host_vector<Real4> derivVelRhoH;
+        GetCPUParticleData(posRadH, velMasH, rhoPresMuH, derivVelRhoH);
+        thrust::host_vector<Real4> sr_tau_I_mu_i(posRadH.size(), mR4(0));
+        utils::PrintParticleToFile(posRadH, velMasH, rhoPresMuH, sr_tau_I_mu_i, derivVelRhoH,
+                                   m_sysFSI->fsiGeneralData->referenceArray,
+                                   m_sysFSI->fsiGeneralData->referenceArray_FEA, dir, m_paramsH);
+        return;
+    }
+
     utils::PrintParticleToFile(m_sysFSI->sphMarkersD2->posRadD, m_sysFSI->sphMarkersD2->velMasD,
                                m_sysFSI->sphMarkersD2->rhoPresMuD, m_sysFSI->fsiGeneralData->sr_tau_I_mu_i,
                                m_sysFSI->fsiGeneralData->derivVelRhoD, m_sysFSI->fsiGeneralData->referenceArray,
@@ -991,6 +1154,26 @@ void ChSystemFsi::PrintParticleToFile(const std::string& dir) const {
 }
 
 void ChSystemFsi::PrintFsiInfoToFile(const std::string& dir, double time) const {
+    if (m_backend == SPHBackend::CPU) {
+        const auto& fsi_bodies = m_sysCPU->GetFsiBodies();
+        thrust::host_vector<Real3> posRigidH(fsi_bodies.size());
+        thrust::host_vector<Real4> velRigidH(fsi_bodies.size());
+        thrust::host_vector<Real4> qRigidH(fsi_bodies.size());
+        thrust::host_vector<Real3> forceRigidH(fsi_bodies.size());
+        thrust::host_vector<Real3> torqueRigidH(fsi_bodies.size());
+        for (size_t i = 0; i < fsi_bodies.size(); i++) {
+            posRigidH[i] = utils::ToReal3(fsi_bodies[i]->GetPos());
+            velRigidH[i] = utils::ToReal4(fsi_bodies[i]->GetPosDt(), fsi_bodies[i]->GetMass());
+            qRigidH[i] = utils::ToReal4(fsi_bodies[i]->GetRot());
+            forceRigidH[i] = utils::ToReal3(m_sysCPU->GetFsiBodyForce(i));
+            torqueRigidH[i] = utils::ToReal3(m_sysCPU->GetFsiBodyTorque(i));
+        }
+        thrust::host_vector<Real3> emptyH;
+        utils::PrintFsiInfoToFile(posRigidH, velRigidH, qRigidH, emptyH, emptyH, forceRigidH, torqueRigidH, emptyH,
+                                  dir, time);
+        return;
+    }
+
     utils::PrintFsiInfoToFile(m_sysFSI->fsiBodiesD2->posRigid_fsiBodies_D,
                               m_sysFSI->fsiBodiesD2->velMassRigid_fsiBodies_D, m_sysFSI->fsiBodiesD2->q_fsiBodies_D,
                               m_sysFSI->fsiMeshD->pos_fsi_fea_D, m_sysFSI->fsiMeshD->vel_fsi_fea_D,
@@ -2088,6 +2271,8 @@ double ChSystemFsi::GetBasePressure() const {
 }
 
 double ChSystemFsi::GetParticleMass() const {
+    if (m_sysCPU)
+        return m_sysCPU->GetParticleMass();
     return m_paramsH->markerMass;
 }
 
@@ -2148,6 +2333,9 @@ std::shared_ptr<fea::ChMesh> ChSystemFsi::GetFsiMesh() const {
 //--------------------------------------------------------------------------------------------------------------------------------
 
 std::vector<ChVector3d> ChSystemFsi::GetParticlePositions() const {
+    if (m_sysCPU)
+        return m_sysCPU->GetParticlePositions();
+
     thrust::host_vector<Real4> posRadH = m_sysFSI->sphMarkersD2->posRadD;
     std::vector<ChVector3d> pos;
     for (size_t i = 0; i < posRadH.size(); i++) {
@@ -2157,6 +2345,9 @@ std::vector<ChVector3d> ChSystemFsi::GetParticlePositions() const {
 }
 
 std::vector<ChVector3d> ChSystemFsi::GetParticleFluidProperties() const {
+    if (m_sysCPU)
+        return m_sysCPU->GetParticleFluidProperties();
+
     thrust::host_vector<Real4> rhoPresMuH = m_sysFSI->sphMarkersD2->rhoPresMuD;
     std::vector<ChVector3d> props;
     for (size_t i = 0; i < rhoPresMuH.size(); i++) {
@@ -2166,6 +2357,9 @@ std::vector<ChVector3d> ChSystemFsi::GetParticleFluidProperties() const {
 }
 
 std::vector<ChVector3d> ChSystemFsi::GetParticleVelocities() const {
+    if (m_sysCPU)
+        return m_sysCPU->GetParticleVelocities();
+
     thrust::host_vector<Real3> velH = m_sysFSI->sphMarkersD2->velMasD;
     std::vector<ChVector3d> vel;
     for (size_t i = 0; i < velH.size(); i++) {
@@ -2175,6 +2369,11 @@ std::vector<ChVector3d> ChSystemFsi::GetParticleVelocities() const {
 }
 
 std::vector<ChVector3d> ChSystemFsi::GetParticleAccelerations() const {
+    if (m_sysCPU) {
+        const auto& acc = m_sysCPU->GetParticleAccelerations();
+        return std::vector<ChVector3d>(acc.begin(), acc.begin() + m_sysCPU->GetNumFluidMarkers());
+    }
+
     thrust::host_vector<Real4> accH = m_sysFSI->GetParticleAccelerations();
     std::vector<ChVector3d> acc;
     for (size_t i = 0; i < accH.size(); i++) {
@@ -2184,6 +2383,13 @@ std::vector<ChVector3d> ChSystemFsi::GetParticleAccelerations() const {
 }
 
 std::vector<ChVector3d> ChSystemFsi::GetParticleForces() const {
+    if (m_sysCPU) {
+        std::vector<ChVector3d> frc = GetParticleAccelerations();
+        for (auto& f : frc)
+            f *= m_sysCPU->GetParticleMass();
+        return frc;
+    }
+
     thrust::host_vector<Real4> frcH = m_sysFSI->GetParticleForces();
     std::vector<ChVector3d> frc;
     for (size_t i = 0; i < frcH.size(); i++) {
@@ -2195,6 +2401,9 @@ std::vector<ChVector3d> ChSystemFsi::GetParticleForces() const {
 //--------------------------------------------------------------------------------------------------------------------------------
 
 thrust::device_vector<int> ChSystemFsi::FindParticlesInBox(const ChFrame<>& frame, const ChVector3d& size) {
+    if (m_backend == SPHBackend::CPU)
+        throw std::runtime_error("ChSystemFsi: FindParticlesInBox is not supported by the CPU backend.");
+
     const ChVector3d& Pos = frame.GetPos();
     ChVector3d Ax = frame.GetRotMat().GetAxisX();
     ChVector3d Ay = frame.GetRotMat().GetAxisY();
@@ -2210,18 +2419,26 @@ thrust::device_vector<int> ChSystemFsi::FindParticlesInBox(const ChFrame<>& fram
 }
 
 thrust::device_vector<Real4> ChSystemFsi::GetParticlePositions(const thrust::device_vector<int>& indices) {
+    if (m_backend == SPHBackend::CPU)
+        throw std::runtime_error("ChSystemFsi: GetParticlePositions is not supported by the CPU backend.");
     return m_sysFSI->GetParticlePositions(indices);
 }
 
 thrust::device_vector<Real3> ChSystemFsi::GetParticleVelocities(const thrust::device_vector<int>& indices) {
+    if (m_backend == SPHBackend::CPU)
+        throw std::runtime_error("ChSystemFsi: GetParticleVelocities is not supported by the CPU backend.");
     return m_sysFSI->GetParticleVelocities(indices);
 }
 
 thrust::device_vector<Real4> ChSystemFsi::GetParticleForces(const thrust::device_vector<int>& indices) {
+    if (m_backend == SPHBackend::CPU)
+        throw std::runtime_error("ChSystemFsi: GetParticleForces is not supported by the CPU backend.");
     return m_sysFSI->GetParticleForces(indices);
 }
 
 thrust::device_vector<Real4> ChSystemFsi::GetParticleAccelerations(const thrust::device_vector<int>& indices) {
+    if (m_backend == SPHBackend::CPU)
+        throw std::runtime_error("ChSystemFsi: GetParticleAccelerations is not supported by the CPU backend.");
     return m_sysFSI->GetParticleAccelerations(indices);
 }
 
@@ -43,6 +43,7 @@ class ChElementShellANCF_3423;
 namespace fsi {
 
 class ChSystemFsi_impl;
+class ChSystemFsiCPU;
 class ChFsiInterface;
 class ChFluidDynamics;
 class ChBce;
@@ -57,6 +58,8 @@ struct ChCounters;
 /// This class is used to represent fluid-solid interaction problems consisting of fluid dynamics and multibody system.
 /// Each of the two underlying physics is an independent object owned and instantiated by this class. The FSI system
 /// owns other objects to handle the interface between the two systems, boundary condition enforcing markers, and data.
+/// The SPH solver runs on the GPU by default; the multithreaded CPU solver (ChSystemFsiCPU) can be selected instead
+/// with SetBackend, in which case the same problem setup (including CRMTerrain) is used unchanged.
 class CH_FSI_API ChSystemFsi {
   public:
     /// Output mode.
@@ -106,6 +109,15 @@ class CH_FSI_API ChSystemFsi {
     /// Enable/disable verbose terminal output.
     void SetVerbose(bool verbose);
 
+    /// Set the computational backend for the SPH solver (default: SPHBackend::CUDA).
+    /// Must be called before Initialize. The CPU backend supports explicit (WCSPH) fluid and elastic SPH (CRM)
+    /// problems with fixed boundaries and rigid FSI bodies; it does not support FEA meshes, fluid helper markers, the
+    /// active domain, or the functions operating on device vectors of particle indices.
+    void SetBackend(SPHBackend backend);
+
+    /// Get the computational backend for the SPH solver.
+    SPHBackend GetBackend() const { return m_backend; }
+
     /// Read Chrono::FSI parameters from the specified JSON file.
     void ReadParametersFromFile(const std::string& json_file);
 
@@ -528,6 +540,16 @@ class CH_FSI_API ChSystemFsi {
     /// Function to initialize the midpoint device data of the fluid system by copying from the full step.
     void CopyDeviceDataToHalfStep();
 
+    /// Complete construction of the FSI system when using the CPU backend.
+    /// Transfers the SPH particles and BCE markers to the CPU solver; no device data is allocated.
+    void InitializeCPU();
+
+    /// Collect the particle data from the CPU solver into host vectors, in the same layout as the device data.
+    void GetCPUParticleData(thrust::host_vector<Real4>& posRadH,
+                            thrust::host_vector<Real3>& velMasH,
+                            thrust::host_vector<Real4>& rhoPresMuH,
+                            thrust::host_vector<Real4>& derivVelRhoH) const;
+
     ChSystem* m_sysMBS;  ///< multibody system
 
     std::shared_ptr<SimParams> m_paramsH;  ///< pointer to the simulation parameters
@@ -537,6 +559,9 @@ class CH_FSI_API ChSystemFsi {
     std::string m_outdir;    ///< output directory
     OutpuMode m_write_mode;  ///< FSI particle output type (CSV, ChPF, or NONE)
 
+    SPHBackend m_backend;                               ///< computational backend for the SPH solver
+    std::unique_ptr<ChSystemFsiCPU> m_sysCPU;           ///< CPU SPH solver (SPHBackend::CPU only)
+    std::shared_ptr<ChBody> m_cpu_ground;               ///< fixed body carrying boundary BCE markers (CPU only)
     std::unique_ptr<ChSystemFsi_impl> m_sysFSI;         ///< underlying system implementation
     std::unique_ptr<ChFluidDynamics> m_fluid_dynamics;  ///< fluid system
     std::unique_ptr<ChFsiInterface> m_fsi_interface;    ///< FSI interface system
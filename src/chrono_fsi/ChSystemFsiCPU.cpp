@@ -0,0 +1,863 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Author: Radu Serban
+// =============================================================================
+//
+// Multithreaded CPU implementation of the explicit (WCSPH) FSI solver.
+//
+// The discretization follows the CUDA WCSPH solver (ChFsiForceExplicitSPH and
+// ChBce): cubic spline kernel with support 2h, linear equation of state,
+// Morris laminar viscosity plus Monaghan artificial viscosity, XSPH position
+// correction, and Adami extrapolation of velocity and pressure on BCE markers.
+// The elastic SPH model for granular material follows NS_SSR (stress rate and
+// momentum equations, particle shifting, free surface detection) and the mu(I)
+// return mapping of UpdateFluidD.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "chrono/core/ChTypes.h"
+#include "chrono/utils/ChUtilsSamplers.h"
+
+#include "chrono_fsi/ChSystemFsiCPU.h"
+
+namespace chrono {
+namespace fsi {
+
+ChSystemFsiCPU::ChSystemFsiCPU(ChSystem* sysMBS)
+    : m_sysMBS(sysMBS),
+      m_num_threads(0),
+      m_spacing(0.01),
+      m_h(0.01),
+      m_num_bce_layers(3),
+      m_rho0(1000),
+      m_mu0(0.001),
+      m_Cs(10),
+      m_alpha(0.02),
+      m_eps_xsph(0.5),
+      m_eps_dist(0.01),
+      m_gravity(VNULL),
+      m_body_force(VNULL),
+      m_use_init_pressure(false),
+      m_pressure_height(0),
+      m_dT(1e-4),
+      m_dT_MBS(0),
+      m_time(0),
+      m_is_initialized(false),
+      m_elastic(false),
+      m_G_shear(0),
+      m_K_bulk(0),
+      m_mu_I0(0),
+      m_mu_fric_s(0),
+      m_mu_fric_2(0),
+      m_ave_diam(0),
+      m_cohesion(0),
+      m_kernel_threshold(0),
+      m_beta_shifting(1),
+      m_num_fluid(0) {}
+
+ChSystemFsiCPU::ElasticMaterialProperties::ElasticMaterialProperties()
+    : Young_modulus(1e6),
+      Poisson_ratio(0.3),
+      mu_I0(0.03),
+      mu_fric_s(0.7),
+      mu_fric_2(0.7),
+      average_diam(0.005),
+      cohesion_coeff(0),
+      kernel_threshold(0.8) {}
+
+ChSystemFsiCPU::~ChSystemFsiCPU() {}
+
+void ChSystemFsiCPU::AttachSystem(ChSystem* sysMBS) {
+    m_sysMBS = sysMBS;
+}
+
+void ChSystemFsiCPU::SetNumThreads(int num_threads) {
+    m_num_threads = num_threads;
+}
+
+void ChSystemFsiCPU::SetInitialSpacing(double spacing) {
+    m_spacing = spacing;
+}
+
+void ChSystemFsiCPU::SetKernelLength(double length) {
+    m_h = length;
+}
+
+void ChSystemFsiCPU::SetNumBoundaryLayers(int num_layers) {
+    m_num_bce_layers = num_layers;
+}
+
+void ChSystemFsiCPU::SetDensity(double rho0) {
+    m_rho0 = rho0;
+}
+
+void ChSystemFsiCPU::SetViscosity(double mu0) {
+    m_mu0 = mu0;
+}
+
+void ChSystemFsiCPU::SetSoundSpeed(double Cs) {
+    m_Cs = Cs;
+}
+
+void ChSystemFsiCPU::SetArtificialViscosity(double alpha) {
+    m_alpha = alpha;
+}
+
+void ChSystemFsiCPU::SetXSPHCoefficient(double eps) {
+    m_eps_xsph = eps;
+}
+
+void ChSystemFsiCPU::SetShiftingCoefficient(double beta) {
+    m_beta_shifting = beta;
+}
+
+void ChSystemFsiCPU::SetElasticSPH(const ElasticMaterialProperties& mat_props) {
+    m_elastic = true;
+    m_G_shear = mat_props.Young_modulus / (2 * (1 + mat_props.Poisson_ratio));
+    m_K_bulk = mat_props.Young_modulus / (3 * (1 - 2 * mat_props.Poisson_ratio));
+    m_mu_I0 = mat_props.mu_I0;
+    m_mu_fric_s = mat_props.mu_fric_s;
+    m_mu_fric_2 = mat_props.mu_fric_2;
+    m_ave_diam = mat_props.average_diam;
+    m_cohesion = mat_props.cohesion_coeff;
+    m_kernel_threshold = mat_props.kernel_threshold;
+}
+
+void ChSystemFsiCPU::SetInitPressure(double height) {
+    m_pressure_height = height;
+    m_use_init_pressure = true;
+}
+
+void ChSystemFsiCPU::SetGravitationalAcceleration(const ChVector3d& gravity) {
+    m_gravity = gravity;
+}
+
+void ChSystemFsiCPU::SetBodyForce(const ChVector3d& force) {
+    m_body_force = force;
+}
+
+void ChSystemFsiCPU::SetStepSize(double dT, double dT_MBS) {
+    m_dT = dT;
+    m_dT_MBS = dT_MBS;
+}
+
+double ChSystemFsiCPU::GetParticleMass() const {
+    return m_rho0 * m_spacing * m_spacing * m_spacing;
+}
+
+std::vector<ChVector3d> ChSystemFsiCPU::GetParticleFluidProperties() const {
+    std::vector<ChVector3d> props(m_pos.size());
+    for (size_t i = 0; i < m_pos.size(); i++)
+        props[i] = ChVector3d(m_rho[i], m_pres[i], m_mu0);
+    return props;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSystemFsiCPU::AddSPHParticle(const ChVector3d& point, const ChVector3d& velocity) {
+    AddSPHParticle(point, velocity, VNULL, VNULL);
+}
+
+void ChSystemFsiCPU::AddSPHParticle(const ChVector3d& point,
+                                    const ChVector3d& velocity,
+                                    const ChVector3d& tauXxYyZz,
+                                    const ChVector3d& tauXyXzYz) {
+    if (m_is_initialized)
+        throw std::runtime_error("ChSystemFsiCPU: cannot add SPH markers after initialization.");
+
+    // BCE markers are appended after all fluid markers at initialization
+    m_pos.push_back(point);
+    m_vel.push_back(velocity);
+    m_tau_diag.push_back(tauXxYyZz);
+    m_tau_offdiag.push_back(tauXyXzYz);
+    m_num_fluid++;
+}
+
+void ChSystemFsiCPU::AddBoxSPH(const ChVector3d& boxCenter, const ChVector3d& boxHalfDim) {
+    utils::ChGridSampler<> sampler(m_spacing);
+    std::vector<ChVector3d> points = sampler.SampleBox(boxCenter, boxHalfDim);
+    for (const auto& p : points)
+        AddSPHParticle(p);
+}
+
+void ChSystemFsiCPU::AddFsiBody(std::shared_ptr<ChBody> body) {
+    m_fsi_bodies.push_back(body);
+}
+
+size_t ChSystemFsiCPU::AddPointsBCE(std::shared_ptr<ChBody> body,
+                                    const std::vector<ChVector3d>& points,
+                                    const ChFrame<>& frame) {
+    if (m_is_initialized)
+        throw std::runtime_error("ChSystemFsiCPU: cannot add BCE markers after initialization.");
+
+    auto it = std::find(m_bce_bodies.begin(), m_bce_bodies.end(), body);
+    int ib = (int)(it - m_bce_bodies.begin());
+    if (it == m_bce_bodies.end())
+        m_bce_bodies.push_back(body);
+
+    for (const auto& p : points) {
+        auto pos_body = frame.TransformPointLocalToParent(p);
+        m_bce_local.push_back(pos_body);
+        m_bce_body.push_back(ib);
+    }
+
+    return points.size();
+}
+
+size_t ChSystemFsiCPU::AddWallBCE(std::shared_ptr<ChBody> body, const ChFrame<>& frame, const ChVector2d& size) {
+    // Calculate actual spacing in x-y directions
+    ChVector2d hsize = size / 2;
+    int npx = (int)std::round(hsize.x() / m_spacing);
+    int npy = (int)std::round(hsize.y() / m_spacing);
+    double dx = hsize.x() / npx;
+    double dy = hsize.y() / npy;
+
+    std::vector<ChVector3d> bce;
+    for (int il = 0; il < m_num_bce_layers; il++) {
+        for (int ix = -npx; ix <= npx; ix++) {
+            for (int iy = -npy; iy <= npy; iy++) {
+                bce.push_back(ChVector3d(ix * dx, iy * dy, -il * m_spacing));
+            }
+        }
+    }
+
+    return AddPointsBCE(body, bce, frame);
+}
+
+size_t ChSystemFsiCPU::AddBoxContainerBCE(std::shared_ptr<ChBody> body,
+                                          const ChFrame<>& frame,
+                                          const ChVector3d& size,
+                                          const ChVector3i& faces) {
+    double buffer = 2 * m_num_bce_layers * m_spacing;
+
+    ChVector3d hsize = size / 2;
+
+    // Wall center positions
+    ChVector3d xn(-hsize.x() - m_spacing, 0, 0);
+    ChVector3d xp(+hsize.x() + m_spacing, 0, 0);
+    ChVector3d yn(0, -hsize.y() - m_spacing, 0);
+    ChVector3d yp(0, +hsize.y() + m_spacing, 0);
+    ChVector3d zn(0, 0, -hsize.z() - m_spacing);
+    ChVector3d zp(0, 0, +hsize.z() + m_spacing);
+
+    size_t num = 0;
+
+    // Z- wall
+    if (faces.z() == -1 || faces.z() == 2)
+        num += AddWallBCE(body, frame * ChFrame<>(zn, QUNIT), {size.x(), size.y()});
+    // Z+ wall
+    if (faces.z() == +1 || faces.z() == 2)
+        num += AddWallBCE(body, frame * ChFrame<>(zp, QuatFromAngleX(CH_PI)), {size.x(), size.y()});
+
+    // X- wall
+    if (faces.x() == -1 || faces.x() == 2)
+        num += AddWallBCE(body, frame * ChFrame<>(xn, QuatFromAngleY(+CH_PI_2)), {size.z() + buffer, size.y()});
+    // X+ wall
+    if (faces.x() == +1 || faces.x() == 2)
+        num += AddWallBCE(body, frame * ChFrame<>(xp, QuatFromAngleY(-CH_PI_2)), {size.z() + buffer, size.y()});
+
+    // Y- wall
+    if (faces.y() == -1 || faces.y() == 2)
+        num += AddWallBCE(body, frame * ChFrame<>(yn, QuatFromAngleX(-CH_PI_2)),
+                          {size.x() + buffer, size.z() + buffer});
+    // Y+ wall
+    if (faces.y() == +1 || faces.y() == 2)
+        num += AddWallBCE(body, frame * ChFrame<>(yp, QuatFromAngleX(+CH_PI_2)),
+                          {size.x() + buffer, size.z() + buffer});
+
+    return num;
+}
+
+size_t ChSystemFsiCPU::AddBoxBCE(std::shared_ptr<ChBody> body,
+                                 const ChFrame<>& frame,
+                                 const ChVector3d& size,
+                                 bool solid) {
+    // Calculate actual spacing in all 3 directions
+    ChVector3d hsize = size / 2;
+    ChVector3i np((int)std::round(hsize.x() / m_spacing), (int)std::round(hsize.y() / m_spacing),
+                  (int)std::round(hsize.z() / m_spacing));
+    ChVector3d delta(hsize.x() / np.x(), hsize.y() / np.y(), hsize.z() / np.z());
+
+    // Inflate box if boundary
+    if (!solid) {
+        np += ChVector3i(m_num_bce_layers - 1);
+        hsize += delta * (m_num_bce_layers - 1);
+    }
+
+    int nl = m_num_bce_layers;
+    std::vector<ChVector3d> bce;
+    for (int il = 0; il < nl; il++) {
+        // faces in Z direction
+        for (int ix = -np.x(); ix <= np.x(); ix++) {
+            for (int iy = -np.y(); iy <= np.y(); iy++) {
+                bce.push_back(ChVector3d(ix * delta.x(), iy * delta.y(), -hsize.z() + il * delta.z()));
+                bce.push_back(ChVector3d(ix * delta.x(), iy * delta.y(), +hsize.z() - il * delta.z()));
+            }
+        }
+
+        // faces in Y direction
+        for (int ix = -np.x(); ix <= np.x(); ix++) {
+            for (int iz = -np.z() + nl; iz <= np.z() - nl; iz++) {
+                bce.push_back(ChVector3d(ix * delta.x(), -hsize.y() + il * delta.y(), iz * delta.z()));
+                bce.push_back(ChVector3d(ix * delta.x(), +hsize.y() - il * delta.y(), iz * delta.z()));
+            }
+        }
+
+        // faces in X direction
+        for (int iy = -np.y() + nl; iy <= np.y() - nl; iy++) {
+            for (int iz = -np.z() + nl; iz <= np.z() - nl; iz++) {
+                bce.push_back(ChVector3d(-hsize.x() + il * delta.x(), iy * delta.y(), iz * delta.z()));
+                bce.push_back(ChVector3d(+hsize.x() - il * delta.x(), iy * delta.y(), iz * delta.z()));
+            }
+        }
+    }
+
+    return AddPointsBCE(body, bce, frame);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSystemFsiCPU::Initialize() {
+    if (m_num_threads <= 0)
+        m_num_threads = m_sysMBS ? (int)m_sysMBS->GetNumThreadsChrono() : 1;
+
+    size_t n = m_num_fluid + m_bce_local.size();
+
+    m_pos.resize(n);
+    m_vel.resize(n);
+    m_tau_diag.resize(n, VNULL);
+    m_tau_offdiag.resize(n, VNULL);
+    m_rho.assign(n, m_rho0);
+    m_pres.assign(n, Eos(m_rho0));
+
+    if (m_elastic) {
+        // The speed of sound is set by the bulk modulus and the density is constant
+        m_Cs = std::sqrt(m_K_bulk / m_rho0);
+        for (size_t i = 0; i < m_num_fluid; i++) {
+            if (m_use_init_pressure) {
+                double p = m_rho0 * m_gravity.z() * (m_pos[i].z() - m_pressure_height);
+                m_tau_diag[i] = ChVector3d(-p);
+            }
+            m_pres[i] = -(m_tau_diag[i].x() + m_tau_diag[i].y() + m_tau_diag[i].z()) / 3;
+        }
+    } else if (m_use_init_pressure) {
+        for (size_t i = 0; i < m_num_fluid; i++) {
+            m_pres[i] = m_rho0 * m_gravity.z() * (m_pos[i].z() - m_pressure_height);
+            m_rho[i] = m_rho0 + m_pres[i] / (m_Cs * m_Cs);
+        }
+    }
+    m_acc.assign(n, VNULL);
+    m_drho.assign(n, 0.0);
+    m_vel_xsph.assign(n, VNULL);
+    m_bce_acc.assign(n - m_num_fluid, VNULL);
+    m_dtau_diag.assign(m_num_fluid, VNULL);
+    m_dtau_offdiag.assign(m_num_fluid, VNULL);
+    m_free_surface.assign(m_num_fluid, 0);
+
+    m_bce_fsi_index.assign(m_bce_bodies.size(), -1);
+    for (size_t ib = 0; ib < m_fsi_bodies.size(); ib++) {
+        auto it = std::find(m_bce_bodies.begin(), m_bce_bodies.end(), m_fsi_bodies[ib]);
+        if (it != m_bce_bodies.end())
+            m_bce_fsi_index[it - m_bce_bodies.begin()] = (int)ib;
+    }
+    m_fsi_forces.assign(m_fsi_bodies.size(), VNULL);
+    m_fsi_torques.assign(m_fsi_bodies.size(), VNULL);
+
+    // Set BCE marker positions and velocities from the current body states
+    UpdateBCEKinematics();
+    m_vel_mod = m_vel;
+
+    m_is_initialized = true;
+}
+
+// -----------------------------------------------------------------------------
+
+// Cubic spline kernel (support 2h)
+double ChSystemFsiCPU::W(double d) const {
+    double q = d / m_h;
+    double c = 0.25 / (CH_PI * m_h * m_h * m_h);
+    if (q < 1)
+        return c * (std::pow(2 - q, 3) - 4 * std::pow(1 - q, 3));
+    if (q < 2)
+        return c * std::pow(2 - q, 3);
+    return 0;
+}
+
+// Gradient of the cubic spline kernel with respect to the first marker, for r = xA - xB and d = |r|
+ChVector3d ChSystemFsiCPU::GradW(const ChVector3d& r, double d) const {
+    double q = d / m_h;
+    double c = 0.75 / (CH_PI * std::pow(m_h, 5));
+    if (q < 1)
+        return r * (c * (3 * q - 4));
+    if (q < 2)
+        return r * (c * (-q + 4 - 4 / q));
+    return VNULL;
+}
+
+void ChSystemFsiCPU::FindNeighbors() {
+    int n = (int)m_pos.size();
+    double cell_size = 2 * m_h;
+    double rad2 = cell_size * cell_size;
+
+    // Grid covering the bounding box of all markers
+    ChVector3d pmin = m_pos[0];
+    ChVector3d pmax = m_pos[0];
+    for (int i = 1; i < n; i++) {
+        pmin = Vmin(pmin, m_pos[i]);
+        pmax = Vmax(pmax, m_pos[i]);
+    }
+    ChVector3i dim((int)((pmax.x() - pmin.x()) / cell_size) + 1, (int)((pmax.y() - pmin.y()) / cell_size) + 1,
+                   (int)((pmax.z() - pmin.z()) / cell_size) + 1);
+    size_t num_cells = (size_t)dim.x() * dim.y() * dim.z();
+    if (num_cells > 64 * (size_t)n + 1000000)
+        throw std::runtime_error("ChSystemFsiCPU: marker bounding box too large for cell-list neighbor search.");
+
+    auto cell_coords = [&](const ChVector3d& p) {
+        return ChVector3i(std::min((int)((p.x() - pmin.x()) / cell_size), dim.x() - 1),
+                          std::min((int)((p.y() - pmin.y()) / cell_size), dim.y() - 1),
+                          std::min((int)((p.z() - pmin.z()) / cell_size), dim.z() - 1));
+    };
+    auto cell_index = [&](const ChVector3i& c) { return ((size_t)c.z() * dim.y() + c.y()) * dim.x() + c.x(); };
+
+    // Counting sort of the markers by cell
+    std::vector<size_t> marker_cell(n);
+    m_cell_start.assign(num_cells + 1, 0);
+    for (int i = 0; i < n; i++) {
+        marker_cell[i] = cell_index(cell_coords(m_pos[i]));
+        m_cell_start[marker_cell[i] + 1]++;
+    }
+    for (size_t c = 0; c < num_cells; c++)
+        m_cell_start[c + 1] += m_cell_start[c];
+    m_cell_markers.resize(n);
+    {
+        std::vector<int> offset(m_cell_start.begin(), m_cell_start.end() - 1);
+        for (int i = 0; i < n; i++)
+            m_cell_markers[offset[marker_cell[i]]++] = i;
+    }
+
+    // Visit all markers within the kernel support of marker i, in the 27 surrounding cells
+    auto visit = [&](int i, auto&& func) {
+        ChVector3i c = cell_coords(m_pos[i]);
+        for (int z = std::max(c.z() - 1, 0); z <= std::min(c.z() + 1, dim.z() - 1); z++) {
+            for (int y = std::max(c.y() - 1, 0); y <= std::min(c.y() + 1, dim.y() - 1); y++) {
+                for (int x = std::max(c.x() - 1, 0); x <= std::min(c.x() + 1, dim.x() - 1); x++) {
+                    size_t cell = cell_index(ChVector3i(x, y, z));
+                    for (int k = m_cell_start[cell]; k < m_cell_start[cell + 1]; k++) {
+                        int j = m_cell_markers[k];
+                        if (j != i && (m_pos[i] - m_pos[j]).Length2() < rad2)
+                            func(j);
+                    }
+                }
+            }
+        }
+    };
+
+    // Build the CSR neighbor lists (count, scan, fill)
+    m_nbr_start.assign(n + 1, 0);
+
+#pragma omp parallel for num_threads(m_num_threads)
+    for (int i = 0; i < n; i++) {
+        int count = 0;
+        visit(i, [&](int) { count++; });
+        m_nbr_start[i + 1] = count;
+    }
+
+    for (int i = 0; i < n; i++)
+        m_nbr_start[i + 1] += m_nbr_start[i];
+    m_nbr_list.resize(m_nbr_start[n]);
+
+#pragma omp parallel for num_threads(m_num_threads)
+    for (int i = 0; i < n; i++) {
+        int k = m_nbr_start[i];
+        visit(i, [&](int j) { m_nbr_list[k++] = j; });
+    }
+}
+
+void ChSystemFsiCPU::UpdateBCEKinematics() {
+    int nf = (int)m_num_fluid;
+    int nb = (int)(m_pos.size() - m_num_fluid);
+
+#pragma omp parallel for num_threads(m_num_threads)
+    for (int k = 0; k < nb; k++) {
+        const auto& frame = m_bce_bodies[m_bce_body[k]]->GetFrameRefToAbs();
+        m_pos[nf + k] = frame.TransformPointLocalToParent(m_bce_local[k]);
+        m_vel[nf + k] = frame.PointSpeedLocalToParent(m_bce_local[k]);
+        m_bce_acc[k] = frame.PointAccelerationLocalToParent(m_bce_local[k]);
+    }
+}
+
+void ChSystemFsiCPU::UpdateBCEState() {
+    int nf = (int)m_num_fluid;
+    int n = (int)m_pos.size();
+
+    // Fluid markers use their own velocities
+#pragma omp parallel for num_threads(m_num_threads)
+    for (int i = 0; i < nf; i++)
+        m_vel_mod[i] = m_vel[i];
+
+    // Adami extrapolation from the neighboring fluid markers
+#pragma omp parallel for num_threads(m_num_threads)
+    for (int i = nf; i < n; i++) {
+        double sumW = 0;
+        double sumPW = 0;
+        ChVector3d sumVW(0);
+        ChVector3d sumRhoRW(0);
+        ChVector3d sumTauDiagW(0);
+        ChVector3d sumTauOffdiagW(0);
+        for (int k = m_nbr_start[i]; k < m_nbr_start[i + 1]; k++) {
+            int j = m_nbr_list[k];
+            if (j >= nf)
+                continue;
+            ChVector3d r = m_pos[i] - m_pos[j];
+            double w = W(r.Length());
+            sumW += w;
+            sumPW += m_pres[j] * w;
+            sumVW += m_vel[j] * w;
+            sumRhoRW += r * (m_rho[j] * w);
+            sumTauDiagW += m_tau_diag[j] * w;
+            sumTauOffdiagW += m_tau_offdiag[j] * w;
+        }
+
+        if (sumW > 1e-12 * W(0)) {
+            double hydro = Vdot(m_gravity + m_body_force - m_bce_acc[i - nf], sumRhoRW);
+            m_vel_mod[i] = 2.0 * m_vel[i] - sumVW / sumW;
+            m_pres[i] = (sumPW + hydro) / sumW;
+            m_rho[i] = m_elastic ? m_rho0 : m_pres[i] / (m_Cs * m_Cs) + m_rho0;
+            // The normal stresses are compressive, hence the hydrostatic correction is subtracted
+            m_tau_diag[i] = (sumTauDiagW - ChVector3d(hydro)) / sumW;
+            m_tau_offdiag[i] = sumTauOffdiagW / sumW;
+        } else {
+            m_vel_mod[i] = VNULL;
+            m_pres[i] = Eos(m_rho0);
+            m_rho[i] = m_rho0;
+            m_tau_diag[i] = VNULL;
+            m_tau_offdiag[i] = VNULL;
+        }
+    }
+}
+
+void ChSystemFsiCPU::ComputeDerivatives() {
+    int nf = (int)m_num_fluid;
+    int n = (int)m_pos.size();
+    double m = GetParticleMass();
+    double eps_h2 = m_eps_dist * m_h * m_h;
+
+#pragma omp parallel for num_threads(m_num_threads)
+    for (int i = 0; i < n; i++) {
+        bool fluidA = i < nf;
+        double rhoA = m_rho[i];
+        double pA = m_pres[i];
+        const ChVector3d& vA = m_vel_mod[i];
+
+        ChVector3d acc(0);
+        ChVector3d vel_xsph(0);
+        double drho = 0;
+
+        for (int k = m_nbr_start[i]; k < m_nbr_start[i + 1]; k++) {
+            int j = m_nbr_list[k];
+            bool fluidB = j < nf;
+            if (!fluidA && !fluidB)
+                continue;
+
+            double rhoB = m_rho[j];
+            double pB = m_pres[j];
+            const ChVector3d& vB = m_vel_mod[j];
+
+            ChVector3d r = m_pos[i] - m_pos[j];
+            double d = r.Length();
+            ChVector3d gradW = GradW(r, d);
+            ChVector3d vAB = vA - vB;
+            double d2_reg = d * d + eps_h2;
+
+            // Continuity equation
+            drho += m * Vdot(vAB, gradW);
+
+            // Pressure gradient
+            acc -= gradW * (m * (pA / (rhoA * rhoA) + pB / (rhoB * rhoB)));
+
+            // Laminar viscosity
+            acc += vAB * (m * 8 * m_mu0 * Vdot(r, gradW) / (d2_reg * (rhoA + rhoB) * (rhoA + rhoB)));
+
+            // Artificial viscosity (approaching markers only)
+            double vr = Vdot(vAB, r);
+            if (vr < 0) {
+                double nu = -m_alpha * m_h * m_Cs / (0.5 * (rhoA + rhoB));
+                acc -= gradW * (m * nu * vr / d2_reg);
+            }
+
+            // XSPH velocity correction (fluid neighbors only)
+            if (fluidA && fluidB)
+                vel_xsph -= vAB * (m * W(d) / (0.5 * (rhoA + rhoB)));
+        }
+
+        if (fluidA)
+            acc += m_gravity + m_body_force;
+
+        m_acc[i] = acc;
+        m_drho[i] = drho;
+        m_vel_xsph[i] = vel_xsph * m_eps_xsph;
+    }
+}
+
+void ChSystemFsiCPU::ComputeDerivativesElastic() {
+    int nf = (int)m_num_fluid;
+    int n = (int)m_pos.size();
+    double m = GetParticleMass();
+    double vol0 = m_spacing * m_spacing * m_spacing;
+    double eps_h2 = m_eps_dist * m_h * m_h;
+    double nu = -m_alpha * m_h * m_Cs / m_rho0;
+    double twoG = 2 * m_G_shear;
+    double radii = 1.241 * m_spacing;
+    double w0 = W(0);
+
+#pragma omp parallel for num_threads(m_num_threads)
+    for (int i = 0; i < n; i++) {
+        bool fluidA = i < nf;
+        const ChVector3d& vA = m_vel_mod[i];
+        const ChVector3d& tdA = m_tau_diag[i];
+        const ChVector3d& toA = m_tau_offdiag[i];
+
+        ChVector3d acc(0);
+        ChVector3d dtd(0);
+        ChVector3d dto(0);
+        ChVector3d deltaV(0);
+        ChVector3d inner_sum(0);
+        double sum_w = w0 * vol0;
+        double bs_vAdT = m_beta_shifting * vA.Length() * m_dT;
+
+        for (int k = m_nbr_start[i]; k < m_nbr_start[i + 1]; k++) {
+            int j = m_nbr_list[k];
+            bool fluidB = j < nf;
+            if (!fluidA && !fluidB)
+                continue;
+
+            const ChVector3d& vB = m_vel_mod[j];
+            ChVector3d td = tdA + m_tau_diag[j];
+            ChVector3d to = toA + m_tau_offdiag[j];
+
+            ChVector3d r = m_pos[i] - m_pos[j];
+            double d = r.Length();
+            ChVector3d gradW = GradW(r, d);
+            ChVector3d vAB = vA - vB;
+
+            // Momentum equation (divergence of the stress tensor)
+            ChVector3d g = gradW * (m / (m_rho0 * m_rho0));
+            acc += ChVector3d(td.x() * g.x() + to.x() * g.y() + to.y() * g.z(),
+                              to.x() * g.x() + td.y() * g.y() + to.z() * g.z(),
+                              to.y() * g.x() + to.z() * g.y() + td.z() * g.z());
+
+            // Artificial viscosity
+            acc -= gradW * (m * nu * Vdot(vAB, r) / (d * d + eps_h2));
+
+            if (!fluidA)
+                continue;
+
+            // Stress rate (Jaumann), from the strain rate and spin tensors
+            ChVector3d vAB_h = vAB * (0.5 * vol0);
+            double exx = -2 * vAB_h.x() * gradW.x();
+            double eyy = -2 * vAB_h.y() * gradW.y();
+            double ezz = -2 * vAB_h.z() * gradW.z();
+            double exy = -vAB_h.x() * gradW.y() - vAB_h.y() * gradW.x();
+            double exz = -vAB_h.x() * gradW.z() - vAB_h.z() * gradW.x();
+            double eyz = -vAB_h.y() * gradW.z() - vAB_h.z() * gradW.y();
+            double wxy = -vAB_h.x() * gradW.y() + vAB_h.y() * gradW.x();
+            double wxz = -vAB_h.x() * gradW.z() + vAB_h.z() * gradW.x();
+            double wyz = -vAB_h.y() * gradW.z() + vAB_h.z() * gradW.y();
+            double edia = (exx + eyy + ezz) / 3;
+            double K_edia = m_K_bulk * edia;
+            double txx = tdA.x(), tyy = tdA.y(), tzz = tdA.z();
+            double txy = toA.x(), txz = toA.y(), tyz = toA.z();
+            dtd += ChVector3d(twoG * (exx - edia) + 2 * (txy * wxy + txz * wxz) + K_edia,
+                              twoG * (eyy - edia) - 2 * (txy * wxy - tyz * wyz) + K_edia,
+                              twoG * (ezz - edia) - 2 * (txz * wxz + tyz * wyz) + K_edia);
+            dto += ChVector3d(twoG * exy - (txx * wxy - txz * wyz) + (wxy * tyy + wxz * tyz),
+                              twoG * exz - (txx * wxz + txy * wyz) + (wxy * tyz + wxz * tzz),
+                              twoG * eyz - (txy * wxz + tyy * wyz) - (wxy * txz - wyz * tzz));
+
+            // Kernel integral (free surface detection) and XSPH
+            if (d > 1e-9 * m_h) {
+                double w = W(d);
+                sum_w += w * vol0;
+                if (fluidB)
+                    deltaV -= vAB * (vol0 * w);
+            }
+
+            // Particle shifting away from close SPH neighbors
+            if (fluidB && d < 1.25 * radii) {
+                ChVector3d r_0 = r * (bs_vAdT / d);
+                ChVector3d r_s = r_0 * ((radii - d) / radii);
+                if (d < radii)
+                    inner_sum += 3.0 * r_s;
+                else if (d < 1.1 * radii)
+                    inner_sum += r_s;
+                else
+                    inner_sum -= 0.1 * r_0;
+            }
+        }
+
+        if (fluidA) {
+            acc += m_gravity + m_body_force;
+
+            m_free_surface[i] = sum_w < m_kernel_threshold;
+            m_dtau_diag[i] = dtd;
+            m_dtau_offdiag[i] = dto;
+
+            // Limit the shifting displacement and convert it to a velocity, together with the XSPH correction
+            double det_r_max = 0.05 * vA.Length() * m_dT;
+            double det_r = inner_sum.Length();
+            if (det_r > det_r_max)
+                inner_sum *= det_r_max / (det_r + 1e-9);
+            m_vel_xsph[i] = inner_sum / m_dT + deltaV * m_eps_xsph;
+        }
+
+        m_acc[i] = acc;
+        m_drho[i] = 0;
+    }
+}
+
+void ChSystemFsiCPU::UpdateStress(int i, double dt) {
+    ChVector3d td = m_tau_diag0[i] + m_dtau_diag[i] * dt;
+    ChVector3d to = m_tau_offdiag0[i] + m_dtau_offdiag[i] * dt;
+
+    // Deviatoric parts of the stress at the beginning of the step and of the trial stress
+    double p_n = -(m_tau_diag0[i].x() + m_tau_diag0[i].y() + m_tau_diag0[i].z()) / 3;
+    ChVector3d sd_n = m_tau_diag0[i] + ChVector3d(p_n);
+    const ChVector3d& so_n = m_tau_offdiag0[i];
+    double p_tr = -(td.x() + td.y() + td.z()) / 3;
+    td += ChVector3d(p_tr);
+
+    double tau_tr = std::sqrt(0.5 * (td.Length2() + 2 * to.Length2()));
+    double tau_n = std::sqrt(0.5 * (sd_n.Length2() + 2 * so_n.Length2()));
+
+    // Return mapping onto the mu(I) yield surface
+    double p_cri = -m_cohesion / m_mu_fric_s;
+    if (p_tr > p_cri) {
+        double Chi = std::abs(tau_tr - tau_n) / (m_G_shear * dt);
+        double I = Chi * m_ave_diam * std::sqrt(m_rho0 / (std::max(p_tr, 0.0) + 1e-9));
+        double mu = m_mu_fric_s + (m_mu_fric_2 - m_mu_fric_s) * (I + 1e-9) / (m_mu_I0 + I + 1e-9);
+        double tau_max = p_tr * mu + m_cohesion;
+        if (tau_tr > tau_max) {
+            double coeff = tau_max / (tau_tr + 1e-9);
+            td *= coeff;
+            to *= coeff;
+        }
+    }
+
+    // No stress under tension or close to the free surface
+    if (p_tr < p_cri || m_free_surface[i]) {
+        td = VNULL;
+        to = VNULL;
+        p_tr = 0;
+    }
+
+    m_tau_diag[i] = td - ChVector3d(p_tr);
+    m_tau_offdiag[i] = to;
+    m_pres[i] = p_tr;
+    m_rho[i] = m_rho0;
+}
+
+void ChSystemFsiCPU::ApplyFsiForces() {
+    int nf = (int)m_num_fluid;
+    double m = GetParticleMass();
+
+    for (size_t ib = 0; ib < m_fsi_bodies.size(); ib++) {
+        m_fsi_forces[ib] = VNULL;
+        m_fsi_torques[ib] = VNULL;
+    }
+
+    // Single pass over the BCE markers, each contributing to the FSI body (if any) its carrier body maps to
+    for (size_t k = 0; k < m_bce_body.size(); k++) {
+        int ib = m_bce_fsi_index[m_bce_body[k]];
+        if (ib < 0)
+            continue;
+        ChVector3d f = m_acc[nf + k] * m;
+        m_fsi_forces[ib] += f;
+        m_fsi_torques[ib] += Vcross(m_pos[nf + k] - m_fsi_bodies[ib]->GetPos(), f);
+    }
+
+    for (size_t ib = 0; ib < m_fsi_bodies.size(); ib++) {
+        auto& body = m_fsi_bodies[ib];
+        body->EmptyAccumulators();
+        body->AccumulateForce(m_fsi_forces[ib], body->GetPos(), false);
+        body->AccumulateTorque(m_fsi_torques[ib], false);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSystemFsiCPU::DoStepDynamics_FSI() {
+    if (!m_is_initialized)
+        throw std::runtime_error("ChSystemFsiCPU: Initialize must be called before DoStepDynamics_FSI.");
+    if (m_pos.empty()) {
+        if (m_sysMBS)
+            m_sysMBS->DoStepDynamics(m_dT);
+        m_time += m_dT;
+        return;
+    }
+
+    int nf = (int)m_num_fluid;
+
+    // Save the fluid state at the beginning of the step
+    m_pos0.assign(m_pos.begin(), m_pos.begin() + nf);
+    m_vel0.assign(m_vel.begin(), m_vel.begin() + nf);
+    m_rho0_step.assign(m_rho.begin(), m_rho.begin() + nf);
+    if (m_elastic) {
+        m_tau_diag0.assign(m_tau_diag.begin(), m_tau_diag.begin() + nf);
+        m_tau_offdiag0.assign(m_tau_offdiag.begin(), m_tau_offdiag.begin() + nf);
+    }
+
+    // Midpoint integration: derivatives at the beginning of the step advance the fluid to the half step, derivatives
+    // at the half step advance the fluid over the full step
+    double h_step[2] = {m_dT / 2, m_dT};
+    for (int stage = 0; stage < 2; stage++) {
+        FindNeighbors();
+        UpdateBCEState();
+        if (m_elastic)
+            ComputeDerivativesElastic();
+        else
+            ComputeDerivatives();
+
+        double dt = h_step[stage];
+
+#pragma omp parallel for num_threads(m_num_threads)
+        for (int i = 0; i < nf; i++) {
+            m_pos[i] = m_pos0[i] + (m_vel[i] + m_vel_xsph[i]) * dt;
+            m_vel[i] = m_vel0[i] + m_acc[i] * dt;
+            if (m_elastic) {
+                UpdateStress(i, dt);
+            } else {
+                m_rho[i] = m_rho0_step[i] + m_drho[i] * dt;
+                m_pres[i] = Eos(m_rho[i]);
+            }
+        }
+    }
+
+    // Apply fluid forces (evaluated at the half step) and advance the multibody system
+    ApplyFsiForces();
+    if (m_sysMBS) {
+        int sync = m_dT_MBS > 0 ? std::max((int)(m_dT / m_dT_MBS), 1) : 1;
+        for (int t = 0; t < sync; t++)
+            m_sysMBS->DoStepDynamics(m_dT / sync);
+    }
+
+    // Move BCE markers with their bodies
+    UpdateBCEKinematics();
+
+    m_time += m_dT;
+}
+
+}  // end namespace fsi
+}  // end namespace chrono
@@ -0,0 +1,324 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Author: Radu Serban
+// =============================================================================
+//
+// Multithreaded CPU implementation of the explicit (WCSPH) FSI solver.
+//
+// =============================================================================
+
+#ifndef CH_SYSTEM_FSI_CPU_H
+#define CH_SYSTEM_FSI_CPU_H
+
+#include <vector>
+
+#include "chrono/core/ChVector2.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/physics/ChBody.h"
+
+#include "chrono_fsi/ChApiFsi.h"
+
+namespace chrono {
+namespace fsi {
+
+/// @addtogroup fsi_physics
+/// @{
+
+/// @brief Physical system for fluid-solid interaction problems, using a multithreaded CPU SPH solver.
+///
+/// This class provides a CUDA-free implementation of the explicit SPH pipeline of ChSystemFsi: cell-list neighbor
+/// search, Adami boundary conditions on BCE markers, XSPH velocity correction, and coupling with rigid bodies of a
+/// Chrono multibody system. Two material models are available, using the same discretization as the CUDA solver:
+/// - weakly-compressible fluid (WCSPH), with laminar and artificial viscosity (default);
+/// - elastic SPH for granular material (CRM), with a Jaumann stress rate and a mu(I) plastic return mapping
+///   (see SetElasticSPH).
+/// All marker loops are parallelized with OpenMP.
+///
+/// Markers are stored with all fluid markers first, followed by all BCE markers. Each BCE marker is attached to a
+/// body and moves rigidly with it. Fluid forces are transmitted only to bodies registered through AddFsiBody.
+///
+/// This class is built in its own library (ChronoEngine_fsi_cpu), which does not require CUDA. It can be used
+/// directly or, in builds with CUDA, as the CPU backend of ChSystemFsi (see ChSystemFsi::SetBackend), so that
+/// CRMTerrain and the SPH terrain co-simulation node run unchanged on it. FEA coupling is not implemented.
+class CH_FSI_API ChSystemFsiCPU {
+  public:
+    /// Structure with elastic material parameters (granular material, CRM).
+    /// These have the same meaning and default values as ChSystemFsi::ElasticMaterialProperties.
+    struct CH_FSI_API ElasticMaterialProperties {
+        double Young_modulus;     ///< Young's modulus
+        double Poisson_ratio;     ///< Poisson's ratio
+        double mu_I0;             ///< reference inertia number
+        double mu_fric_s;         ///< friction mu_s
+        double mu_fric_2;         ///< mu_2 constant in mu=mu(I)
+        double average_diam;      ///< average particle diameter
+        double cohesion_coeff;    ///< cohesion coefficient
+        double kernel_threshold;  ///< threshold on the kernel integral for free surface detection
+
+        ElasticMaterialProperties();
+    };
+
+    /// Create an FSI system using the specified multibody system (if any).
+    ChSystemFsiCPU(ChSystem* sysMBS = nullptr);
+
+    ~ChSystemFsiCPU();
+
+    /// Attach Chrono MBS system.
+    void AttachSystem(ChSystem* sysMBS);
+
+    /// Set the number of OpenMP threads (default: number of Chrono threads of the MBS system, or 1).
+    void SetNumThreads(int num_threads);
+
+    /// Set the initial spacing of SPH and BCE markers (default: 0.01).
+    void SetInitialSpacing(double spacing);
+
+    /// Set the SPH kernel length (default: 0.01).
+    void SetKernelLength(double length);
+
+    /// Set the number of BCE layers of boundary walls and solid objects (default: 3).
+    void SetNumBoundaryLayers(int num_layers);
+
+    /// Set the fluid reference density (default: 1000).
+    void SetDensity(double rho0);
+
+    /// Set the fluid dynamic viscosity (default: 0.001).
+    void SetViscosity(double mu0);
+
+    /// Set the artificial speed of sound used in the equation of state (default: 10).
+    /// For elastic SPH, the speed of sound is calculated from the bulk modulus and the density at initialization.
+    void SetSoundSpeed(double Cs);
+
+    /// Set the artificial viscosity coefficient (default: 0.02).
+    void SetArtificialViscosity(double alpha);
+
+    /// Set the XSPH velocity correction coefficient (default: 0.5).
+    void SetXSPHCoefficient(double eps);
+
+    /// Set the coefficient of the particle shifting used with elastic SPH (default: 1).
+    void SetShiftingCoefficient(double beta);
+
+    /// Enable elastic SPH (granular material) with the specified material properties.
+    /// Must be called before Initialize.
+    void SetElasticSPH(const ElasticMaterialProperties& mat_props);
+
+    /// Set prescribed initial (hydrostatic) pressure for a fluid with free surface at the specified height.
+    void SetInitPressure(double height);
+
+    /// Set gravitational acceleration for the FSI system.
+    /// This is applied to the fluid markers only; gravity on solid bodies is handled by the MBS system.
+    void SetGravitationalAcceleration(const ChVector3d& gravity);
+
+    /// Set a constant force applied to the fluid (acceleration).
+    void SetBodyForce(const ChVector3d& force);
+
+    /// Set the integration step size (default: 1e-4).
+    /// If dT_MBS is positive, the MBS system is advanced in int(dT / dT_MBS) substeps during each FSI step.
+    void SetStepSize(double dT, double dT_MBS = 0);
+
+    double GetInitialSpacing() const { return m_spacing; }
+    double GetKernelLength() const { return m_h; }
+    int GetNumBoundaryLayers() const { return m_num_bce_layers; }
+    double GetDensity() const { return m_rho0; }
+    double GetViscosity() const { return m_mu0; }
+    double GetSoundSpeed() const { return m_Cs; }
+    const ChVector3d& GetGravitationalAcceleration() const { return m_gravity; }
+    double GetStepSize() const { return m_dT; }
+
+    /// Return true if elastic SPH (granular material) is used.
+    bool GetElasticSPH() const { return m_elastic; }
+
+    /// Return the mass of an SPH or BCE marker.
+    double GetParticleMass() const;
+
+    /// Return the current simulation time.
+    double GetSimTime() const { return m_time; }
+
+    /// Return the number of fluid markers.
+    size_t GetNumFluidMarkers() const { return m_num_fluid; }
+
+    /// Return the number of BCE markers (attached to any body).
+    size_t GetNumBCEMarkers() const { return m_bce_local.size(); }
+
+    /// Return the positions of all markers (fluid markers first, followed by BCE markers).
+    const std::vector<ChVector3d>& GetParticlePositions() const { return m_pos; }
+
+    /// Return the velocities of all markers (fluid markers first, followed by BCE markers).
+    const std::vector<ChVector3d>& GetParticleVelocities() const { return m_vel; }
+
+    /// Return the accelerations of all markers, as evaluated at the last step.
+    const std::vector<ChVector3d>& GetParticleAccelerations() const { return m_acc; }
+
+    /// Return the fluid properties (density, pressure, viscosity) of all markers.
+    std::vector<ChVector3d> GetParticleFluidProperties() const;
+
+    /// Return the diagonal stress components (xx, yy, zz) of all markers (elastic SPH only).
+    const std::vector<ChVector3d>& GetParticleStressDiagonal() const { return m_tau_diag; }
+
+    /// Return the off-diagonal stress components (xy, xz, yz) of all markers (elastic SPH only).
+    const std::vector<ChVector3d>& GetParticleStressOffDiagonal() const { return m_tau_offdiag; }
+
+    /// Return the list of FSI bodies.
+    const std::vector<std::shared_ptr<ChBody>>& GetFsiBodies() const { return m_fsi_bodies; }
+
+    /// Return the fluid force on the specified FSI body, as applied at the last step.
+    const ChVector3d& GetFsiBodyForce(size_t i) const { return m_fsi_forces[i]; }
+
+    /// Return the fluid torque (about the body center of mass, in the absolute frame) on the specified FSI body.
+    const ChVector3d& GetFsiBodyTorque(size_t i) const { return m_fsi_torques[i]; }
+
+    /// Add an SPH fluid marker with given position and initial velocity.
+    void AddSPHParticle(const ChVector3d& point, const ChVector3d& velocity = ChVector3d(0));
+
+    /// Add an SPH marker with given position, initial velocity, and initial stress (elastic SPH).
+    void AddSPHParticle(const ChVector3d& point,
+                        const ChVector3d& velocity,
+                        const ChVector3d& tauXxYyZz,
+                        const ChVector3d& tauXyXzYz);
+
+    /// Add SPH fluid markers on a uniform grid filling the specified box.
+    void AddBoxSPH(const ChVector3d& boxCenter, const ChVector3d& boxHalfDim);
+
+    /// Add a rigid body to the FSI system.
+    /// The fluid forces and torques acting on the BCE markers of this body are applied to it at each step.
+    void AddFsiBody(std::shared_ptr<ChBody> body);
+
+    /// Add BCE markers from a set of points and associate them with the given body.
+    /// The points are assumed to be provided relative to the specified frame, itself relative to the body frame.
+    size_t AddPointsBCE(std::shared_ptr<ChBody> body, const std::vector<ChVector3d>& points, const ChFrame<>& frame);
+
+    /// Add BCE markers for a rectangular plate of specified X-Y dimensions and associate them with the given body.
+    /// BCE layers are created in the negative Z direction of the plate orientation frame.
+    size_t AddWallBCE(std::shared_ptr<ChBody> body, const ChFrame<>& frame, const ChVector2d& size);
+
+    /// Add BCE markers for a box container of specified dimensions and associate them with the given body.
+    /// See ChSystemFsi::AddBoxContainerBCE for the meaning of the 'faces' argument.
+    size_t AddBoxContainerBCE(std::shared_ptr<ChBody> body,
+                              const ChFrame<>& frame,
+                              const ChVector3d& size,
+                              const ChVector3i& faces);
+
+    /// Add BCE markers for a box of specified dimensions and associate them with the given body.
+    /// BCE markers are created inside the box if solid=true, and outside the box otherwise.
+    size_t AddBoxBCE(std::shared_ptr<ChBody> body, const ChFrame<>& frame, const ChVector3d& size, bool solid);
+
+    /// Complete construction of the FSI system.
+    void Initialize();
+
+    /// Advance the FSI system by one step, with the current step size.
+    /// The fluid is advanced with a two-stage midpoint scheme, the fluid forces are applied to the FSI bodies, the MBS
+    /// system (if any) is advanced over the same step, and the BCE markers are moved with their associated bodies.
+    void DoStepDynamics_FSI();
+
+  private:
+    /// Cell-list neighbor search (CSR lists of neighbors within the kernel support, excluding the marker itself).
+    void FindNeighbors();
+
+    /// Update position and velocity of all BCE markers from the states of their associated bodies.
+    void UpdateBCEKinematics();
+
+    /// Extrapolate the fluid state onto the BCE markers (Adami boundary conditions).
+    void UpdateBCEState();
+
+    /// Evaluate the marker accelerations, density rates, and XSPH velocity corrections.
+    void ComputeDerivatives();
+
+    /// Evaluate the marker accelerations, stress rates, and shifting velocities (elastic SPH).
+    void ComputeDerivativesElastic();
+
+    /// Integrate the stress of the specified SPH marker over the given step, with plastic return mapping.
+    void UpdateStress(int i, double dt);
+
+    /// Accumulate the fluid forces on the FSI bodies and apply them.
+    /// The forces are accumulated in a single pass over the BCE markers.
+    void ApplyFsiForces();
+
+    double W(double d) const;
+    ChVector3d GradW(const ChVector3d& r, double d) const;
+    double Eos(double rho) const { return m_Cs * m_Cs * (rho - m_rho0); }
+
+    ChSystem* m_sysMBS;  ///< associated multibody system
+
+    int m_num_threads;  ///< number of OpenMP threads
+
+    double m_spacing;          ///< initial marker spacing
+    double m_h;                ///< kernel length
+    int m_num_bce_layers;      ///< number of BCE layers
+    double m_rho0;             ///< reference density
+    double m_mu0;              ///< dynamic viscosity
+    double m_Cs;               ///< speed of sound
+    double m_alpha;            ///< artificial viscosity coefficient
+    double m_eps_xsph;         ///< XSPH coefficient
+    double m_eps_dist;         ///< relative regularization of marker distances
+    ChVector3d m_gravity;      ///< gravitational acceleration (fluid only)
+    ChVector3d m_body_force;   ///< additional fluid acceleration
+    bool m_use_init_pressure;  ///< initialize fluid with hydrostatic pressure
+    double m_pressure_height;  ///< free surface height for initial hydrostatic pressure
+    double m_dT;               ///< step size
+    double m_dT_MBS;           ///< maximum step size for the MBS system (if positive)
+    double m_time;             ///< current simulation time
+    bool m_is_initialized;     ///< set to true once Initialize is called
+
+    bool m_elastic;             ///< use elastic SPH (granular material)
+    double m_G_shear;           ///< shear modulus
+    double m_K_bulk;            ///< bulk modulus
+    double m_mu_I0;             ///< reference inertia number
+    double m_mu_fric_s;         ///< static friction coefficient
+    double m_mu_fric_2;         ///< limiting friction coefficient in mu(I)
+    double m_ave_diam;          ///< average particle diameter
+    double m_cohesion;          ///< cohesion coefficient
+    double m_kernel_threshold;  ///< threshold on the kernel integral for free surface detection
+    double m_beta_shifting;     ///< particle shifting coefficient
+
+    size_t m_num_fluid;  ///< number of fluid markers
+
+    std::vector<ChVector3d> m_pos;       ///< marker positions
+    std::vector<ChVector3d> m_vel;       ///< marker velocities (for BCE markers, velocity of the attached point)
+    std::vector<double> m_rho;           ///< marker densities
+    std::vector<double> m_pres;          ///< marker pressures
+    std::vector<ChVector3d> m_vel_mod;   ///< velocities used in the force evaluation (extrapolated for BCE markers)
+    std::vector<ChVector3d> m_acc;       ///< marker accelerations
+    std::vector<double> m_drho;          ///< density rates
+    std::vector<ChVector3d> m_vel_xsph;  ///< XSPH velocity corrections
+
+    std::vector<ChVector3d> m_pos0;   ///< fluid positions at the beginning of the step
+    std::vector<ChVector3d> m_vel0;   ///< fluid velocities at the beginning of the step
+    std::vector<double> m_rho0_step;  ///< fluid densities at the beginning of the step
+
+    std::vector<ChVector3d> m_tau_diag;      ///< diagonal stress components (elastic SPH)
+    std::vector<ChVector3d> m_tau_offdiag;   ///< off-diagonal stress components (elastic SPH)
+    std::vector<ChVector3d> m_dtau_diag;     ///< rates of diagonal stress components
+    std::vector<ChVector3d> m_dtau_offdiag;  ///< rates of off-diagonal stress components
+    std::vector<ChVector3d> m_tau_diag0;     ///< diagonal stress components at the beginning of the step
+    std::vector<ChVector3d> m_tau_offdiag0;  ///< off-diagonal stress components at the beginning of the step
+    std::vector<char> m_free_surface;        ///< free surface flags of the SPH markers (elastic SPH)
+
+    std::vector<int> m_nbr_start;     ///< CSR offsets into the neighbor list (size = number of markers + 1)
+    std::vector<int> m_nbr_list;      ///< CSR neighbor indices
+    std::vector<int> m_cell_start;    ///< cell-list offsets into the sorted marker indices
+    std::vector<int> m_cell_markers;  ///< marker indices, sorted by cell
+
+    std::vector<std::shared_ptr<ChBody>> m_bce_bodies;  ///< bodies carrying BCE markers
+    std::vector<int> m_bce_body;                        ///< index into m_bce_bodies for each BCE marker
+    std::vector<ChVector3d> m_bce_local;                ///< BCE marker position in the frame of its body
+    std::vector<ChVector3d> m_bce_acc;                  ///< BCE marker accelerations (from body motion)
+
+    std::vector<std::shared_ptr<ChBody>> m_fsi_bodies;  ///< bodies receiving fluid forces
+    std::vector<int> m_bce_fsi_index;                   ///< for each body in m_bce_bodies, its FSI body index (or -1)
+    std::vector<ChVector3d> m_fsi_forces;               ///< fluid forces on FSI bodies
+    std::vector<ChVector3d> m_fsi_torques;              ///< fluid torques on FSI bodies
+};
+
+/// @} fsi_physics
+
+}  // end namespace fsi
+}  // end namespace chrono
+
+#endif
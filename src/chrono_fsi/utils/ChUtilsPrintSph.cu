@@ -41,6 +41,19 @@ void PrintParticleToFile(const thrust::device_vector<Real4>& posRadD,
     thrust::host_vector<Real4> h_sr_tau_I_mu_i = sr_tau_I_mu_i;
     thrust::host_vector<Real4> derivVelRhoH = derivVelRhoD;
 
+    PrintParticleToFile(posRadH, velMasH, rhoPresMuH, h_sr_tau_I_mu_i, derivVelRhoH, referenceArray, referenceArrayFEA,
+                        dir, paramsH);
+}
+
+void PrintParticleToFile(const thrust::host_vector<Real4>& posRadH,
+                         const thrust::host_vector<Real3>& velMasH,
+                         const thrust::host_vector<Real4>& rhoPresMuH,
+                         const thrust::host_vector<Real4>& h_sr_tau_I_mu_i,
+                         const thrust::host_vector<Real4>& derivVelRhoH,
+                         const thrust::host_vector<int4>& referenceArray,
+                         const thrust::host_vector<int4>& referenceArrayFEA,
+                         const std::string& dir,
+                         const std::shared_ptr<SimParams>& paramsH) {
     // Current frame number
     static int frame_num = -1;
     frame_num++;
@@ -274,11 +287,6 @@ void PrintParticleToFile(const thrust::device_vector<Real4>& posRadD,
         fileNameBCE_Flex << ssBCE_Flex.str();
         fileNameBCE_Flex.close();
     }
-
-    posRadH.clear();
-    velMasH.clear();
-    rhoPresMuH.clear();
-    h_sr_tau_I_mu_i.clear();
 }
 
 void PrintFsiInfoToFile(const thrust::device_vector<Real3>& posRigidD,
@@ -297,6 +305,19 @@ void PrintFsiInfoToFile(const thrust::device_vector<Real3>& posRigidD,
     thrust::host_vector<Real3> posNodeH = posNodeD;
     thrust::host_vector<Real3> velNodeH = velNodeD;
 
+    PrintFsiInfoToFile(posRigidH, velRigidH, qRigidH, posNodeH, velNodeH, forceRigid, torqueRigid, forceNode, dir, time);
+}
+
+void PrintFsiInfoToFile(const thrust::host_vector<Real3>& posRigidH,
+                        const thrust::host_vector<Real4>& velRigidH,
+                        const thrust::host_vector<Real4>& qRigidH,
+                        const thrust::host_vector<Real3>& posNodeH,
+                        const thrust::host_vector<Real3>& velNodeH,
+                        const thrust::host_vector<Real3>& forceRigid,
+                        const thrust::host_vector<Real3>& torqueRigid,
+                        const thrust::host_vector<Real3>& forceNode,
+                        const std::string& dir,
+                        const double time) {
     std::string delim = ",";
     
     // Output fsi information for rigid bodies
@@ -369,6 +390,15 @@ void WriteCsvParticlesToFile(thrust::device_vector<Real4>& posRadD,
     thrust::host_vector<Real4> posRadH = posRadD;
     thrust::host_vector<Real3> velMasH = velMasD;
     thrust::host_vector<Real4> rhoPresMuH = rhoPresMuD;
+
+    WriteCsvParticlesToFile(posRadH, velMasH, rhoPresMuH, referenceArray, outfilename);
+}
+
+void WriteCsvParticlesToFile(const thrust::host_vector<Real4>& posRadH,
+                             const thrust::host_vector<Real3>& velMasH,
+                             const thrust::host_vector<Real4>& rhoPresMuH,
+                             const thrust::host_vector<int4>& referenceArray,
+                             const std::string& outfilename) {
     double eps = 1e-20;
 
     // ======================================================
@@ -402,11 +432,18 @@ void WriteCsvParticlesToFile(thrust::device_vector<Real4>& posRadD,
 void WriteChPFParticlesToFile(thrust::device_vector<Real4>& posRadD,
                               thrust::host_vector<int4>& referenceArray,
                               const std::string& outfilename) {
+    thrust::host_vector<Real4> posRadH = posRadD;
+
+    WriteChPFParticlesToFile(posRadH, referenceArray, outfilename);
+}
+
+void WriteChPFParticlesToFile(const thrust::host_vector<Real4>& posRadH,
+                              const thrust::host_vector<int4>& referenceArray,
+                              const std::string& outfilename) {
     std::ofstream ptFile(outfilename, std::ios::out | std::ios::binary);
 
     ParticleFormatWriter pw;
 
-    thrust::host_vector<Real4> posRadH = posRadD;
     std::vector<float> pos_x(posRadH.size());
     std::vector<float> pos_y(posRadH.size());
     std::vector<float> pos_z(posRadH.size());
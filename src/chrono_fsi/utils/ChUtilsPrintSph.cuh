@@ -46,7 +46,18 @@ CH_FSI_API void PrintParticleToFile(const thrust::device_vector<Real4>& posRadD,
                                     const thrust::host_vector<int4>& referenceArrayFEA,
                                     const std::string& dir,
                                     const std::shared_ptr<SimParams>& paramsH);
-                                
+
+/// Helper function to save the SPH data, provided in host vectors, into files.
+CH_FSI_API void PrintParticleToFile(const thrust::host_vector<Real4>& posRadH,
+                                    const thrust::host_vector<Real3>& velMasH,
+                                    const thrust::host_vector<Real4>& rhoPresMuH,
+                                    const thrust::host_vector<Real4>& sr_tau_I_mu_i,
+                                    const thrust::host_vector<Real4>& derivVelRhoH,
+                                    const thrust::host_vector<int4>& referenceArray,
+                                    const thrust::host_vector<int4>& referenceArrayFEA,
+                                    const std::string& dir,
+                                    const std::shared_ptr<SimParams>& paramsH);
+
 /// Helper function to save the FSI information into files.
 /// When called, this function creates files to write position,
 /// velocity, orientation of rigid bosied and position, velocity
@@ -62,6 +73,18 @@ CH_FSI_API void PrintFsiInfoToFile(const thrust::device_vector<Real3>& posRigidD
                                    const std::string& dir,
                                    const double time);
 
+/// Helper function to save the FSI information, provided in host vectors, into files.
+CH_FSI_API void PrintFsiInfoToFile(const thrust::host_vector<Real3>& posRigidH,
+                                   const thrust::host_vector<Real4>& velRigidH,
+                                   const thrust::host_vector<Real4>& qRigidH,
+                                   const thrust::host_vector<Real3>& posNodeH,
+                                   const thrust::host_vector<Real3>& velNodeH,
+                                   const thrust::host_vector<Real3>& forceRigid,
+                                   const thrust::host_vector<Real3>& torqueRigid,
+                                   const thrust::host_vector<Real3>& forceNode,
+                                   const std::string& dir,
+                                   const double time);
+
 /// Helper function to save particle info from FSI system to a CSV files. 
 /// This function saves particle positions, velocities, rho, pressure, and mu.
 CH_FSI_API void WriteCsvParticlesToFile(thrust::device_vector<Real4>& posRadD,
@@ -70,12 +93,24 @@ CH_FSI_API void WriteCsvParticlesToFile(thrust::device_vector<Real4>& posRadD,
                                         thrust::host_vector<int4>& referenceArray,
                                         const std::string& outfilename);
 
+/// Helper function to save particle info, provided in host vectors, to a CSV files.
+CH_FSI_API void WriteCsvParticlesToFile(const thrust::host_vector<Real4>& posRadH,
+                                        const thrust::host_vector<Real3>& velMasH,
+                                        const thrust::host_vector<Real4>& rhoPresMuH,
+                                        const thrust::host_vector<int4>& referenceArray,
+                                        const std::string& outfilename);
+
 /// Helper function to save particle info from FSI system to a ChPF binary files.
 /// This function saves only particle positions.
 CH_FSI_API void WriteChPFParticlesToFile(thrust::device_vector<Real4>& posRadD,
                                          thrust::host_vector<int4>& referenceArray,
                                          const std::string& outfilename);
 
+/// Helper function to save particle positions, provided in a host vector, to a ChPF binary files.
+CH_FSI_API void WriteChPFParticlesToFile(const thrust::host_vector<Real4>& posRadH,
+                                         const thrust::host_vector<int4>& referenceArray,
+                                         const std::string& outfilename);
+
 /// @} fsi_utils
 
 }  // end namespace utils
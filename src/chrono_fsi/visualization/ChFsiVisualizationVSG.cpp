@@ -198,8 +198,8 @@ bool ChFsiVisualizationVSG::Render() {
     m_system->SetRTF(m_systemFSI->GetRTF());
 
     if (m_vsys->Run()) {
-        // Copy SPH particle positions from device to host
-        thrust::host_vector<Real4> posH = m_systemFSI->m_sysFSI->sphMarkersD2->posRadD;
+        // Current positions of SPH particles and BCE markers (from the GPU or CPU solver)
+        auto posH = m_systemFSI->GetParticlePositions();
 
         // List of proxy bodies
         ////const auto& blist = m_system->GetBodies();
@@ -208,28 +208,28 @@ bool ChFsiVisualizationVSG::Render() {
 
         if (m_sph_markers) {
             for (unsigned int i = 0; i < m_systemFSI->GetNumFluidMarkers(); i++) {
-                m_sph_cloud->GetParticle(i).SetPos(ChVector3d(posH[p + i].x, posH[p + i].y, posH[p + i].z));
+                m_sph_cloud->GetParticle(i).SetPos(posH[p + i]);
             }
         }
         p += m_systemFSI->GetNumFluidMarkers();
 
         if (m_bndry_bce_markers) {
             for (unsigned int i = 0; i < m_systemFSI->GetNumBoundaryMarkers(); i++) {
-                m_bndry_bce_cloud->GetParticle(i).SetPos(ChVector3d(posH[p + i].x, posH[p + i].y, posH[p + i].z));
+                m_bndry_bce_cloud->GetParticle(i).SetPos(posH[p + i]);
             }
         }
         p += m_systemFSI->GetNumBoundaryMarkers();
 
         if (m_rigid_bce_markers) {
             for (unsigned int i = 0; i < m_systemFSI->GetNumRigidBodyMarkers(); i++) {
-                m_rigid_bce_cloud->GetParticle(i).SetPos(ChVector3d(posH[p + i].x, posH[p + i].y, posH[p + i].z));
+                m_rigid_bce_cloud->GetParticle(i).SetPos(posH[p + i]);
             }
         }
         p += m_systemFSI->GetNumRigidBodyMarkers();
 
         if (m_flex_bce_markers) {
             for (unsigned int i = 0; i < m_systemFSI->GetNumFlexBodyMarkers(); i++) {
-                m_flex_bce_cloud->GetParticle(i).SetPos(ChVector3d(posH[p + i].x, posH[p + i].y, posH[p + i].z));
+                m_flex_bce_cloud->GetParticle(i).SetPos(posH[p + i]);
             }
         }
 
@@ -888,88 +888,46 @@ void drawPlot3D(ChVisualSystemIrrlicht* vis,
     }
 }
 
-void drawProfilerRecursive(utils::ChProfileIterator* profileIterator,
-                           irr::IrrlichtDevice* device,
-                           int mx,
-                           int my,
-                           int sx,
-                           int sy,
-                           int xspacing,
-                           int& ypos) {
-    profileIterator->First();
-    if (profileIterator->Is_Done())
-        return;
-
-    irr::gui::IGUIFont* font = device->getGUIEnvironment()->getSkin()->getFont();  // getBuiltInFont();
-
-    float accumulated_time = 0, parent_time = profileIterator->Is_Root()
-                                                  ? utils::ChProfileManager::Get_Time_Since_Reset()
-                                                  : profileIterator->Get_Current_Parent_Total_Time();
-    int i;
-    int frames_since_reset = utils::ChProfileManager::Get_Frame_Count_Since_Reset();
+// Draw run-time profiler infos
+void drawProfiler(ChVisualSystemIrrlicht* vis) {
+    int mx = 230;
+    int my = 30;
+    int sx = 500;
 
-    float tot_frametime = utils::ChProfileManager::Get_Time_Since_Reset();
+    const auto& stats = vis->GetProfileStats();
+    if (stats.empty())
+        return;
 
-    char buffer[300];
+    irr::IrrlichtDevice* device = vis->GetDevice();
+    irr::gui::IGUIFont* font = device->getGUIEnvironment()->getSkin()->getFont();
     irr::video::SColor mcol(255, 255, 255, 90);
 
-    int numChildren = 0;
-
-    for (i = 0; !profileIterator->Is_Done(); i++, profileIterator->Next()) {
-        numChildren++;
-        float current_total_time = profileIterator->Get_Current_Total_Time();
-        accumulated_time += current_total_time;
-        float fraction = parent_time > FLT_EPSILON ? (current_total_time / parent_time) * 100 : 0.f;
-        float fraction_tot = tot_frametime > FLT_EPSILON ? (current_total_time / tot_frametime) * 100 : 0.f;
+    // Total time of the top-level zones
+    double tot_frametime = 0;
+    for (const auto& zone : stats) {
+        if (zone.depth == 0)
+            tot_frametime += zone.total_time;
+    }
 
-        irr::core::rect<s32> mrect(mx, my + ypos, mx + (int)(sx * (current_total_time / tot_frametime)),
-                                   my + ypos + 18);
+    char buffer[300];
+    int ypos = 0;
+    for (const auto& zone : stats) {
+        int xspacing = 30 * zone.depth;
+        double parent_time = zone.parent >= 0 ? stats[zone.parent].total_time : tot_frametime;
+        double fraction = parent_time > FLT_EPSILON ? (zone.total_time / parent_time) * 100 : 0.0;
+        double fraction_tot = tot_frametime > FLT_EPSILON ? (zone.total_time / tot_frametime) * 100 : 0.0;
+        int length = tot_frametime > FLT_EPSILON ? (int)(sx * (zone.total_time / tot_frametime)) : 0;
+
+        irr::core::rect<s32> mrect(mx, my + ypos, mx + length, my + ypos + 18);
         device->getVideoDriver()->draw2DRectangle(
             irr::video::SColor(100, ((xspacing * 200) % 255), ((-xspacing * 151 + 200) % 255), 230), mrect);
 
-        snprintf(buffer, sizeof(buffer), "%d -- %s (%.2f %% parent, %.2f %% tot.) :: %.3f ms / frame (%d calls)\n", i,
-                 profileIterator->Get_Current_Name(), fraction, fraction_tot,
-                 (current_total_time / (double)frames_since_reset), profileIterator->Get_Current_Total_Calls());
+        snprintf(buffer, sizeof(buffer), "%s (%.2f %% parent, %.2f %% tot.) :: %.3f ms (%lu calls, self %.3f ms)\n",
+                 zone.name.c_str(), fraction, fraction_tot, zone.total_time * 1e3, zone.calls, zone.self_time * 1e3);
         irr::core::stringw mstring(buffer);
         font->draw(mstring, irr::core::rect<irr::s32>(mx + xspacing, my + ypos, mx + sx, my + ypos + 20), mcol);
         ypos += 20;
-
-        profileIterator->Enter_Child(i);
-        drawProfilerRecursive(profileIterator, device, mx, my, sx, sy, xspacing + 30, ypos);
-        profileIterator->Enter_Parent();
-        for (int j = 0; j < i; ++j)
-            profileIterator->Next();
     }
-
-    float fraction = parent_time > FLT_EPSILON ? ((parent_time - accumulated_time) / parent_time) * 100 : 0.f;
-    float fraction_tot = tot_frametime > FLT_EPSILON ? ((parent_time - accumulated_time) / tot_frametime) * 100 : 0.f;
-
-    irr::core::rect<s32> mrect(mx, my + ypos, mx + (int)(sx * ((parent_time - accumulated_time) / tot_frametime)),
-                               my + ypos + 18);
-    device->getVideoDriver()->draw2DRectangle(
-        irr::video::SColor(100, ((xspacing * 200) % 255), ((-xspacing * 151 + 200) % 255), 230), mrect);
-
-    snprintf(buffer, sizeof(buffer), "n -- %s (%.2f %% parent, %.2f %% tot.) :: %.3f ms\n", "Unaccounted:", fraction,
-             fraction_tot, parent_time - accumulated_time);
-    irr::core::stringw mstringu(buffer);
-    font->draw(mstringu, irr::core::rect<irr::s32>(mx + xspacing, my + ypos, mx + sx, my + ypos + 20), mcol);
-    ypos += 20;
-}
-
-// Draw run-time profiler infos
-void drawProfiler(ChVisualSystemIrrlicht* vis) {
-    int mx = 230;
-    int my = 30;
-    int sx = 500;
-    int sy = 400;
-
-    int ypos = 0;
-    utils::ChProfileIterator* profileIterator = 0;
-    profileIterator = chrono::utils::ChProfileManager::Get_Iterator();
-
-    drawProfilerRecursive(profileIterator, vis->GetDevice(), mx, my, sx, sy, 0, ypos);
-
-    utils::ChProfileManager::Release_Iterator(profileIterator);
 }
 
 // Draw RGB coordinate system
@@ -55,7 +55,8 @@ ChVisualSystemIrrlicht::ChVisualSystemIrrlicht()
       m_win_title(""),
       m_yup(true),
       m_use_effects(false),
-      m_modal(false) {
+      m_modal(false),
+      m_profile_frame(false) {
     // Set default device parameter values
     m_device_params.AntiAlias = true;
     m_device_params.Bits = 32;
@@ -571,9 +572,16 @@ void ChVisualSystemIrrlicht::BeginScene() {
 void ChVisualSystemIrrlicht::BeginScene(bool backBuffer, bool zBuffer, ChColor color) {
     assert(!m_systems.empty());
 
-    utils::ChProfileManager::Reset();
-    utils::ChProfileManager::Start_Profile("Irrlicht loop");
-    utils::ChProfileManager::Increment_Frame_Counter();
+    // If the profiler is displayed, keep the profile zones collected since the beginning of the previous frame
+    // (these include any simulation steps performed between frames) and restart profiling for the current frame
+    if (m_gui->show_profiler) {
+        m_profile_stats = utils::ChProfiler::GetZoneStats();
+        utils::ChProfiler::Reset();
+        utils::ChProfiler::Enable(true);
+    } else {
+        m_profile_stats.clear();
+    }
+    m_profile_frame = utils::ChProfiler::BeginZone("Irrlicht loop");
 
     GetVideoDriver()->beginScene(backBuffer, zBuffer, tools::ToIrrlichtSColor(color));
 
@@ -616,7 +624,9 @@ void ChVisualSystemIrrlicht::BeginScene(bool backBuffer, bool zBuffer, ChColor c
 void ChVisualSystemIrrlicht::EndScene() {
     assert(!m_systems.empty());
 
-    utils::ChProfileManager::Stop_Profile();
+    if (m_profile_frame)
+        utils::ChProfiler::EndZone();
+    m_profile_frame = false;
 
     m_gui->EndScene();
 
@@ -20,6 +20,7 @@
 
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include <irrlicht.h>
 
@@ -34,6 +35,7 @@
 #include "chrono/assets/ChGlyphs.h"
 #include "chrono/assets/ChVisualShapePath.h"
 #include "chrono/assets/ChVisualShapeLine.h"
+#include "chrono/utils/ChProfiler.h"
 
 #include "chrono_irrlicht/ChApiIrr.h"
 #include "chrono_irrlicht/ChIrrNodeModel.h"
@@ -241,6 +243,10 @@ class ChApiIrr ChVisualSystemIrrlicht : virtual public ChVisualSystem {
     /// Show the realtime profiler in the 3D view.
     void ShowProfiler(bool val);
 
+    /// Get the profile zones collected over the previous frame (including simulation steps between frames).
+    /// Only available while the realtime profiler is shown.
+    const std::vector<utils::ChProfileZoneStats>& GetProfileStats() const { return m_profile_stats; }
+
     /// Show the object explorer.
     void ShowExplorer(bool val);
 
@@ -397,8 +403,11 @@ class ChApiIrr ChVisualSystemIrrlicht : virtual public ChVisualSystem {
     std::unique_ptr<EffectHandler> m_effect_handler;   ///< effect handler for shadow maps
     bool m_use_effects;                                ///< flag to enable/disable effects
     bool m_modal;                                      ///< visualize modal analysis
+    bool m_profile_frame;                              ///< is the current frame profiled?
     bool m_utility_flag = false;                       ///< utility flag that may be accessed from outside
 
+    std::vector<utils::ChProfileZoneStats> m_profile_stats;  ///< profile zones collected over the previous frame
+
     // shared meshes
     irr::scene::IAnimatedMesh* sphereMesh;
     irr::scene::IMesh* cubeMesh;
@@ -42,6 +42,8 @@ class collision_settings {
           bins_per_axis(vec3(10, 10, 10)),
           bin_size(real3(1, 1, 1)),
           grid_density(5),
+          broadphase_persistent(false),
+          broadphase_margin(0),
           broadphase_grid(ChBroadphase::GridType::FIXED_RESOLUTION),
           narrowphase_algorithm(ChNarrowphase::Algorithm::HYBRID) {}
 
@@ -79,6 +81,15 @@ class collision_settings {
     /// `broadphase_grid` type is set to FIXED_DENSITY.
     real grid_density;
 
+    /// Flag enabling the persistent (temporally coherent) broadphase.
+    /// If enabled, the broadphase grid, the binning of shapes, and the list of candidate pairs are reused across steps
+    /// for shapes that moved less than `broadphase_margin` (see ChCollisionSystemMulticore::EnablePersistentBroadphase).
+    bool broadphase_persistent;
+
+    /// Inflation margin for the shape AABBs cached by the persistent broadphase.
+    /// If not positive, the collision envelope is used.
+    real broadphase_margin;
+
     /// Algorithm for narrowphase collision detection phase.
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
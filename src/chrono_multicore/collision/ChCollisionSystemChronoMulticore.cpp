@@ -74,6 +74,8 @@ void ChCollisionSystemChronoMulticore::PreProcess() {
     broadphase.grid_resolution = settings.bins_per_axis;
     broadphase.bin_size = settings.bin_size;
     broadphase.grid_density = settings.grid_density;
+    broadphase.persistent = settings.broadphase_persistent;
+    broadphase.margin = settings.broadphase_margin;
     narrowphase.algorithm = settings.narrowphase_algorithm;
 }
 
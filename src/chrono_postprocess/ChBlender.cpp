@@ -12,6 +12,8 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 
@@ -86,6 +88,7 @@ ChBlender::ChBlender(ChSystem* system) : ChPostProcessBase(system) {
     contacts_vector_tip = true;
     wireframe_thickness = 0.001;
     single_asset_file = true;
+    binary_data = false;
     rank = -1;
 
     SetBlenderUp_is_ChronoY();
@@ -1019,18 +1022,12 @@ void ChBlender::ExportItemState(std::ofstream& state_file,
 
     if (has_stored_assets) {
         if (auto particleclones = std::dynamic_pointer_cast<ChParticleCloud>(item)) {
-            state_file << "make_chrono_object_clones('" << item->GetName() << "',"
-                       << "(" << parentframe.GetPos().x() << "," << parentframe.GetPos().y() << ","
-                       << parentframe.GetPos().z() << "),"
-                       << "(" << parentframe.GetRot().e0() << "," << parentframe.GetRot().e1() << ","
-                       << parentframe.GetRot().e2() << "," << parentframe.GetRot().e3() << "), " << std::endl;
+            state_file << "make_chrono_object_clones('" << item->GetName() << "',";
         } else {
-            state_file << "make_chrono_object_assetlist('" << item->GetName() << "',"
-                       << "(" << parentframe.GetPos().x() << "," << parentframe.GetPos().y() << ","
-                       << parentframe.GetPos().z() << "),"
-                       << "(" << parentframe.GetRot().e0() << "," << parentframe.GetRot().e1() << ","
-                       << parentframe.GetRot().e2() << "," << parentframe.GetRot().e3() << "), " << std::endl;
+            state_file << "make_chrono_object_assetlist('" << item->GetName() << "',";
         }
+        ExportFrame(state_file, parentframe);
+        state_file << std::endl;
 
         // List visual shapes to use as children of the Blender object (parent)
 
@@ -1090,15 +1087,29 @@ void ChBlender::ExportItemState(std::ofstream& state_file,
         // in case of particle clones, add array of positions&rotations of particles
 
         if (auto particleclones = std::dynamic_pointer_cast<ChParticleCloud>(item)) {
-            state_file << " [";
-            for (unsigned int m = 0; m < particleclones->GetNumParticles(); ++m) {
-                // Get the current coordinate frame of the i-th particle
-                ChCoordsys<> partframe = particleclones->GetParticle(m).GetCoordsys();
-                state_file << "[(" << partframe.pos.x() << "," << partframe.pos.y() << "," << partframe.pos.z() << "),";
-                state_file << "(" << partframe.rot.e0() << "," << partframe.rot.e1() << "," << partframe.rot.e2() << ","
-                           << partframe.rot.e3() << ")], " << std::endl;
+            if (binary_data) {
+                // store the particle frames as rows (x, y, z, e0, e1, e2, e3) of a binary data block
+                size_t block = AddBinaryBlock(7);
+                auto& data = m_binary_blocks[block].second;
+                data.resize(7 * (size_t)particleclones->GetNumParticles());
+                for (unsigned int m = 0; m < particleclones->GetNumParticles(); ++m) {
+                    const ChCoordsys<>& partframe = particleclones->GetParticle(m).GetCoordsys();
+                    std::memcpy(&data[7 * (size_t)m], partframe.pos.data(), 3 * sizeof(double));
+                    std::memcpy(&data[7 * (size_t)m + 3], partframe.rot.data(), 4 * sizeof(double));
+                }
+                state_file << " chrono_bin_data[" << block << "]" << std::endl;
+            } else {
+                state_file << " [";
+                for (unsigned int m = 0; m < particleclones->GetNumParticles(); ++m) {
+                    // Get the current coordinate frame of the i-th particle
+                    ChCoordsys<> partframe = particleclones->GetParticle(m).GetCoordsys();
+                    state_file << "[(" << partframe.pos.x() << "," << partframe.pos.y() << "," << partframe.pos.z()
+                               << "),";
+                    state_file << "(" << partframe.rot.e0() << "," << partframe.rot.e1() << ","
+                               << partframe.rot.e2() << "," << partframe.rot.e3() << ")], " << std::endl;
+                }
+                state_file << "]" << std::endl;
             }
-            state_file << "]" << std::endl;
         }
         state_file << ")\n" << std::endl;
 
@@ -1133,6 +1144,61 @@ void ChBlender::ExportItemState(std::ofstream& state_file,
     }
 }
 
+// Write the position and rotation of a frame as arguments of a Python function call, either as literals or as
+// references to a row of the binary block of item frames.
+void ChBlender::ExportFrame(std::ofstream& state_file, const ChFrame<>& frame) {
+    if (binary_data) {
+        auto& data = m_binary_blocks[0].second;
+        size_t row = data.size() / 7;
+        data.insert(data.end(), frame.GetPos().data(), frame.GetPos().data() + 3);
+        data.insert(data.end(), frame.GetRot().data(), frame.GetRot().data() + 4);
+        state_file << "chrono_bin_data[0][" << row << ",0:3],chrono_bin_data[0][" << row << ",3:7], ";
+        return;
+    }
+
+    state_file << "(" << frame.GetPos().x() << "," << frame.GetPos().y() << "," << frame.GetPos().z() << "),"
+               << "(" << frame.GetRot().e0() << "," << frame.GetRot().e1() << "," << frame.GetRot().e2() << ","
+               << frame.GetRot().e3() << "), ";
+}
+
+size_t ChBlender::AddBinaryBlock(size_t num_columns) {
+    m_binary_blocks.push_back({num_columns, std::vector<double>()});
+    return m_binary_blocks.size() - 1;
+}
+
+// Binary data file layout (native byte order):
+//   char[8]    magic string "CHBLBIN"
+//   uint32     format version
+//   uint32     number of blocks
+//   uint64[3]  for each block: offset (in bytes, from the beginning of the file), number of rows, number of columns
+//   double[]   for each block: data, in row-major order
+void ChBlender::WriteBinaryData(const std::string& filename) {
+    const char magic[8] = {'C', 'H', 'B', 'L', 'B', 'I', 'N', '\0'};
+    uint32_t version = 1;
+    uint32_t num_blocks = (uint32_t)m_binary_blocks.size();
+
+    std::vector<uint64_t> index(3 * num_blocks);
+    uint64_t offset = sizeof(magic) + 2 * sizeof(uint32_t) + index.size() * sizeof(uint64_t);
+    for (uint32_t ib = 0; ib < num_blocks; ib++) {
+        const auto& block = m_binary_blocks[ib];
+        index[3 * ib + 0] = offset;
+        index[3 * ib + 1] = block.second.size() / block.first;
+        index[3 * ib + 2] = block.first;
+        offset += block.second.size() * sizeof(double);
+    }
+
+    std::ofstream bin_file(filename, std::ios::binary);
+    bin_file.write(magic, sizeof(magic));
+    bin_file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    bin_file.write(reinterpret_cast<const char*>(&num_blocks), sizeof(num_blocks));
+    bin_file.write(reinterpret_cast<const char*>(index.data()), index.size() * sizeof(uint64_t));
+    for (const auto& block : m_binary_blocks)
+        bin_file.write(reinterpret_cast<const char*>(block.second.data()), block.second.size() * sizeof(double));
+
+    if (!bin_file)
+        throw std::runtime_error("Can't save data into file " + filename);
+}
+
 // This function is used at each timestep to export data formatted in a way that it can be load with the python scripts
 // generated by ExportScript(). The generated filename must be set at the beginning of the animation via
 // SetOutputDataFilebase(), and then a number is automatically appended and incremented at each ExportData(), e.g.,
@@ -1162,6 +1228,11 @@ void ChBlender::ExportData(const std::string& filename) {
         m_blender_frame_shapes.clear();
         m_blender_frame_materials.clear();
 
+        // reset the binary data blocks; the first block always contains the frames of the exported items
+        m_binary_blocks.clear();
+        if (binary_data)
+            AddBinaryBlock(7);
+
         // Save assets
         // - non mutable assets will go into assets_file, mutable will go into state_file
         // - in both cases, assets that are already present assets will not be appended
@@ -1248,6 +1319,11 @@ void ChBlender::ExportData(const std::string& filename) {
                         fabs(react_forces.z()) > 1e-8) {
                         // ChMatrix33<> localmatr(plane_coord);
                         ChQuaternion<> q = plane_coord.GetQuaternion();
+                        if (mdata) {
+                            mdata->insert(mdata->end(), {pA.x(), pA.y(), pA.z(), q.e0(), q.e1(), q.e2(), q.e3(),
+                                                         react_forces.x(), react_forces.y(), react_forces.z()});
+                            return true;
+                        }
                         // ChVector3d n1 = localmatr.GetAxisX();
                         // ChVector3d absreac = localmatr * react_forces;
                         (*mfile) << "\t\t[";
@@ -1269,18 +1345,28 @@ void ChBlender::ExportData(const std::string& filename) {
                 }
                 // Data
                 std::ofstream* mfile;
+                std::vector<double>* mdata;
             };
 
-            state_file << "if chrono_view_contacts:" << std::endl;
-            state_file << "\tcontacts= np.array([ " << std::endl;
-
             auto my_contact_reporter = chrono_types::make_shared<_reporter_class>();
             my_contact_reporter->mfile = &state_file;
+            my_contact_reporter->mdata = nullptr;
+
+            state_file << "if chrono_view_contacts:" << std::endl;
+            if (binary_data) {
+                // store the contact data as rows (pA, plane rotation, force) of a binary data block
+                size_t block = AddBinaryBlock(10);
+                my_contact_reporter->mdata = &m_binary_blocks[block].second;
+                mSystem->GetContactContainer()->ReportAllContacts(my_contact_reporter);
+                state_file << "\tcontacts = chrono_bin_data[" << block << "]" << std::endl;
+            } else {
+                state_file << "\tcontacts= np.array([ " << std::endl;
 
-            // scan all contacts
-            mSystem->GetContactContainer()->ReportAllContacts(my_contact_reporter);
+                // scan all contacts
+                mSystem->GetContactContainer()->ReportAllContacts(my_contact_reporter);
 
-            state_file << "\t])" << std::endl;
+                state_file << "\t])" << std::endl;
+            }
 
             state_file << "\tif len(contacts):" << std::endl;
             state_file << "\t\tglyphsetting = setup_glyph_setting('contacts', glyph_type ='VECTOR LOCAL'," << std::endl;
@@ -1347,6 +1433,10 @@ void ChBlender::ExportData(const std::string& filename) {
             state_file << "\t\t) " << std::endl;
         }
 
+        // Write the binary data blocks referenced in the state file
+        if (binary_data)
+            WriteBinaryData(base_path + filename + ".bin");
+
     } catch (const std::exception&) {
         throw std::runtime_error("Can't save data into file " + filename + ".py (or .dat)");
     }
@@ -20,6 +20,8 @@
 #include <string>
 #include <unordered_set>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "chrono/assets/ChVisualShape.h"
 #include "chrono/physics/ChSystem.h"
@@ -235,6 +237,14 @@ class ChApiPostProcess ChBlender : public ChPostProcessBase {
     /// would allow assets whose settings change during time (ex time-changing colors)
     void SetUseSingleAssetFile(bool use) { single_asset_file = use; }
 
+    /// Set if the bulk per-frame data must be saved in binary format (default: false).
+    /// If enabled, ExportData() also writes a binary file state00001.bin, state00002.bin, etc. next to each
+    /// state00001.py, state00002.py, etc. It contains an index followed by raw arrays of doubles: the frames of all
+    /// exported items, the positions and rotations of particles in particle clouds, and the contact data. The per-frame
+    /// Python script only references these arrays, which are loaded by the chrono_import.py add-on. This makes the
+    /// export of large particle clouds much faster and the output files much smaller.
+    void SetUseBinaryData(bool use) { binary_data = use; }
+
     /// Se the rank of this process. This is useful when doing parallel simulations on multiple computing
     /// nodes, each with its own ChBlender exporter, each generating .py files in different directories, and later
     /// you want to load all them in a single Blender project: this is possible tanks to the "Merge" mode
@@ -254,6 +264,9 @@ class ChApiPostProcess ChBlender : public ChPostProcessBase {
                          bool per_frame,
                          std::shared_ptr<ChVisualShape> mshape);
     void ExportItemState(std::ofstream& state_file, std::shared_ptr<ChPhysicsItem> item, const ChFrame<>& parentframe);
+    void ExportFrame(std::ofstream& state_file, const ChFrame<>& frame);
+    size_t AddBinaryBlock(size_t num_columns);
+    void WriteBinaryData(const std::string& filename);
 
     const std::string unique_bl_id(size_t mpointer) const;
 
@@ -334,6 +347,9 @@ class ChApiPostProcess ChBlender : public ChPostProcessBase {
 
     bool single_asset_file;
 
+    bool binary_data;
+    std::vector<std::pair<size_t, std::vector<double>>> m_binary_blocks;  ///< binary data blocks (num. columns, data)
+
     int rank;
 };
 
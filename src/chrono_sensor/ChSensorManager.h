@@ -25,9 +25,11 @@
 #include "chrono/physics/ChSystem.h"
 
 #include "chrono_sensor/sensors/ChSensor.h"
-#include "chrono_sensor/optix/ChOptixEngine.h"
 #include "chrono_sensor/ChDynamicsManager.h"
-#include "chrono_sensor/optix/scene/ChScene.h"
+#ifdef CHRONO_HAS_OPTIX
+    #include "chrono_sensor/optix/ChOptixEngine.h"
+    #include "chrono_sensor/optix/scene/ChScene.h"
+#endif
 
 #include <fstream>
 #include <sstream>
@@ -39,6 +41,8 @@ namespace sensor {
 /// @{
 
 /// class for managing sensors. This is the Sensor system class.
+/// Without OptiX support (CHRONO_HAS_OPTIX undefined), only the dynamic and CPU sensors are available and the engine
+/// and scene interface is omitted.
 
 class CH_SENSOR_API ChSensorManager {
   public:
@@ -70,6 +74,7 @@ class CH_SENSOR_API ChSensorManager {
     /// @return List of device IDs that the manager will try to use when rendering.
     std::vector<unsigned int> GetDeviceList();
 
+#ifdef CHRONO_HAS_OPTIX
     /// Get the number of engines the manager is currently using
     /// @return An integer number of OptiX engines
     int GetNumEngines() { return (int)m_engines.size(); }
@@ -82,6 +87,7 @@ class CH_SENSOR_API ChSensorManager {
     /// Calls on the sensor manager to rebuild the scene, translating all objects from the Chrono system into their
     /// appropriate optix objects.
     void ReconstructScenes();
+#endif
 
     /// Get the maximum number of allowed OptiX Engines for the manager.
     /// @return An integer specifying the maximum number of engines the manager is allowed to create.
@@ -110,9 +116,11 @@ class CH_SENSOR_API ChSensorManager {
     /// @return The verbose setting
     bool GetVerbose() { return m_verbose; }
 
+#ifdef CHRONO_HAS_OPTIX
     /// Public pointer to the scene. This is used to specify additional componenets include lights, background colors,
     /// etc
     std::shared_ptr<ChScene> scene;
+#endif
 
   private:
     bool m_verbose;           ///< Whether we should print messages and warnings
@@ -120,8 +128,10 @@ class CH_SENSOR_API ChSensorManager {
     int m_num_keyframes;      ///< number of keyframes to use
 
     // class variables
-    ChSystem* m_system;                                     ///< Chrono system the manager is attached to
+    ChSystem* m_system;  ///< Chrono system the manager is attached to
+#ifdef CHRONO_HAS_OPTIX
     std::vector<std::shared_ptr<ChOptixEngine>> m_engines;  ///< The optix engine(s) used for rendered sensors
+#endif
     std::shared_ptr<ChDynamicsManager> m_dynamics_manager;  ///< Container for updating dynamic sensors
 
     int m_allowable_groups = 1;  ///< Default maximum number of allowable engines
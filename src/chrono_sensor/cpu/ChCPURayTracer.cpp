@@ -0,0 +1,619 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Asher Elmquist
+// =============================================================================
+//
+// CPU ray tracer (BVH over visual shapes, packet traversal)
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "chrono_sensor/cpu/ChCPURayTracer.h"
+
+#include "chrono/assets/ChVisualShapeBox.h"
+#include "chrono/assets/ChVisualShapeCylinder.h"
+#include "chrono/assets/ChVisualShapeSphere.h"
+#include "chrono/assets/ChVisualShapeTriangleMesh.h"
+#include "chrono/utils/ChOpenMP.h"
+
+namespace chrono {
+namespace sensor {
+
+// Maximum number of primitives in a BVH leaf
+static const int max_leaf_size = 4;
+
+// Rebuild the BVH if a refit increases its total node area by more than this factor
+static const double max_refit_area_ratio = 2.0;
+
+// Replacement for vanishing direction components when computing inverse directions
+static inline float SafeDir(float d) {
+    return std::abs(d) > 1e-20f ? d : 1e-20f;
+}
+
+ChCPURayTracer::ChCPURayTracer() : m_num_threads(ChOMP::GetNumProcs()), m_origin(VNULL), m_build_area(0) {}
+
+void ChCPURayTracer::SetNumThreads(int num_threads) {
+    m_num_threads = std::max(1, num_threads);
+}
+
+void ChCPURayTracer::Clear() {
+    ClearPrimitives();
+    m_order.clear();
+    m_nodes.clear();
+}
+
+void ChCPURayTracer::ClearPrimitives() {
+    m_triangles.clear();
+    m_spheres.clear();
+    m_boxes.clear();
+    m_cylinders.clear();
+    m_refs.clear();
+}
+
+// -----------------------------------------------------------------------------
+// Scene construction
+// -----------------------------------------------------------------------------
+
+void ChCPURayTracer::AddSphere(const ChVector3d& center, double radius) {
+    ChVector3d c = center - m_origin;
+    Sphere sph = {{(float)c.x(), (float)c.y(), (float)c.z()}, (float)radius};
+    m_refs.push_back({PrimitiveType::SPHERE, (int)m_spheres.size()});
+    m_spheres.push_back(sph);
+}
+
+ChCPURayTracer::LocalShape ChCPURayTracer::MakeLocalShape(const ChFrame<>& frame, const ChVector3d& h) const {
+    // rows of the absolute-to-local rotation are the local axes expressed in the absolute frame
+    const ChMatrix33<>& A = frame.GetRotMat();
+    ChVector3d p = frame.GetPos() - m_origin;
+    LocalShape shape;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++)
+            shape.R[3 * i + j] = (float)A(j, i);
+        shape.p[i] = (float)p[i];
+        shape.h[i] = (float)h[i];
+    }
+    return shape;
+}
+
+void ChCPURayTracer::AddBox(const ChFrame<>& frame, const ChVector3d& hlen) {
+    m_refs.push_back({PrimitiveType::BOX, (int)m_boxes.size()});
+    m_boxes.push_back(MakeLocalShape(frame, hlen));
+}
+
+void ChCPURayTracer::AddCylinder(const ChFrame<>& frame, double radius, double height) {
+    m_refs.push_back({PrimitiveType::CYLINDER, (int)m_cylinders.size()});
+    m_cylinders.push_back(MakeLocalShape(frame, ChVector3d(radius, radius, height / 2)));
+}
+
+void ChCPURayTracer::AddTriangle(const ChVector3d& v0, const ChVector3d& v1, const ChVector3d& v2) {
+    ChVector3d a = v0 - m_origin;
+    ChVector3d e1 = v1 - v0;
+    ChVector3d e2 = v2 - v0;
+    ChVector3d n = Vcross(e1, e2);
+    double len = n.Length();
+    if (len > 1e-20)
+        n /= len;  // degenerate triangles are kept (so that the number of primitives does not change) but never hit
+
+    Triangle tri;
+    for (int i = 0; i < 3; i++) {
+        tri.v0[i] = (float)a[i];
+        tri.e1[i] = (float)e1[i];
+        tri.e2[i] = (float)e2[i];
+        tri.n[i] = (float)n[i];
+    }
+    m_refs.push_back({PrimitiveType::TRIANGLE, (int)m_triangles.size()});
+    m_triangles.push_back(tri);
+}
+
+void ChCPURayTracer::AddMesh(const ChTriangleMeshConnected& mesh, const ChFrame<>& frame, const ChVector3d& scale) {
+    const auto& vertices = mesh.GetCoordsVertices();
+    const auto& faces = mesh.GetIndicesVertexes();
+
+    std::vector<ChVector3d> abs_vertices(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++)
+        abs_vertices[i] = frame.TransformPointLocalToParent(scale * vertices[i]);
+
+    for (const auto& face : faces)
+        AddTriangle(abs_vertices[face[0]], abs_vertices[face[1]], abs_vertices[face[2]]);
+}
+
+void ChCPURayTracer::AddVisualModel(const ChVisualModel& model, const ChFrame<>& frame) {
+    for (const auto& shape_instance : model.GetShapes()) {
+        const auto& shape = shape_instance.first;
+        ChFrame<> shape_frame = frame * shape_instance.second;
+
+        if (!shape->IsVisible()) {
+            continue;
+        } else if (auto box_shape = std::dynamic_pointer_cast<ChVisualShapeBox>(shape)) {
+            AddBox(shape_frame, box_shape->GetHalflengths());
+        } else if (auto sphere_shape = std::dynamic_pointer_cast<ChVisualShapeSphere>(shape)) {
+            AddSphere(shape_frame.GetPos(), sphere_shape->GetRadius());
+        } else if (auto cylinder_shape = std::dynamic_pointer_cast<ChVisualShapeCylinder>(shape)) {
+            AddCylinder(shape_frame, cylinder_shape->GetRadius(), cylinder_shape->GetHeight());
+        } else if (auto trimesh_shape = std::dynamic_pointer_cast<ChVisualShapeTriangleMesh>(shape)) {
+            // rigid and deformable meshes are both added with their current vertex positions
+            AddMesh(*trimesh_shape->GetMesh(), shape_frame, trimesh_shape->GetScale());
+        }
+    }
+}
+
+void ChCPURayTracer::AddSystem(ChSystem* sys) {
+    for (const auto& body : sys->GetBodies()) {
+        if (body->GetVisualModel())
+            AddVisualModel(*body->GetVisualModel(), body->GetVisualModelFrame());
+    }
+    for (const auto& item : sys->GetOtherPhysicsItems()) {
+        if (item->GetVisualModel())
+            AddVisualModel(*item->GetVisualModel(), item->GetVisualModelFrame());
+    }
+}
+
+void ChCPURayTracer::BuildScene(ChSystem* sys) {
+    // keep the BVH topology and the leaf ordering of the previous build
+    ClearPrimitives();
+    AddSystem(sys);
+
+    if (m_nodes.empty() || m_refs.size() != m_order.size()) {
+        m_order.clear();
+        Build();
+        return;
+    }
+
+    // place the primitives in their previous BVH leaves and update the node bounds
+    std::vector<PrimitiveRef> refs(m_refs.size());
+    for (size_t i = 0; i < m_refs.size(); i++)
+        refs[i] = m_refs[m_order[i]];
+    m_refs.swap(refs);
+    Refit();
+
+    if (CalcTreeArea() > max_refit_area_ratio * m_build_area)
+        Build();
+}
+
+// -----------------------------------------------------------------------------
+// BVH construction
+// -----------------------------------------------------------------------------
+
+void ChCPURayTracer::GetBounds(const PrimitiveRef& ref, float* bmin, float* bmax) const {
+    switch (ref.type) {
+        case PrimitiveType::TRIANGLE: {
+            const Triangle& tri = m_triangles[ref.index];
+            for (int i = 0; i < 3; i++) {
+                float v1 = tri.v0[i] + tri.e1[i];
+                float v2 = tri.v0[i] + tri.e2[i];
+                bmin[i] = std::min(tri.v0[i], std::min(v1, v2));
+                bmax[i] = std::max(tri.v0[i], std::max(v1, v2));
+            }
+            break;
+        }
+        case PrimitiveType::SPHERE: {
+            const Sphere& sph = m_spheres[ref.index];
+            for (int i = 0; i < 3; i++) {
+                bmin[i] = sph.c[i] - sph.r;
+                bmax[i] = sph.c[i] + sph.r;
+            }
+            break;
+        }
+        case PrimitiveType::BOX:
+        case PrimitiveType::CYLINDER: {
+            // absolute extent of the oriented bounding box
+            const LocalShape& shape = (ref.type == PrimitiveType::BOX) ? m_boxes[ref.index] : m_cylinders[ref.index];
+            for (int i = 0; i < 3; i++) {
+                float e = std::abs(shape.R[i]) * shape.h[0] + std::abs(shape.R[3 + i]) * shape.h[1] +
+                          std::abs(shape.R[6 + i]) * shape.h[2];
+                bmin[i] = shape.p[i] - e;
+                bmax[i] = shape.p[i] + e;
+            }
+            break;
+        }
+    }
+}
+
+void ChCPURayTracer::Build() {
+    m_nodes.clear();
+
+    int num_prims = (int)m_refs.size();
+    if (num_prims == 0) {
+        m_order.clear();
+        return;
+    }
+
+    std::vector<float> bounds(6 * num_prims);
+    for (int i = 0; i < num_prims; i++)
+        GetBounds(m_refs[i], &bounds[6 * i], &bounds[6 * i + 3]);
+
+    std::vector<int> order(num_prims);
+    std::iota(order.begin(), order.end(), 0);
+
+    m_nodes.reserve(2 * num_prims);
+    m_nodes.push_back(Node());
+    BuildNode(0, 0, num_prims, bounds, order);
+
+    // reorder the primitive references so that each leaf covers a contiguous range
+    std::vector<PrimitiveRef> refs(num_prims);
+    for (int i = 0; i < num_prims; i++)
+        refs[i] = m_refs[order[i]];
+    m_refs.swap(refs);
+
+    // keep track of the order in which the primitives were added (the references may already have been permuted)
+    if (m_order.size() == order.size()) {
+        for (int i = 0; i < num_prims; i++)
+            order[i] = m_order[order[i]];
+    }
+    m_order.swap(order);
+
+    m_build_area = CalcTreeArea();
+}
+
+void ChCPURayTracer::Refit() {
+    // children are always stored after their parent, so a reverse sweep updates the nodes bottom-up
+    for (int n = (int)m_nodes.size() - 1; n >= 0; n--) {
+        Node& node = m_nodes[n];
+        for (int k = 0; k < 3; k++) {
+            node.bmin[k] = std::numeric_limits<float>::max();
+            node.bmax[k] = -std::numeric_limits<float>::max();
+        }
+        if (node.count > 0) {
+            for (int i = node.first; i < node.first + node.count; i++) {
+                float bmin[3], bmax[3];
+                GetBounds(m_refs[i], bmin, bmax);
+                for (int k = 0; k < 3; k++) {
+                    node.bmin[k] = std::min(node.bmin[k], bmin[k]);
+                    node.bmax[k] = std::max(node.bmax[k], bmax[k]);
+                }
+            }
+        } else {
+            for (int c = node.first; c <= node.first + 1; c++) {
+                for (int k = 0; k < 3; k++) {
+                    node.bmin[k] = std::min(node.bmin[k], m_nodes[c].bmin[k]);
+                    node.bmax[k] = std::max(node.bmax[k], m_nodes[c].bmax[k]);
+                }
+            }
+        }
+    }
+}
+
+double ChCPURayTracer::CalcTreeArea() const {
+    double area = 0;
+    for (const auto& node : m_nodes) {
+        double dx = node.bmax[0] - node.bmin[0];
+        double dy = node.bmax[1] - node.bmin[1];
+        double dz = node.bmax[2] - node.bmin[2];
+        area += dx * dy + dy * dz + dz * dx;
+    }
+    return area;
+}
+
+void ChCPURayTracer::BuildNode(int node,
+                               int first,
+                               int count,
+                               const std::vector<float>& bounds,
+                               std::vector<int>& order) {
+    // bounding box of the node primitives and of their centroids
+    float bmin[3], bmax[3], cmin[3], cmax[3];
+    for (int k = 0; k < 3; k++) {
+        bmin[k] = cmin[k] = std::numeric_limits<float>::max();
+        bmax[k] = cmax[k] = -std::numeric_limits<float>::max();
+    }
+    for (int i = first; i < first + count; i++) {
+        const float* b = &bounds[6 * order[i]];
+        for (int k = 0; k < 3; k++) {
+            float c = 0.5f * (b[k] + b[3 + k]);
+            bmin[k] = std::min(bmin[k], b[k]);
+            bmax[k] = std::max(bmax[k], b[3 + k]);
+            cmin[k] = std::min(cmin[k], c);
+            cmax[k] = std::max(cmax[k], c);
+        }
+    }
+
+    for (int k = 0; k < 3; k++) {
+        m_nodes[node].bmin[k] = bmin[k];
+        m_nodes[node].bmax[k] = bmax[k];
+    }
+
+    // split along the direction of largest centroid extent
+    int axis = 0;
+    if (cmax[1] - cmin[1] > cmax[axis] - cmin[axis])
+        axis = 1;
+    if (cmax[2] - cmin[2] > cmax[axis] - cmin[axis])
+        axis = 2;
+
+    if (count <= max_leaf_size || cmax[axis] <= cmin[axis]) {
+        m_nodes[node].first = first;
+        m_nodes[node].count = count;
+        m_nodes[node].axis = axis;
+        return;
+    }
+
+    // median split (the children are stored in consecutive nodes)
+    int mid = first + count / 2;
+    std::nth_element(order.begin() + first, order.begin() + mid, order.begin() + first + count, [&](int a, int b) {
+        return bounds[6 * a + axis] + bounds[6 * a + 3 + axis] < bounds[6 * b + axis] + bounds[6 * b + 3 + axis];
+    });
+
+    int left = (int)m_nodes.size();
+    m_nodes.push_back(Node());
+    m_nodes.push_back(Node());
+    m_nodes[node].first = left;
+    m_nodes[node].count = 0;
+    m_nodes[node].axis = axis;
+
+    BuildNode(left, first, mid - first, bounds, order);
+    BuildNode(left + 1, mid, first + count - mid, bounds, order);
+}
+
+// -----------------------------------------------------------------------------
+// Ray tracing
+// -----------------------------------------------------------------------------
+
+void ChCPURayTracer::Trace(const std::vector<ChVector3f>& origins,
+                           const std::vector<ChVector3f>& directions,
+                           float tmin,
+                           float tmax,
+                           std::vector<float>& distances,
+                           std::vector<float>& cosines) const {
+    int num_rays = (int)origins.size();
+    distances.resize(num_rays);
+    cosines.resize(num_rays);
+    if (num_rays == 0)
+        return;
+
+    int num_packets = (num_rays + PACKET_SIZE - 1) / PACKET_SIZE;
+
+#pragma omp parallel for num_threads(m_num_threads) schedule(dynamic, 16)
+    for (int p = 0; p < num_packets; p++) {
+        RayPacket packet;
+        int start = p * PACKET_SIZE;
+
+        // load the packet; lanes past the last ray repeat it and are disabled by a negative distance bound
+        for (int k = 0; k < PACKET_SIZE; k++) {
+            int i = std::min(start + k, num_rays - 1);
+            for (int j = 0; j < 3; j++) {
+                packet.o[j][k] = origins[i][j];
+                packet.d[j][k] = directions[i][j];
+                packet.inv_d[j][k] = 1.0f / SafeDir(directions[i][j]);
+            }
+            packet.t[k] = (start + k < num_rays) ? tmax : -1.0f;
+            packet.cos[k] = 0;
+        }
+
+        if (!m_nodes.empty())
+            TracePacket(packet, tmin);
+
+        for (int k = 0; k < PACKET_SIZE && start + k < num_rays; k++) {
+            bool hit = packet.t[k] < tmax;
+            distances[start + k] = hit ? packet.t[k] : 0.f;
+            cosines[start + k] = hit ? packet.cos[k] : 0.f;
+        }
+    }
+}
+
+void ChCPURayTracer::TracePacket(RayPacket& packet, float tmin) const {
+    // the BVH depth is bounded by log2 of the number of primitives (median splits)
+    int stack[64];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const Node& node = m_nodes[stack[--top]];
+        if (!IntersectNode(node, packet, tmin))
+            continue;
+
+        if (node.count > 0) {
+            for (int i = node.first; i < node.first + node.count; i++) {
+                const PrimitiveRef& ref = m_refs[i];
+                switch (ref.type) {
+                    case PrimitiveType::TRIANGLE:
+                        IntersectTriangle(m_triangles[ref.index], packet, tmin);
+                        break;
+                    case PrimitiveType::SPHERE:
+                        IntersectSphere(m_spheres[ref.index], packet, tmin);
+                        break;
+                    case PrimitiveType::BOX:
+                        IntersectBox(m_boxes[ref.index], packet, tmin);
+                        break;
+                    case PrimitiveType::CYLINDER:
+                        IntersectCylinder(m_cylinders[ref.index], packet, tmin);
+                        break;
+                }
+            }
+        } else {
+            // visit the near child first, based on the direction of the first ray in the packet
+            if (packet.d[node.axis][0] > 0) {
+                stack[top++] = node.first + 1;
+                stack[top++] = node.first;
+            } else {
+                stack[top++] = node.first;
+                stack[top++] = node.first + 1;
+            }
+        }
+    }
+}
+
+bool ChCPURayTracer::IntersectNode(const Node& node, const RayPacket& packet, float tmin) const {
+    int any_hit = 0;
+    for (int k = 0; k < PACKET_SIZE; k++) {
+        float tx0 = (node.bmin[0] - packet.o[0][k]) * packet.inv_d[0][k];
+        float tx1 = (node.bmax[0] - packet.o[0][k]) * packet.inv_d[0][k];
+        float ty0 = (node.bmin[1] - packet.o[1][k]) * packet.inv_d[1][k];
+        float ty1 = (node.bmax[1] - packet.o[1][k]) * packet.inv_d[1][k];
+        float tz0 = (node.bmin[2] - packet.o[2][k]) * packet.inv_d[2][k];
+        float tz1 = (node.bmax[2] - packet.o[2][k]) * packet.inv_d[2][k];
+        float tnear = std::max(std::max(std::min(tx0, tx1), std::min(ty0, ty1)), std::min(tz0, tz1));
+        float tfar = std::min(std::min(std::max(tx0, tx1), std::max(ty0, ty1)), std::max(tz0, tz1));
+        any_hit |= (tnear <= tfar) & (tfar >= tmin) & (tnear < packet.t[k]);
+    }
+    return any_hit != 0;
+}
+
+void ChCPURayTracer::IntersectTriangle(const Triangle& tri, RayPacket& packet, float tmin) const {
+    // Moller-Trumbore intersection
+    for (int k = 0; k < PACKET_SIZE; k++) {
+        float dx = packet.d[0][k];
+        float dy = packet.d[1][k];
+        float dz = packet.d[2][k];
+
+        float px = dy * tri.e2[2] - dz * tri.e2[1];
+        float py = dz * tri.e2[0] - dx * tri.e2[2];
+        float pz = dx * tri.e2[1] - dy * tri.e2[0];
+        float det = tri.e1[0] * px + tri.e1[1] * py + tri.e1[2] * pz;
+        float inv_det = 1.0f / SafeDir(det);
+
+        float sx = packet.o[0][k] - tri.v0[0];
+        float sy = packet.o[1][k] - tri.v0[1];
+        float sz = packet.o[2][k] - tri.v0[2];
+        float u = (sx * px + sy * py + sz * pz) * inv_det;
+
+        float qx = sy * tri.e1[2] - sz * tri.e1[1];
+        float qy = sz * tri.e1[0] - sx * tri.e1[2];
+        float qz = sx * tri.e1[1] - sy * tri.e1[0];
+        float v = (dx * qx + dy * qy + dz * qz) * inv_det;
+        float t = (tri.e2[0] * qx + tri.e2[1] * qy + tri.e2[2] * qz) * inv_det;
+
+        bool hit = (std::abs(det) > 1e-20f) & (u >= 0) & (v >= 0) & (u + v <= 1) & (t > tmin) & (t < packet.t[k]);
+        float c = std::abs(dx * tri.n[0] + dy * tri.n[1] + dz * tri.n[2]);
+
+        packet.t[k] = hit ? t : packet.t[k];
+        packet.cos[k] = hit ? c : packet.cos[k];
+    }
+}
+
+void ChCPURayTracer::IntersectSphere(const Sphere& sph, RayPacket& packet, float tmin) const {
+    float inv_r = 1.0f / sph.r;
+    for (int k = 0; k < PACKET_SIZE; k++) {
+        float ox = packet.o[0][k] - sph.c[0];
+        float oy = packet.o[1][k] - sph.c[1];
+        float oz = packet.o[2][k] - sph.c[2];
+        float dx = packet.d[0][k];
+        float dy = packet.d[1][k];
+        float dz = packet.d[2][k];
+
+        float b = ox * dx + oy * dy + oz * dz;
+        float c = ox * ox + oy * oy + oz * oz - sph.r * sph.r;
+        float disc = b * b - c;
+        float sq = std::sqrt(std::max(disc, 0.0f));
+        float t0 = -b - sq;
+        float t1 = -b + sq;
+        float t = (t0 > tmin) ? t0 : t1;
+
+        bool hit = (disc >= 0) & (t > tmin) & (t < packet.t[k]);
+        float cs = std::abs(((ox + t * dx) * dx + (oy + t * dy) * dy + (oz + t * dz) * dz) * inv_r);
+
+        packet.t[k] = hit ? t : packet.t[k];
+        packet.cos[k] = hit ? cs : packet.cos[k];
+    }
+}
+
+void ChCPURayTracer::IntersectBox(const LocalShape& box, RayPacket& packet, float tmin) const {
+    float inv_h[3];
+    for (int j = 0; j < 3; j++)
+        inv_h[j] = 1.0f / std::max(box.h[j], 1e-12f);
+
+    for (int k = 0; k < PACKET_SIZE; k++) {
+        // ray in the box frame
+        float ox = packet.o[0][k] - box.p[0];
+        float oy = packet.o[1][k] - box.p[1];
+        float oz = packet.o[2][k] - box.p[2];
+        float lo[3], ld[3];
+        for (int j = 0; j < 3; j++) {
+            lo[j] = box.R[3 * j] * ox + box.R[3 * j + 1] * oy + box.R[3 * j + 2] * oz;
+            ld[j] = box.R[3 * j] * packet.d[0][k] + box.R[3 * j + 1] * packet.d[1][k] +
+                    box.R[3 * j + 2] * packet.d[2][k];
+        }
+
+        // slab test
+        float tnear = -std::numeric_limits<float>::max();
+        float tfar = std::numeric_limits<float>::max();
+        for (int j = 0; j < 3; j++) {
+            float inv = 1.0f / SafeDir(ld[j]);
+            float t0 = (-box.h[j] - lo[j]) * inv;
+            float t1 = (box.h[j] - lo[j]) * inv;
+            tnear = std::max(tnear, std::min(t0, t1));
+            tfar = std::min(tfar, std::max(t0, t1));
+        }
+        float t = (tnear > tmin) ? tnear : tfar;
+
+        bool hit = (tnear <= tfar) & (t > tmin) & (t < packet.t[k]);
+
+        // the face normal is along the direction with the largest normalized coordinate of the hit point
+        float ax = std::abs(lo[0] + t * ld[0]) * inv_h[0];
+        float ay = std::abs(lo[1] + t * ld[1]) * inv_h[1];
+        float az = std::abs(lo[2] + t * ld[2]) * inv_h[2];
+        float c = (ax >= ay && ax >= az) ? std::abs(ld[0]) : ((ay >= az) ? std::abs(ld[1]) : std::abs(ld[2]));
+
+        packet.t[k] = hit ? t : packet.t[k];
+        packet.cos[k] = hit ? c : packet.cos[k];
+    }
+}
+
+void ChCPURayTracer::IntersectCylinder(const LocalShape& cyl, RayPacket& packet, float tmin) const {
+    const float no_hit = std::numeric_limits<float>::max();
+    float r = cyl.h[0];
+    float hh = cyl.h[2];
+    float inv_r = 1.0f / r;
+
+    for (int k = 0; k < PACKET_SIZE; k++) {
+        // ray in the cylinder frame
+        float ox = packet.o[0][k] - cyl.p[0];
+        float oy = packet.o[1][k] - cyl.p[1];
+        float oz = packet.o[2][k] - cyl.p[2];
+        float lo[3], ld[3];
+        for (int j = 0; j < 3; j++) {
+            lo[j] = cyl.R[3 * j] * ox + cyl.R[3 * j + 1] * oy + cyl.R[3 * j + 2] * oz;
+            ld[j] = cyl.R[3 * j] * packet.d[0][k] + cyl.R[3 * j + 1] * packet.d[1][k] +
+                    cyl.R[3 * j + 2] * packet.d[2][k];
+        }
+
+        // lateral surface
+        float a = ld[0] * ld[0] + ld[1] * ld[1];
+        float b = lo[0] * ld[0] + lo[1] * ld[1];
+        float c = lo[0] * lo[0] + lo[1] * lo[1] - r * r;
+        float disc = b * b - a * c;
+        float sq = std::sqrt(std::max(disc, 0.0f));
+        float inv_a = 1.0f / std::max(a, 1e-20f);
+        float ts0 = (-b - sq) * inv_a;
+        float ts1 = (-b + sq) * inv_a;
+        bool side = (disc >= 0) & (a > 1e-20f);
+        bool vs0 = side & (ts0 > tmin) & (std::abs(lo[2] + ts0 * ld[2]) <= hh);
+        bool vs1 = side & (ts1 > tmin) & (std::abs(lo[2] + ts1 * ld[2]) <= hh);
+        float t_side = vs0 ? ts0 : (vs1 ? ts1 : no_hit);
+        float xs = lo[0] + t_side * ld[0];
+        float ys = lo[1] + t_side * ld[1];
+        float c_side = std::abs((xs * ld[0] + ys * ld[1]) * inv_r);
+
+        // end caps
+        float inv_z = 1.0f / SafeDir(ld[2]);
+        float tc0 = (-hh - lo[2]) * inv_z;
+        float tc1 = (hh - lo[2]) * inv_z;
+        float x0 = lo[0] + tc0 * ld[0];
+        float y0 = lo[1] + tc0 * ld[1];
+        float x1 = lo[0] + tc1 * ld[0];
+        float y1 = lo[1] + tc1 * ld[1];
+        bool vc0 = (tc0 > tmin) & (x0 * x0 + y0 * y0 <= r * r);
+        bool vc1 = (tc1 > tmin) & (x1 * x1 + y1 * y1 <= r * r);
+        float t_cap = std::min(vc0 ? tc0 : no_hit, vc1 ? tc1 : no_hit);
+
+        float t = std::min(t_side, t_cap);
+        float cs = (t_side <= t_cap) ? c_side : std::abs(ld[2]);
+        bool hit = (t < packet.t[k]);
+
+        packet.t[k] = hit ? t : packet.t[k];
+        packet.cos[k] = hit ? cs : packet.cos[k];
+    }
+}
+
+}  // namespace sensor
+}  // namespace chrono
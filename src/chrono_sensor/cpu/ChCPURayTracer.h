@@ -0,0 +1,202 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Asher Elmquist
+// =============================================================================
+//
+// CPU ray tracer (BVH over visual shapes, packet traversal)
+//
+// =============================================================================
+
+#ifndef CHCPURAYTRACER_H
+#define CHCPURAYTRACER_H
+
+#include <vector>
+
+#include "chrono_sensor/ChApiSensor.h"
+
+#include "chrono/core/ChFrame.h"
+#include "chrono/assets/ChVisualModel.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_cpu
+/// @{
+
+/// CPU ray tracer used by the CPU sensors (ChCPULidarSensor, ChCPUDepthCamera).
+/// The scene is assembled from the visual models of all bodies and other physics items of a Chrono system. Spheres,
+/// boxes, and cylinders are kept as analytic primitives; triangle meshes (rigid or deformable) are added as world-space
+/// triangles. A bounding volume hierarchy (BVH) is built over all primitives and rays are traced in packets of
+/// PACKET_SIZE coherent rays, with the per-ray work written as fixed-length loops over the packet lanes so that it can
+/// be vectorized by the compiler. Packets are distributed over OpenMP threads.
+class CH_SENSOR_API ChCPURayTracer {
+  public:
+    /// Number of rays traversing the BVH together.
+    static const int PACKET_SIZE = 8;
+
+    ChCPURayTracer();
+    ~ChCPURayTracer() {}
+
+    /// Set the number of OpenMP threads used for tracing (default: number of processors).
+    void SetNumThreads(int num_threads);
+
+    /// Return the number of OpenMP threads used for tracing.
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Set the origin with respect to which all primitives are stored and all rays are expressed (default: 0).
+    /// Placing the origin near the sensor preserves single-precision accuracy far from the absolute origin.
+    /// Must be called before adding primitives.
+    void SetOriginOffset(const ChVector3d& origin) { m_origin = origin; }
+
+    /// Return the current origin offset.
+    const ChVector3d& GetOriginOffset() const { return m_origin; }
+
+    /// Remove all primitives from the scene.
+    void Clear();
+
+    /// Add a sphere with given center and radius.
+    void AddSphere(const ChVector3d& center, double radius);
+
+    /// Add a box with given half-lengths, centered at the specified frame.
+    void AddBox(const ChFrame<>& frame, const ChVector3d& hlen);
+
+    /// Add a cylinder with given radius and height, centered at the specified frame and aligned with its Z axis.
+    void AddCylinder(const ChFrame<>& frame, double radius, double height);
+
+    /// Add a triangle with the given vertices.
+    void AddTriangle(const ChVector3d& v0, const ChVector3d& v1, const ChVector3d& v2);
+
+    /// Add all faces of a triangle mesh, after scaling its vertices and expressing them in the specified frame.
+    void AddMesh(const ChTriangleMeshConnected& mesh, const ChFrame<>& frame, const ChVector3d& scale);
+
+    /// Add all visible (and supported) shapes of a visual model, placed at the specified frame.
+    void AddVisualModel(const ChVisualModel& model, const ChFrame<>& frame);
+
+    /// Add the visual models of all bodies and other physics items in the given system.
+    void AddSystem(ChSystem* sys);
+
+    /// Build the BVH over all primitives currently in the scene.
+    /// Must be called after any modification of the scene and before tracing.
+    void Build();
+
+    /// Update the BVH node bounds for the current primitive positions, without changing the BVH topology.
+    void Refit();
+
+    /// Update the scene from the current state of the given system.
+    /// If the system provides the same number of primitives as at the last BVH build, the primitives are replaced in
+    /// their current BVH leaves and the BVH is refit; the BVH is rebuilt if the refit quality degrades too much (large
+    /// increase of the total node surface area) or if the number of primitives changed.
+    void BuildScene(ChSystem* sys);
+
+    /// Return the number of primitives in the scene.
+    size_t GetNumPrimitives() const { return m_refs.size(); }
+
+    /// Return the number of BVH nodes.
+    size_t GetNumNodes() const { return m_nodes.size(); }
+
+    /// Trace a set of rays with given origins (relative to the origin offset) and unit directions.
+    /// For each ray, the distance to the closest intersection in [tmin, tmax] and the absolute value of the cosine
+    /// between the ray direction and the surface normal at that point are returned. Both are set to 0 if no
+    /// intersection is found.
+    void Trace(const std::vector<ChVector3f>& origins,
+               const std::vector<ChVector3f>& directions,
+               float tmin,
+               float tmax,
+               std::vector<float>& distances,
+               std::vector<float>& cosines) const;
+
+  private:
+    enum class PrimitiveType { TRIANGLE, SPHERE, BOX, CYLINDER };
+
+    /// Reference to a primitive of the given type.
+    struct PrimitiveRef {
+        PrimitiveType type;
+        int index;
+    };
+
+    /// Triangle with vertex, edge vectors, and unit normal.
+    struct Triangle {
+        float v0[3];
+        float e1[3];
+        float e2[3];
+        float n[3];
+    };
+
+    /// Sphere with center and radius.
+    struct Sphere {
+        float c[3];
+        float r;
+    };
+
+    /// Box or cylinder, stored with its absolute-to-local rotation, center, and half-dimensions.
+    /// For a cylinder, the half-dimensions are (radius, radius, height/2).
+    struct LocalShape {
+        float R[9];
+        float p[3];
+        float h[3];
+    };
+
+    /// BVH node. For a leaf, 'first' is the index of its first primitive reference and count > 0.
+    /// For an internal node, 'first' is the index of its left child (the right child is the next node), count = 0,
+    /// and 'axis' is the split direction.
+    struct Node {
+        float bmin[3];
+        float bmax[3];
+        int first;
+        int count;
+        int axis;
+    };
+
+    /// Packet of rays, in SoA layout.
+    struct RayPacket {
+        float o[3][PACKET_SIZE];
+        float d[3][PACKET_SIZE];
+        float inv_d[3][PACKET_SIZE];
+        float t[PACKET_SIZE];    ///< distance to closest intersection so far
+        float cos[PACKET_SIZE];  ///< cosine of incidence angle at closest intersection so far
+    };
+
+    LocalShape MakeLocalShape(const ChFrame<>& frame, const ChVector3d& h) const;
+    void GetBounds(const PrimitiveRef& ref, float* bmin, float* bmax) const;
+    void ClearPrimitives();
+    void BuildNode(int node, int first, int count, const std::vector<float>& bounds, std::vector<int>& order);
+    double CalcTreeArea() const;
+
+    void TracePacket(RayPacket& packet, float tmin) const;
+    bool IntersectNode(const Node& node, const RayPacket& packet, float tmin) const;
+    void IntersectTriangle(const Triangle& tri, RayPacket& packet, float tmin) const;
+    void IntersectSphere(const Sphere& sph, RayPacket& packet, float tmin) const;
+    void IntersectBox(const LocalShape& box, RayPacket& packet, float tmin) const;
+    void IntersectCylinder(const LocalShape& cyl, RayPacket& packet, float tmin) const;
+
+    int m_num_threads;    ///< number of OpenMP threads
+    ChVector3d m_origin;  ///< origin offset of the scene
+
+    std::vector<Triangle> m_triangles;    ///< triangle primitives
+    std::vector<Sphere> m_spheres;        ///< sphere primitives
+    std::vector<LocalShape> m_boxes;      ///< box primitives
+    std::vector<LocalShape> m_cylinders;  ///< cylinder primitives
+
+    std::vector<PrimitiveRef> m_refs;  ///< primitive references, ordered by BVH leaf
+    std::vector<int> m_order;          ///< for each BVH leaf slot, the order in which its primitive was added
+    std::vector<Node> m_nodes;         ///< BVH nodes (root is the first node)
+    double m_build_area;               ///< total surface area of the BVH nodes at the last build
+};
+
+/// @} sensor_cpu
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
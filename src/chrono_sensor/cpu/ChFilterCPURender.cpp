@@ -0,0 +1,156 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Asher Elmquist
+// =============================================================================
+//
+// Filter generating the data of a CPU sensor with the CPU ray tracer
+//
+// =============================================================================
+
+#include "chrono_sensor/cpu/ChFilterCPURender.h"
+#include "chrono_sensor/sensors/ChCPULidarSensor.h"
+#include "chrono_sensor/sensors/ChCPUDepthCamera.h"
+
+#include "chrono/utils/ChConstants.h"
+
+namespace chrono {
+namespace sensor {
+
+ChFilterCPURender::ChFilterCPURender() : ChFilter("CPU Renderer") {}
+
+CH_SENSOR_API void ChFilterCPURender::Initialize(std::shared_ptr<ChSensor> pSensor,
+                                                 std::shared_ptr<SensorBuffer>& bufferInOut) {
+    if (bufferInOut) {
+        throw std::runtime_error("CPU render filter must be applied first in filter graph");
+    }
+    m_cpuSensor = std::dynamic_pointer_cast<ChCPUSensor>(pSensor);
+    if (!m_cpuSensor) {
+        InvalidFilterGraphSensorTypeMismatch(pSensor);
+    }
+
+    unsigned int w = m_cpuSensor->GetWidth();
+    unsigned int h = m_cpuSensor->GetHeight();
+    m_local_dirs.resize(w * h);
+
+    if (auto lidar = std::dynamic_pointer_cast<ChCPULidarSensor>(pSensor)) {
+        // same beam layout as the OptiX lidar: columns sweep the horizontal field of view, rows the vertical channels
+        m_lidarSensor = lidar;
+        float hfov = lidar->GetHFOV();
+        float min_vert = lidar->GetMinVertAngle();
+        float max_vert = lidar->GetMaxVertAngle();
+        for (unsigned int y = 0; y < h; y++) {
+            float phi = (float)y / (float)(std::max(1u, h - 1)) * (max_vert - min_vert) + min_vert;
+            for (unsigned int x = 0; x < w; x++) {
+                float theta = (float)x / (float)(std::max(1u, w - 1)) * hfov - hfov / 2;
+                m_local_dirs[w * y + x] = {cosf(phi) * cosf(theta), cosf(phi) * sinf(theta), sinf(phi)};
+            }
+        }
+
+        m_bufferDI = chrono_types::make_shared<SensorHostDIBuffer>();
+        m_bufferDI->Buffer = std::shared_ptr<PixelDI[]>(new PixelDI[w * h]);
+        m_bufferDI->Width = w;
+        m_bufferDI->Height = h;
+        m_bufferDI->LaunchedCount = m_cpuSensor->GetNumLaunches();
+        m_bufferDI->TimeStamp = 0.f;
+        bufferInOut = m_bufferDI;
+    } else if (auto cam = std::dynamic_pointer_cast<ChCPUDepthCamera>(pSensor)) {
+        // pinhole projection, same as the OptiX depth camera (x forward, y left, z up)
+        float h_factor = cam->GetHFOV() / (float)CH_PI * 2;
+        for (unsigned int y = 0; y < h; y++) {
+            float dy = ((y + 0.5f) / h * 2 - 1) * ((float)h / (float)w);
+            for (unsigned int x = 0; x < w; x++) {
+                float dx = (x + 0.5f) / w * 2 - 1;
+                m_local_dirs[w * y + x] = ChVector3f(1.f, -dx * h_factor, dy * h_factor).GetNormalized();
+            }
+        }
+
+        m_bufferDepth = chrono_types::make_shared<SensorHostDepthBuffer>();
+        m_bufferDepth->Buffer = std::shared_ptr<PixelDepth[]>(new PixelDepth[w * h]);
+        m_bufferDepth->Width = w;
+        m_bufferDepth->Height = h;
+        m_bufferDepth->LaunchedCount = m_cpuSensor->GetNumLaunches();
+        m_bufferDepth->TimeStamp = 0.f;
+        bufferInOut = m_bufferDepth;
+    } else {
+        InvalidFilterGraphSensorTypeMismatch(pSensor);
+    }
+
+    m_origins.resize(w * h);
+    m_directions.resize(w * h);
+}
+
+CH_SENSOR_API void ChFilterCPURender::Apply() {
+    ChSystem* sys = m_cpuSensor->GetParent()->GetSystem();
+    unsigned int w = m_cpuSensor->GetWidth();
+    unsigned int h = m_cpuSensor->GetHeight();
+
+    // sensor poses at the start and end of the collection window
+    const auto& keyframes = m_cpuSensor->m_keyframes;
+    ChFrame<double> start_pose = keyframes.empty()
+                                     ? m_cpuSensor->GetParent()->GetVisualModelFrame() * m_cpuSensor->GetOffsetPose()
+                                     : keyframes.front();
+    ChFrame<double> end_pose = keyframes.empty() ? start_pose : keyframes.back();
+
+    // shift the scene so that single precision rays stay accurate far away from the absolute origin
+    m_tracer.SetOriginOffset(end_pose.GetPos());
+    m_tracer.SetNumThreads(m_cpuSensor->GetNumThreads());
+    m_tracer.BuildScene(sys);
+
+    if (m_lidarSensor) {
+        // each column is interpolated between the start and end poses, as the beams sweep through the scan
+        ChQuaterniond q0 = start_pose.GetRot();
+        ChQuaterniond q1 = end_pose.GetRot();
+        if (q0.Dot(q1) < 0)
+            q1 = -q1;
+        ChVector3d p0 = start_pose.GetPos() - end_pose.GetPos();
+
+#pragma omp parallel for num_threads(m_cpuSensor->GetNumThreads())
+        for (int x = 0; x < (int)w; x++) {
+            double t_frac = (double)x / (double)w;
+            ChMatrix33<> R((q0 * (1 - t_frac) + q1 * t_frac).GetNormalized());
+            ChVector3f origin(p0 * (1 - t_frac));
+            for (unsigned int y = 0; y < h; y++) {
+                m_origins[w * y + x] = origin;
+                m_directions[w * y + x] = ChVector3f(R * ChVector3d(m_local_dirs[w * y + x]));
+            }
+        }
+
+        float tmax = 1.5f * m_lidarSensor->GetMaxDistance();
+        m_tracer.Trace(m_origins, m_directions, m_lidarSensor->GetClipNear(), tmax, m_distances, m_cosines);
+
+        PixelDI* buf = m_bufferDI->Buffer.get();
+        for (unsigned int i = 0; i < w * h; i++) {
+            buf[i].range = m_distances[i];
+            buf[i].intensity = m_cosines[i];
+        }
+        m_bufferDI->LaunchedCount = m_cpuSensor->GetNumLaunches();
+        m_bufferDI->TimeStamp = (float)sys->GetChTime();
+    } else {
+        ChMatrix33<> R = end_pose.GetRotMat();
+        for (unsigned int i = 0; i < w * h; i++) {
+            m_origins[i] = ChVector3f(0, 0, 0);
+            m_directions[i] = ChVector3f(R * ChVector3d(m_local_dirs[i]));
+        }
+
+        m_tracer.Trace(m_origins, m_directions, 1e-3f, 1e16f, m_distances, m_cosines);
+
+        PixelDepth* buf = m_bufferDepth->Buffer.get();
+        for (unsigned int i = 0; i < w * h; i++) {
+            buf[i].depth = m_distances[i];
+        }
+        m_bufferDepth->LaunchedCount = m_cpuSensor->GetNumLaunches();
+        m_bufferDepth->TimeStamp = (float)sys->GetChTime();
+    }
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,78 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Asher Elmquist
+// =============================================================================
+//
+// Filter generating the data of a CPU sensor with the CPU ray tracer
+//
+// =============================================================================
+
+#ifndef CHFILTERCPURENDER_H
+#define CHFILTERCPURENDER_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono_sensor/filters/ChFilter.h"
+#include "chrono_sensor/cpu/ChCPURayTracer.h"
+
+namespace chrono {
+namespace sensor {
+
+// forward declaration
+class ChSensor;
+class ChCPUSensor;
+class ChCPULidarSensor;
+
+/// @addtogroup sensor_cpu
+/// @{
+
+/// Filter that renders the data of a CPU sensor (ChCPULidarSensor or ChCPUDepthCamera) on the host. It must be the
+/// first filter in the graph and is added automatically by ChCPUSensor. Its output is a depth-intensity buffer for
+/// lidars and a depth buffer for depth cameras, both in host memory, which can be processed by the host paths of the
+/// lidar noise, point cloud, and access filters.
+class CH_SENSOR_API ChFilterCPURender : public ChFilter {
+  public:
+    /// Class constructor
+    ChFilterCPURender();
+
+    /// Apply function. Rebuilds (or refits) the scene BVH and traces all sensor rays.
+    virtual void Apply();
+
+    /// Initializes all data needed by the filter access apply function.
+    /// @param pSensor A pointer to the sensor.
+    /// @param bufferInOut pointer to the process buffer
+    virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
+
+    /// Access the ray tracer used by this filter.
+    ChCPURayTracer& GetRayTracer() { return m_tracer; }
+
+  private:
+    std::shared_ptr<ChCPUSensor> m_cpuSensor;              ///< the sensor this filter renders
+    std::shared_ptr<ChCPULidarSensor> m_lidarSensor;       ///< the sensor, if it is a lidar
+    std::shared_ptr<SensorHostDIBuffer> m_bufferDI;        ///< output buffer for lidars
+    std::shared_ptr<SensorHostDepthBuffer> m_bufferDepth;  ///< output buffer for depth cameras
+
+    ChCPURayTracer m_tracer;               ///< BVH and ray tracer over the scene visual shapes
+    std::vector<ChVector3f> m_local_dirs;  ///< ray directions in the sensor frame
+    std::vector<ChVector3f> m_origins;     ///< ray origins, relative to the tracer origin offset
+    std::vector<ChVector3f> m_directions;  ///< ray directions in the absolute frame
+    std::vector<float> m_distances;        ///< traced distances
+    std::vector<float> m_cosines;          ///< cosine of the incidence angle of each ray
+};
+
+/// @} sensor_cpu
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
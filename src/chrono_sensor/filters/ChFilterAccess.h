@@ -17,14 +17,18 @@
 #ifndef CHFILTERACCESS_H
 #define CHFILTERACCESS_H
 
+#include <cmath>
 #include <functional>
+#include <iostream>
 #include <memory>
 #include <queue>
 #include <stack>
 #include <mutex>
 #include "chrono_sensor/sensors/ChSensorBuffer.h"
 #include "chrono_sensor/filters/ChFilter.h"
-#include "chrono_sensor/sensors/ChOptixSensor.h"
+#ifdef CHRONO_HAS_OPTIX
+    #include "chrono_sensor/sensors/ChOptixSensor.h"
+#endif
 #include "chrono/physics/ChSystem.h"
 
 #include <typeinfo>
@@ -69,9 +73,15 @@ class CH_SENSOR_API ChFilterAccess : public ChFilter {
             InvalidFilterGraphBufferTypeMismatch(pSensor);
         }
 
+        // only OptiX sensors produce device-side buffers; CPU sensors fill host buffers directly
+        m_host_input = true;
+#ifdef CHRONO_HAS_OPTIX
+        m_cuda_stream = nullptr;
         if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
             m_cuda_stream = pOpx->GetCudaStream();
+            m_host_input = false;
         }
+#endif
 
         m_sensor = pSensor;  // save handle to the parent sensor (weak ptr to not cause loop dependency)
         m_max_lag_buffers = 1 + (unsigned int)std::ceil((pSensor->GetLag() + pSensor->GetCollectionWindow()) *
@@ -122,7 +132,10 @@ class CH_SENSOR_API ChFilterAccess : public ChFilter {
     UserBufferType m_user_buffer;            ///< buffer that can be returned
     std::weak_ptr<ChSensor> m_sensor;        ///< pointer to the sensor to which this filter is attached
     std::shared_ptr<BufferType> m_bufferIn;  ///< shared pointer to the buffer coming in
-    CUstream m_cuda_stream;                  ///< reference to the cuda stream for device-side buffers
+#ifdef CHRONO_HAS_OPTIX
+    CUstream m_cuda_stream;  ///< reference to the cuda stream for device-side buffers
+#endif
+    bool m_host_input;                       ///< true if the incoming buffer lives in host memory
 
     std::queue<std::shared_ptr<BufferType>>
         m_lag_buffers;  ///< buffers that are time stamped and held until past their lag time
@@ -15,11 +15,15 @@
 // =============================================================================
 
 #include "chrono_sensor/filters/ChFilterLidarNoise.h"
-#include "chrono_sensor/sensors/ChOptixSensor.h"
-#include "chrono_sensor/cuda/lidar_noise.cuh"
-#include "chrono_sensor/cuda/curand_utils.cuh"
-#include "chrono_sensor/utils/CudaMallocHelper.h"
+#include "chrono_sensor/sensors/ChCPULidarSensor.h"
+#ifdef CHRONO_HAS_OPTIX
+    #include "chrono_sensor/sensors/ChOptixSensor.h"
+    #include "chrono_sensor/cuda/lidar_noise.cuh"
+    #include "chrono_sensor/cuda/curand_utils.cuh"
+    #include "chrono_sensor/utils/CudaMallocHelper.h"
+#endif
 #include <chrono>
+#include <cmath>
 
 namespace chrono {
 namespace sensor {
@@ -45,22 +49,61 @@ void ChFilterLidarNoiseXYZI::Initialize(std::shared_ptr<ChSensor> pSensor, std::
     }
     m_bufferInOut = pXYZI;
 
+    if (std::dynamic_pointer_cast<ChCPULidarSensor>(pSensor)) {
+        m_host_input = true;
+        m_host_rng =
+            std::minstd_rand((unsigned int)(std::chrono::high_resolution_clock::now().time_since_epoch().count()));
+        return;
+    }
+
+#ifdef CHRONO_HAS_OPTIX
     if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
         m_cuda_stream = pOpx->GetCudaStream();
-    } else {
-        InvalidFilterGraphSensorTypeMismatch(pSensor);
+        m_host_input = false;
+        unsigned int num_rng = m_bufferInOut->Width * m_bufferInOut->Height;
+        m_rng = std::shared_ptr<curandState_t>(cudaMallocHelper<curandState_t>(num_rng), cudaFreeHelper<curandState_t>);
+        init_cuda_rng((unsigned int)(std::chrono::high_resolution_clock::now().time_since_epoch().count()),
+                      m_rng.get(), num_rng);
+        return;
     }
+#endif
 
-    m_rng = std::shared_ptr<curandState_t>(
-        cudaMallocHelper<curandState_t>(m_bufferInOut->Width * m_bufferInOut->Height), cudaFreeHelper<curandState_t>);
-    init_cuda_rng((unsigned int)(std::chrono::high_resolution_clock::now().time_since_epoch().count()), m_rng.get(),
-                  m_bufferInOut->Width * m_bufferInOut->Height);
+    InvalidFilterGraphSensorTypeMismatch(pSensor);
 }
 
 void ChFilterLidarNoiseXYZI::Apply() {
+    if (m_host_input) {
+        // same noise model as the device kernel, applied to the compacted host point cloud
+        std::normal_distribution<float> dist(0.f, 1.f);
+        PixelXYZI* buf = m_bufferInOut->Buffer.get();
+        for (unsigned int k = 0; k < m_bufferInOut->Beam_return_count; k++) {
+            PixelXYZI& p = buf[k];
+            float range = sqrtf(p.x * p.x + p.y * p.y + p.z * p.z);
+            if (p.intensity > 1e-6f && range > 1e-6f) {
+                float phi = asinf(p.z / (range + 1e-6f));
+                float theta = acosf(p.x / ((range + 1e-6f) * cosf(phi)));
+                if (p.y < 0)
+                    theta = -theta;
+
+                range += dist(m_host_rng) * m_stdev_range;
+                theta += dist(m_host_rng) * m_stdev_h_angle;
+                phi += dist(m_host_rng) * m_stdev_v_angle;
+                float i = p.intensity + dist(m_host_rng) * m_stdev_intensity;
+
+                p.x = cosf(theta) * cosf(phi) * range;
+                p.y = sinf(theta) * cosf(phi) * range;
+                p.z = sinf(phi) * range;
+                p.intensity = i > 0 ? i : 0;
+            }
+        }
+        return;
+    }
+
+#ifdef CHRONO_HAS_OPTIX
     cuda_lidar_noise_normal((float*)m_bufferInOut->Buffer.get(), (int)m_bufferInOut->Width, (int)m_bufferInOut->Height,
                             m_stdev_range, m_stdev_v_angle, m_stdev_h_angle, m_stdev_intensity, m_rng.get(),
                             m_cuda_stream);
+#endif
 }
 
 }  // namespace sensor
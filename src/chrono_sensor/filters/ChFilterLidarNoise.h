@@ -19,9 +19,13 @@
 
 #include "chrono_sensor/filters/ChFilter.h"
 
-#include <cuda.h>
-#include <curand.h>
-#include <curand_kernel.h>
+#include <random>
+
+#ifdef CHRONO_HAS_OPTIX
+    #include <cuda.h>
+    #include <curand.h>
+    #include <curand_kernel.h>
+#endif
 
 namespace chrono {
 namespace sensor {
@@ -29,7 +33,8 @@ namespace sensor {
 /// @addtogroup sensor_filters
 /// @{
 
-/// A filter that adds noise based on depth and intensity given data in point cloud format
+/// A filter that adds noise based on depth and intensity given data in point cloud format.
+/// Noise is generated on the device for OptiX lidars and on the host for CPU lidars (ChCPULidarSensor).
 class CH_SENSOR_API ChFilterLidarNoiseXYZI : public ChFilter {
   public:
     /// Class constructor
@@ -57,9 +62,13 @@ class CH_SENSOR_API ChFilterLidarNoiseXYZI : public ChFilter {
     float m_stdev_v_angle;    ///< Standard deviation of the normal distribution applied to the vertical angle
     float m_stdev_h_angle;    ///< Standard deviation of the normal distribution applied to the horizontal angle
     float m_stdev_intensity;  ///< Standard deviation of the normal distribution applied to the intensity measurement
-    std::shared_ptr<curandState_t> m_rng;                   ///< cuda random number generator
+#ifdef CHRONO_HAS_OPTIX
+    std::shared_ptr<curandState_t> m_rng;  ///< cuda random number generator
+    CUstream m_cuda_stream;                ///< reference to the cuda stream
+#endif
     std::shared_ptr<SensorDeviceXYZIBuffer> m_bufferInOut;  ///< buffer for applying noise to point cloud
-    CUstream m_cuda_stream;                                 ///< reference to the cuda stream
+    bool m_host_input;                                      ///< true if the point cloud lives in host memory
+    std::minstd_rand m_host_rng;                            ///< random number generator for host buffers
 };
 
 /// @}
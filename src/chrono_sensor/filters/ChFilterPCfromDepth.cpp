@@ -15,9 +15,12 @@
 // =============================================================================
 
 #include "chrono_sensor/filters/ChFilterPCfromDepth.h"
-#include "chrono_sensor/sensors/ChLidarSensor.h"
-#include "chrono_sensor/cuda/pointcloud.cuh"
-#include "chrono_sensor/utils/CudaMallocHelper.h"
+#include "chrono_sensor/sensors/ChCPULidarSensor.h"
+#ifdef CHRONO_HAS_OPTIX
+    #include "chrono_sensor/sensors/ChLidarSensor.h"
+    #include "chrono_sensor/cuda/pointcloud.cuh"
+    #include "chrono_sensor/utils/CudaMallocHelper.h"
+#endif
 
 // #include <cuda_runtime_api.h>
 
@@ -32,21 +35,35 @@ CH_SENSOR_API void ChFilterPCfromDepth::Initialize(std::shared_ptr<ChSensor> pSe
         InvalidFilterGraphNullBuffer(pSensor);
     if (!(m_buffer_in = std::dynamic_pointer_cast<SensorDeviceDIBuffer>(bufferInOut)))
         InvalidFilterGraphBufferTypeMismatch(pSensor);
-    if (auto pLidar = std::dynamic_pointer_cast<ChLidarSensor>(pSensor)) {
+    if (auto pCPULidar = std::dynamic_pointer_cast<ChCPULidarSensor>(pSensor)) {
+        m_hFOV = pCPULidar->GetHFOV();
+        m_min_vert_angle = pCPULidar->GetMinVertAngle();
+        m_max_vert_angle = pCPULidar->GetMaxVertAngle();
+        m_host_input = true;
+#ifdef CHRONO_HAS_OPTIX
+    } else if (auto pLidar = std::dynamic_pointer_cast<ChLidarSensor>(pSensor)) {
         m_hFOV = pLidar->GetHFOV();
         m_min_vert_angle = pLidar->GetMinVertAngle();
         m_max_vert_angle = pLidar->GetMaxVertAngle();
         m_cuda_stream = pLidar->GetCudaStream();
+        m_host_input = false;
+#endif
     } else {
         InvalidFilterGraphSensorTypeMismatch(pSensor);
     }
 
     // allocate output buffer
     m_buffer_out = chrono_types::make_shared<SensorDeviceXYZIBuffer>();
-    DeviceXYZIBufferPtr b(
-        cudaMallocHelper<PixelXYZI>(m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1)),
-        cudaFreeHelper<PixelXYZI>);
-    m_buffer_out->Buffer = std::move(b);
+    unsigned int size = m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1);
+    if (m_host_input) {
+        m_buffer_out->Buffer = std::make_unique<PixelXYZI[]>(size);
+    }
+#ifdef CHRONO_HAS_OPTIX
+    else {
+        DeviceXYZIBufferPtr b(cudaMallocHelper<PixelXYZI>(size), cudaFreeHelper<PixelXYZI>);
+        m_buffer_out->Buffer = std::move(b);
+    }
+#endif
     m_buffer_out->Width = m_buffer_in->Width;
     m_buffer_out->Height = m_buffer_in->Height;
     m_buffer_out->Dual_return = m_buffer_in->Dual_return;
@@ -54,6 +71,32 @@ CH_SENSOR_API void ChFilterPCfromDepth::Initialize(std::shared_ptr<ChSensor> pSe
 }
 
 CH_SENSOR_API void ChFilterPCfromDepth::Apply() {
+    if (m_host_input) {
+        // convert on the host and keep only the beams that returned, in a single pass
+        int w = (int)m_buffer_in->Width;
+        int h = (int)m_buffer_in->Height;
+        PixelDI* in = m_buffer_in->Buffer.get();
+        PixelXYZI* out = m_buffer_out->Buffer.get();
+        m_buffer_out->Beam_return_count = 0;
+        for (int j = 0; j < h; j++) {
+            float vAngle = (j / (float)(std::max(1, h - 1))) * (m_max_vert_angle - m_min_vert_angle) + m_min_vert_angle;
+            for (int i = 0; i < w; i++) {
+                const PixelDI& p = in[w * j + i];
+                if (p.intensity > 0) {
+                    float hAngle = (i / (float)(std::max(1, w - 1))) * m_hFOV - m_hFOV / 2.f;
+                    float proj_xy = p.range * cosf(vAngle);
+                    out[m_buffer_out->Beam_return_count] = {proj_xy * cosf(hAngle), proj_xy * sinf(hAngle),
+                                                            p.range * sinf(vAngle), p.intensity};
+                    m_buffer_out->Beam_return_count++;
+                }
+            }
+        }
+        m_buffer_out->LaunchedCount = m_buffer_in->LaunchedCount;
+        m_buffer_out->TimeStamp = m_buffer_in->TimeStamp;
+        return;
+    }
+
+#ifdef CHRONO_HAS_OPTIX
     // carry out the conversion from depth to point cloud
     if (m_buffer_in->Dual_return) {
         cuda_pointcloud_from_depth_dual_return(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(),
@@ -84,6 +127,7 @@ CH_SENSOR_API void ChFilterPCfromDepth::Apply() {
 
     m_buffer_out->LaunchedCount = m_buffer_in->LaunchedCount;
     m_buffer_out->TimeStamp = m_buffer_in->TimeStamp;
+#endif
 }
 }  // namespace sensor
 }  // namespace chrono
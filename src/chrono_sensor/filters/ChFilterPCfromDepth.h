@@ -18,7 +18,9 @@
 #define CHFILTERPCFROMDEPTH_H
 
 #include "chrono_sensor/filters/ChFilter.h"
-#include <cuda.h>
+#ifdef CHRONO_HAS_OPTIX
+    #include <cuda.h>
+#endif
 
 namespace chrono {
 namespace sensor {
@@ -29,7 +31,9 @@ class ChSensor;
 /// @addtogroup sensor_filters
 /// @{
 
-/// A filter that, when applied to a sensor, generates point cloud data from depth values
+/// A filter that, when applied to a sensor, generates point cloud data from depth values.
+/// Supports both ChLidarSensor (device buffers) and ChCPULidarSensor (host buffers). A ChCPULidarSensor casts a single
+/// ray per beam and never produces dual returns, so its point cloud holds at most one point per beam.
 class CH_SENSOR_API ChFilterPCfromDepth : public ChFilter {
   public:
     /// Class constructor
@@ -48,7 +52,10 @@ class CH_SENSOR_API ChFilterPCfromDepth : public ChFilter {
     float m_hFOV;                                          ///< field of view of the parent lidar
     float m_min_vert_angle;                                ///< mimimum vertical angle of parent lidar
     float m_max_vert_angle;                                ///< maximum vetical angle of parent lidar
-    CUstream m_cuda_stream;                                ///< reference to the cuda stream
+#ifdef CHRONO_HAS_OPTIX
+    CUstream m_cuda_stream;  ///< reference to the cuda stream
+#endif
+    bool m_host_input;                                     ///< true if the parent lidar renders on the CPU
     std::shared_ptr<SensorDeviceDIBuffer> m_buffer_in;     ///< holder of the input buffer
     std::shared_ptr<SensorDeviceXYZIBuffer> m_buffer_out;  ///< holder of the output buffer
 };
@@ -0,0 +1,47 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Asher Elmquist
+// =============================================================================
+//
+// Container class for a depth camera rendered with the CPU ray tracer
+//
+// =============================================================================
+
+#include "chrono_sensor/sensors/ChCPUDepthCamera.h"
+#include "chrono_sensor/filters/ChFilterAccess.h"
+
+namespace chrono {
+namespace sensor {
+
+// -----------------------------------------------------------------------------
+// Constructor
+// -----------------------------------------------------------------------------
+CH_SENSOR_API ChCPUDepthCamera::ChCPUDepthCamera(std::shared_ptr<chrono::ChBody> parent,
+                                                 float updateRate,
+                                                 chrono::ChFrame<double> offsetPose,
+                                                 unsigned int w,  // image width
+                                                 unsigned int h,  // image height
+                                                 float hFOV)      // horizontal field of view
+    : m_hFOV(hFOV), ChCPUSensor(parent, updateRate, offsetPose, w, h) {
+    SetCollectionWindow(0.f);
+    SetLag(1.f / updateRate);
+
+    m_filters.push_back(chrono_types::make_shared<ChFilterDepthAccess>());
+}
+
+// -----------------------------------------------------------------------------
+// Destructor
+// -----------------------------------------------------------------------------
+CH_SENSOR_API ChCPUDepthCamera::~ChCPUDepthCamera() {}
+
+}  // namespace sensor
+}  // namespace chrono
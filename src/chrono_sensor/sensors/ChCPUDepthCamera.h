@@ -0,0 +1,63 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Asher Elmquist
+// =============================================================================
+//
+// Container class for a depth camera rendered with the CPU ray tracer
+//
+// =============================================================================
+
+#ifndef CHCPUDEPTHCAMERA_H
+#define CHCPUDEPTHCAMERA_H
+
+#include "chrono_sensor/sensors/ChCPUSensor.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_sensors
+/// @{
+
+/// Depth camera class rendered on the CPU, using a pinhole lens model. The generated depth image (distance along each
+/// camera ray, 0 where no object is hit) uses the same ray layout as ChDepthCamera.
+class CH_SENSOR_API ChCPUDepthCamera : public ChCPUSensor {
+  public:
+    /// Constructor for the CPU depth camera class
+    /// @param parent A shared pointer to a body on which the sensor should be attached.
+    /// @param updateRate The desired update rate of the sensor in Hz.
+    /// @param offsetPose The desired relative position and orientation of the sensor on the body.
+    /// @param w The width of the image the camera should generate.
+    /// @param h The height of the image the camera should generate.
+    /// @param hFOV The horizontal field of view of the camera lens.
+    ChCPUDepthCamera(std::shared_ptr<chrono::ChBody> parent,
+                     float updateRate,
+                     chrono::ChFrame<double> offsetPose,
+                     unsigned int w,
+                     unsigned int h,
+                     float hFOV);
+
+    /// Class destructor
+    ~ChCPUDepthCamera();
+
+    /// returns the camera's horizontal field of view. Vertical field of view is determined by the image aspect ratio
+    float GetHFOV() const { return m_hFOV; }
+
+  private:
+    float m_hFOV;  ///< the horizontal field of view of the sensor
+};
+
+/// @} sensor_sensors
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
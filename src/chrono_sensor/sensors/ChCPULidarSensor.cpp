@@ -0,0 +1,53 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Asher Elmquist
+// =============================================================================
+//
+// Container class for a lidar sensor rendered with the CPU ray tracer
+//
+// =============================================================================
+
+#include "chrono_sensor/sensors/ChCPULidarSensor.h"
+
+namespace chrono {
+namespace sensor {
+
+// -----------------------------------------------------------------------------
+// Constructor
+// -----------------------------------------------------------------------------
+CH_SENSOR_API ChCPULidarSensor::ChCPULidarSensor(std::shared_ptr<chrono::ChBody> parent,
+                                                 float updateRate,
+                                                 chrono::ChFrame<double> offsetPose,
+                                                 unsigned int w,            // number of horizontal samples
+                                                 unsigned int h,            // number of vertical channels
+                                                 float hfov,                // horizontal field of view
+                                                 float max_vertical_angle,  // highest vertical angle
+                                                 float min_vertical_angle,  // lowest ray angle
+                                                 float max_distance,        // maximum distance for lidar
+                                                 float clip_near)           // minimum return distance
+    : m_hFOV(hfov),
+      m_max_vert_angle(max_vertical_angle),
+      m_min_vert_angle(min_vertical_angle),
+      m_max_distance(max_distance),
+      m_clip_near(clip_near),
+      ChCPUSensor(parent, updateRate, offsetPose, w, h) {
+    SetCollectionWindow(0);
+    SetLag(1 / updateRate);
+}
+
+// -----------------------------------------------------------------------------
+// Destructor
+// -----------------------------------------------------------------------------
+CH_SENSOR_API ChCPULidarSensor::~ChCPULidarSensor() {}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,80 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Asher Elmquist
+// =============================================================================
+//
+// Container class for a lidar sensor rendered with the CPU ray tracer
+//
+// =============================================================================
+
+#ifndef CHCPULIDARSENSOR_H
+#define CHCPULIDARSENSOR_H
+
+#include "chrono_sensor/sensors/ChCPUSensor.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_sensors
+/// @{
+
+/// Lidar class rendered on the CPU. This corresponds to a scanning lidar with a single ray per beam and the strongest
+/// return mode, generating the same depth-intensity data (and supporting the same host filters) as ChLidarSensor,
+/// without requiring OptiX or a GPU. Since each beam casts a single ray, every beam yields at most one return; the
+/// dual-return and mean-return modes of ChLidarSensor are not supported and the output buffer never sets Dual_return.
+class CH_SENSOR_API ChCPULidarSensor : public ChCPUSensor {
+  public:
+    /// Constructor for the CPU lidar class
+    /// @param parent Body to which the sensor is attached.
+    /// @param updateRate Rate at which the sensor should update.
+    /// @param offsetPose Relative position and orientation of the sensor with respect to its parent object.
+    /// @param w Number of horizontal samples.
+    /// @param h Number of vertical channels.
+    /// @param hfov Horizontal field of view of the lidar.
+    /// @param max_vertical_angle Maximum vertical angle of the lidar.
+    /// @param min_vertical_angle Minimum vertical angle of the lidar.
+    /// @param max_distance The maximum distance reached by the lidar.
+    /// @param clip_near Near clipping distance, so that objects close to the lidar (e.g. its housing) are ignored.
+    ChCPULidarSensor(std::shared_ptr<chrono::ChBody> parent,
+                     float updateRate,
+                     chrono::ChFrame<double> offsetPose,
+                     unsigned int w,
+                     unsigned int h,
+                     float hfov,
+                     float max_vertical_angle,
+                     float min_vertical_angle,
+                     float max_distance,
+                     float clip_near = 1e-3f);
+
+    /// Class destructor
+    ~ChCPULidarSensor();
+
+    float GetHFOV() const { return m_hFOV; }                     ///< returns the lidar's horizontal field of view
+    float GetMaxVertAngle() const { return m_max_vert_angle; }   ///< returns the lidar's maximum vertical angle
+    float GetMinVertAngle() const { return m_min_vert_angle; }   ///< returns the lidar's minimum vertical angle
+    float GetMaxDistance() const { return m_max_distance; }      ///< returns the lidar's maximum distance
+    float GetClipNear() const { return m_clip_near; }            ///< returns the lidar's near clipping distance
+
+  private:
+    float m_hFOV;            ///< the horizontal field of view of the sensor
+    float m_max_vert_angle;  ///< maximum vertical angle of the rays
+    float m_min_vert_angle;  ///< minimum vertical angle of the rays
+    float m_max_distance;    ///< maximum distance for lidar
+    float m_clip_near;       ///< near clipping distance
+};
+
+/// @} sensor_sensors
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
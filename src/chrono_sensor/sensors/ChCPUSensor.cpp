@@ -0,0 +1,58 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Asher Elmquist
+// =============================================================================
+//
+// Base class for sensors rendered with the CPU ray tracer
+//
+// =============================================================================
+
+#include "chrono_sensor/sensors/ChCPUSensor.h"
+#include "chrono_sensor/cpu/ChFilterCPURender.h"
+
+#include "chrono/utils/ChOpenMP.h"
+
+namespace chrono {
+namespace sensor {
+
+// -----------------------------------------------------------------------------
+// Constructor
+// -----------------------------------------------------------------------------
+CH_SENSOR_API ChCPUSensor::ChCPUSensor(std::shared_ptr<chrono::ChBody> parent,
+                                       float updateRate,
+                                       chrono::ChFrame<double> offsetPose,
+                                       unsigned int w,
+                                       unsigned int h)
+    : m_width(w), m_height(h), m_num_threads(ChOMP::GetNumProcs()), ChDynamicSensor(parent, updateRate, offsetPose) {
+    // CPU sensors are rendered by their first filter
+    m_filters.push_front(chrono_types::make_shared<ChFilterCPURender>());
+}
+
+// -----------------------------------------------------------------------------
+// Destructor
+// -----------------------------------------------------------------------------
+CH_SENSOR_API ChCPUSensor::~ChCPUSensor() {}
+
+CH_SENSOR_API void ChCPUSensor::SetNumThreads(int num_threads) {
+    m_num_threads = std::max(1, num_threads);
+}
+
+CH_SENSOR_API void ChCPUSensor::PushKeyFrame() {
+    m_keyframes.push_back(GetParent()->GetVisualModelFrame() * GetOffsetPose());
+}
+
+CH_SENSOR_API void ChCPUSensor::ClearKeyFrames() {
+    m_keyframes.clear();
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,79 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Asher Elmquist
+// =============================================================================
+//
+// Base class for sensors rendered with the CPU ray tracer
+//
+// =============================================================================
+
+#ifndef CHCPUSENSOR_H
+#define CHCPUSENSOR_H
+
+#include "chrono_sensor/sensors/ChSensor.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_sensors
+/// @{
+
+/// CPU sensor class - the base class for all sensors that are rendered with the CPU ray tracer (ChCPURayTracer).
+/// These sensors do not require OptiX or a GPU. They are updated by the dynamics manager, in lock-step with the Chrono
+/// simulation, and their first filter is always a ChFilterCPURender which generates the sensor data on the host.
+class CH_SENSOR_API ChCPUSensor : public ChDynamicSensor {
+  public:
+    /// Constructor for the base CPU sensor class
+    /// @param parent Body to which the sensor is attached.
+    /// @param updateRate Rate at which the sensor should update.
+    /// @param offsetPose Relative position and orientation of the sensor with respect to its parent object.
+    /// @param w Width of the data the sensor should generate
+    /// @param h Height of the data the sensor should generate
+    ChCPUSensor(std::shared_ptr<chrono::ChBody> parent,
+                float updateRate,
+                chrono::ChFrame<double> offsetPose,
+                unsigned int w,
+                unsigned int h);
+
+    /// Class destructor
+    virtual ~ChCPUSensor();
+
+    unsigned int GetWidth() const { return m_width; }
+    unsigned int GetHeight() const { return m_height; }
+
+    /// Set the number of OpenMP threads used to render this sensor (default: number of processors).
+    void SetNumThreads(int num_threads);
+
+    /// Return the number of OpenMP threads used to render this sensor.
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Record the absolute pose of the sensor at the current simulation time.
+    virtual void PushKeyFrame();
+
+    /// Clear all recorded sensor poses.
+    virtual void ClearKeyFrames();
+
+  private:
+    unsigned int m_width;                      ///< width of the data generated by the sensor
+    unsigned int m_height;                     ///< height of the data generated by the sensor
+    int m_num_threads;                         ///< number of OpenMP threads used for rendering
+    std::vector<ChFrame<double>> m_keyframes;  ///< absolute sensor poses over the collection window
+
+    friend class ChFilterCPURender;
+};
+
+/// @} sensor_sensors
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -27,7 +27,9 @@
 #include "chrono_sensor/sensors/ChSensorBuffer.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono_sensor/filters/ChFilter.h"
-#include "chrono_sensor/optix/ChOptixUtils.h"
+#ifdef CHRONO_HAS_OPTIX
+    #include "chrono_sensor/optix/ChOptixUtils.h"
+#endif
 
 namespace chrono {
 namespace sensor {
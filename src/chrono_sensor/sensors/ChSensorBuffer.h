@@ -23,7 +23,12 @@
     #endif
 #endif
 
-#include <cuda_fp16.h>
+#include "chrono_sensor/ChConfigSensor.h"
+
+#ifdef CHRONO_HAS_OPTIX
+    #include <cuda_fp16.h>
+#endif
+
 #include <functional>
 #include <memory>
 #include <vector>
@@ -97,6 +102,7 @@ using SensorDeviceFloat4Buffer = SensorBufferT<DeviceFloat4BufferPtr>;
 /// pointer to an RGBA image on the host that has been moved for safety and can be given to the user
 using UserFloat4BufferPtr = std::shared_ptr<SensorHostFloat4Buffer>;
 
+#ifdef CHRONO_HAS_OPTIX
 /// A pixel as defined by RGBA float4 format
 struct PixelHalf4 {
     __half R;  ///< Red value
@@ -112,6 +118,7 @@ using DeviceHalf4BufferPtr = std::shared_ptr<PixelHalf4[]>;
 using SensorDeviceHalf4Buffer = SensorBufferT<DeviceHalf4BufferPtr>;
 /// pointer to an RGBA image on the host that has been moved for safety and can be given to the user
 using UserHalf4BufferPtr = std::shared_ptr<SensorHostHalf4Buffer>;
+#endif
 
 //================================
 // RGBA8 Camera Format and Buffers
@@ -42,5 +42,16 @@ void ChTerrain::GetProperties(const ChVector3d& loc, double& height, ChVector3d&
     friction = GetCoefficientFriction(loc);
 }
 
+void ChTerrain::GetPropertiesBatch(const std::vector<ChVector3d>& loc,
+                                   std::vector<double>& height,
+                                   std::vector<ChVector3d>& normal,
+                                   std::vector<float>& friction) const {
+    height.resize(loc.size());
+    normal.resize(loc.size());
+    friction.resize(loc.size());
+    for (size_t i = 0; i < loc.size(); i++)
+        GetProperties(loc[i], height[i], normal[i], friction[i]);
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
@@ -19,6 +19,8 @@
 #ifndef CH_TERRAIN_H
 #define CH_TERRAIN_H
 
+#include <vector>
+
 #include "chrono/core/ChVector3.h"
 
 #include "chrono_vehicle/ChApiVehicle.h"
@@ -57,6 +59,14 @@ class CH_VEHICLE_API ChTerrain {
     /// Get all terrain characteristics at the point below the specified location.
     virtual void GetProperties(const ChVector3d& loc, double& height, ChVector3d& normal, float& friction) const;
 
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// The output vectors are resized to match the number of input locations. The default implementation calls
+    /// GetProperties for each location in turn; derived classes may provide a more efficient implementation.
+    virtual void GetPropertiesBatch(const std::vector<ChVector3d>& loc,
+                                    std::vector<double>& height,
+                                    std::vector<ChVector3d>& normal,
+                                    std::vector<float>& friction) const;
+
     /// Class to be used as a functor interface for location-dependent terrain height.
     class CH_VEHICLE_API HeightFunctor {
       public:
@@ -31,6 +31,7 @@
 #include "chrono_vehicle/output/ChVehicleOutputASCII.h"
 #ifdef CHRONO_HAS_HDF5
     #include "chrono_vehicle/output/ChVehicleOutputHDF5.h"
+    #include "chrono_vehicle/output/ChVehicleOutputHDF5Async.h"
 #endif
 
 namespace chrono {
@@ -123,6 +124,11 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type,
         case ChVehicleOutput::HDF5:
 #ifdef CHRONO_HAS_HDF5
             m_output_db = new ChVehicleOutputHDF5(out_dir + "/" + out_name + ".h5");
+#endif
+            break;
+        case ChVehicleOutput::HDF5_ASYNC:
+#ifdef CHRONO_HAS_HDF5
+            m_output_db = new ChVehicleOutputHDF5Async(out_dir + "/" + out_name + ".h5");
 #endif
             break;
     }
@@ -140,6 +146,7 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type, std::ostream& out_stream,
             //// TODO
             break;
         case ChVehicleOutput::HDF5:
+        case ChVehicleOutput::HDF5_ASYNC:
 #ifdef CHRONO_HAS_HDF5
             //// TODO
 #endif
@@ -44,9 +44,10 @@ namespace vehicle {
 class CH_VEHICLE_API ChVehicleOutput {
   public:
     enum Type {
-        ASCII,  ///< ASCII text
-        JSON,   ///< JSON
-        HDF5    ///< HDF-5
+        ASCII,      ///< ASCII text
+        JSON,       ///< JSON
+        HDF5,       ///< HDF-5
+        HDF5_ASYNC  ///< HDF-5, buffered and written from a background thread
     };
 
     ChVehicleOutput() {}
@@ -0,0 +1,329 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Base class for an asynchronous vehicle output database.
+//
+// =============================================================================
+
+#include <iostream>
+
+#include "chrono_vehicle/output/ChVehicleOutputAsync.h"
+
+namespace chrono {
+namespace vehicle {
+
+// -----------------------------------------------------------------------------
+
+static const std::vector<std::string> record_names = {
+    "Bodies", "AuxRefBodies", "Markers", "Shafts", "Joints", "Couples", "LinSprings", "RotSprings", "BodyLoads"};
+
+static const std::vector<std::vector<std::string>> field_names = {
+    // bodies
+    {"x", "y", "z", "e0", "e1", "e2", "e3",
+     "xd", "yd", "zd", "wx", "wy", "wz",
+     "xdd", "ydd", "zdd", "wxd", "wyd", "wzd"},
+    // bodies with auxiliary reference frame
+    {"x", "y", "z", "e0", "e1", "e2", "e3",
+     "xd", "yd", "zd", "wx", "wy", "wz",
+     "xdd", "ydd", "zdd", "wxd", "wyd", "wzd",
+     "rx", "ry", "rz", "rxd", "ryd", "rzd", "rxdd", "rydd", "rzdd"},
+    // markers
+    {"x", "y", "z", "xd", "yd", "zd", "xdd", "ydd", "zdd"},
+    // shafts
+    {"x", "xd", "xdd", "t"},
+    // joints
+    {"fx", "fy", "fz", "tx", "ty", "tz"},
+    // couples
+    {"x", "xd", "xdd", "t1", "t2"},
+    // translational springs
+    {"x", "xd", "f"},
+    // rotational springs
+    {"x", "xd", "t"},
+    // body-body loads
+    {"fx", "fy", "fz", "tx", "ty", "tz"}};
+
+int ChVehicleOutputAsync::GetNumFields(RecordType type) {
+    return (int)field_names[type].size();
+}
+
+const std::vector<std::string>& ChVehicleOutputAsync::GetFieldNames(RecordType type) {
+    return field_names[type];
+}
+
+const std::string& ChVehicleOutputAsync::GetRecordName(RecordType type) {
+    return record_names[type];
+}
+
+static inline void Append(std::vector<double>& data, const ChVector3d& v) {
+    data.push_back(v.x());
+    data.push_back(v.y());
+    data.push_back(v.z());
+}
+
+static inline void Append(std::vector<double>& data, const ChQuaterniond& q) {
+    data.push_back(q.e0());
+    data.push_back(q.e1());
+    data.push_back(q.e2());
+    data.push_back(q.e3());
+}
+
+// -----------------------------------------------------------------------------
+
+ChVehicleOutputAsync::ChVehicleOutputAsync()
+    : m_current(0), m_written(1), m_recording(false), m_pending(false), m_stop(false) {
+    // The writer thread idles until the first frame is submitted
+    m_thread = std::thread(&ChVehicleOutputAsync::Run, this);
+}
+
+ChVehicleOutputAsync::~ChVehicleOutputAsync() {
+    // Derived classes must call Stop in their destructor. If they did not, the derived object is already destroyed
+    // here, so the writer thread is terminated without processing any outstanding frame.
+    if (m_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        m_thread.join();
+    }
+}
+
+void ChVehicleOutputAsync::Stop() {
+    if (!m_thread.joinable())
+        return;
+
+    try {
+        Flush();
+    } catch (const std::exception& e) {
+        std::cerr << "ChVehicleOutputAsync: error writing output frame: " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "ChVehicleOutputAsync: error writing output frame" << std::endl;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    m_thread.join();
+}
+
+void ChVehicleOutputAsync::Flush() {
+    if (m_recording)
+        Submit();
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this] { return !m_pending; });
+    }
+    RethrowError();
+}
+
+// Hand the current frame buffer to the writer thread and switch to the other buffer.
+// Only blocks if the writer thread is still processing the previous frame.
+// If writing the previous frame failed, the current frame is discarded and the exception is rethrown.
+void ChVehicleOutputAsync::Submit() {
+    m_recording = false;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this] { return !m_pending; });
+        if (!m_error) {
+            m_written = m_current;
+            m_current = 1 - m_current;
+            m_pending = true;
+        }
+    }
+    m_cv.notify_all();
+    RethrowError();
+}
+
+// Rethrow (once) an exception captured on the writer thread.
+void ChVehicleOutputAsync::RethrowError() {
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::swap(error, m_error);
+    }
+    if (error)
+        std::rethrow_exception(error);
+}
+
+void ChVehicleOutputAsync::Run() {
+    while (true) {
+        int index;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this] { return m_pending || m_stop; });
+            if (m_stop)
+                return;
+            index = m_written;
+        }
+
+        // An exception escaping the writer thread would terminate the program; capture it for the simulation thread
+        std::exception_ptr error;
+        try {
+            WriteFrame(m_frames[index]);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending = false;
+            if (error && !m_error)
+                m_error = error;
+        }
+        m_cv.notify_all();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutputAsync::WriteTime(int frame, double time) {
+    if (m_recording)
+        Submit();
+
+    auto& current = m_frames[m_current];
+    current.frame = frame;
+    current.time = time;
+    current.num_sections = 0;
+    m_recording = true;
+}
+
+void ChVehicleOutputAsync::WriteSection(const std::string& name) {
+    auto& current = m_frames[m_current];
+    if (current.num_sections == current.sections.size())
+        current.sections.emplace_back();
+
+    // Reuse the section buffer (keep the allocated capacity)
+    auto& section = current.sections[current.num_sections++];
+    section.name = name;
+    for (auto& records : section.records) {
+        records.ids.clear();
+        records.data.clear();
+    }
+    m_recording = true;
+}
+
+ChVehicleOutputAsync::Records& ChVehicleOutputAsync::GetRecords(RecordType type) {
+    // Objects written before any section are collected in an unnamed section
+    if (m_frames[m_current].num_sections == 0)
+        WriteSection("");
+    auto& current = m_frames[m_current];
+    return current.sections[current.num_sections - 1].records[type];
+}
+
+void ChVehicleOutputAsync::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    auto& records = GetRecords(BODIES);
+    for (const auto& body : bodies) {
+        records.ids.push_back(body->GetIdentifier());
+        Append(records.data, body->GetPos());
+        Append(records.data, body->GetRot());
+        Append(records.data, body->GetPosDt());
+        Append(records.data, body->GetAngVelParent());
+        Append(records.data, body->GetPosDt2());
+        Append(records.data, body->GetAngAccParent());
+    }
+}
+
+void ChVehicleOutputAsync::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
+    auto& records = GetRecords(AUXREF_BODIES);
+    for (const auto& body : bodies) {
+        records.ids.push_back(body->GetIdentifier());
+        Append(records.data, body->GetPos());
+        Append(records.data, body->GetRot());
+        Append(records.data, body->GetPosDt());
+        Append(records.data, body->GetAngVelParent());
+        Append(records.data, body->GetPosDt2());
+        Append(records.data, body->GetAngAccParent());
+        Append(records.data, body->GetFrameRefToAbs().GetPos());
+        Append(records.data, body->GetFrameRefToAbs().GetPosDt());
+        Append(records.data, body->GetFrameRefToAbs().GetPosDt2());
+    }
+}
+
+void ChVehicleOutputAsync::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
+    auto& records = GetRecords(MARKERS);
+    for (const auto& marker : markers) {
+        records.ids.push_back(marker->GetIdentifier());
+        Append(records.data, marker->GetAbsCoordsys().pos);
+        Append(records.data, marker->GetAbsCoordsysDt().pos);
+        Append(records.data, marker->GetAbsCoordsysDt2().pos);
+    }
+}
+
+void ChVehicleOutputAsync::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
+    auto& records = GetRecords(SHAFTS);
+    for (const auto& shaft : shafts) {
+        records.ids.push_back(shaft->GetIdentifier());
+        records.data.push_back(shaft->GetPos());
+        records.data.push_back(shaft->GetPosDt());
+        records.data.push_back(shaft->GetPosDt2());
+        records.data.push_back(shaft->GetAppliedLoad());
+    }
+}
+
+void ChVehicleOutputAsync::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
+    auto& records = GetRecords(JOINTS);
+    for (const auto& joint : joints) {
+        auto reaction = joint->GetReaction2();
+        records.ids.push_back(joint->GetIdentifier());
+        Append(records.data, reaction.force);
+        Append(records.data, reaction.torque);
+    }
+}
+
+void ChVehicleOutputAsync::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
+    auto& records = GetRecords(COUPLES);
+    for (const auto& couple : couples) {
+        records.ids.push_back(couple->GetIdentifier());
+        records.data.push_back(couple->GetRelativePos());
+        records.data.push_back(couple->GetRelativePosDt());
+        records.data.push_back(couple->GetRelativePosDt2());
+        records.data.push_back(couple->GetReaction1());
+        records.data.push_back(couple->GetReaction2());
+    }
+}
+
+void ChVehicleOutputAsync::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
+    auto& records = GetRecords(LIN_SPRINGS);
+    for (const auto& spring : springs) {
+        records.ids.push_back(spring->GetIdentifier());
+        records.data.push_back(spring->GetLength());
+        records.data.push_back(spring->GetVelocity());
+        records.data.push_back(spring->GetForce());
+    }
+}
+
+void ChVehicleOutputAsync::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) {
+    auto& records = GetRecords(ROT_SPRINGS);
+    for (const auto& spring : springs) {
+        records.ids.push_back(spring->GetIdentifier());
+        records.data.push_back(spring->GetAngle());
+        records.data.push_back(spring->GetVelocity());
+        records.data.push_back(spring->GetTorque());
+    }
+}
+
+void ChVehicleOutputAsync::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
+    auto& records = GetRecords(BODY_LOADS);
+    for (const auto& load : loads) {
+        records.ids.push_back(load->GetIdentifier());
+        Append(records.data, load->GetForce());
+        Append(records.data, load->GetTorque());
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,143 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Base class for an asynchronous vehicle output database.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_OUTPUT_ASYNC_H
+#define CH_VEHICLE_OUTPUT_ASYNC_H
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+#include "chrono_vehicle/ChVehicleOutput.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle
+/// @{
+
+/// Base class for an asynchronous vehicle output database.
+/// On the simulation thread, the Write functions only copy the current state of the output objects into a
+/// preallocated frame buffer. Completed frames are handed (double-buffered) to a background writer thread which
+/// calls WriteFrame. The simulation thread blocks only if the writer is still busy with the previous frame.
+/// An exception thrown by WriteFrame is captured on the writer thread and rethrown on the simulation thread at the
+/// next frame submission (WriteTime) or by Flush; the frame being recorded at that point is discarded.
+class CH_VEHICLE_API ChVehicleOutputAsync : public ChVehicleOutput {
+  public:
+    /// Types of output records.
+    enum RecordType {
+        BODIES,
+        AUXREF_BODIES,
+        MARKERS,
+        SHAFTS,
+        JOINTS,
+        COUPLES,
+        LIN_SPRINGS,
+        ROT_SPRINGS,
+        BODY_LOADS,
+        NUM_RECORD_TYPES
+    };
+
+    /// Snapshot of all output objects of a given type in one section.
+    struct Records {
+        std::vector<int> ids;      ///< object identifiers
+        std::vector<double> data;  ///< object values (row-major, GetNumFields values per object)
+    };
+
+    /// Snapshot of the output objects in one section.
+    struct Section {
+        std::string name;                   ///< section name
+        Records records[NUM_RECORD_TYPES];  ///< records, indexed by RecordType
+    };
+
+    /// Snapshot of the output objects at one output frame.
+    struct Frame {
+        int frame;                      ///< output frame number
+        double time;                    ///< simulation time
+        size_t num_sections;            ///< number of valid sections
+        std::vector<Section> sections;  ///< section buffers (storage reused across frames)
+    };
+
+    virtual ~ChVehicleOutputAsync();
+
+    /// Hand the current frame to the writer thread and wait until all recorded frames were written.
+    /// Rethrows any exception thrown while writing a frame.
+    void Flush();
+
+    /// Return the number of values recorded for each object of the given type.
+    static int GetNumFields(RecordType type);
+
+    /// Return the names of the values recorded for each object of the given type.
+    static const std::vector<std::string>& GetFieldNames(RecordType type);
+
+    /// Return the name of the given record type.
+    static const std::string& GetRecordName(RecordType type);
+
+  protected:
+    ChVehicleOutputAsync();
+
+    /// Flush all recorded frames and stop the background writer thread.
+    /// Must be called in the destructor of derived classes (before their members are destroyed). Since it is called
+    /// from a destructor, an exception thrown while writing the outstanding frames is reported and not rethrown.
+    void Stop();
+
+    /// Write a complete output frame (called on the background writer thread).
+    virtual void WriteFrame(const Frame& frame) = 0;
+
+  private:
+    virtual void WriteTime(int frame, double time) override;
+    virtual void WriteSection(const std::string& name) override;
+
+    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) override;
+    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) override;
+    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) override;
+    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) override;
+    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) override;
+    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) override;
+    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) override;
+    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) override;
+    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
+
+    Records& GetRecords(RecordType type);
+    void Submit();
+    void Run();
+    void RethrowError();
+
+    Frame m_frames[2];  ///< frame buffers
+    int m_current;      ///< index of the frame buffer filled on the simulation thread
+    int m_written;      ///< index of the frame buffer processed by the writer thread
+    bool m_recording;   ///< true if the current frame buffer holds data
+    bool m_pending;     ///< true while the writer thread processes a frame
+    bool m_stop;        ///< request termination of the writer thread
+
+    std::exception_ptr m_error;  ///< exception thrown by WriteFrame, to be rethrown on the simulation thread
+
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+};
+
+/// @} vehicle
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
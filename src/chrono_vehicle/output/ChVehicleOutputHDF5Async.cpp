@@ -0,0 +1,145 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Asynchronous HDF5 vehicle output database.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono_vehicle/output/ChVehicleOutputHDF5Async.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChVehicleOutputHDF5Async::ChVehicleOutputHDF5Async(const std::string& filename, int chunk_rows, int compression_level)
+    : m_chunk_rows((hsize_t)std::max(chunk_rows, 1)), m_compression_level(std::min(std::max(compression_level, 0), 9)) {
+    m_file = new H5::H5File(filename, H5F_ACC_TRUNC);
+}
+
+ChVehicleOutputHDF5Async::~ChVehicleOutputHDF5Async() {
+    // Write all outstanding frames and stop the writer thread before closing the file
+    Stop();
+    for (auto& table : m_tables)
+        FlushTable(table.second);
+    m_tables.clear();
+
+    m_file->close();
+    delete m_file;
+}
+
+// Return the table for the specified group and name, creating the dataset on first use.
+ChVehicleOutputHDF5Async::Table& ChVehicleOutputHDF5Async::GetTable(const std::string& group,
+                                                                    const std::string& name,
+                                                                    const std::vector<std::string>& columns) {
+    std::string path = group + "/" + name;
+    auto it = m_tables.find(path);
+    if (it != m_tables.end())
+        return it->second;
+
+    if (!group.empty() && !m_file->nameExists(group))
+        m_file->createGroup(group);
+
+    hsize_t num_cols = (hsize_t)columns.size();
+    hsize_t dims[2] = {0, num_cols};
+    hsize_t max_dims[2] = {H5S_UNLIMITED, num_cols};
+    hsize_t chunk_dims[2] = {m_chunk_rows, num_cols};
+    H5::DataSpace dataspace(2, dims, max_dims);
+
+    H5::DSetCreatPropList props;
+    props.setChunk(2, chunk_dims);
+    if (m_compression_level > 0)
+        props.setDeflate(m_compression_level);
+
+    Table& table = m_tables[path];
+    table.dataset = m_file->createDataSet(path, H5::PredType::NATIVE_DOUBLE, dataspace, props);
+    table.num_cols = num_cols;
+    table.num_rows = 0;
+    table.buffer.reserve(m_chunk_rows * num_cols);
+
+    // Record the column names as a dataset attribute
+    std::string col_names;
+    for (const auto& col : columns)
+        col_names += (col_names.empty() ? "" : ",") + col;
+    H5::StrType str_type(H5::PredType::C_S1, col_names.size());
+    H5::Attribute attribute = table.dataset.createAttribute("Columns", str_type, H5::DataSpace(H5S_SCALAR));
+    attribute.write(str_type, col_names);
+
+    return table;
+}
+
+// Append all pending rows to the dataset.
+void ChVehicleOutputHDF5Async::FlushTable(Table& table) {
+    hsize_t num_rows = (hsize_t)table.buffer.size() / table.num_cols;
+    if (num_rows == 0)
+        return;
+
+    hsize_t dims[2] = {table.num_rows + num_rows, table.num_cols};
+    table.dataset.extend(dims);
+
+    hsize_t offset[2] = {table.num_rows, 0};
+    hsize_t count[2] = {num_rows, table.num_cols};
+    H5::DataSpace filespace = table.dataset.getSpace();
+    filespace.selectHyperslab(H5S_SELECT_SET, count, offset);
+    H5::DataSpace memspace(2, count);
+    table.dataset.write(table.buffer.data(), H5::PredType::NATIVE_DOUBLE, memspace, filespace);
+
+    table.num_rows += num_rows;
+    table.buffer.clear();
+}
+
+void ChVehicleOutputHDF5Async::WriteFrame(const Frame& frame) {
+    static const std::vector<std::string> time_columns = {"frame", "time"};
+    auto& time_table = GetTable("", "Time", time_columns);
+    time_table.buffer.push_back(frame.frame);
+    time_table.buffer.push_back(frame.time);
+    if (time_table.buffer.size() >= m_chunk_rows * time_table.num_cols)
+        FlushTable(time_table);
+
+    // Dataset columns for each record type: time, object identifier, object values
+    static const std::vector<std::vector<std::string>> record_columns = [] {
+        std::vector<std::vector<std::string>> columns(NUM_RECORD_TYPES);
+        for (int it = 0; it < NUM_RECORD_TYPES; it++) {
+            const auto& fields = GetFieldNames(static_cast<RecordType>(it));
+            columns[it] = {"time", "id"};
+            columns[it].insert(columns[it].end(), fields.begin(), fields.end());
+        }
+        return columns;
+    }();
+
+    for (size_t is = 0; is < frame.num_sections; is++) {
+        const auto& section = frame.sections[is];
+        std::string group = "/" + (section.name.empty() ? std::string("Vehicle") : section.name);
+
+        for (int it = 0; it < NUM_RECORD_TYPES; it++) {
+            const auto& records = section.records[it];
+            if (records.ids.empty())
+                continue;
+
+            auto& table = GetTable(group, GetRecordName(static_cast<RecordType>(it)), record_columns[it]);
+            size_t num_fields = table.num_cols - 2;
+            for (size_t i = 0; i < records.ids.size(); i++) {
+                table.buffer.push_back(frame.time);
+                table.buffer.push_back(records.ids[i]);
+                auto values = records.data.begin() + i * num_fields;
+                table.buffer.insert(table.buffer.end(), values, values + num_fields);
+                if (table.buffer.size() >= m_chunk_rows * table.num_cols)
+                    FlushTable(table);
+            }
+        }
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
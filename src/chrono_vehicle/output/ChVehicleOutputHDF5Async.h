@@ -0,0 +1,74 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Asynchronous HDF5 vehicle output database.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_OUTPUT_HDF5_ASYNC_H
+#define CH_VEHICLE_OUTPUT_HDF5_ASYNC_H
+
+#include <string>
+#include <map>
+#include <vector>
+
+#include "chrono_vehicle/output/ChVehicleOutputAsync.h"
+
+#include "H5Cpp.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle
+/// @{
+
+/// Asynchronous HDF5 vehicle output database.
+/// Output data is written from a background thread into one extendible 2D dataset per section and record type
+/// ("/<section>/<record type>"), with one row per object and output frame and columns (time, id, values...).
+/// Frame numbers and times are written to the dataset "/Time". Rows are accumulated in memory and appended to the
+/// datasets one chunk at a time. Datasets are chunked and optionally compressed (deflate).
+class CH_VEHICLE_API ChVehicleOutputHDF5Async : public ChVehicleOutputAsync {
+  public:
+    ChVehicleOutputHDF5Async(const std::string& filename,  ///< [in] output file name
+                             int chunk_rows = 1024,        ///< [in] number of rows in a dataset chunk
+                             int compression_level = 0     ///< [in] deflate compression level (0: no compression)
+    );
+    ~ChVehicleOutputHDF5Async();
+
+  private:
+    /// Extendible dataset and the rows not yet appended to it.
+    struct Table {
+        H5::DataSet dataset;         ///< HDF5 dataset
+        hsize_t num_cols;            ///< number of columns
+        hsize_t num_rows;            ///< number of rows in the dataset
+        std::vector<double> buffer;  ///< pending rows (row-major)
+    };
+
+    virtual void WriteFrame(const Frame& frame) override;
+
+    Table& GetTable(const std::string& group, const std::string& name, const std::vector<std::string>& columns);
+    void FlushTable(Table& table);
+
+    H5::H5File* m_file;
+    hsize_t m_chunk_rows;
+    int m_compression_level;
+    std::map<std::string, Table> m_tables;
+};
+
+/// @} vehicle
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
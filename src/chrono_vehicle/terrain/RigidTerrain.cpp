@@ -21,6 +21,10 @@
 #include <cmath>
 #include <cstdio>
 
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
 #include "chrono/assets/ChVisualSystem.h"
 #include "chrono/assets/ChVisualShapeBox.h"
 #include "chrono/assets/ChTexture.h"
@@ -50,6 +54,8 @@ RigidTerrain::RigidTerrain(ChSystem* system)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_use_height_grid(false),
+      m_grid_spacing(0.05),
       m_contact_callback(nullptr),
       m_collision_family(14),
       m_initialized(false) {}
@@ -61,6 +67,8 @@ RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_use_height_grid(false),
+      m_grid_spacing(0.05),
       m_contact_callback(nullptr),
       m_collision_family(14),
       m_initialized(false) {
@@ -179,6 +187,12 @@ void RigidTerrain::InitializePatch(std::shared_ptr<Patch> patch) {
     // Initialize the patch
     patch->Initialize();
 
+    // Optionally, bake height grids and cache the horizontal patch extents
+    if (m_use_height_grid) {
+        patch->BuildHeightGrid(m_grid_spacing);
+        patch->ComputeBounds(m_grid_spacing);
+    }
+
     // All patches are added to the same collision family and collision with other models in this family is disabled
     patch->m_body->GetCollisionModel()->SetFamily(m_collision_family);
     patch->m_body->GetCollisionModel()->DisallowCollisionsWith(m_collision_family);
@@ -844,7 +858,7 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChCo
 // Functions to modify properties of a patch
 // -----------------------------------------------------------------------------
 
-RigidTerrain::Patch::Patch() : m_friction(0.8f), m_visualize(true) {
+RigidTerrain::Patch::Patch() : m_friction(0.8f), m_has_bounds(false), m_visualize(true) {
     m_vis_mat = std::make_shared<ChVisualMaterial>(*ChVisualMaterial::Default());
 }
 
@@ -1075,13 +1089,49 @@ void RigidTerrain::GetProperties(const ChVector3d& loc, double& height, ChVector
         friction = (*m_friction_fun)(loc);
 }
 
+void RigidTerrain::GetPropertiesBatch(const std::vector<ChVector3d>& loc,
+                                      std::vector<double>& height,
+                                      std::vector<ChVector3d>& normal,
+                                      std::vector<float>& friction) const {
+    // User-provided functors are not assumed to be thread-safe
+    if (m_height_fun || m_normal_fun || m_friction_fun) {
+        ChTerrain::GetPropertiesBatch(loc, height, normal, friction);
+        return;
+    }
+
+    int num_points = (int)loc.size();
+    height.resize(num_points);
+    normal.resize(num_points);
+    friction.resize(num_points);
+
+    int nthreads = m_system->GetNumThreadsChrono();
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (int i = 0; i < num_points; i++) {
+        bool hit = FindPoint(loc[i], height[i], normal[i], friction[i]);
+        if (!hit) {
+            height[i] = 0;
+            normal[i] = ChWorldFrame::Vertical();
+            friction[i] = 0.8f;
+        }
+    }
+}
+
 bool RigidTerrain::FindPoint(const ChVector3d loc, double& height, ChVector3d& normal, float& friction) const {
     bool hit = false;
     height = std::numeric_limits<double>::lowest();
     normal = ChWorldFrame::Vertical();
     friction = 0.8f;
 
-    for (auto patch : m_patches) {
+    // Horizontal coordinates of the query location (used to skip patches that cannot contain it)
+    ChVector3d loc_iso = ChWorldFrame::ToISO(loc);
+
+    for (const auto& patch : m_patches) {
+        if (patch->m_has_bounds &&
+            (loc_iso.x() < patch->m_min_xy.x() || loc_iso.x() > patch->m_max_xy.x() ||
+             loc_iso.y() < patch->m_min_xy.y() || loc_iso.y() > patch->m_max_xy.y()))
+            continue;
+
         double pheight;
         ChVector3d pnormal;
         bool phit = patch->FindPoint(loc, pheight, pnormal);
@@ -1113,6 +1163,9 @@ bool RigidTerrain::BoxPatch::FindPoint(const ChVector3d& loc, double& height, Ch
 }
 
 bool RigidTerrain::MeshPatch::FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    if (FindPointGrid(loc, height, normal))
+        return true;
+
     ChVector3d from = loc;
     ChVector3d to = loc - (m_radius + 1000) * ChWorldFrame::Vertical();
 
@@ -1124,6 +1177,157 @@ bool RigidTerrain::MeshPatch::FindPoint(const ChVector3d& loc, double& height, C
     return result.hit;
 }
 
+// -----------------------------------------------------------------------------
+// Horizontal patch extents and baked height grids
+// -----------------------------------------------------------------------------
+void RigidTerrain::BoxPatch::ComputeBounds(double margin) {
+    m_min_xy = ChVector2d(std::numeric_limits<double>::max());
+    m_max_xy = ChVector2d(std::numeric_limits<double>::lowest());
+    for (int ix = -1; ix <= 1; ix += 2) {
+        for (int iy = -1; iy <= 1; iy += 2) {
+            ChVector3d corner_loc(ix * m_hlength, iy * m_hwidth, 0);
+            auto corner = ChWorldFrame::ToISO(m_body->TransformPointLocalToParent(corner_loc));
+            m_min_xy = ChVector2d(std::min(m_min_xy.x(), corner.x()), std::min(m_min_xy.y(), corner.y()));
+            m_max_xy = ChVector2d(std::max(m_max_xy.x(), corner.x()), std::max(m_max_xy.y(), corner.y()));
+        }
+    }
+    m_min_xy -= ChVector2d(margin);
+    m_max_xy += ChVector2d(margin);
+    m_has_bounds = true;
+}
+
+void RigidTerrain::MeshPatch::ComputeBounds(double margin) {
+    m_min_xy = ChVector2d(std::numeric_limits<double>::max());
+    m_max_xy = ChVector2d(std::numeric_limits<double>::lowest());
+    for (const auto& v : m_trimesh->GetCoordsVertices()) {
+        auto vertex = ChWorldFrame::ToISO(m_body->TransformPointLocalToParent(v));
+        m_min_xy = ChVector2d(std::min(m_min_xy.x(), vertex.x()), std::min(m_min_xy.y(), vertex.y()));
+        m_max_xy = ChVector2d(std::max(m_max_xy.x(), vertex.x()), std::max(m_max_xy.y(), vertex.y()));
+    }
+    m_min_xy -= ChVector2d(margin);
+    m_max_xy += ChVector2d(margin);
+    m_has_bounds = true;
+}
+
+// Sample the mesh on a regular grid in the horizontal plane of the (ISO) world frame. Each grid node stores the height
+// and normal of the highest mesh triangle above or below it.
+void RigidTerrain::MeshPatch::BuildHeightGrid(double spacing) {
+    const auto& vertices = m_trimesh->GetCoordsVertices();
+    const auto& faces = m_trimesh->GetIndicesVertexes();
+    if (vertices.empty() || spacing <= 0)
+        return;
+
+    // Mesh vertices in the ISO world frame
+    std::vector<ChVector3d> verts(vertices.size());
+    ChVector2d min_xy(std::numeric_limits<double>::max());
+    ChVector2d max_xy(std::numeric_limits<double>::lowest());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        verts[i] = ChWorldFrame::ToISO(m_body->TransformPointLocalToParent(vertices[i]));
+        min_xy = ChVector2d(std::min(min_xy.x(), verts[i].x()), std::min(min_xy.y(), verts[i].y()));
+        max_xy = ChVector2d(std::max(max_xy.x(), verts[i].x()), std::max(max_xy.y(), verts[i].y()));
+    }
+
+    m_grid_spacing = spacing;
+    m_grid_origin = min_xy;
+    m_grid_nx = (int)std::ceil((max_xy.x() - min_xy.x()) / spacing) + 1;
+    m_grid_ny = (int)std::ceil((max_xy.y() - min_xy.y()) / spacing) + 1;
+    m_grid_height.assign(m_grid_nx * m_grid_ny, std::numeric_limits<double>::quiet_NaN());
+    m_grid_normal.assign(m_grid_nx * m_grid_ny, ChWorldFrame::Vertical());
+
+    // Rasterize each triangle onto the grid nodes covered by its horizontal projection
+    const double eps = 1e-10;
+    for (const auto& face : faces) {
+        const auto& A = verts[face[0]];
+        const auto& B = verts[face[1]];
+        const auto& C = verts[face[2]];
+
+        // Skip vertical (or degenerate) triangles
+        double det = (B.x() - A.x()) * (C.y() - A.y()) - (C.x() - A.x()) * (B.y() - A.y());
+        if (std::abs(det) < eps)
+            continue;
+
+        // Upward triangle normal (in world frame)
+        ChVector3d nrm = Vcross(B - A, C - A).GetNormalized();
+        if (nrm.z() < 0)
+            nrm = -nrm;
+        nrm = ChWorldFrame::FromISO(nrm);
+
+        // Range of grid nodes within the horizontal bounding box of the triangle
+        double x_min = std::min({A.x(), B.x(), C.x()}) - m_grid_origin.x();
+        double x_max = std::max({A.x(), B.x(), C.x()}) - m_grid_origin.x();
+        double y_min = std::min({A.y(), B.y(), C.y()}) - m_grid_origin.y();
+        double y_max = std::max({A.y(), B.y(), C.y()}) - m_grid_origin.y();
+        int i_min = std::max(0, (int)std::ceil(x_min / spacing));
+        int i_max = std::min(m_grid_nx - 1, (int)std::floor(x_max / spacing));
+        int j_min = std::max(0, (int)std::ceil(y_min / spacing));
+        int j_max = std::min(m_grid_ny - 1, (int)std::floor(y_max / spacing));
+
+        for (int i = i_min; i <= i_max; i++) {
+            double x = m_grid_origin.x() + i * spacing;
+            for (int j = j_min; j <= j_max; j++) {
+                double y = m_grid_origin.y() + j * spacing;
+
+                // Barycentric coordinates of the grid node in the projected triangle
+                double b = ((x - A.x()) * (C.y() - A.y()) - (C.x() - A.x()) * (y - A.y())) / det;
+                double c = ((B.x() - A.x()) * (y - A.y()) - (x - A.x()) * (B.y() - A.y())) / det;
+                double a = 1 - b - c;
+                if (a < -eps || b < -eps || c < -eps)
+                    continue;
+
+                double h = a * A.z() + b * B.z() + c * C.z();
+                auto& node_height = m_grid_height[i * m_grid_ny + j];
+                if (std::isnan(node_height) || h > node_height) {
+                    node_height = h;
+                    m_grid_normal[i * m_grid_ny + j] = nrm;
+                }
+            }
+        }
+    }
+}
+
+// Bilinear interpolation of baked grid heights and normals. Returns false if the location is outside the grid, if any
+// of the surrounding grid nodes is not covered by the mesh, or if the location is below the interpolated surface (in
+// which case the caller falls back on ray casting).
+bool RigidTerrain::MeshPatch::FindPointGrid(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    if (m_grid_height.empty())
+        return false;
+
+    ChVector3d loc_iso = ChWorldFrame::ToISO(loc);
+    double x = (loc_iso.x() - m_grid_origin.x()) / m_grid_spacing;
+    double y = (loc_iso.y() - m_grid_origin.y()) / m_grid_spacing;
+    int i = (int)std::floor(x);
+    int j = (int)std::floor(y);
+    if (i < 0 || j < 0 || i >= m_grid_nx - 1 || j >= m_grid_ny - 1)
+        return false;
+
+    int k00 = i * m_grid_ny + j;
+    int k01 = k00 + 1;
+    int k10 = k00 + m_grid_ny;
+    int k11 = k10 + 1;
+    double h00 = m_grid_height[k00];
+    double h01 = m_grid_height[k01];
+    double h10 = m_grid_height[k10];
+    double h11 = m_grid_height[k11];
+    if (std::isnan(h00) || std::isnan(h01) || std::isnan(h10) || std::isnan(h11))
+        return false;
+
+    double wx = x - i;
+    double wy = y - j;
+    double w00 = (1 - wx) * (1 - wy);
+    double w01 = (1 - wx) * wy;
+    double w10 = wx * (1 - wy);
+    double w11 = wx * wy;
+
+    height = w00 * h00 + w01 * h01 + w10 * h10 + w11 * h11;
+    if (height > loc_iso.z())
+        return false;
+
+    normal = w00 * m_grid_normal[k00] + w01 * m_grid_normal[k01] + w10 * m_grid_normal[k10] + w11 * m_grid_normal[k11];
+    normal.Normalize();
+
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // Export all patch meshes
 // -----------------------------------------------------------------------------
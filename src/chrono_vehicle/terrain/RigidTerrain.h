@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "chrono/assets/ChColor.h"
+#include "chrono/core/ChVector2.h"
 #include "chrono/geometry/ChTriangleMeshConnected.h"
 #include "chrono/geometry/ChTriangleMeshSoup.h"
 #include "chrono/physics/ChBody.h"
@@ -76,6 +77,8 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         Patch();
 
         virtual bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const = 0;
+        virtual void ComputeBounds(double margin) = 0;
+        virtual void BuildHeightGrid(double spacing) {}
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) {}
         virtual void ExportMeshWavefront(const std::string& out_dir) {}
 
@@ -84,6 +87,10 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         float m_friction;                ///< coefficient of friction
         double m_radius;                 ///< bounding sphere radius
 
+        bool m_has_bounds;               ///< true if the horizontal bounds below were computed
+        ChVector2d m_min_xy;             ///< minimum horizontal coordinates (in ISO world frame)
+        ChVector2d m_max_xy;             ///< maximum horizontal coordinates (in ISO world frame)
+
         bool m_visualize;
         std::shared_ptr<ChVisualMaterial> m_vis_mat;
 
@@ -184,6 +191,20 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     /// default, this option is disabled.  This function must be called before Initialize.
     void UseLocationDependentFriction(bool val) { m_use_friction_functor = val; }
 
+    /// Enable use of baked height grids for terrain queries on mesh patches.
+    /// If enabled, a regular grid (with the specified spacing, in the horizontal plane of the world frame) of terrain
+    /// heights and normals is built from the triangular mesh of each mesh patch at initialization. Terrain queries
+    /// (GetHeight, GetNormal, GetProperties) use bilinear interpolation in this grid instead of ray casting, falling
+    /// back to ray casting at locations not covered by the grid or below the interpolated surface. Queries also skip
+    /// patches whose horizontal extent does not contain the query location. This assumes that patches do not move
+    /// after initialization and that mesh patches are height fields (a single surface point above any horizontal
+    /// location); the grid spacing should be small relative to the mesh features. By default, this option is
+    /// disabled. This function must be called before Initialize.
+    void UseHeightGrid(bool val, double spacing = 0.05) {
+        m_use_height_grid = val;
+        m_grid_spacing = spacing;
+    }
+
     /// Get the terrain height below the specified location.
     /// This function should return the height of the closest point *below* the specified location (in the direction of
     /// the current world vertical). If a user-provided functor object of type ChTerrain::HeightFunctor is provided,
@@ -217,6 +238,15 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
                                ChVector3d& normal,
                                float& friction) const override;
 
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// If all terrain queries can be answered from height grids (see UseHeightGrid) and no user-provided functors are
+    /// registered, the locations are processed in parallel (using the number of Chrono threads of the containing
+    /// system).
+    virtual void GetPropertiesBatch(const std::vector<ChVector3d>& loc,
+                                    std::vector<double>& height,
+                                    std::vector<ChVector3d>& normal,
+                                    std::vector<float>& friction) const override;
+
     /// Export all patch meshes as macros in PovRay include files.
     void ExportMeshPovray(const std::string& out_dir, bool smoothed = false);
 
@@ -243,6 +273,7 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         double m_hthickness;    ///< patch half-thickness
         virtual void Initialize() override;
         virtual bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const override;
+        virtual void ComputeBounds(double margin) override;
     };
 
     /// Patch represented as a mesh.
@@ -250,8 +281,20 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         std::shared_ptr<ChTriangleMeshConnected> m_trimesh;  ///< associated mesh (contact and visualization)
         std::shared_ptr<ChTriangleMeshSoup> m_trimesh_s;     ///< associated contact mesh soup
         std::string m_mesh_name;                             ///< name of associated mesh
+
+        double m_grid_spacing;                               ///< height grid spacing
+        ChVector2d m_grid_origin;                            ///< horizontal coordinates of first grid node (ISO frame)
+        int m_grid_nx;                                       ///< number of grid nodes in x direction
+        int m_grid_ny;                                       ///< number of grid nodes in y direction
+        std::vector<double> m_grid_height;                   ///< grid node heights (NaN if not covered by the mesh)
+        std::vector<ChVector3d> m_grid_normal;               ///< grid node normals (in world frame)
+
+        MeshPatch() : m_grid_spacing(0), m_grid_nx(0), m_grid_ny(0) {}
         virtual void Initialize() override;
         virtual bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const override;
+        virtual void ComputeBounds(double margin) override;
+        virtual void BuildHeightGrid(double spacing) override;
+        bool FindPointGrid(const ChVector3d& loc, double& height, ChVector3d& normal) const;
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) override;
         virtual void ExportMeshWavefront(const std::string& out_dir) override;
     };
@@ -260,6 +303,8 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     int m_num_patches;
     std::vector<std::shared_ptr<Patch>> m_patches;
     bool m_use_friction_functor;
+    bool m_use_height_grid;
+    double m_grid_spacing;
     std::shared_ptr<ChContactContainer::AddContactCallback> m_contact_callback;
 
     void AddPatch(std::shared_ptr<Patch> patch,
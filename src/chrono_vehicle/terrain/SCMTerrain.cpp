@@ -1031,8 +1031,8 @@ static const std::vector<ChVector2i> neighbors4{
     ChVector2i(0, 1)    // N
 };
 
-// Default implementation uses Map-Reduce for collecting ray intersection hits.
-// The alternative is to simultaenously load the global map of hits while ray casting (using a critical section).
+// Default implementation uses batched ray casting (see ChCollisionSystem::RayHitMulti) for collecting ray intersection
+// hits. The alternative is to simultaenously load the global map of hits while ray casting (using a critical section).
 ////#define RAY_CASTING_WITH_CRITICAL_SECTION
 
 // Reset the list of forces, and fills it with forces from a soil contact model.
@@ -1168,20 +1168,25 @@ void SCMLoader::ComputeInternalForces() {
 
 #else
 
-    // Map-reduce approach (to eliminate critical section)
+    // Batched ray casting (results are written lock-free in preallocated slots)
 
     const int nthreads = GetSystem()->GetNumThreadsChrono();
-    std::vector<std::unordered_map<ChVector2i, HitRecord, CoordHash>> t_hits(nthreads);
+    std::vector<ChCollisionSystem::ChRay> rays;
+    std::vector<ChCollisionSystem::ChRayhitResult> rayhit_results;
+    std::vector<ChVector2i> ray_nodes;
+    std::vector<char> ray_cast;
 
     // Loop through all moving patches (user-defined or default one)
     for (auto& p : m_patches) {
         m_timer_ray_testing.start();
 
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            int t_num = ChOMP::GetThreadNum();
+        // Create rays at all vertices in the patch range.
+        // Rays are stored in the order of the patch range, so that consecutive rays are spatially coherent.
+        int num_nodes = (int)p.m_range.size();
+        rays.resize(num_nodes);
+        ray_cast.resize(num_nodes);
+    #pragma omp parallel for num_threads(nthreads)
+        for (int k = 0; k < num_nodes; k++) {
             ChVector2i ij = p.m_range[k];
 
             // Move from (i, j) to (x, y, z) representation in the world frame
@@ -1192,42 +1197,47 @@ void SCMLoader::ComputeInternalForces() {
             ChVector3d vertex_abs = m_plane.TransformPointLocalToParent(ChVector3d(x, y, z));
 
             // Create ray at current grid location
-            ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector3d to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector3d from = to - m_Z * m_test_offset_down;
+            rays[k].to = vertex_abs + m_Z * m_test_offset_up;
+            rays[k].from = rays[k].to - m_Z * m_test_offset_down;
 
             // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
-
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
+            ray_cast[k] = !m_moving_patch || RayOBBtest(p, rays[k].from, m_Z);
+        }
 
-            if (mrayhit_result.hit) {
-                // Add to our map of hits to process
-                HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                t_hits[t_num].insert(std::make_pair(ij, record));
-            }
+        // Keep only the rays that passed the quick rejection test
+        int num_ray_casts = 0;
+        ray_nodes.clear();
+        for (int k = 0; k < num_nodes; k++) {
+            if (!ray_cast[k])
+                continue;
+            rays[num_ray_casts++] = rays[k];
+            ray_nodes.push_back(p.m_range[k]);
         }
+        rays.resize(num_ray_casts);
+
+        // Cast all rays into collision system
+        GetSystem()->GetCollisionSystem()->RayHitMulti(rays, rayhit_results);
 
         m_timer_ray_testing.stop();
 
         m_num_ray_casts += num_ray_casts;
 
         // Sequential insertion in global hits
-        for (int t_num = 0; t_num < nthreads; t_num++) {
-            for (auto& h : t_hits[t_num]) {
-                // If this is the first hit from this node, initialize the node record
-                if (m_grid_map.find(h.first) == m_grid_map.end()) {
-                    double z = GetInitHeight(h.first);
-                    m_grid_map.insert(std::make_pair(h.first, NodeRecord(z, z, GetInitNormal(h.first))));
-                }
-                ////hits.insert(h);
+        for (int k = 0; k < num_ray_casts; k++) {
+            if (!rayhit_results[k].hit)
+                continue;
+
+            const auto& ij = ray_nodes[k];
+
+            // If this is the first hit from this node, initialize the node record
+            if (m_grid_map.find(ij) == m_grid_map.end()) {
+                double z = GetInitHeight(ij);
+                m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, GetInitNormal(ij))));
             }
 
-            hits.insert(t_hits[t_num].begin(), t_hits[t_num].end());
-            t_hits[t_num].clear();
+            // Add to our map of hits to process
+            HitRecord record = {rayhit_results[k].hitModel->GetContactable(), rayhit_results[k].abs_hitPoint, -1};
+            hits.insert(std::make_pair(ij, record));
         }
         m_num_ray_hits = (int)hits.size();
     }
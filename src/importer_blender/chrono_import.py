@@ -37,6 +37,9 @@
 #   if a material is added to a visual shape in Chrono, it overrides the material you add to
 #   the asset object available in "chrono_assets" collection (unless you disable "Chrono materials" in
 #   the Chrono sidebar panel).
+# - if the Chrono app enables binary data with my_blender_exporter.SetUseBinaryData(true),
+#   each output/state00001.py file comes with a state00001.bin file holding the bulk data
+#   (object frames, particle positions, contacts) as raw arrays. It is loaded automatically.
 
 
 
@@ -95,6 +98,28 @@ chrono_view_link_csys_size = 0.25
 chrono_view_materials = True
 chrono_view_contacts = False
 chrono_gui_doupdate = True
+chrono_bin_data = []
+
+#
+# Load the binary data blocks saved by ChBlender next to a state file (if SetUseBinaryData(true)).
+# Layout: 8 bytes magic string, uint32 version, uint32 number of blocks, then for each block
+# an uint64 triplet (offset in bytes, rows, columns), followed by the raw double arrays.
+# Returns a list of 2D numpy arrays, referenced as chrono_bin_data[i] in statexxxyy.py files.
+#
+
+def load_chrono_binary_data(filename):
+    with open(filename, "rb") as f:
+        buffer = f.read()
+    if buffer[0:8] != b'CHBLBIN\x00':
+        print("not a Chrono binary data file: ", filename)
+        return []
+    version, num_blocks = np.frombuffer(buffer, dtype=np.uint32, count=2, offset=8)
+    index = np.frombuffer(buffer, dtype=np.uint64, count=3*int(num_blocks), offset=16).reshape(-1,3)
+    blocks = []
+    for offset, rows, cols in index:
+        block = np.frombuffer(buffer, dtype=np.float64, count=int(rows*cols), offset=int(offset))
+        blocks.append(block.reshape(int(rows), int(cols)))
+    return blocks
 
 #
 # utility functions to be used in assets.py  or   output/statexxxyy.py files
@@ -754,17 +779,30 @@ def make_chrono_object_clones(mname,mpos,mrot,
             print("not found asset: ",masset_list[m][0])
         
     ncl = len(list_clones_posrot)
-    verts = [(0,0,0)] * (4*ncl)
-    faces = [(0,0,0,0)] * ncl
     edges = []
-    for ic in range(ncl):
-        mpos = mathutils.Vector(list_clones_posrot[ic][0])
-        mrot = mathutils.Quaternion(list_clones_posrot[ic][1])
-        verts[4*ic]   = (mpos + mrot @ mathutils.Vector((-0.1,-0.1,0)))[:]
-        verts[4*ic+1] = (mpos + mrot @ mathutils.Vector(( 0.1,-0.1,0)))[:]
-        verts[4*ic+2] = (mpos + mrot @ mathutils.Vector(( 0.1, 0.1,0)))[:]
-        verts[4*ic+3] = (mpos + mrot @ mathutils.Vector((-0.1, 0.1,0)))[:]
-        faces[ic] = (4*ic, 4*ic+1, 4*ic+2, 4*ic+3)    
+    if isinstance(list_clones_posrot, np.ndarray):
+        # binary data: rows of (x,y,z, e0,e1,e2,e3), rotate the corners of all quads at once
+        pos = list_clones_posrot[:,0:3]
+        w = list_clones_posrot[:,3:4]
+        u = list_clones_posrot[:,4:7]
+        verts = np.empty((ncl,4,3))
+        for ik, corner in enumerate([(-0.1,-0.1,0), (0.1,-0.1,0), (0.1,0.1,0), (-0.1,0.1,0)]):
+            v = np.broadcast_to(np.array(corner), (ncl,3))
+            t = 2.0 * np.cross(u, v)
+            verts[:,ik,:] = pos + v + w * t + np.cross(u, t)
+        verts = verts.reshape(-1,3).tolist()
+        faces = np.arange(4*ncl).reshape(-1,4).tolist()
+    else:
+        verts = [(0,0,0)] * (4*ncl)
+        faces = [(0,0,0,0)] * ncl
+        for ic in range(ncl):
+            mpos = mathutils.Vector(list_clones_posrot[ic][0])
+            mrot = mathutils.Quaternion(list_clones_posrot[ic][1])
+            verts[4*ic]   = (mpos + mrot @ mathutils.Vector((-0.1,-0.1,0)))[:]
+            verts[4*ic+1] = (mpos + mrot @ mathutils.Vector(( 0.1,-0.1,0)))[:]
+            verts[4*ic+2] = (mpos + mrot @ mathutils.Vector(( 0.1, 0.1,0)))[:]
+            verts[4*ic+3] = (mpos + mrot @ mathutils.Vector((-0.1, 0.1,0)))[:]
+            faces[ic] = (4*ic, 4*ic+1, 4*ic+2, 4*ic+3)    
     new_mesh = bpy.data.meshes.new('mesh_position_clones')
     new_mesh.from_pydata(verts, edges, faces)
     new_mesh.update()
@@ -1336,6 +1374,7 @@ def callback_post(self):
     global chrono_view_materials
     global chrono_view_contacts
     global chrono_gui_doupdate
+    global chrono_bin_data
     
     chrono_assets = bpy.data.collections.get('chrono_assets')
     chrono_frame_assets = bpy.data.collections.get('chrono_frame_assets')
@@ -1397,6 +1436,12 @@ def callback_post(self):
             proj_dir = os.path.dirname(os.path.abspath(chrono_filename))
             filename = os.path.join(proj_dir, 'output', 'state'+'{:05d}'.format(cFrame)+'.py')
             
+            # Load binary data blocks referenced by the state file, if any
+            bin_filename = os.path.join(proj_dir, 'output', 'state'+'{:05d}'.format(cFrame)+'.bin')
+            chrono_bin_data = []
+            if os.path.exists(bin_filename):
+                chrono_bin_data = load_chrono_binary_data(bin_filename)
+            
             if os.path.exists(filename):
                 f = open(filename, "rb")
                 exec(compile(f.read(), filename, 'exec'))
@@ -0,0 +1,139 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Microbenchmark for the loading of FEA residuals (ChMesh internal forces and
+// mass-matrix products) on a square plate of ANCF shell elements, for different
+// mesh sizes and different numbers of Chrono threads.
+//
+// Use --benchmark_out=<file> --benchmark_out_format=json to save a baseline.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementShellANCF_3423.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// =============================================================================
+
+static void SweepSizeThreads(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"div", "threads"});
+    for (int num_div = 16; num_div <= 64; num_div *= 2) {
+        for (int nthreads = 1; nthreads <= 8; nthreads *= 2)
+            b->Args({num_div, nthreads});
+    }
+}
+
+class MeshFixture : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        int N = (int)st.range(0);
+        int nthreads = (int)st.range(1);
+
+        m_system = new ChSystemSMC();
+        m_system->SetGravitationalAcceleration(ChVector3d(0, 0, -9.8));
+        m_system->SetNumThreads(nthreads, 1, 1);
+
+        double length = 1;
+        double thickness = 0.01;
+        double rho = 500;
+        ChVector3d E(2.1e7, 2.1e7, 2.1e7);
+        ChVector3d nu(0.3, 0.3, 0.3);
+        ChVector3d G(8.0769231e6, 8.0769231e6, 8.0769231e6);
+        auto mat = chrono_types::make_shared<ChMaterialShellANCF>(rho, E, nu, G);
+
+        // Square plate of NxN shell elements
+        m_mesh = chrono_types::make_shared<ChMesh>();
+        m_system->Add(m_mesh);
+
+        double dx = length / N;
+        ChVector3d dir(0, 0, 1);
+        std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+        for (int j = 0; j <= N; j++) {
+            for (int i = 0; i <= N; i++) {
+                auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector3d(i * dx, j * dx, 0), dir);
+                node->SetFixed(j == 0);
+                m_mesh->AddNode(node);
+                nodes.push_back(node);
+            }
+        }
+
+        for (int j = 0; j < N; j++) {
+            for (int i = 0; i < N; i++) {
+                int n0 = j * (N + 1) + i;
+                auto element = chrono_types::make_shared<ChElementShellANCF_3423>();
+                element->SetNodes(nodes[n0], nodes[n0 + 1], nodes[n0 + N + 2], nodes[n0 + N + 1]);
+                element->SetDimensions(dx, dx);
+                element->AddLayer(thickness, 0 * CH_DEG_TO_RAD, mat);
+                element->SetAlphaDamp(0.0);
+                m_mesh->AddElement(element);
+            }
+        }
+
+        // Initialize the system and set up the state offsets
+        m_system->Update();
+        m_system->Setup();
+
+        m_R.setZero(m_system->GetNumCoordsVelLevel());
+        m_w.setOnes(m_system->GetNumCoordsVelLevel());
+    }
+
+    void TearDown(const ::benchmark::State&) override {
+        m_mesh.reset();
+        delete m_system;
+    }
+
+    void Report(benchmark::State& st) {
+        st.SetItemsProcessed(st.iterations() * m_mesh->GetNumElements());
+        st.counters["Elements"] = m_mesh->GetNumElements();
+        st.counters["Colors"] = m_mesh->GetNumElementColors();
+    }
+
+  protected:
+    ChSystemSMC* m_system;
+    std::shared_ptr<ChMesh> m_mesh;
+    ChVectorDynamic<> m_R;
+    ChVectorDynamic<> m_w;
+};
+
+// =============================================================================
+
+BENCHMARK_DEFINE_F(MeshFixture, LoadResidual_F)(benchmark::State& st) {
+    while (st.KeepRunning()) {
+        m_R.setZero();
+        m_system->LoadResidual_F(m_R, 1.0);
+    }
+    Report(st);
+}
+BENCHMARK_REGISTER_F(MeshFixture, LoadResidual_F)
+    ->Apply(SweepSizeThreads)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_DEFINE_F(MeshFixture, LoadResidual_Mv)(benchmark::State& st) {
+    while (st.KeepRunning()) {
+        m_R.setZero();
+        m_system->LoadResidual_Mv(m_R, m_w, 1.0);
+    }
+    Report(st);
+}
+BENCHMARK_REGISTER_F(MeshFixture, LoadResidual_Mv)
+    ->Apply(SweepSizeThreads)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -40,7 +40,7 @@ using namespace chrono;
 
 class SettlingSMC : public utils::ChBenchmarkTest {
   public:
-    SettlingSMC();
+    SettlingSMC(bool persistent_broadphase = false);
     ~SettlingSMC() { delete m_system; }
 
     void SetNumthreads(int nthreads) { m_system->SetNumThreads(nthreads); }
@@ -56,7 +56,7 @@ class SettlingSMC : public utils::ChBenchmarkTest {
     unsigned int m_num_particles;
 };
 
-SettlingSMC::SettlingSMC() : m_system(new ChSystemMulticoreSMC), m_step(1e-3) {
+SettlingSMC::SettlingSMC(bool persistent_broadphase) : m_system(new ChSystemMulticoreSMC), m_step(1e-3) {
     // Simulation parameters
     double gravity = 9.81;
 
@@ -72,6 +72,7 @@ SettlingSMC::SettlingSMC() : m_system(new ChSystemMulticoreSMC), m_step(1e-3) {
 
     m_system->GetSettings()->collision.narrowphase_algorithm = ChNarrowphase::Algorithm::HYBRID;
     m_system->GetSettings()->collision.bins_per_axis = vec3(10, 10, 1);
+    m_system->GetSettings()->collision.broadphase_persistent = persistent_broadphase;
 
     // The following two lines are optional, since they are the default options.
     m_system->GetSettings()->solver.contact_force_model = ChSystemSMC::ContactForceModel::Hertz;
@@ -174,6 +175,32 @@ BENCHMARK_REGISTER_F(TEST_NAME, Settle)
     ->UseRealTime()
     ->DenseRange(TEST_MIN_THREADS, TEST_MAX_THREADS, TEST_STEP_THREADS);
 
+// Same test, using the persistent broadphase
+class SettlingSMCpersistent : public SettlingSMC {
+  public:
+    SettlingSMCpersistent() : SettlingSMC(true) {}
+};
+
+using TEST_NAME_P = chrono::utils::ChBenchmarkFixture<SettlingSMCpersistent, 0>;
+BENCHMARK_DEFINE_F(TEST_NAME_P, SettlePersistent)(benchmark::State& st) {
+    Reset(NUM_SKIP_STEPS);
+    m_test->SetNumthreads((int)st.range(0));
+    while (st.KeepRunning()) {
+        m_test->Simulate(NUM_SIM_STEPS);
+    }
+    Report(st);
+    std::cout << "Simulated " << m_test->GetNumParticles() << " particles (persistent broadphase) ";
+#pragma omp parallel
+#pragma omp master
+    std::cout << "using " << ChOMP::GetNumThreads() << " threads." << std::endl;
+}
+BENCHMARK_REGISTER_F(TEST_NAME_P, SettlePersistent)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1)
+    ->Repetitions(1)
+    ->UseRealTime()
+    ->DenseRange(TEST_MIN_THREADS, TEST_MAX_THREADS, TEST_STEP_THREADS);
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
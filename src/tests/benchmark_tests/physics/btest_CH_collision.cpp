@@ -0,0 +1,147 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Microbenchmark for collision detection.
+// A lattice of slightly overlapping bodies is created, with shapes alternating
+// between the two shapes of a given pair. Collision detection is repeatedly
+// invoked (without advancing the system state), for all pairs of primitive
+// shapes, for the Bullet and multicore collision systems, and for different
+// numbers of collision threads. Broad-phase and narrow-phase times per call are
+// reported as counters.
+//
+// Use --benchmark_out=<file> --benchmark_out_format=json to save a baseline.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+enum ShapeType { SPHERE, BOX, CYLINDER, CAPSULE, NUM_SHAPES };
+
+static const char* ShapeName(int shape) {
+    static const char* names[] = {"sphere", "box", "cylinder", "capsule"};
+    return names[shape];
+}
+
+// Create a body of given shape, with unit characteristic size
+static std::shared_ptr<ChBody> CreateBody(int shape, std::shared_ptr<ChContactMaterial> mat) {
+    switch (shape) {
+        case SPHERE:
+            return chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+        case BOX:
+            return chrono_types::make_shared<ChBodyEasyBox>(1.0, 1.0, 1.0, 1000, false, true, mat);
+        case CYLINDER:
+            return chrono_types::make_shared<ChBodyEasyCylinder>(ChAxis::Z, 0.5, 1.0, 1000, false, true, mat);
+        case CAPSULE:
+        default: {
+            auto body = chrono_types::make_shared<ChBody>();
+            utils::AddCapsuleGeometry(body.get(), mat, 0.5, 0.5, VNULL, QUNIT, false);
+            body->EnableCollision(true);
+            return body;
+        }
+    }
+}
+
+// Encode the shape pair (A,B) with A <= B as a single benchmark argument
+static void SweepShapePairs(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"pair", "threads"});
+    for (int a = 0; a < NUM_SHAPES; a++) {
+        for (int b2 = a; b2 < NUM_SHAPES; b2++) {
+            for (int nthreads = 1; nthreads <= 8; nthreads *= 2)
+                b->Args({a * NUM_SHAPES + b2, nthreads});
+        }
+    }
+}
+
+// =============================================================================
+
+template <ChCollisionSystem::Type COLL_TYPE>
+class CollisionFixture : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        int shapeA = (int)st.range(0) / NUM_SHAPES;
+        int shapeB = (int)st.range(0) % NUM_SHAPES;
+        int nthreads = (int)st.range(1);
+
+        m_system = new ChSystemNSC();
+        m_system->SetCollisionSystemType(COLL_TYPE);
+        m_system->SetGravitationalAcceleration(ChVector3d(0, 0, 0));
+        m_system->SetNumThreads(1, nthreads, 1);
+
+        // Lattice of bodies, with neighbors overlapping by 5% of the body size
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+        int n = 12;
+        double spacing = 0.95;
+        for (int ix = 0; ix < n; ix++) {
+            for (int iy = 0; iy < n; iy++) {
+                for (int iz = 0; iz < n; iz++) {
+                    auto body = CreateBody((ix + iy + iz) % 2 == 0 ? shapeA : shapeB, mat);
+                    body->SetPos(spacing * ChVector3d(ix, iy, iz));
+                    m_system->AddBody(body);
+                }
+            }
+        }
+
+        // Initialize the system and the collision system
+        m_system->DoStepDynamics(1e-8);
+
+        m_label = std::string(ShapeName(shapeA)) + "-" + ShapeName(shapeB);
+    }
+
+    void TearDown(const ::benchmark::State&) override { delete m_system; }
+
+    void Run(benchmark::State& st) {
+        double time_broad = 0;
+        double time_narrow = 0;
+        while (st.KeepRunning()) {
+            m_system->ComputeCollisions();
+            time_broad += m_system->GetTimerCollisionBroad();
+            time_narrow += m_system->GetTimerCollisionNarrow();
+        }
+        auto num_it = st.iterations();
+        st.SetLabel(m_label);
+        st.counters["CD_Broad"] = time_broad * 1e3 / num_it;
+        st.counters["CD_Narrow"] = time_narrow * 1e3 / num_it;
+        st.counters["Contacts"] = m_system->GetNumContacts();
+    }
+
+  protected:
+    ChSystemNSC* m_system;
+    std::string m_label;
+};
+
+// =============================================================================
+
+BENCHMARK_TEMPLATE_DEFINE_F(CollisionFixture, Bullet, ChCollisionSystem::Type::BULLET)(benchmark::State& st) {
+    Run(st);
+}
+BENCHMARK_REGISTER_F(CollisionFixture, Bullet)->Apply(SweepShapePairs)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+#ifdef CHRONO_COLLISION
+BENCHMARK_TEMPLATE_DEFINE_F(CollisionFixture, Multicore, ChCollisionSystem::Type::MULTICORE)(benchmark::State& st) {
+    Run(st);
+}
+BENCHMARK_REGISTER_F(CollisionFixture, Multicore)
+    ->Apply(SweepShapePairs)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+#endif
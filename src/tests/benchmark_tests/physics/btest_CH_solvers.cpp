@@ -0,0 +1,227 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Microbenchmark for the Chrono solvers.
+// Each solver type is run repeatedly on a fixed problem, recorded in a system
+// descriptor at the end of a short simulation:
+// - VI solvers: granular pile with NSC frictional contacts
+// - linear solvers: chain of bodies connected by revolute joints (SMC system)
+// Setup and solve times per call are reported as counters, for different
+// numbers of Chrono threads.
+//
+// Use --benchmark_out=<file> --benchmark_out_format=json to save a baseline.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/core/ChTimer.h"
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+#include "chrono/solver/ChSolverADMM.h"
+#include "chrono/solver/ChSolverAPGD.h"
+#include "chrono/solver/ChSolverBB.h"
+#include "chrono/solver/ChSolverPJacobi.h"
+#include "chrono/solver/ChSolverPMINRES.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSORcolored.h"
+#include "chrono/solver/ChSolverPSSOR.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+static std::shared_ptr<ChSolver> CreateSolver(ChSolver::Type type) {
+    switch (type) {
+        case ChSolver::Type::PSOR:
+            return chrono_types::make_shared<ChSolverPSOR>();
+        case ChSolver::Type::PSSOR:
+            return chrono_types::make_shared<ChSolverPSSOR>();
+        case ChSolver::Type::PSOR_COLORED:
+            return chrono_types::make_shared<ChSolverPSORcolored>();
+        case ChSolver::Type::PJACOBI:
+            return chrono_types::make_shared<ChSolverPJacobi>();
+        case ChSolver::Type::PMINRES:
+            return chrono_types::make_shared<ChSolverPMINRES>();
+        case ChSolver::Type::BARZILAIBORWEIN:
+            return chrono_types::make_shared<ChSolverBB>();
+        case ChSolver::Type::APGD:
+            return chrono_types::make_shared<ChSolverAPGD>();
+        case ChSolver::Type::ADMM:
+            return chrono_types::make_shared<ChSolverADMM>();
+        case ChSolver::Type::SPARSE_LU:
+            return chrono_types::make_shared<ChSolverSparseLU>();
+        case ChSolver::Type::SPARSE_QR:
+            return chrono_types::make_shared<ChSolverSparseQR>();
+        case ChSolver::Type::GMRES:
+            return chrono_types::make_shared<ChSolverGMRES>();
+        case ChSolver::Type::MINRES:
+            return chrono_types::make_shared<ChSolverMINRES>();
+        case ChSolver::Type::BICGSTAB:
+            return chrono_types::make_shared<ChSolverBiCGSTAB>();
+        default:
+            return nullptr;
+    }
+}
+
+static void SweepThreads(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"threads"});
+    for (int nthreads = 1; nthreads <= 8; nthreads *= 2)
+        b->Arg(nthreads);
+}
+
+// =============================================================================
+
+// Base fixture: records the system descriptor at the end of a short simulation and repeatedly solves the recorded
+// problem with the solver of given type.
+class SolverFixture : public ::benchmark::Fixture {
+  public:
+    void TearDown(const ::benchmark::State&) override {
+        m_descriptor.reset();
+        delete m_system;
+    }
+
+    void Run(benchmark::State& st, ChSolver::Type type) {
+        auto solver = CreateSolver(type);
+        solver->SetNumThreads((int)st.range(0));
+        if (auto iterative = solver->AsIterative()) {
+            iterative->SetMaxIterations(100);
+            iterative->SetTolerance(1e-8);
+            iterative->EnableWarmStart(false);
+        }
+
+        ChTimer timer_setup;
+        ChTimer timer_solve;
+        while (st.KeepRunning()) {
+            timer_setup.start();
+            solver->Setup(*m_descriptor);
+            timer_setup.stop();
+            timer_solve.start();
+            solver->Solve(*m_descriptor);
+            timer_solve.stop();
+        }
+
+        auto num_it = st.iterations();
+        st.counters["SIZE"] = m_descriptor->CountActiveVariables() + m_descriptor->CountActiveConstraints();
+        st.counters["LS_Setup"] = timer_setup() * 1e3 / num_it;
+        st.counters["LS_Solve"] = timer_solve() * 1e3 / num_it;
+        if (auto iterative = solver->AsIterative())
+            st.counters["Iterations"] = iterative->GetIterations();
+    }
+
+  protected:
+    // Simulate the system for the given number of steps and keep the descriptor of the last step.
+    void Record(int num_steps, double step) {
+        for (int i = 0; i < num_steps; i++)
+            m_system->DoStepDynamics(step);
+        m_descriptor = m_system->GetSystemDescriptor();
+    }
+
+    ChSystem* m_system;
+    std::shared_ptr<ChSystemDescriptor> m_descriptor;
+};
+
+// Granular pile with NSC frictional contacts (problem for VI solvers).
+class SolverFixtureVI : public SolverFixture {
+  public:
+    void SetUp(const ::benchmark::State&) override {
+        m_system = new ChSystemNSC();
+        m_system->SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+        m_system->SetSolverType(ChSolver::Type::PSOR);
+        m_system->GetSolver()->AsIterative()->SetMaxIterations(50);
+
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+        mat->SetFriction(0.4f);
+        utils::CreateBoxContainer(m_system, mat, ChVector3d(2, 2, 2), 0.1);
+
+        double radius = 0.1;
+        for (int ix = 0; ix < 9; ix++) {
+            for (int iy = 0; iy < 9; iy++) {
+                for (int iz = 0; iz < 6; iz++) {
+                    auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+                    ball->SetPos(ChVector3d(0.21 * (ix - 4), 0.21 * (iy - 4), radius + 0.21 * iz + 0.01 * ix));
+                    m_system->AddBody(ball);
+                }
+            }
+        }
+
+        Record(200, 2e-3);
+    }
+};
+
+// Chain of bodies connected by revolute joints, SMC formulation (problem for linear solvers).
+class SolverFixtureLS : public SolverFixture {
+  public:
+    void SetUp(const ::benchmark::State&) override {
+        m_system = new ChSystemSMC();
+        m_system->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+        m_system->SetSolverType(ChSolver::Type::SPARSE_LU);
+
+        auto ground = chrono_types::make_shared<ChBody>();
+        ground->SetFixed(true);
+        m_system->AddBody(ground);
+
+        double length = 0.25;
+        auto prev = ground;
+        for (int i = 0; i < 500; i++) {
+            auto link = chrono_types::make_shared<ChBodyEasyBox>(length, 0.02, 0.02, 1000, false, false);
+            link->SetPos(ChVector3d((i + 0.5) * length, 0, 0));
+            m_system->AddBody(link);
+
+            auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+            joint->Initialize(prev, link, ChFrame<>(ChVector3d(i * length, 0, 0), QUNIT));
+            m_system->AddLink(joint);
+
+            prev = link;
+        }
+
+        Record(20, 1e-3);
+    }
+};
+
+// =============================================================================
+
+#define BM_SOLVER_VI(TYPE)                                                        \
+    BENCHMARK_DEFINE_F(SolverFixtureVI, TYPE)(benchmark::State & st) {            \
+        Run(st, ChSolver::Type::TYPE);                                            \
+    }                                                                             \
+    BENCHMARK_REGISTER_F(SolverFixtureVI, TYPE)->Apply(SweepThreads)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+#define BM_SOLVER_LS(TYPE)                                                        \
+    BENCHMARK_DEFINE_F(SolverFixtureLS, TYPE)(benchmark::State & st) {            \
+        Run(st, ChSolver::Type::TYPE);                                            \
+    }                                                                             \
+    BENCHMARK_REGISTER_F(SolverFixtureLS, TYPE)->Apply(SweepThreads)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BM_SOLVER_VI(PSOR)
+BM_SOLVER_VI(PSSOR)
+BM_SOLVER_VI(PSOR_COLORED)
+BM_SOLVER_VI(PJACOBI)
+BM_SOLVER_VI(PMINRES)
+BM_SOLVER_VI(BARZILAIBORWEIN)
+BM_SOLVER_VI(APGD)
+BM_SOLVER_VI(ADMM)
+
+BM_SOLVER_LS(SPARSE_LU)
+BM_SOLVER_LS(SPARSE_QR)
+BM_SOLVER_LS(GMRES)
+BM_SOLVER_LS(MINRES)
+BM_SOLVER_LS(BICGSTAB)
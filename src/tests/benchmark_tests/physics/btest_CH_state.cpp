@@ -0,0 +1,117 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Microbenchmark for state gather/scatter operations (ChSystem::StateGather and
+// ChSystem::StateScatter) on systems of bodies connected by joints, for
+// different problem sizes and different numbers of Chrono threads.
+//
+// Use --benchmark_out=<file> --benchmark_out_format=json to save a baseline.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+static void SweepSizeThreads(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"bodies", "threads"});
+    for (int num_bodies = 100; num_bodies <= 10000; num_bodies *= 10) {
+        for (int nthreads = 1; nthreads <= 8; nthreads *= 2)
+            b->Args({num_bodies, nthreads});
+    }
+}
+
+class StateFixture : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        int num_bodies = (int)st.range(0);
+        int nthreads = (int)st.range(1);
+
+        m_system = new ChSystemNSC();
+        m_system->SetNumThreads(nthreads, 1, 1);
+
+        // Chains of 10 bodies connected by revolute joints
+        std::shared_ptr<ChBody> prev;
+        for (int i = 0; i < num_bodies; i++) {
+            auto body = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.02, 0.02, 1000, false, false);
+            body->SetPos(ChVector3d(0.2 * (i % 10), 0.1 * (i / 10), 0));
+            m_system->AddBody(body);
+
+            if (i % 10 != 0) {
+                auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+                joint->Initialize(prev, body, ChFrame<>(ChVector3d(0.2 * (i % 10) - 0.1, 0.1 * (i / 10), 0), QUNIT));
+                m_system->AddLink(joint);
+            }
+
+            prev = body;
+        }
+
+        // Initialize the system and set up the state offsets
+        m_system->Update();
+        m_system->Setup();
+
+        m_x.setZero(m_system->GetNumCoordsPosLevel(), m_system);
+        m_v.setZero(m_system->GetNumCoordsVelLevel(), m_system);
+        m_system->StateGather(m_x, m_v, m_T);
+    }
+
+    void TearDown(const ::benchmark::State&) override { delete m_system; }
+
+    void Report(benchmark::State& st) {
+        st.SetItemsProcessed(st.iterations() * m_system->GetBodies().size());
+        st.counters["DOFs"] = m_system->GetNumCoordsVelLevel();
+    }
+
+  protected:
+    ChSystemNSC* m_system;
+    ChState m_x;
+    ChStateDelta m_v;
+    double m_T;
+};
+
+// =============================================================================
+
+BENCHMARK_DEFINE_F(StateFixture, Gather)(benchmark::State& st) {
+    while (st.KeepRunning()) {
+        m_system->StateGather(m_x, m_v, m_T);
+    }
+    Report(st);
+}
+BENCHMARK_REGISTER_F(StateFixture, Gather)->Apply(SweepSizeThreads)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+BENCHMARK_DEFINE_F(StateFixture, Scatter)(benchmark::State& st) {
+    while (st.KeepRunning()) {
+        m_system->StateScatter(m_x, m_v, m_T, false);
+    }
+    Report(st);
+}
+BENCHMARK_REGISTER_F(StateFixture, Scatter)->Apply(SweepSizeThreads)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+BENCHMARK_DEFINE_F(StateFixture, ScatterFullUpdate)(benchmark::State& st) {
+    while (st.KeepRunning()) {
+        m_system->StateScatter(m_x, m_v, m_T, true);
+    }
+    Report(st);
+}
+BENCHMARK_REGISTER_F(StateFixture, ScatterFullUpdate)
+    ->Apply(SweepSizeThreads)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
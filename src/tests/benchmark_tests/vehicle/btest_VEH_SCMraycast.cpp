@@ -0,0 +1,112 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Microbenchmark for SCM ray casting.
+// A set of fixed wheel-like cylinders is placed in contact with an SCM terrain
+// patch, each monitored by a moving patch. The SCM loader (ray casting, contact
+// patches, and contact forces) is repeatedly invoked without advancing the
+// system state, for different SCM grid resolutions and numbers of threads.
+// Ray casting times and counts per call are reported as counters.
+//
+// Use --benchmark_out=<file> --benchmark_out_format=json to save a baseline.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// =============================================================================
+
+static void SweepResolutionThreads(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"div", "threads"});
+    for (int num_div = 250; num_div <= 1000; num_div *= 2) {
+        for (int nthreads = 1; nthreads <= 8; nthreads *= 2)
+            b->Args({num_div, nthreads});
+    }
+}
+
+class SCMFixture : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        int num_div = (int)st.range(0);
+        int nthreads = (int)st.range(1);
+
+        double patch_size = 10;
+        double radius = 0.5;
+        double width = 0.3;
+
+        m_system = new ChSystemSMC();
+        m_system->SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+        m_system->SetNumThreads(nthreads, 1, 1);
+
+        m_terrain = new SCMTerrain(m_system, false);
+        m_terrain->SetSoilParameters(2e6, 0, 1.1, 0, 30, 0.01, 2e8, 3e4);
+
+        // Grid of wheels, slightly sunk into the terrain
+        auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+        for (int ix = 0; ix < 4; ix++) {
+            for (int iy = 0; iy < 4; iy++) {
+                auto wheel = chrono_types::make_shared<ChBodyEasyCylinder>(ChAxis::Y, radius, width, 1000, mat);
+                wheel->SetPos(ChVector3d(2.0 * ix - 3.0, 2.0 * iy - 3.0, radius - 0.02));
+                wheel->SetFixed(true);
+                m_system->AddBody(wheel);
+                m_terrain->AddMovingPatch(wheel, VNULL, ChVector3d(2 * radius, width, 2 * radius));
+            }
+        }
+
+        m_terrain->Initialize(patch_size, patch_size, patch_size / num_div);
+
+        // Initialize the system
+        m_system->Update();
+    }
+
+    void TearDown(const ::benchmark::State&) override {
+        delete m_terrain;
+        delete m_system;
+    }
+
+  protected:
+    ChSystemSMC* m_system;
+    SCMTerrain* m_terrain;
+};
+
+// =============================================================================
+
+BENCHMARK_DEFINE_F(SCMFixture, RayCasting)(benchmark::State& st) {
+    double time_ray_testing = 0;
+    double time_ray_casting = 0;
+    while (st.KeepRunning()) {
+        // The SCM loader processes the terrain during system setup
+        m_system->Setup();
+        time_ray_testing += m_terrain->GetTimerRayTesting();
+        time_ray_casting += m_terrain->GetTimerRayCasting();
+    }
+    auto num_it = st.iterations();
+    st.counters["Ray_Testing"] = time_ray_testing / num_it;
+    st.counters["Ray_Casting"] = time_ray_casting / num_it;
+    st.counters["Ray_Casts"] = m_terrain->GetNumRayCasts();
+    st.counters["Ray_Hits"] = m_terrain->GetNumRayHits();
+}
+BENCHMARK_REGISTER_F(SCMFixture, RayCasting)
+    ->Apply(SweepResolutionThreads)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,148 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Chrono::Multicore unit test for batched narrowphase collision detection.
+// A random set of overlapping shapes is processed with and without batching of
+// the candidate pairs (i.e., with the SIMD batched kernels and with the scalar
+// narrowphase routines). The same contacts must be generated, in the same order.
+// The shape set either mixes spheres, boxes, capsules, and cylinders, or only
+// includes spheres (so that all pairs are evaluated by the batched kernels).
+//
+// =============================================================================
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/ChCollisionShapeCapsule.h"
+#include "chrono/collision/ChCollisionShapeCylinder.h"
+#include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
+
+using namespace chrono;
+
+struct ContactData {
+    ChVector3d pA;
+    ChVector3d pB;
+    ChVector3d normal;
+    double distance;
+    double eff_radius;
+};
+
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        contacts.push_back({pA, pB, plane_coord.GetAxisX(), distance, eff_radius});
+        return true;
+    }
+
+    std::vector<ContactData> contacts;
+};
+
+static std::vector<ContactData> Collide(ChNarrowphase::Algorithm algorithm, bool batching, bool only_spheres) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, 0));
+    sys.SetNumThreads(1);
+
+    auto coll_sys = std::static_pointer_cast<ChCollisionSystemMulticore>(sys.GetCollisionSystem());
+    coll_sys->SetNarrowphaseAlgorithm(algorithm);
+    coll_sys->EnableNarrowphaseBatching(batching);
+    coll_sys->SetEnvelope(0.01);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> pos_dist(-1.5, 1.5);
+    std::uniform_real_distribution<double> size_dist(0.15, 0.35);
+    std::uniform_real_distribution<double> angle_dist(-CH_PI, CH_PI);
+
+    for (int i = 0; i < 200; i++) {
+        double size = size_dist(generator);
+        std::shared_ptr<ChBody> body;
+        switch (only_spheres ? 0 : i % 4) {
+            case 0:
+            case 1:
+                body = chrono_types::make_shared<ChBodyEasySphere>(size, 1000, false, true, mat);
+                break;
+            case 2:
+                body = chrono_types::make_shared<ChBodyEasyBox>(2 * size, 1.5 * size, size, 1000, false, true, mat);
+                break;
+            case 3:
+                body = chrono_types::make_shared<ChBody>();
+                if (i % 8 == 3) {
+                    auto shape = chrono_types::make_shared<ChCollisionShapeCapsule>(mat, 0.5 * size, 2 * size);
+                    body->AddCollisionShape(shape);
+                } else {
+                    auto shape = chrono_types::make_shared<ChCollisionShapeCylinder>(mat, 0.5 * size, 2 * size);
+                    body->AddCollisionShape(shape);
+                }
+                body->EnableCollision(true);
+                break;
+        }
+        body->SetPos(ChVector3d(pos_dist(generator), pos_dist(generator), pos_dist(generator)));
+        body->SetRot(QuatFromAngleX(angle_dist(generator)) * QuatFromAngleZ(angle_dist(generator)));
+        sys.AddBody(body);
+    }
+
+    sys.DoStepDynamics(1e-4);
+
+    auto collector = chrono_types::make_shared<ContactCollector>();
+    sys.GetContactContainer()->ReportAllContacts(collector);
+
+    return collector->contacts;
+}
+
+static void CompareContacts(ChNarrowphase::Algorithm algorithm, bool only_spheres = false) {
+    auto ref = Collide(algorithm, false, only_spheres);
+    auto res = Collide(algorithm, true, only_spheres);
+
+    ASSERT_GT(ref.size(), 100u);
+    ASSERT_EQ(ref.size(), res.size());
+    for (size_t i = 0; i < ref.size(); i++) {
+        ASSERT_NEAR(ref[i].distance, res[i].distance, 1e-10);
+        ASSERT_NEAR(ref[i].eff_radius, res[i].eff_radius, 1e-10);
+        ASSERT_NEAR((ref[i].pA - res[i].pA).Length(), 0.0, 1e-10);
+        ASSERT_NEAR((ref[i].pB - res[i].pB).Length(), 0.0, 1e-10);
+        ASSERT_NEAR((ref[i].normal - res[i].normal).Length(), 0.0, 1e-10);
+    }
+}
+
+TEST(ChNarrowphase, batched_prims) {
+    CompareContacts(ChNarrowphase::Algorithm::PRIMS);
+}
+
+TEST(ChNarrowphase, batched_hybrid) {
+    CompareContacts(ChNarrowphase::Algorithm::HYBRID);
+}
+
+TEST(ChNarrowphase, batched_spheres) {
+    CompareContacts(ChNarrowphase::Algorithm::PRIMS, true);
+}
+
+TEST(ChNarrowphase, batched_vectorized) {
+#if defined(CHRONO_SIMD_ENABLED) && defined(CHRONO_HAS_AVX) && defined(USE_COLLISION_DOUBLE)
+    ASSERT_TRUE(ChNarrowphase::IsBatchingVectorized());
+#endif
+}
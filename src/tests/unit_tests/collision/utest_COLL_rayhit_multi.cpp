@@ -0,0 +1,99 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for batched ray-hit tests (ChCollisionSystem::RayHitMulti).
+// A grid of vertical rays is cast over a set of bodies, both one ray at a time
+// and as a batch. The results of the two approaches must be identical.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/ChConfig.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class RayHitMultiTest : public ::testing::TestWithParam<ChCollisionSystem::Type> {};
+
+TEST_P(RayHitMultiTest, batch_vs_single) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(GetParam());
+    sys.SetNumThreads(1, 4, 1);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 5; i++) {
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+        sphere->SetPos(ChVector3d(-3.0 + 1.5 * i, 0.5 * i - 1.0, 0.5 + 0.2 * i));
+        sys.AddBody(sphere);
+
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.8, 0.6, 0.4, 1000, false, true, mat);
+        box->SetPos(ChVector3d(-3.0 + 1.5 * i, 2.0 - 0.5 * i, 0.2));
+        sys.AddBody(box);
+    }
+
+    // Run collision detection once to initialize the collision system
+    sys.DoStepDynamics(1e-4);
+
+    // Grid of vertical rays, some of them missing all objects
+    std::vector<ChCollisionSystem::ChRay> rays;
+    for (int ix = 0; ix < 60; ix++) {
+        for (int iy = 0; iy < 60; iy++) {
+            ChCollisionSystem::ChRay ray;
+            ray.from = ChVector3d(-6.0 + 0.2 * ix, -6.0 + 0.2 * iy, 3.0);
+            ray.to = ChVector3d(-6.0 + 0.2 * ix, -6.0 + 0.2 * iy, -0.5);
+            rays.push_back(ray);
+        }
+    }
+
+    auto coll_sys = sys.GetCollisionSystem();
+
+    std::vector<ChCollisionSystem::ChRayhitResult> results;
+    coll_sys->RayHitMulti(rays, results);
+    ASSERT_EQ(results.size(), rays.size());
+
+    int num_hits = 0;
+    for (size_t i = 0; i < rays.size(); i++) {
+        ChCollisionSystem::ChRayhitResult result;
+        coll_sys->RayHit(rays[i].from, rays[i].to, result);
+        ASSERT_EQ(result.hit, results[i].hit);
+        if (!result.hit)
+            continue;
+        num_hits++;
+        ASSERT_EQ(result.hitModel, results[i].hitModel);
+        ASSERT_NEAR(result.dist_factor, results[i].dist_factor, 1e-6);
+        ASSERT_NEAR(result.abs_hitPoint.z(), results[i].abs_hitPoint.z(), 1e-6);
+    }
+
+    // Rays outside the ground box must miss
+    ASSERT_GT(num_hits, 0);
+    ASSERT_LT(num_hits, (int)rays.size());
+}
+
+#ifdef CHRONO_COLLISION
+INSTANTIATE_TEST_SUITE_P(ChronoCollision,
+                         RayHitMultiTest,
+                         ::testing::Values(ChCollisionSystem::Type::BULLET, ChCollisionSystem::Type::MULTICORE));
+#else
+INSTANTIATE_TEST_SUITE_P(ChronoCollision, RayHitMultiTest, ::testing::Values(ChCollisionSystem::Type::BULLET));
+#endif
@@ -0,0 +1,167 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the hierarchical profiler (ChProfiler).
+// Checks the zone hierarchy, call counts, merging of zones recorded on multiple
+// threads, and the Chrome trace output.
+//
+// =============================================================================
+
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "chrono/utils/ChProfiler.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono::utils;
+
+// Do some work, so that zones have a non-zero duration
+static double Work(int n) {
+    double sum = 0;
+    for (int i = 0; i < n; i++)
+        sum += std::sqrt(1.0 + i);
+    return sum;
+}
+
+static int FindZone(const std::vector<ChProfileZoneStats>& stats,
+                    const std::string& name,
+                    const std::string& category = "") {
+    for (int i = 0; i < (int)stats.size(); i++) {
+        if (stats[i].name == name && stats[i].category == category)
+            return i;
+    }
+    return -1;
+}
+
+TEST(ChProfilerTest, disabled) {
+    ChProfiler::Enable(false);
+    ChProfiler::Reset();
+    {
+        CH_PROFILE("Disabled");
+        Work(1000);
+    }
+    ASSERT_TRUE(ChProfiler::GetZoneStats().empty());
+}
+
+TEST(ChProfilerTest, hierarchy) {
+    ChProfiler::Reset();
+    ChProfiler::Enable(true);
+    for (int step = 0; step < 3; step++) {
+        CH_PROFILE("Step");
+        {
+            CH_PROFILE_CATEGORY("Update", "bodies");
+            Work(1000);
+        }
+        {
+            CH_PROFILE_CATEGORY("Update", "links");
+            Work(1000);
+        }
+        {
+            CH_PROFILE("Solve");
+            Work(5000);
+        }
+    }
+    ChProfiler::Enable(false);
+
+    auto stats = ChProfiler::GetZoneStats();
+    ASSERT_EQ((int)stats.size(), 4);
+
+    int step = FindZone(stats, "Step");
+    int bodies = FindZone(stats, "Update", "bodies");
+    int links = FindZone(stats, "Update", "links");
+    int solve = FindZone(stats, "Solve");
+    ASSERT_EQ(step, 0);
+    ASSERT_GT(bodies, 0);
+    ASSERT_GT(links, 0);
+    ASSERT_GT(solve, 0);
+
+    ASSERT_EQ(stats[step].depth, 0);
+    ASSERT_EQ(stats[step].parent, -1);
+    ASSERT_EQ(stats[step].calls, 3u);
+
+    double children_time = 0;
+    for (int i : {bodies, links, solve}) {
+        ASSERT_EQ(stats[i].depth, 1);
+        ASSERT_EQ(stats[i].parent, step);
+        ASSERT_EQ(stats[i].calls, 3u);
+        ASSERT_NEAR(stats[i].self_time, stats[i].total_time, 1e-12);
+        children_time += stats[i].total_time;
+    }
+
+    ASSERT_LE(children_time, stats[step].total_time);
+    ASSERT_NEAR(stats[step].self_time, stats[step].total_time - children_time, 1e-9);
+}
+
+TEST(ChProfilerTest, threads) {
+    int num_items = 16;
+
+    ChProfiler::Reset();
+    ChProfiler::Enable(true);
+    {
+        CH_PROFILE("Parallel");
+#pragma omp parallel for num_threads(4)
+        for (int i = 0; i < num_items; i++) {
+            CH_PROFILE_CATEGORY("Item", "items");
+            Work(1000);
+        }
+    }
+    ChProfiler::Enable(false);
+
+    // Zones opened on worker threads are top-level zones on those threads.
+    // Zones with same name and category are merged over all threads.
+    auto stats = ChProfiler::GetZoneStats();
+    unsigned long item_calls = 0;
+    for (const auto& zone : stats) {
+        if (zone.name == "Item") {
+            ASSERT_EQ(zone.category, "items");
+            item_calls += zone.calls;
+        }
+    }
+    ASSERT_EQ(item_calls, (unsigned long)num_items);
+
+    int parallel = FindZone(stats, "Parallel");
+    ASSERT_GE(parallel, 0);
+    ASSERT_EQ(stats[parallel].calls, 1u);
+}
+
+TEST(ChProfilerTest, trace) {
+    ChProfiler::Reset();
+    ChProfiler::EnableTrace(true);
+    ChProfiler::Enable(true);
+    for (int step = 0; step < 5; step++) {
+        CH_PROFILE_CATEGORY("Step", "test");
+        Work(1000);
+    }
+    ChProfiler::Enable(false);
+    ChProfiler::EnableTrace(false);
+
+    std::string filename = "utest_CH_profiler_trace.json";
+    ASSERT_TRUE(ChProfiler::WriteChromeTrace(filename));
+
+    std::ifstream ifile(filename);
+    std::stringstream buffer;
+    buffer << ifile.rdbuf();
+    std::string trace = buffer.str();
+
+    ASSERT_EQ(trace.find("{\"traceEvents\":["), 0u);
+
+    int num_events = 0;
+    for (size_t pos = trace.find("\"ph\":\"X\""); pos != std::string::npos; pos = trace.find("\"ph\":\"X\"", pos + 1))
+        num_events++;
+    ASSERT_EQ(num_events, 5);
+    ASSERT_NE(trace.find("\"name\":\"Step\",\"cat\":\"test\""), std::string::npos);
+}
@@ -0,0 +1,150 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the system matrix assembly with a cached map (used by direct
+// sparse linear solvers when the sparsity pattern is locked).
+// A set of ANCF cables, pinned to the ground, swing under gravity.
+// - the matrix assembled with the cached map must match the matrix assembled
+//   with ChSystemDescriptor::BuildSystemMatrix, also after the coupling changes
+//   without changing the number of variables and constraints
+// - simulations with and without the assembly map must produce the same results
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/core/ChSparsityPatternLearner.h"
+#include "chrono/fea/ChBuilderBeam.h"
+#include "chrono/fea/ChLinkNodeFrame.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+class CableSystem {
+  public:
+    CableSystem(bool use_map, int num_threads);
+
+    ChSystemSMC sys;
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    std::vector<std::shared_ptr<ChLinkNodeFrame>> links;
+};
+
+CableSystem::CableSystem(bool use_map, int num_threads) {
+    sys.SetNumThreads(num_threads);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    auto section = chrono_types::make_shared<ChBeamSectionCable>();
+    section->SetDiameter(0.02);
+    section->SetYoungModulus(1e7);
+    section->SetRayleighDamping(0.01);
+
+    for (int i = 0; i < 4; i++) {
+        ChBuilderCableANCF builder;
+        builder.BuildBeam(mesh, section, 10, ChVector3d(0, 0.2 * i, 0), ChVector3d(1, 0.2 * i, 0.1 * i));
+
+        auto link = chrono_types::make_shared<ChLinkNodeFrame>();
+        link->Initialize(builder.GetLastBeamNodes().front(), ground);
+        sys.Add(link);
+        links.push_back(link);
+
+        nodes.insert(nodes.end(), builder.GetLastBeamNodes().begin(), builder.GetLastBeamNodes().end());
+    }
+
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    solver->LockSparsityPattern(true);
+    solver->UseAssemblyMap(use_map);
+    sys.SetSolver(solver);
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT);
+}
+
+TEST(AssemblyMap, matrix) {
+    CableSystem cables(true, 1);
+    cables.sys.DoStepDynamics(1e-3);
+
+    auto& descriptor = *cables.sys.GetSystemDescriptor();
+    unsigned int n = descriptor.CountActiveVariables() + descriptor.CountActiveConstraints();
+
+    // Reference matrix
+    ChSparseMatrix Z_ref;
+    ChSparsityPatternLearner pattern(n, n);
+    descriptor.BuildSystemMatrix(&pattern, nullptr);
+    pattern.Apply(Z_ref);
+    descriptor.BuildSystemMatrix(&Z_ref, nullptr);
+    Z_ref.makeCompressed();
+
+    // Matrix with same pattern, assembled with the cached map (at creation and at reuse)
+    ChSparseMatrix Z_map = Z_ref;
+    for (int pass = 0; pass < 2; pass++) {
+        Z_map.coeffs().setZero();
+        ASSERT_TRUE(descriptor.BuildSystemMatrixMapped(Z_map, 4));
+        ASSERT_EQ(Z_map.nonZeros(), Z_ref.nonZeros());
+        for (int k = 0; k < Z_ref.nonZeros(); k++)
+            ASSERT_EQ(Z_map.valuePtr()[k], Z_ref.valuePtr()[k]);
+    }
+
+    // A matrix with a different pattern must be rejected
+    ChSparseMatrix Z_diag(n, n);
+    for (unsigned int i = 0; i < n; i++)
+        Z_diag.insert(i, i) = 1;
+    Z_diag.makeCompressed();
+    ASSERT_FALSE(descriptor.BuildSystemMatrixMapped(Z_diag, 4));
+
+    // Move the first pin to the last node of the first cable: same number of entries, at different locations
+    ASSERT_TRUE(descriptor.BuildSystemMatrixMapped(Z_map, 4));
+    cables.links[0]->Initialize(cables.nodes[10], cables.sys.GetBodies()[0]);
+
+    // The old pattern does not contain the new coupling
+    ASSERT_FALSE(descriptor.BuildSystemMatrixMapped(Z_map, 4));
+
+    // With the new pattern, the map is created anew and the matrix matches the reference
+    ChSparsityPatternLearner pattern_new(n, n);
+    descriptor.BuildSystemMatrix(&pattern_new, nullptr);
+    pattern_new.Apply(Z_ref);
+    descriptor.BuildSystemMatrix(&Z_ref, nullptr);
+    Z_ref.makeCompressed();
+    Z_map = Z_ref;
+    Z_map.coeffs().setZero();
+    ASSERT_TRUE(descriptor.BuildSystemMatrixMapped(Z_map, 4));
+    for (int k = 0; k < Z_ref.nonZeros(); k++)
+        ASSERT_EQ(Z_map.valuePtr()[k], Z_ref.valuePtr()[k]);
+}
+
+TEST(AssemblyMap, simulation) {
+    CableSystem ref(false, 1);
+    CableSystem map(true, 4);
+
+    for (int step = 0; step < 100; step++) {
+        ref.sys.DoStepDynamics(1e-3);
+        map.sys.DoStepDynamics(1e-3);
+    }
+
+    ASSERT_EQ(map.nodes.size(), ref.nodes.size());
+    for (size_t i = 0; i < ref.nodes.size(); i++) {
+        ASSERT_NEAR(map.nodes[i]->GetPos().x(), ref.nodes[i]->GetPos().x(), 1e-10);
+        ASSERT_NEAR(map.nodes[i]->GetPos().y(), ref.nodes[i]->GetPos().y(), 1e-10);
+        ASSERT_NEAR(map.nodes[i]->GetPos().z(), ref.nodes[i]->GetPos().z(), 1e-10);
+    }
+}
@@ -0,0 +1,112 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the element coloring used in the parallel assembly of FEA
+// residuals (ChMesh). A clamped ANCF shell plate deforming under gravity is
+// simulated with 1 and with 4 threads. The mesh is checked to be partitioned in
+// 4 colors and the final nodal positions from the two simulations must match.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+#include "chrono/fea/ChElementShellANCF_3423.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+static std::vector<ChVector3d> SimulatePlate(int num_threads, unsigned int& num_colors) {
+    ChSystemSMC sys;
+    sys.SetNumThreads(num_threads);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    int nx = 8;
+    int ny = 8;
+    double dx = 0.1;
+    double dy = 0.1;
+    double dz = 0.01;
+
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int j = 0; j <= ny; j++) {
+        for (int i = 0; i <= nx; i++) {
+            auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector3d(i * dx, j * dy, 0), ChVector3d(0, 0, 1));
+            node->SetMass(0);
+            if (i == 0)
+                node->SetFixed(true);
+            mesh->AddNode(node);
+            nodes.push_back(node);
+        }
+    }
+
+    auto mat = chrono_types::make_shared<ChMaterialShellANCF>(500, 2.1e7, 0.3);
+
+    for (int j = 0; j < ny; j++) {
+        for (int i = 0; i < nx; i++) {
+            int n0 = j * (nx + 1) + i;
+            auto element = chrono_types::make_shared<ChElementShellANCF_3423>();
+            element->SetNodes(nodes[n0], nodes[n0 + 1], nodes[n0 + nx + 2], nodes[n0 + nx + 1]);
+            element->SetDimensions(dx, dy);
+            element->AddLayer(dz, 0, mat);
+            element->SetAlphaDamp(0.05);
+            mesh->AddElement(element);
+        }
+    }
+
+    auto solver = chrono_types::make_shared<ChSolverMINRES>();
+    solver->SetMaxIterations(200);
+    solver->SetTolerance(1e-12);
+    solver->EnableDiagonalPreconditioner(true);
+    sys.SetSolver(solver);
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    for (int step = 0; step < 50; step++)
+        sys.DoStepDynamics(1e-3);
+
+    num_colors = mesh->GetNumElementColors();
+
+    std::vector<ChVector3d> pos;
+    for (const auto& node : nodes)
+        pos.push_back(node->GetPos());
+
+    return pos;
+}
+
+TEST(ChMesh, element_coloring) {
+    unsigned int num_colors_1;
+    unsigned int num_colors_4;
+    auto pos_1 = SimulatePlate(1, num_colors_1);
+    auto pos_4 = SimulatePlate(4, num_colors_4);
+
+    // Elements of a structured quadrilateral grid can be partitioned in 4 colors
+    ASSERT_EQ(num_colors_1, 4);
+    ASSERT_EQ(num_colors_4, 4);
+
+    // The plate must have deformed
+    ASSERT_LT(pos_1.back().z(), -1e-6);
+
+    ASSERT_EQ(pos_1.size(), pos_4.size());
+    for (size_t i = 0; i < pos_1.size(); i++) {
+        ASSERT_NEAR(pos_1[i].x(), pos_4[i].x(), 1e-10);
+        ASSERT_NEAR(pos_1[i].y(), pos_4[i].y(), 1e-10);
+        ASSERT_NEAR(pos_1[i].z(), pos_4[i].z(), 1e-10);
+    }
+}
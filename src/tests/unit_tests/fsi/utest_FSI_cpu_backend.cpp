@@ -0,0 +1,123 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the CPU backend of ChSystemFsi. A column of granular material
+// (elastic SPH), with lithostatic initial stress, is placed in a box container
+// and simulated through the ChSystemFsi interface with SPHBackend::CPU. The
+// material must remain at rest and the pressure must increase linearly with
+// depth.
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_fsi/ChSystemFsi.h"
+
+// Chrono namespaces
+using namespace chrono;
+using namespace chrono::fsi;
+
+// Tolerances
+const double pres_rel_Tol = 0.2;
+const double vel_Tol = 0.05;
+
+//------------------------------------------------------------------
+// dimension of the granular column
+//------------------------------------------------------------------
+double bxDim = 0.3;
+double byDim = 0.3;
+double bzDim = 0.3;
+
+int main(int argc, char* argv[]) {
+    ChSystemSMC sysMBS;
+    ChSystemFsi sysFSI(&sysMBS);
+    sysFSI.SetVerbose(false);
+    sysFSI.SetBackend(SPHBackend::CPU);
+
+    double initSpace0 = 0.05;
+    double density = 1700;
+    double g = 9.81;
+    double step_size = 2.5e-4;
+    double t_end = 0.3;
+
+    ChSystemFsi::ElasticMaterialProperties mat_props;
+    mat_props.Young_modulus = 1e6;
+    mat_props.Poisson_ratio = 0.3;
+    mat_props.viscosity_alpha = 0.5;
+    mat_props.mu_I0 = 0.04;
+    mat_props.mu_fric_s = 0.8;
+    mat_props.mu_fric_2 = 0.8;
+    mat_props.average_diam = 0.005;
+    mat_props.cohesion_coeff = 0;
+
+    sysFSI.SetInitialSpacing(initSpace0);
+    sysFSI.SetKernelLength(1.2 * initSpace0);
+    sysFSI.SetDensity(density);
+    sysFSI.SetElasticSPH(mat_props);
+    sysFSI.SetSPHMethod(FluidDynamics::WCSPH);
+    sysFSI.SetGravitationalAcceleration(ChVector3d(0, 0, -g));
+    sysFSI.SetInitPressure(bzDim);
+    sysFSI.SetStepSize(step_size);
+    sysFSI.SetContainerDim(ChVector3d(bxDim, byDim, bzDim));
+
+    // Create SPH particles for the granular column (bottom layer at z = 0)
+    ChVector3d boxHalfDim(bxDim / 2, byDim / 2, (bzDim - initSpace0) / 2);
+    sysFSI.AddBoxSPH(ChVector3d(0, 0, boxHalfDim.z()), boxHalfDim + ChVector3d(1e-6));
+
+    // Create a fixed container with BCE markers on the bottom and side walls
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sysMBS.AddBody(ground);
+
+    sysFSI.AddBoxContainerBCE(ground, ChFrame<>(ChVector3d(0, 0, bzDim), QUNIT), ChVector3d(bxDim, byDim, 2 * bzDim),
+                              ChVector3i(2, 2, -1));
+
+    sysFSI.Initialize();
+
+    int num_steps = (int)std::round(t_end / step_size);
+    for (int step = 0; step < num_steps; step++)
+        sysFSI.DoStepDynamics_FSI();
+
+    // Check velocities and compare the pressure in the bottom layer with the lithostatic pressure
+    double vel_max = 0;
+    double pres_bottom = 0;
+    int num_bottom = 0;
+    auto pos = sysFSI.GetParticlePositions();
+    auto vel = sysFSI.GetParticleVelocities();
+    auto props = sysFSI.GetParticleFluidProperties();
+    for (size_t i = 0; i < sysFSI.GetNumFluidMarkers(); i++) {
+        vel_max = std::max(vel_max, vel[i].Length());
+        if (pos[i].z() < initSpace0 / 2) {
+            pres_bottom += props[i].y();
+            num_bottom++;
+        }
+    }
+    pres_bottom /= num_bottom;
+    double pres_ref = density * g * bzDim;
+
+    std::cout << "Simulation time:        " << sysFSI.GetSimTime() << std::endl;
+    std::cout << "Max. velocity:          " << vel_max << std::endl;
+    std::cout << "Bottom layer pressure:  " << pres_bottom << "  (lithostatic: " << pres_ref << ")" << std::endl;
+
+    if (vel_max > vel_Tol)
+        return 1;
+    if (std::abs(pres_bottom - pres_ref) > pres_rel_Tol * pres_ref)
+        return 1;
+
+    std::cout << "Test passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,111 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the CPU SPH solver (ChSystemFsiCPU). A column of fluid, with
+// hydrostatic initial pressure, is placed in a box container attached to a
+// fixed FSI body. The fluid must remain at rest and the average fluid force on
+// the container must balance the weight of the fluid.
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_fsi/ChSystemFsiCPU.h"
+
+// Chrono namespaces
+using namespace chrono;
+using namespace chrono::fsi;
+
+// Tolerances
+const double force_rel_Tol = 2.0e-2;
+const double vel_Tol = 0.1;
+
+//------------------------------------------------------------------
+// dimension of the fluid column
+//------------------------------------------------------------------
+double bxDim = 0.3;
+double byDim = 0.3;
+double bzDim = 0.3;
+
+int main(int argc, char* argv[]) {
+    ChSystemSMC sysMBS;
+    ChSystemFsiCPU sysFSI(&sysMBS);
+
+    double initSpace0 = 0.05;
+    double g = 9.81;
+    double step_size = 2.5e-4;
+    double t_end = 0.3;
+
+    sysFSI.SetInitialSpacing(initSpace0);
+    sysFSI.SetKernelLength(1.2 * initSpace0);
+    sysFSI.SetDensity(1000);
+    sysFSI.SetViscosity(0.01);
+    sysFSI.SetSoundSpeed(15);
+    sysFSI.SetArtificialViscosity(0.05);
+    sysFSI.SetGravitationalAcceleration(ChVector3d(0, 0, -g));
+    sysFSI.SetInitPressure(bzDim);
+    sysFSI.SetStepSize(step_size);
+
+    // Create SPH particles for the fluid column (bottom layer at z = 0)
+    ChVector3d boxHalfDim(bxDim / 2, byDim / 2, (bzDim - initSpace0) / 2);
+    sysFSI.AddBoxSPH(ChVector3d(0, 0, boxHalfDim.z()), boxHalfDim + ChVector3d(1e-6));
+
+    // Create a fixed container with BCE markers on the bottom and side walls
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sysMBS.AddBody(ground);
+
+    sysFSI.AddBoxContainerBCE(ground, ChFrame<>(ChVector3d(0, 0, bzDim), QUNIT), ChVector3d(bxDim, byDim, 2 * bzDim),
+                              ChVector3i(2, 2, -1));
+    sysFSI.AddFsiBody(ground);
+
+    sysFSI.Initialize();
+
+    double weight = sysFSI.GetNumFluidMarkers() * sysFSI.GetParticleMass() * g;
+
+    // Integrate and average the fluid force over the last third of the simulation
+    int num_steps = (int)std::round(t_end / step_size);
+    ChVector3d force_avg(0);
+    int num_avg = 0;
+    for (int step = 0; step < num_steps; step++) {
+        sysFSI.DoStepDynamics_FSI();
+        if (3 * step >= 2 * num_steps) {
+            force_avg += sysFSI.GetFsiBodyForce(0);
+            num_avg++;
+        }
+    }
+    force_avg /= num_avg;
+
+    double vel_max = 0;
+    const auto& vel = sysFSI.GetParticleVelocities();
+    for (size_t i = 0; i < sysFSI.GetNumFluidMarkers(); i++)
+        vel_max = std::max(vel_max, vel[i].Length());
+
+    std::cout << "Fluid weight:        " << weight << std::endl;
+    std::cout << "Average fluid force: " << force_avg << std::endl;
+    std::cout << "Max. fluid velocity: " << vel_max << std::endl;
+
+    if (vel_max > vel_Tol)
+        return 1;
+    if (std::abs(force_avg.z() + weight) > force_rel_Tol * weight)
+        return 1;
+    if (std::abs(force_avg.x()) > force_rel_Tol * weight || std::abs(force_avg.y()) > force_rel_Tol * weight)
+        return 1;
+
+    std::cout << "Test passed" << std::endl;
+    return 0;
+}
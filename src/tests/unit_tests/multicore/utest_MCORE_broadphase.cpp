@@ -0,0 +1,109 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Author: Radu Serban
+// =============================================================================
+//
+// Unit test for the persistent broadphase.
+// The same granular settling problem is simulated with the default broadphase
+// and with the persistent (temporally coherent) broadphase. The two systems
+// must report the same number of contacts at each step and end up with the same
+// particle positions.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "chrono_multicore/physics/ChSystemMulticore.h"
+
+#include "unit_testing.h"
+
+using namespace chrono;
+
+class BroadphaseTest : public ::testing::Test {
+  protected:
+    BroadphaseTest();
+    ~BroadphaseTest() {
+        delete sys_ref;
+        delete sys_per;
+    }
+
+    ChSystemMulticoreSMC* CreateSystem(bool persistent, std::vector<std::shared_ptr<ChBody>>& balls);
+
+    ChSystemMulticoreSMC* sys_ref;
+    ChSystemMulticoreSMC* sys_per;
+    std::vector<std::shared_ptr<ChBody>> balls_ref;
+    std::vector<std::shared_ptr<ChBody>> balls_per;
+};
+
+BroadphaseTest::BroadphaseTest() {
+    sys_ref = CreateSystem(false, balls_ref);
+    sys_per = CreateSystem(true, balls_per);
+}
+
+ChSystemMulticoreSMC* BroadphaseTest::CreateSystem(bool persistent, std::vector<std::shared_ptr<ChBody>>& balls) {
+    ChSystemMulticoreSMC* sys = new ChSystemMulticoreSMC;
+    sys->SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+    sys->SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys->GetSettings()->solver.tolerance = 1e-5;
+    sys->GetSettings()->collision.collision_envelope = 0.01;
+    sys->GetSettings()->collision.bins_per_axis = vec3(8, 8, 4);
+    sys->GetSettings()->collision.broadphase_persistent = persistent;
+    sys->GetSettings()->collision.broadphase_margin = 0.05;
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat->SetYoungModulus(1e6f);
+    mat->SetFriction(0.4f);
+    mat->SetRestitution(0.1f);
+
+    // Create the container
+    utils::CreateBoxContainer(sys, mat, ChVector3d(4, 4, 2), 0.1);
+
+    // Create layers of balls
+    double radius = 0.2;
+    double mass = 1;
+    for (int ix = 0; ix < 8; ix++) {
+        for (int iy = 0; iy < 8; iy++) {
+            for (int iz = 0; iz < 3; iz++) {
+                auto ball = chrono_types::make_shared<ChBody>();
+                ball->SetMass(mass);
+                ball->SetInertiaXX(0.4 * mass * radius * radius * ChVector3d(1, 1, 1));
+                ball->SetPos(ChVector3d(0.45 * (ix - 3.5), 0.45 * (iy - 3.5), 0.3 + 0.45 * iz + 0.01 * ix));
+                ball->EnableCollision(true);
+                utils::AddSphereGeometry(ball.get(), mat, radius);
+                sys->AddBody(ball);
+                balls.push_back(ball);
+            }
+        }
+    }
+
+    return sys;
+}
+
+TEST_F(BroadphaseTest, persistent) {
+    double time_step = 1e-3;
+    double end_time = 0.5;
+
+    while (sys_ref->GetChTime() < end_time) {
+        sys_ref->DoStepDynamics(time_step);
+        sys_per->DoStepDynamics(time_step);
+        ASSERT_EQ(sys_ref->GetNumContacts(), sys_per->GetNumContacts());
+    }
+
+    for (size_t i = 0; i < balls_ref.size(); i++) {
+        const auto& pos_ref = balls_ref[i]->GetPos();
+        const auto& pos_per = balls_per[i]->GetPos();
+        ASSERT_NEAR(pos_ref.x(), pos_per.x(), 1e-4);
+        ASSERT_NEAR(pos_ref.y(), pos_per.y(), 1e-4);
+        ASSERT_NEAR(pos_ref.z(), pos_per.z(), 1e-4);
+    }
+}
@@ -0,0 +1,105 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Test for adding and removing bodies in batches.
+// Bodies are queued for insertion and removal and then processed at once, as
+// done by particle emitters and removers. The body list must remain consistent
+// (each body index matching its slot) and the collision models of removed
+// bodies must be released by the collision system.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+using namespace chrono;
+
+static void CheckBodyList(const ChSystem& sys) {
+    const auto& bodies = sys.GetBodies();
+    for (unsigned int i = 0; i < (unsigned int)bodies.size(); i++) {
+        ASSERT_EQ(bodies[i]->GetIndex(), i);
+        ASSERT_EQ(bodies[i]->GetSystem(), &sys);
+        if (bodies[i]->GetCollisionModel())
+            ASSERT_TRUE(bodies[i]->GetCollisionModel()->HasImplementation());
+    }
+}
+
+TEST(ChAssembly, batch_add_remove) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 20, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> particles;
+    for (int i = 0; i < 100; i++) {
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, true, mat);
+        sphere->SetPos(ChVector3d(0.3 * (i % 10) - 1.5, 0.3 * (i / 10) - 1.5, 0.1));
+        sys.AddBody(sphere);
+        particles.push_back(sphere);
+    }
+    sys.DoStepDynamics(1e-3);
+    CheckBodyList(sys);
+    ASSERT_EQ(sys.GetNumBodies(), 101u);
+
+    // Remove a single body (moves the last body in its slot)
+    sys.RemoveBody(particles[10]);
+    ASSERT_EQ(sys.GetBodies().size(), 100u);
+    ASSERT_EQ(sys.GetBodies()[particles[10]->GetIndex()], particles.back());
+    ASSERT_FALSE(particles[10]->GetCollisionModel()->HasImplementation());
+    CheckBodyList(sys);
+
+    // Queue every other (remaining) particle for removal and a new set of particles for insertion
+    std::vector<std::shared_ptr<ChBody>> removed;
+    for (int i = 0; i < 100; i += 2) {
+        if (i == 10)
+            continue;
+        sys.RemoveBatch(particles[i]);
+        removed.push_back(particles[i]);
+    }
+    for (int i = 0; i < 20; i++) {
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, true, mat);
+        sphere->SetPos(ChVector3d(0.3 * (i % 10) - 1.5, 2, 0.1 + 0.3 * (i / 10)));
+        sys.AddBatch(sphere);
+    }
+    ASSERT_EQ(sys.GetBodies().size(), 100u);
+
+    // Queued items are processed at the next step
+    sys.DoStepDynamics(1e-3);
+    ASSERT_EQ(sys.GetBodies().size(), 71u);
+    ASSERT_EQ(sys.GetNumBodies(), 71u);
+    CheckBodyList(sys);
+    for (const auto& body : removed) {
+        ASSERT_EQ(body->GetSystem(), nullptr);
+        ASSERT_FALSE(body->GetCollisionModel()->HasImplementation());
+    }
+
+    // The remaining particles rest on the ground
+    for (int i = 0; i < 200; i++)
+        sys.DoStepDynamics(1e-3);
+    ASSERT_GT(sys.GetNumContacts(), 0u);
+    for (const auto& body : sys.GetBodies()) {
+        if (!body->IsFixed())
+            ASSERT_GT(body->GetPos().z(), 0.0);
+    }
+}
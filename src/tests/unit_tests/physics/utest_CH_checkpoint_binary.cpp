@@ -0,0 +1,143 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Test for the binary checkpoint of the system state.
+// A pendulum chain is simulated and a binary checkpoint is written half-way.
+// A second, identically constructed system is restored from the checkpoint and
+// simulated to the same final time. The final body states must be identical.
+// For a system with contacts, only the multipliers of the assembly constraints
+// are restored; contact multipliers are reset to zero.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/core/ChGlobal.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+using namespace chrono;
+
+static const std::string out_dir = GetChronoOutputPath() + "CHECKPOINT_BINARY/";
+
+static std::vector<std::shared_ptr<ChBody>> CreateChain(ChSystemNSC& sys, int num_links) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    double length = 0.5;
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    auto prev = ground;
+    for (int ib = 0; ib < num_links; ib++) {
+        auto body = chrono_types::make_shared<ChBodyEasyBox>(length, 0.05, 0.05, 1000, false, false);
+        body->SetPos(ChVector3d((ib + 0.5) * length, 0, 0));
+        sys.AddBody(body);
+        bodies.push_back(body);
+
+        auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(prev, body, ChFrame<>(ChVector3d(ib * length, 0, 0), QUNIT));
+        sys.AddLink(joint);
+
+        prev = body;
+    }
+
+    return bodies;
+}
+
+TEST(ChSystem, checkpoint_binary) {
+    ASSERT_TRUE(filesystem::create_directory(filesystem::path(GetChronoOutputPath())));
+    ASSERT_TRUE(filesystem::create_directory(filesystem::path(out_dir)));
+    std::string filename = out_dir + "chain.dat";
+
+    // Reference simulation, with a checkpoint half-way
+    ChSystemNSC sys_ref;
+    auto bodies_ref = CreateChain(sys_ref, 5);
+    for (int step = 0; step < 400; step++) {
+        if (step == 200)
+            ASSERT_TRUE(utils::WriteCheckpointBinary(&sys_ref, filename));
+        sys_ref.DoStepDynamics(1e-3);
+    }
+
+    // Restart from the checkpoint
+    ChSystemNSC sys;
+    auto bodies = CreateChain(sys, 5);
+    ASSERT_TRUE(utils::ReadCheckpointBinary(&sys, filename));
+    ASSERT_NEAR(sys.GetChTime(), 0.2, 1e-12);
+    for (int step = 200; step < 400; step++)
+        sys.DoStepDynamics(1e-3);
+
+    ASSERT_NEAR(sys.GetChTime(), sys_ref.GetChTime(), 1e-12);
+    for (size_t i = 0; i < bodies.size(); i++) {
+        ASSERT_NEAR((bodies[i]->GetPos() - bodies_ref[i]->GetPos()).Length(), 0, 1e-12);
+        ASSERT_NEAR((bodies[i]->GetPosDt() - bodies_ref[i]->GetPosDt()).Length(), 0, 1e-12);
+        ASSERT_NEAR((bodies[i]->GetAngVelLocal() - bodies_ref[i]->GetAngVelLocal()).Length(), 0, 1e-12);
+    }
+
+    // A checkpoint cannot be restored on a different system
+    ChSystemNSC sys_other;
+    CreateChain(sys_other, 4);
+    ASSERT_FALSE(utils::ReadCheckpointBinary(&sys_other, filename));
+}
+
+TEST(ChSystem, checkpoint_binary_contacts) {
+    ASSERT_TRUE(filesystem::create_directory(filesystem::path(GetChronoOutputPath())));
+    ASSERT_TRUE(filesystem::create_directory(filesystem::path(out_dir)));
+    std::string filename = out_dir + "contacts.dat";
+
+    // Pendulum chain and a box resting on the ground
+    auto create = [](ChSystemNSC& sys) {
+        sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+        CreateChain(sys, 2);
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+        auto floor = chrono_types::make_shared<ChBodyEasyBox>(4, 0.2, 4, 1000, false, true, mat);
+        floor->SetPos(ChVector3d(0, -2.1, 0));
+        floor->SetFixed(true);
+        sys.AddBody(floor);
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.2, 0.2, 1000, false, true, mat);
+        box->SetPos(ChVector3d(0, -1.9, 0));
+        sys.AddBody(box);
+    };
+
+    ChSystemNSC sys_ref;
+    create(sys_ref);
+    for (int step = 0; step < 50; step++)
+        sys_ref.DoStepDynamics(1e-3);
+    ASSERT_GT(sys_ref.GetContactContainer()->GetNumContacts(), 0u);
+    ASSERT_TRUE(utils::WriteCheckpointBinary(&sys_ref, filename));
+
+    unsigned int num_constr_assembly = sys_ref.GetNumConstraints() - sys_ref.GetContactContainer()->GetNumConstraints();
+    ChVectorDynamic<> L_ref(sys_ref.GetNumConstraints());
+    sys_ref.StateGatherReactions(L_ref);
+    ASSERT_GT(L_ref.tail(L_ref.size() - num_constr_assembly).cwiseAbs().maxCoeff(), 0.0);
+
+    ChSystemNSC sys;
+    create(sys);
+    ASSERT_TRUE(utils::ReadCheckpointBinary(&sys, filename));
+    ASSERT_GT(sys.GetContactContainer()->GetNumContacts(), 0u);
+
+    ChVectorDynamic<> L(sys.GetNumConstraints());
+    sys.StateGatherReactions(L);
+    for (unsigned int i = 0; i < num_constr_assembly; i++)
+        ASSERT_EQ(L(i), L_ref(i));
+    for (Eigen::Index i = num_constr_assembly; i < L.size(); i++)
+        ASSERT_EQ(L(i), 0.0);
+}
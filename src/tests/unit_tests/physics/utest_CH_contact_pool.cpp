@@ -0,0 +1,168 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Test for the pooled contact storage used by the NSC and SMC contact
+// containers:
+// - contact objects are reused (not reconstructed) across collision passes, keep
+//   their addresses, and receive the contact history provided by the container
+// - the pool grows as needed and is trimmed when much larger than its use
+//
+// =============================================================================
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChContactPool.h"
+
+using namespace chrono;
+
+// Minimal contact container, providing the state of a contact at the previous step.
+struct TestContainer {
+    const int* GetContactHistory(const ChCollisionInfo& cinfo) const { return &history; }
+
+    int history = 0;
+};
+
+// Minimal contact type, counting constructions, resets, and destructions.
+struct TestContact {
+    TestContact(TestContainer* container,
+                int* objA,
+                int* objB,
+                const ChCollisionInfo& cinfo,
+                const int& cmat,
+                const int* history)
+        : a(*objA), b(*objB), h(*history) {
+        num_constructed++;
+    }
+    ~TestContact() { num_destroyed++; }
+
+    void Reset(int* objA, int* objB, const ChCollisionInfo& cinfo, const int& cmat, const int* history) {
+        a = *objA;
+        b = *objB;
+        h = *history;
+        num_reset++;
+    }
+
+    int a;
+    int b;
+    int h;
+
+    static size_t num_constructed;
+    static size_t num_reset;
+    static size_t num_destroyed;
+};
+
+size_t TestContact::num_constructed = 0;
+size_t TestContact::num_reset = 0;
+size_t TestContact::num_destroyed = 0;
+
+// Perform a collision pass adding the specified number of contacts.
+static void AddContacts(ChContactPool<TestContact>& pool, size_t num_contacts, int pass) {
+    ChCollisionInfo cinfo;
+    TestContainer container;
+    container.history = -pass;
+    int mat = 0;
+    pool.Rewind();
+    for (int i = 0; i < (int)num_contacts; i++) {
+        int b = pass;
+        pool.Insert(&container, &i, &b, cinfo, mat);
+    }
+    pool.Trim();
+}
+
+TEST(ChContactPool, reuse) {
+    TestContact::num_constructed = 0;
+    TestContact::num_reset = 0;
+    TestContact::num_destroyed = 0;
+
+    ChContactPool<TestContact> pool;
+    size_t n = 600;
+
+    AddContacts(pool, n, 0);
+    ASSERT_EQ(pool.size(), n);
+    ASSERT_EQ(TestContact::num_constructed, n);
+
+    std::vector<TestContact*> addresses;
+    for (auto contact : pool)
+        addresses.push_back(contact);
+
+    // Subsequent passes with the same number of contacts reuse all contact objects
+    for (int pass = 1; pass <= 3; pass++) {
+        AddContacts(pool, n, pass);
+        ASSERT_EQ(pool.size(), n);
+        ASSERT_EQ(pool.capacity(), n);
+        ASSERT_EQ(TestContact::num_constructed, n);
+        ASSERT_EQ(TestContact::num_reset, pass * n);
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_EQ(pool[i], addresses[i]);
+            ASSERT_EQ(pool[i]->a, (int)i);
+            ASSERT_EQ(pool[i]->b, pass);
+            ASSERT_EQ(pool[i]->h, -pass);
+        }
+    }
+
+    // Fewer contacts: the unused objects are kept for later passes
+    AddContacts(pool, n / 2, 4);
+    ASSERT_EQ(pool.size(), n / 2);
+    ASSERT_EQ(pool.capacity(), n);
+    ASSERT_EQ(TestContact::num_destroyed, 0);
+
+    // More contacts: only the missing objects are constructed
+    AddContacts(pool, n + 10, 5);
+    ASSERT_EQ(pool.size(), n + 10);
+    ASSERT_EQ(TestContact::num_constructed, n + 10);
+    for (size_t i = 0; i < n; i++)
+        ASSERT_EQ(pool[i], addresses[i]);
+
+    pool.Clear();
+    ASSERT_EQ(pool.capacity(), 0u);
+    ASSERT_EQ(TestContact::num_destroyed, TestContact::num_constructed);
+}
+
+TEST(ChContactPool, trim) {
+    TestContact::num_constructed = 0;
+    TestContact::num_destroyed = 0;
+
+    ChContactPool<TestContact> pool;
+    size_t chunk = ChContactPool<TestContact>::chunk_size;
+
+    // Transient peak in the number of contacts
+    size_t peak = 20 * chunk;
+    AddContacts(pool, peak, 0);
+    ASSERT_EQ(pool.capacity(), peak);
+    TestContact* first = pool[0];
+
+    // Small number of contacts: the pool is trimmed, keeping a reserve of one chunk
+    AddContacts(pool, 10, 1);
+    ASSERT_EQ(pool.size(), 10u);
+    ASSERT_EQ(pool.capacity(), 10 + chunk);
+    ASSERT_EQ(pool[0], first);
+    ASSERT_EQ(TestContact::num_destroyed, peak - 10 - chunk);
+
+    // Moderate growth (within 4 times the use): no trimming
+    size_t use = 3 * chunk;
+    AddContacts(pool, use, 2);
+    AddContacts(pool, use / 2, 3);
+    ASSERT_EQ(pool.capacity(), use);
+    ASSERT_EQ(pool[0], first);
+
+    // Steady state after trimming: no further constructions or destructions
+    size_t num_constructed = TestContact::num_constructed;
+    size_t num_destroyed = TestContact::num_destroyed;
+    for (int pass = 4; pass < 10; pass++)
+        AddContacts(pool, use / 2, pass);
+    ASSERT_EQ(TestContact::num_constructed, num_constructed);
+    ASSERT_EQ(TestContact::num_destroyed, num_destroyed);
+}
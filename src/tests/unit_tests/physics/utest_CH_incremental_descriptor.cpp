@@ -0,0 +1,189 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Test for the incremental rebuild of the system descriptor.
+// A system with joints, frictional contacts, and bodies added and removed during
+// the simulation is simulated with and without incremental descriptor rebuild.
+// The final body states must be identical.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkMate.h"
+#include "chrono/physics/ChLoadContainer.h"
+#include "chrono/physics/ChLoadsBody.h"
+
+using namespace chrono;
+
+static std::vector<ChVector3d> Simulate(bool incremental) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.EnableIncrementalDescriptor(incremental);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+
+    // Pendulum hinged to the ground
+    auto pendulum = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, false, false);
+    pendulum->SetPos(ChVector3d(0.5, 3, 2));
+    sys.AddBody(pendulum);
+    bodies.push_back(pendulum);
+
+    auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+    joint->Initialize(ground, pendulum, ChFrame<>(ChVector3d(0, 3, 2), QuatFromAngleX(CH_PI_2)));
+    sys.AddLink(joint);
+
+    // Spheres falling on the ground
+    for (int i = 0; i < 4; i++) {
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.25, 1000, false, true, mat);
+        sphere->SetPos(ChVector3d(0.6 * i, 0, 0.5 + 0.2 * i));
+        sys.AddBody(sphere);
+        bodies.push_back(sphere);
+    }
+
+    std::shared_ptr<ChBody> extra;
+    for (int step = 0; step < 300; step++) {
+        // Add and later remove a body during the simulation
+        if (step == 100) {
+            extra = chrono_types::make_shared<ChBodyEasySphere>(0.25, 1000, false, true, mat);
+            extra->SetPos(ChVector3d(-1, 0, 0.5));
+            sys.AddBody(extra);
+        }
+        if (step == 200)
+            sys.RemoveBody(extra);
+
+        sys.DoStepDynamics(1e-3);
+    }
+
+    std::vector<ChVector3d> states;
+    for (const auto& body : bodies) {
+        states.push_back(body->GetPos());
+        states.push_back(body->GetPosDt());
+    }
+
+    return states;
+}
+
+TEST(ChSystem, incremental_descriptor) {
+    auto states_full = Simulate(false);
+    auto states_incr = Simulate(true);
+
+    ASSERT_EQ(states_full.size(), states_incr.size());
+    for (size_t i = 0; i < states_full.size(); i++) {
+        ASSERT_NEAR(states_full[i].x(), states_incr[i].x(), 1e-12);
+        ASSERT_NEAR(states_full[i].y(), states_incr[i].y(), 1e-12);
+        ASSERT_NEAR(states_full[i].z(), states_incr[i].z(), 1e-12);
+    }
+}
+
+TEST(ChSystem, incremental_descriptor_sections) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.EnableIncrementalDescriptor(true);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.25, 1000, false, true, mat);
+    sphere->SetPos(ChVector3d(0, 0, 0.24));
+    sys.AddBody(sphere);
+
+    sys.DoStepDynamics(1e-3);
+    auto descriptor = sys.GetSystemDescriptor();
+    auto num_variables = descriptor->GetVariables().size();
+    auto num_constraints = descriptor->GetConstraints().size();
+    ASSERT_GT(num_constraints, 0u);
+
+    // Variables of the assembly are kept, the contact constraints are rebuilt
+    sys.DoStepDynamics(1e-3);
+    ASSERT_EQ(descriptor->GetVariables().size(), num_variables);
+    ASSERT_EQ(descriptor->GetVariables()[1], &sphere->Variables());
+
+    // Adding a body triggers a full rebuild
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.2, 0.2, 1000, false, false);
+    box->SetPos(ChVector3d(2, 0, 1));
+    sys.AddBody(box);
+    sys.DoStepDynamics(1e-3);
+    ASSERT_EQ(descriptor->GetVariables().size(), num_variables + 1);
+    ASSERT_EQ(descriptor->GetVariables().back(), &box->Variables());
+}
+
+TEST(ChSystem, incremental_descriptor_replaced_items) {
+    ChSystemNSC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.EnableIncrementalDescriptor(true);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto body = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.2, 0.2, 1000, false, false);
+    body->SetPos(ChVector3d(1, 0, 0));
+    sys.AddBody(body);
+
+    auto joint = chrono_types::make_shared<ChLinkMateGeneric>(true, true, true, false, false, false);
+    joint->Initialize(ground, body, ChFrame<>(ChVector3d(0, 0, 0)));
+    sys.AddLink(joint);
+
+    auto loads = chrono_types::make_shared<ChLoadContainer>();
+    sys.Add(loads);
+
+    sys.DoStepDynamics(1e-3);
+    auto descriptor = sys.GetSystemDescriptor();
+    ASSERT_EQ(descriptor->GetConstraints().size(), 3u);
+    ASSERT_EQ(descriptor->GetKRMBlocks().size(), 0u);
+
+    // Constraints re-created with the same count must replace the old ones in the descriptor: with only the rotations
+    // constrained, the body falls freely without rotating
+    body->SetPos(ChVector3d(1, 0, 0));
+    body->SetRot(QUNIT);
+    body->SetPosDt(VNULL);
+    body->SetAngVelParent(VNULL);
+    joint->SetConstrainedCoords(false, false, false, true, true, true);
+    for (int i = 0; i < 10; i++)
+        sys.DoStepDynamics(1e-3);
+    ASSERT_EQ(descriptor->GetConstraints().size(), 3u);
+    ASSERT_NEAR(body->GetPosDt().z(), -9.81 * 1e-2, 1e-6);
+    ASSERT_NEAR(body->GetAngVelParent().Length(), 0.0, 1e-6);
+
+    // Loads added to or removed from a container do not change the assembly counters, but their KRM blocks must be
+    // injected or removed
+    auto bushing = chrono_types::make_shared<ChLoadBodyBodyBushingSpherical>(
+        ground, body, ChFrame<>(ChVector3d(0.5, 0, 0)), ChVector3d(1e4), ChVector3d(1e2));
+    loads->Add(bushing);
+    sys.DoStepDynamics(1e-3);
+    sys.DoStepDynamics(1e-3);
+    ASSERT_EQ(descriptor->GetKRMBlocks().size(), 1u);
+
+    loads->Remove(bushing);
+    sys.DoStepDynamics(1e-3);
+    ASSERT_EQ(descriptor->GetKRMBlocks().size(), 0u);
+}
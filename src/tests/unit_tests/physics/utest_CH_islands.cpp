@@ -0,0 +1,188 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Tests for island decomposition.
+// - a set of independent box stacks and pendulums is simulated with and without
+//   concurrent island solving. With the PSOR solver (fixed number of iterations),
+//   each island is processed in the same order, so the final body states must
+//   be identical. The solver statistics reported with island solving (maximum
+//   over all islands) must match those of the full system solve.
+// - a stack of two boxes (also connected by a joint) comes to rest and must be
+//   put to sleep as a whole; the joint is then excluded from the descriptor. A
+//   falling sphere must wake up the entire stack on impact.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+
+using namespace chrono;
+
+static std::vector<ChVector3d> SimulateStacks(bool island_solver,
+                                              unsigned int& num_islands,
+                                              std::vector<int>& iterations,
+                                              std::vector<double>& errors) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.SetNumThreads(4);
+    sys.SetSolverType(ChSolver::Type::PSOR);
+    sys.GetSolver()->AsIterative()->SetMaxIterations(50);
+    sys.EnableIslandSolver(island_solver);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(40, 10, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i < 6; i++) {
+        double x = 3.0 * i - 8;
+
+        // Stack of boxes, slightly offset
+        for (int j = 0; j < 3; j++) {
+            auto box = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, false, true, mat);
+            box->SetPos(ChVector3d(x + 0.05 * j, -2, 0.25 + 0.5 * j));
+            sys.AddBody(box);
+            bodies.push_back(box);
+        }
+
+        // Pendulum hinged to the ground
+        auto pendulum = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, false, false);
+        pendulum->SetPos(ChVector3d(x + 0.5, 2, 2));
+        sys.AddBody(pendulum);
+        bodies.push_back(pendulum);
+
+        auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(ground, pendulum, ChFrame<>(ChVector3d(x, 2, 2), QuatFromAngleX(CH_PI_2)));
+        sys.AddLink(joint);
+    }
+
+    // Free falling body
+    auto free_body = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, false, false);
+    free_body->SetPos(ChVector3d(0, 0, 5));
+    sys.AddBody(free_body);
+    bodies.push_back(free_body);
+
+    num_islands = 0;
+    iterations.clear();
+    errors.clear();
+    for (int step = 0; step < 200; step++) {
+        sys.DoStepDynamics(1e-3);
+        num_islands = std::max(num_islands, sys.GetNumIslandsSolved());
+        iterations.push_back(sys.GetSolver()->AsIterative()->GetIterations());
+        errors.push_back(sys.GetSolver()->AsIterative()->GetError());
+    }
+
+    std::vector<ChVector3d> states;
+    for (const auto& body : bodies) {
+        states.push_back(body->GetPos());
+        states.push_back(body->GetPosDt());
+    }
+
+    return states;
+}
+
+TEST(ChSystemNSC, island_solver) {
+    unsigned int num_islands_ref;
+    unsigned int num_islands;
+    std::vector<int> iterations_ref;
+    std::vector<int> iterations;
+    std::vector<double> errors_ref;
+    std::vector<double> errors;
+    auto states_ref = SimulateStacks(false, num_islands_ref, iterations_ref, errors_ref);
+    auto states = SimulateStacks(true, num_islands, iterations, errors);
+
+    ASSERT_EQ(num_islands_ref, 0u);
+    ASSERT_GE(num_islands, 12u);
+
+    ASSERT_EQ(states_ref.size(), states.size());
+    for (size_t i = 0; i < states_ref.size(); i++) {
+        ASSERT_NEAR(states_ref[i].x(), states[i].x(), 1e-10);
+        ASSERT_NEAR(states_ref[i].y(), states[i].y(), 1e-10);
+        ASSERT_NEAR(states_ref[i].z(), states[i].z(), 1e-10);
+    }
+
+    ASSERT_EQ(iterations_ref.size(), iterations.size());
+    for (size_t i = 0; i < iterations_ref.size(); i++) {
+        ASSERT_EQ(iterations_ref[i], iterations[i]);
+        ASSERT_NEAR(errors_ref[i], errors[i], 1e-10);
+    }
+}
+
+TEST(ChSystem, sleeping_islands) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.SetSleepingAllowed(true);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto box1 = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, true, mat);
+    box1->SetPos(ChVector3d(0, 0, 0.5));
+    sys.AddBody(box1);
+
+    auto box2 = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, false, true, mat);
+    box2->SetPos(ChVector3d(0, 0, 1.5));
+    sys.AddBody(box2);
+
+    auto joint = chrono_types::make_shared<ChLinkLockLock>();
+    joint->Initialize(box1, box2, ChFrame<>(ChVector3d(0, 0, 1), QUNIT));
+    sys.AddLink(joint);
+
+    auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.25, 1000, false, true, mat);
+    sphere->SetPos(ChVector3d(0.2, 0, 8));
+    sys.AddBody(sphere);
+
+    bool slept = false;
+    bool woken = false;
+    while (sys.GetChTime() < 1.5) {
+        bool sleeping = box1->IsSleeping();
+        sys.DoStepDynamics(1e-3);
+
+        // The stack is put to sleep and woken up as a whole
+        ASSERT_EQ(box1->IsSleeping(), box2->IsSleeping());
+        ASSERT_FALSE(sphere->IsSleeping());
+
+        if (box1->IsSleeping()) {
+            slept = true;
+            ASSERT_TRUE(joint->IsSleeping());
+            ASSERT_EQ(sys.GetNumIslands(), 2u);
+            ASSERT_EQ(sys.GetNumIslandsSleeping(), 1u);
+            // Sphere in free flight: no contacts generated for the sleeping stack and no active link
+            if (sleeping && sphere->GetPos().z() > 3)
+                ASSERT_EQ(sys.GetSystemDescriptor()->GetConstraints().size(), 0u);
+        } else if (slept) {
+            woken = true;
+        }
+    }
+
+    ASSERT_TRUE(slept);
+    ASSERT_TRUE(woken);
+}
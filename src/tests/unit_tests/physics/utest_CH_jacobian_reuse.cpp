@@ -0,0 +1,125 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Test for the Jacobian update strategies of implicit timesteppers.
+// A chain of pendulums connected by springs is simulated with a direct sparse
+// solver, updating the Newton matrix at each iteration or only when needed.
+// The final body states must agree, with fewer factorizations when reusing the
+// Newton matrix across steps.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkTSDA.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+using namespace chrono;
+
+using JacobianUpdate = ChImplicitIterativeTimestepper::JacobianUpdate;
+
+static std::vector<ChVector3d> Simulate(ChTimestepper::Type type,
+                                        JacobianUpdate method,
+                                        unsigned int& num_steps,
+                                        unsigned int& num_setups) {
+    ChSystemNSC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    solver->LockSparsityPattern(true);
+    sys.SetSolver(solver);
+
+    sys.SetTimestepperType(type);
+    auto integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(sys.GetTimestepper());
+    integrator->SetJacobianUpdateMethod(method);
+    integrator->SetMaxIters(50);
+    integrator->SetAbsTolerances(1e-8);
+    if (auto hht = std::dynamic_pointer_cast<ChTimestepperHHT>(integrator))
+        hht->SetStepControl(false);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    auto prev = ground;
+    for (int i = 0; i < 4; i++) {
+        auto link = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, false, false);
+        link->SetPos(ChVector3d(i + 0.5, 0, 0));
+        sys.AddBody(link);
+        bodies.push_back(link);
+
+        auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(prev, link, ChFrame<>(ChVector3d(i, 0, 0), QuatFromAngleX(CH_PI_2)));
+        sys.AddLink(joint);
+
+        auto spring = chrono_types::make_shared<ChLinkTSDA>();
+        spring->Initialize(ground, link, false, ChVector3d(i + 0.5, 0, 1), ChVector3d(i + 0.5, 0, 0));
+        spring->SetSpringCoefficient(200);
+        spring->SetDampingCoefficient(5);
+        sys.AddLink(spring);
+
+        prev = link;
+    }
+
+    num_steps = 0;
+    num_setups = 0;
+    while (sys.GetChTime() < 0.5) {
+        sys.DoStepDynamics(1e-3);
+        num_steps++;
+        num_setups += integrator->GetNumSetupCalls();
+    }
+
+    std::vector<ChVector3d> states;
+    for (const auto& body : bodies) {
+        states.push_back(body->GetPos());
+        states.push_back(body->GetPosDt());
+    }
+
+    return states;
+}
+
+static void CompareStrategies(ChTimestepper::Type type) {
+    unsigned int num_steps;
+    unsigned int num_setups_ref;
+    unsigned int num_setups_step;
+    unsigned int num_setups_auto;
+    auto states_ref = Simulate(type, JacobianUpdate::EVERY_ITERATION, num_steps, num_setups_ref);
+    auto states_step = Simulate(type, JacobianUpdate::EVERY_STEP, num_steps, num_setups_step);
+    auto states_auto = Simulate(type, JacobianUpdate::AUTOMATIC, num_steps, num_setups_auto);
+
+    ASSERT_EQ(num_setups_step, num_steps);
+    ASSERT_GE(num_setups_ref, num_steps);
+    ASSERT_LT(num_setups_auto, num_setups_step);
+
+    ASSERT_EQ(states_ref.size(), states_auto.size());
+    for (size_t i = 0; i < states_ref.size(); i++) {
+        ASSERT_NEAR((states_ref[i] - states_step[i]).Length(), 0.0, 1e-4);
+        ASSERT_NEAR((states_ref[i] - states_auto[i]).Length(), 0.0, 1e-4);
+    }
+}
+
+TEST(ChTimestepper, jacobian_reuse_HHT) {
+    CompareStrategies(ChTimestepper::Type::HHT);
+}
+
+TEST(ChTimestepper, jacobian_reuse_euler_implicit) {
+    CompareStrategies(ChTimestepper::Type::EULER_IMPLICIT);
+}
@@ -0,0 +1,177 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Test for the Jacobians of body-body bushing loads.
+// The Jacobians obtained through forward-mode automatic differentiation (dual
+// numbers) are compared against the default finite difference approximation,
+// for a deformed bushing between two rotated and moving bodies. A derived
+// bushing overriding only the real-valued force law must not use the
+// dual-number law of its base class (finite differences are used instead).
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChLoadsBody.h"
+
+using namespace chrono;
+
+// Bushing load which does not provide a dual-number force law (finite difference Jacobians)
+template <class Bushing>
+class BushingFD : public Bushing {
+  public:
+    using Bushing::Bushing;
+    virtual bool ComputeBodyBodyForceTorqueDual(const ChVector3<ChLoadBodyBody::DualType>& rel_pos,
+                                                const ChQuaternion<ChLoadBodyBody::DualType>& rel_rot,
+                                                const ChVector3<ChLoadBodyBody::DualType>& rel_vel,
+                                                const ChVector3<ChLoadBodyBody::DualType>& rel_angvel,
+                                                ChVector3<ChLoadBodyBody::DualType>& loc_force,
+                                                ChVector3<ChLoadBodyBody::DualType>& loc_torque) override {
+        return false;
+    }
+};
+
+// Bushing load which scales the force and torque, overriding only the real-valued force law.
+// Its Jacobians must be computed with finite differences (not with the dual-number law of the base class).
+template <class Bushing>
+class BushingScaled : public Bushing {
+  public:
+    using Bushing::Bushing;
+
+  protected:
+    virtual void ComputeBodyBodyForceTorque(const ChFrameMoving<>& rel_AB,
+                                            ChVector3d& loc_force,
+                                            ChVector3d& loc_torque) override {
+        Bushing::ComputeBodyBodyForceTorque(rel_AB, loc_force, loc_torque);
+        loc_force *= 2;
+        loc_torque *= 2;
+    }
+};
+
+// Create two bodies connected at the given bushing location, then move them so that the bushing is deformed
+static void CreateBodies(std::shared_ptr<ChBody>& bodyA, std::shared_ptr<ChBody>& bodyB, ChFrame<>& bushing_frame) {
+    bodyA = chrono_types::make_shared<ChBody>();
+    bodyA->SetPos(ChVector3d(0.1, 0.2, 0.3));
+    bodyA->SetRot(QuatFromAngleAxis(0.7, ChVector3d(1, 1, 0).GetNormalized()));
+
+    bodyB = chrono_types::make_shared<ChBody>();
+    bodyB->SetPos(ChVector3d(0.5, -0.1, 0.2));
+    bodyB->SetRot(QuatFromAngleAxis(-0.5, ChVector3d(0, 1, 2).GetNormalized()));
+
+    bushing_frame = ChFrame<>(ChVector3d(0.3, 0.1, 0.25), QuatFromAngleAxis(0.4, ChVector3d(1, 2, 3).GetNormalized()));
+}
+
+static void SetBodyStates(std::shared_ptr<ChBody> bodyA, std::shared_ptr<ChBody> bodyB) {
+    bodyA->SetPos(bodyA->GetPos() + ChVector3d(0.02, -0.03, 0.01));
+    bodyA->SetRot(bodyA->GetRot() * QuatFromAngleX(0.1));
+    bodyA->SetPosDt(ChVector3d(0.3, -0.4, 0.5));
+    bodyA->SetAngVelLocal(ChVector3d(1.1, -0.7, 0.4));
+
+    bodyB->SetRot(bodyB->GetRot() * QuatFromAngleZ(-0.15));
+    bodyB->SetPosDt(ChVector3d(-0.2, 0.1, 0.6));
+    bodyB->SetAngVelLocal(ChVector3d(-0.3, 0.8, 1.2));
+}
+
+// Compare the Jacobians of the first load against those of the second one (scaled by the given factor)
+static void CompareJacobians(ChLoadBodyBody& load_ad, ChLoadBodyBody& load_fd, double scale = 1) {
+    load_ad.Update(0);
+    load_fd.Update(0);
+
+    const auto& K_ad = load_ad.GetJacobians()->K;
+    const auto& K_fd = load_fd.GetJacobians()->K;
+    const auto& R_ad = load_ad.GetJacobians()->R;
+    const auto& R_fd = load_fd.GetJacobians()->R;
+
+    ASSERT_EQ(K_ad.rows(), 12);
+    ASSERT_EQ(K_ad.cols(), 12);
+
+    double K_max = K_fd.cwiseAbs().maxCoeff();
+    double R_max = R_fd.cwiseAbs().maxCoeff();
+    ASSERT_GT(K_max, 0.0);
+    ASSERT_GT(R_max, 0.0);
+
+    for (int i = 0; i < 12; i++) {
+        for (int j = 0; j < 12; j++) {
+            ASSERT_NEAR(K_ad(i, j), scale * K_fd(i, j), 1e-4 * scale * K_max);
+            ASSERT_NEAR(R_ad(i, j), scale * R_fd(i, j), 1e-4 * scale * R_max);
+        }
+    }
+}
+
+TEST(ChLoadBodyBody, jacobians_bushing_spherical) {
+    std::shared_ptr<ChBody> bodyA, bodyB;
+    ChFrame<> frame;
+    CreateBodies(bodyA, bodyB, frame);
+
+    ChVector3d stiffness(1000, 2000, 3000);
+    ChVector3d damping(10, 20, 30);
+
+    ChLoadBodyBodyBushingSpherical load_ad(bodyA, bodyB, frame, stiffness, damping);
+    BushingFD<ChLoadBodyBodyBushingSpherical> load_fd(bodyA, bodyB, frame, stiffness, damping);
+    BushingScaled<ChLoadBodyBodyBushingSpherical> load_scaled(bodyA, bodyB, frame, stiffness, damping);
+
+    SetBodyStates(bodyA, bodyB);
+    CompareJacobians(load_ad, load_fd);
+    CompareJacobians(load_scaled, load_fd, 2.0);
+}
+
+TEST(ChLoadBodyBody, jacobians_bushing_mate) {
+    std::shared_ptr<ChBody> bodyA, bodyB;
+    ChFrame<> frame;
+    CreateBodies(bodyA, bodyB, frame);
+
+    ChVector3d stiffness(1000, 2000, 3000);
+    ChVector3d damping(10, 20, 30);
+    ChVector3d rot_stiffness(400, 500, 600);
+    ChVector3d rot_damping(4, 5, 6);
+
+    ChLoadBodyBodyBushingMate load_ad(bodyA, bodyB, frame, stiffness, damping, rot_stiffness, rot_damping);
+    BushingFD<ChLoadBodyBodyBushingMate> load_fd(bodyA, bodyB, frame, stiffness, damping, rot_stiffness, rot_damping);
+    BushingScaled<ChLoadBodyBodyBushingMate> load_scaled(bodyA, bodyB, frame, stiffness, damping, rot_stiffness,
+                                                         rot_damping);
+
+    SetBodyStates(bodyA, bodyB);
+    CompareJacobians(load_ad, load_fd);
+    CompareJacobians(load_scaled, load_fd, 2.0);
+}
+
+TEST(ChLoadBodyBody, jacobians_bushing_generic) {
+    std::shared_ptr<ChBody> bodyA, bodyB;
+    ChFrame<> frame;
+    CreateBodies(bodyA, bodyB, frame);
+
+    ChMatrix66d stiffness;
+    ChMatrix66d damping;
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            stiffness(i, j) = (i == j) ? 1000.0 * (i + 1) : 50.0 * (i + j);
+            damping(i, j) = (i == j) ? 10.0 * (i + 1) : 0.5 * (i + 2 * j);
+        }
+    }
+
+    ChLoadBodyBodyBushingGeneric load_ad(bodyA, bodyB, frame, stiffness, damping);
+    BushingFD<ChLoadBodyBodyBushingGeneric> load_fd(bodyA, bodyB, frame, stiffness, damping);
+    BushingScaled<ChLoadBodyBodyBushingGeneric> load_scaled(bodyA, bodyB, frame, stiffness, damping);
+    for (ChLoadBodyBodyBushingGeneric* load : {(ChLoadBodyBodyBushingGeneric*)&load_ad,
+                                               (ChLoadBodyBodyBushingGeneric*)&load_fd,
+                                               (ChLoadBodyBodyBushingGeneric*)&load_scaled}) {
+        load->SetNeutralForce(ChVector3d(10, -20, 5));
+        load->NeutralDisplacement() = ChFrame<>(ChVector3d(0.01, 0, -0.02), QuatFromAngleY(0.05));
+    }
+
+    SetBodyStates(bodyA, bodyB);
+    CompareJacobians(load_ad, load_fd);
+    CompareJacobians(load_scaled, load_fd, 2.0);
+}
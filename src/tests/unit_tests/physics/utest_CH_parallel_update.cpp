@@ -0,0 +1,187 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Test for the concurrent update of assembly items.
+// A set of pendulum chains (bodies, lock and mate joints, springs) and a set of
+// free shafts is simulated with 1 and with 4 Chrono threads. Bodies, shafts, and
+// joints are updated concurrently by default, springs sequentially. Since each
+// item is updated independently, the final states must be identical.
+// Items that did not opt in (here, springs sharing a force functor) must be
+// updated sequentially.
+//
+// =============================================================================
+
+#include <atomic>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkMate.h"
+#include "chrono/physics/ChLinkMotorRotationSpeed.h"
+#include "chrono/physics/ChLinkTSDA.h"
+#include "chrono/physics/ChShaft.h"
+
+using namespace chrono;
+
+static std::vector<ChVector3d> Simulate(int num_threads) {
+    ChSystemNSC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys.SetNumThreads(num_threads);
+    sys.SetSolverType(ChSolver::Type::PSOR);
+    sys.GetSolver()->AsIterative()->SetMaxIterations(50);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    double length = 0.5;
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int ic = 0; ic < 20; ic++) {
+        double z = 0.2 * ic;
+        auto prev = ground;
+        for (int ib = 0; ib < 10; ib++) {
+            auto body = chrono_types::make_shared<ChBodyEasyBox>(length, 0.05, 0.05, 1000, false, false);
+            body->SetPos(ChVector3d((ib + 0.5) * length, 0, z));
+            sys.AddBody(body);
+            bodies.push_back(body);
+
+            ChFrame<> joint_frame(ChVector3d(ib * length, 0, z), QUNIT);
+            if (ib % 2 == 0) {
+                auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+                joint->Initialize(prev, body, joint_frame);
+                sys.AddLink(joint);
+            } else {
+                auto joint = chrono_types::make_shared<ChLinkMateRevolute>();
+                joint->Initialize(prev, body, joint_frame);
+                sys.AddLink(joint);
+            }
+
+            auto spring = chrono_types::make_shared<ChLinkTSDA>();
+            spring->Initialize(ground, body, false, ChVector3d(ib * length, 1, z), body->GetPos());
+            spring->SetSpringCoefficient(50);
+            spring->SetDampingCoefficient(2);
+            sys.AddLink(spring);
+
+            prev = body;
+        }
+    }
+
+    std::vector<std::shared_ptr<ChShaft>> shafts;
+    for (int is = 0; is < 100; is++) {
+        auto shaft = chrono_types::make_shared<ChShaft>();
+        shaft->SetInertia(0.5 + 0.01 * is);
+        shaft->SetAppliedLoad(0.1 * is);
+        sys.AddShaft(shaft);
+        shafts.push_back(shaft);
+    }
+
+    while (sys.GetChTime() < 0.2)
+        sys.DoStepDynamics(1e-3);
+
+    std::vector<ChVector3d> states;
+    for (const auto& body : bodies) {
+        states.push_back(body->GetPos());
+        states.push_back(body->GetPosDt());
+    }
+    for (const auto& shaft : shafts)
+        states.push_back(ChVector3d(shaft->GetPos(), shaft->GetPosDt(), shaft->GetPosDt2()));
+
+    return states;
+}
+
+TEST(ChAssembly, parallel_update) {
+    auto states_1 = Simulate(1);
+    auto states_4 = Simulate(4);
+
+    ASSERT_EQ(states_1.size(), states_4.size());
+    for (size_t i = 0; i < states_1.size(); i++) {
+        ASSERT_NEAR(states_1[i].x(), states_4[i].x(), 1e-10);
+        ASSERT_NEAR(states_1[i].y(), states_4[i].y(), 1e-10);
+        ASSERT_NEAR(states_1[i].z(), states_4[i].z(), 1e-10);
+    }
+}
+
+TEST(ChAssembly, parallel_update_flag) {
+    // items whose Update() only modifies their own state
+    ChBody body;
+    ASSERT_TRUE(body.IsParallelUpdateEnabled());
+    ChBodyEasySphere sphere(0.1, 1000, false, false);
+    ASSERT_TRUE(sphere.IsParallelUpdateEnabled());
+    ChShaft shaft;
+    ASSERT_TRUE(shaft.IsParallelUpdateEnabled());
+    ChLinkLockRevolute revolute;
+    ASSERT_TRUE(revolute.IsParallelUpdateEnabled());
+    ChLinkMateSpherical spherical;
+    ASSERT_TRUE(spherical.IsParallelUpdateEnabled());
+
+    // items whose Update() may modify shared user objects
+    ChLinkTSDA spring;
+    ASSERT_FALSE(spring.IsParallelUpdateEnabled());
+    ChLinkMotorRotationSpeed motor;
+    ASSERT_FALSE(motor.IsParallelUpdateEnabled());
+
+    body.EnableParallelUpdate(false);
+    ChBody copy(body);
+    ASSERT_FALSE(copy.IsParallelUpdateEnabled());
+}
+
+// Spring force functor that records whether it was ever evaluated concurrently.
+class SharedForce : public ChLinkTSDA::ForceFunctor {
+  public:
+    virtual double evaluate(double time,
+                            double rest_length,
+                            double length,
+                            double vel,
+                            const ChLinkTSDA& link) override {
+        if (active.fetch_add(1) > 0)
+            overlap = true;
+        num_calls++;
+        active--;
+        return -100 * (length - rest_length) - 2 * vel;
+    }
+
+    std::atomic<int> active{0};
+    std::atomic<bool> overlap{false};
+    int num_calls = 0;
+};
+
+TEST(ChAssembly, parallel_update_shared_functor) {
+    ChSystemNSC sys;
+    sys.SetNumThreads(4);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto force = chrono_types::make_shared<SharedForce>();
+    int num_springs = 200;
+    for (int i = 0; i < num_springs; i++) {
+        auto body = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, false);
+        body->SetPos(ChVector3d(0.5 * i, -1, 0));
+        sys.AddBody(body);
+
+        auto spring = chrono_types::make_shared<ChLinkTSDA>();
+        spring->Initialize(ground, body, false, ChVector3d(0.5 * i, 0, 0), body->GetPos());
+        spring->RegisterForceFunctor(force);
+        sys.AddLink(spring);
+    }
+
+    sys.DoStepDynamics(1e-3);
+
+    ASSERT_FALSE(force->overlap);
+    ASSERT_GE(force->num_calls, num_springs);
+}
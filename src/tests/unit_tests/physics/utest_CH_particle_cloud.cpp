@@ -0,0 +1,103 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Test for ChParticleCloud.
+// - particle addresses must remain valid as particles are added to a cloud
+// - particles in free flight must follow the analytical ballistic trajectory,
+//   independent of the number of threads used to process the cloud
+//
+// =============================================================================
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChParticleCloud.h"
+
+using namespace chrono;
+
+static const int num_particles = 2500;
+
+static std::shared_ptr<ChParticleCloud> CreateCloud(ChSystem& sys) {
+    auto cloud = chrono_types::make_shared<ChParticleCloud>();
+    cloud->SetMass(0.1);
+    cloud->SetInertiaXX(ChVector3d(1e-3, 1e-3, 1e-3));
+    for (int i = 0; i < num_particles; i++)
+        cloud->AddParticle(ChCoordsys<>(ChVector3d(0.01 * (i % 50), 0.01 * (i / 50), 1.0)));
+    sys.Add(cloud);
+    return cloud;
+}
+
+TEST(ChParticleCloud, storage) {
+    ChParticleCloud cloud;
+    cloud.AddParticle(ChCoordsys<>(ChVector3d(1, 2, 3)));
+    auto first = cloud.GetParticles()[0];
+
+    // Add enough particles to require several storage chunks
+    for (int i = 1; i < num_particles; i++)
+        cloud.AddParticle(ChCoordsys<>(ChVector3d(i, 0, 0)));
+
+    ASSERT_EQ(cloud.GetNumParticles(), num_particles);
+    ASSERT_EQ(cloud.GetParticles()[0], first);
+    ASSERT_EQ(first->GetContainer(), &cloud);
+    ASSERT_EQ(cloud.GetParticlePos(0), ChVector3d(1, 2, 3));
+    ASSERT_EQ(cloud.GetParticlePos(num_particles - 1), ChVector3d(num_particles - 1, 0, 0));
+
+    cloud.ResizeNparticles(10);
+    ASSERT_EQ(cloud.GetNumParticles(), 10);
+    ASSERT_EQ(cloud.GetParticlePos(9), VNULL);
+}
+
+TEST(ChParticleCloud, free_flight) {
+    ChSystemSMC sys_1;
+    ChSystemSMC sys_4;
+    sys_1.SetNumThreads(1);
+    sys_4.SetNumThreads(4);
+    sys_1.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys_4.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto cloud_1 = CreateCloud(sys_1);
+    auto cloud_4 = CreateCloud(sys_4);
+
+    // Initial particle velocities
+    for (int i = 0; i < num_particles; i++) {
+        ChVector3d vel(0.1, 0.01 * (i % 7), 0);
+        cloud_1->GetParticle(i).SetPosDt(vel);
+        cloud_4->GetParticle(i).SetPosDt(vel);
+    }
+
+    double step = 1e-3;
+    int num_steps = 200;
+    for (int n = 0; n < num_steps; n++) {
+        sys_1.DoStepDynamics(step);
+        sys_4.DoStepDynamics(step);
+    }
+
+    double t = num_steps * step;
+    for (int i = 0; i < num_particles; i++) {
+        const auto& pos_1 = cloud_1->GetParticlePos(i);
+        const auto& pos_4 = cloud_4->GetParticlePos(i);
+
+        // same results with 1 and 4 threads
+        ASSERT_DOUBLE_EQ(pos_1.x(), pos_4.x());
+        ASSERT_DOUBLE_EQ(pos_1.y(), pos_4.y());
+        ASSERT_DOUBLE_EQ(pos_1.z(), pos_4.z());
+
+        // ballistic trajectory (up to the time integration error)
+        ASSERT_NEAR(pos_1.x(), 0.01 * (i % 50) + 0.1 * t, 1e-6);
+        ASSERT_NEAR(pos_1.y(), 0.01 * (i / 50) + 0.01 * (i % 7) * t, 1e-6);
+        ASSERT_NEAR(pos_1.z(), 1.0 - 0.5 * 9.81 * t * t, 1e-2);
+    }
+}
@@ -0,0 +1,138 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Tests for persistent contacts reported by the Bullet collision system.
+// - NSC: contacts of a box resting on the ground are matched across steps and
+//   their reactions at the previous step are used to initialize the contacts
+// - SMC: with the MultiStep tangential displacement model, the contact history
+//   allows a box to stick on an incline (which it slowly slides down otherwise)
+//
+// =============================================================================
+
+#include <map>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+
+using namespace chrono;
+
+// Contact container providing access to the body-body contacts
+class TestContainerNSC : public ChContactContainerNSC {
+  public:
+    const ChContactPool<ChContactNSC_6_6>& GetContacts() const { return contactlist_6_6; }
+};
+
+TEST(ChContactContainerNSC, persistent_contacts) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    auto container = chrono_types::make_shared<TestContainerNSC>();
+    sys.SetContactContainer(container);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.5f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 4, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, false, true, mat);
+    box->SetPos(ChVector3d(0, 0, 0.25));
+    sys.AddBody(box);
+
+    for (int i = 0; i < 200; i++)
+        sys.DoStepDynamics(1e-3);
+
+    // Record the contact reactions at the end of the last step
+    std::map<unsigned long long, ChVector3d> reactions;
+    for (auto contact : container->GetContacts()) {
+        ASSERT_TRUE(contact->IsPersistent());
+        reactions[contact->GetContactKey().feature_id] = contact->GetContactForce();
+    }
+    ASSERT_FALSE(reactions.empty());
+
+    // Matched contacts are initialized with their reactions at the previous step
+    sys.ComputeCollisions();
+    int num_matched = 0;
+    for (auto contact : container->GetContacts()) {
+        auto it = reactions.find(contact->GetContactKey().feature_id);
+        if (it == reactions.end())
+            continue;
+        ChVector3d force;
+        ChVector3d torque;
+        ASSERT_TRUE(container->GetPersistentContactReactions(contact->GetContactKey(), force, torque));
+        ASSERT_DOUBLE_EQ(contact->GetContactForce().x(), it->second.x());
+        ASSERT_DOUBLE_EQ(contact->GetContactForce().y(), it->second.y());
+        ASSERT_DOUBLE_EQ(contact->GetContactForce().z(), it->second.z());
+        num_matched++;
+    }
+    ASSERT_GT(num_matched, 0);
+
+    // No contacts are matched if persistence is disabled
+    container->EnablePersistentContacts(false);
+    sys.ComputeCollisions();
+    for (auto contact : container->GetContacts()) {
+        ChVector3d force;
+        ChVector3d torque;
+        ASSERT_FALSE(container->GetPersistentContactReactions(contact->GetContactKey(), force, torque));
+    }
+}
+
+static double SlideOnIncline(ChSystemSMC::TangentialDisplacementModel model) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetTangentialDisplacementModel(model);
+
+    // Incline of 15 degrees (friction coefficient above the tangent of the incline angle)
+    double angle = 15 * CH_DEG_TO_RAD;
+    sys.SetGravitationalAcceleration(9.81 * ChVector3d(std::sin(angle), 0, -std::cos(angle)));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat->SetFriction(0.6f);
+    mat->SetRestitution(0.1f);
+    mat->SetYoungModulus(1e7f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 4, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, false, true, mat);
+    box->SetPos(ChVector3d(0, 0, 0.25));
+    sys.AddBody(box);
+
+    // Let the box settle, then measure its slip along the incline
+    while (sys.GetChTime() < 0.5)
+        sys.DoStepDynamics(1e-4);
+    double x0 = box->GetPos().x();
+    while (sys.GetChTime() < 1.5)
+        sys.DoStepDynamics(1e-4);
+
+    return box->GetPos().x() - x0;
+}
+
+TEST(ChContactContainerSMC, persistent_contacts) {
+    double slip_onestep = SlideOnIncline(ChSystemSMC::TangentialDisplacementModel::OneStep);
+    double slip_multistep = SlideOnIncline(ChSystemSMC::TangentialDisplacementModel::MultiStep);
+
+    // With the contact history, the tangential force does not require a sliding velocity
+    ASSERT_GT(slip_onestep, 0.0);
+    ASSERT_LT(std::abs(slip_multistep), 0.5 * slip_onestep);
+}
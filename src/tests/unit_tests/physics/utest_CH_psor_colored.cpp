@@ -0,0 +1,91 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Test for the multithreaded, graph-colored PSOR solver.
+// A grid of stacked spheres is let to settle on a fixed box, once with the
+// sequential PSOR solver and once with the colored PSOR solver. The final
+// sphere positions are compared.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/solver/ChSolverPSORcolored.h"
+
+using namespace chrono;
+
+static std::vector<ChVector3d> SettleSpheres(ChSolver::Type solver_type, int num_threads, int& num_colors) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.SetNumThreads(num_threads);
+    sys.SetSolverType(solver_type);
+    sys.GetSolver()->AsIterative()->SetMaxIterations(100);
+    sys.GetSolver()->AsIterative()->SetTolerance(1e-6);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 20, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    double radius = 0.5;
+    std::vector<std::shared_ptr<ChBody>> spheres;
+    for (int ix = 0; ix < 8; ix++) {
+        for (int iy = 0; iy < 8; iy++) {
+            for (int iz = 0; iz < 3; iz++) {
+                auto sphere = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+                sphere->SetPos(ChVector3d(2 * radius * (ix - 3.5), 2 * radius * (iy - 3.5), radius * (1 + 2 * iz)));
+                sys.AddBody(sphere);
+                spheres.push_back(sphere);
+            }
+        }
+    }
+
+    num_colors = 0;
+    while (sys.GetChTime() < 0.5) {
+        sys.DoStepDynamics(1e-3);
+        if (auto solver = std::dynamic_pointer_cast<ChSolverPSORcolored>(sys.GetSolver()))
+            num_colors = std::max(num_colors, solver->GetNumColors());
+    }
+
+    std::vector<ChVector3d> pos;
+    for (const auto& sphere : spheres)
+        pos.push_back(sphere->GetPos());
+
+    return pos;
+}
+
+TEST(ChSolverPSORcolored, settling) {
+    int num_colors;
+    auto pos_ref = SettleSpheres(ChSolver::Type::PSOR, 1, num_colors);
+    auto pos_col = SettleSpheres(ChSolver::Type::PSOR_COLORED, 4, num_colors);
+
+    // With 4 threads, the contact graph must have been split in several colors
+    ASSERT_GT(num_colors, 1);
+
+    ASSERT_EQ(pos_ref.size(), pos_col.size());
+    for (size_t i = 0; i < pos_ref.size(); i++) {
+        ASSERT_NEAR(pos_ref[i].x(), pos_col[i].x(), 1e-2);
+        ASSERT_NEAR(pos_ref[i].y(), pos_col[i].y(), 1e-2);
+        ASSERT_NEAR(pos_ref[i].z(), pos_col[i].z(), 1e-2);
+    }
+}
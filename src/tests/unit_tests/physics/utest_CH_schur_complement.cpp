@@ -0,0 +1,150 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Test for the assembled sparse Schur complement operator.
+// - the product with the assembled operator is compared against the matrix-free
+//   product on the problem recorded at the end of a short simulation of a
+//   sphere pile (with and without a mask of enabled constraints)
+// - the sphere pile is simulated with the APGD and BB solvers, with and without
+//   the assembled operator, and the final sphere positions are compared
+//
+// =============================================================================
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/solver/ChIterativeSolverVI.h"
+
+using namespace chrono;
+
+static std::vector<std::shared_ptr<ChBody>> CreatePile(ChSystemNSC& sys) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 20, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    double radius = 0.5;
+    std::vector<std::shared_ptr<ChBody>> spheres;
+    for (int ix = 0; ix < 5; ix++) {
+        for (int iy = 0; iy < 5; iy++) {
+            for (int iz = 0; iz < 3; iz++) {
+                auto sphere = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+                double x = 2 * radius * (ix - 2) + 0.01 * iz;
+                double y = 2 * radius * (iy - 2);
+                sphere->SetPos(ChVector3d(x, y, radius * (1 + 2 * iz)));
+                sys.AddBody(sphere);
+                spheres.push_back(sphere);
+            }
+        }
+    }
+
+    return spheres;
+}
+
+TEST(ChSystemDescriptor, schur_complement_product) {
+    ChSystemNSC sys;
+    CreatePile(sys);
+    sys.SetSolverType(ChSolver::Type::PSOR);
+    for (int i = 0; i < 100; i++)
+        sys.DoStepDynamics(1e-3);
+
+    auto sysd = sys.GetSystemDescriptor();
+    int nc = (int)sysd->CountActiveConstraints();
+    ASSERT_GT(nc, 0);
+
+    for (auto constr : sysd->GetConstraints())
+        constr->Update_auxiliary();
+
+    ChVectorDynamic<> l = ChVectorDynamic<>::Random(nc);
+    std::vector<bool> enabled(nc);
+    for (int i = 0; i < nc; i++)
+        enabled[i] = (i % 3 != 0);
+
+    ChVectorDynamic<> ref;
+    ChVectorDynamic<> ref_masked;
+    sysd->SchurComplementProduct(ref, l);
+    sysd->SchurComplementProduct(ref_masked, l, &enabled);
+
+    ASSERT_TRUE(sysd->BuildSchurComplement(2));
+    ASSERT_TRUE(sysd->IsSchurComplementAssembled());
+
+    ChVectorDynamic<> res;
+    ChVectorDynamic<> res_masked;
+    sysd->SchurComplementProduct(res, l);
+    sysd->SchurComplementProduct(res_masked, l, &enabled);
+
+    sysd->ResetSchurComplement();
+    ASSERT_FALSE(sysd->IsSchurComplementAssembled());
+
+    ASSERT_EQ(res.size(), nc);
+    ASSERT_EQ(res_masked.size(), nc);
+    double scale = ref.lpNorm<Eigen::Infinity>();
+    for (int i = 0; i < nc; i++) {
+        ASSERT_NEAR(ref(i), res(i), 1e-10 * scale);
+        ASSERT_NEAR(ref_masked(i), res_masked(i), 1e-10 * scale);
+    }
+}
+
+static std::vector<ChVector3d> SettlePile(ChSolver::Type solver_type, bool sparse_schur) {
+    ChSystemNSC sys;
+    auto spheres = CreatePile(sys);
+    sys.SetNumThreads(2);
+    sys.SetSolverType(solver_type);
+    auto solver = std::dynamic_pointer_cast<ChIterativeSolverVI>(sys.GetSolver());
+    solver->SetMaxIterations(100);
+    solver->SetTolerance(1e-8);
+    solver->EnableSparseSchurComplement(sparse_schur);
+
+    while (sys.GetChTime() < 0.3)
+        sys.DoStepDynamics(1e-3);
+
+    std::vector<ChVector3d> pos;
+    for (const auto& sphere : spheres)
+        pos.push_back(sphere->GetPos());
+
+    return pos;
+}
+
+TEST(ChIterativeSolverVI, sparse_schur_APGD) {
+    auto pos_ref = SettlePile(ChSolver::Type::APGD, false);
+    auto pos_spm = SettlePile(ChSolver::Type::APGD, true);
+
+    ASSERT_EQ(pos_ref.size(), pos_spm.size());
+    for (size_t i = 0; i < pos_ref.size(); i++) {
+        ASSERT_NEAR(pos_ref[i].x(), pos_spm[i].x(), 1e-3);
+        ASSERT_NEAR(pos_ref[i].y(), pos_spm[i].y(), 1e-3);
+        ASSERT_NEAR(pos_ref[i].z(), pos_spm[i].z(), 1e-3);
+    }
+}
+
+TEST(ChIterativeSolverVI, sparse_schur_BB) {
+    auto pos_ref = SettlePile(ChSolver::Type::BARZILAIBORWEIN, false);
+    auto pos_spm = SettlePile(ChSolver::Type::BARZILAIBORWEIN, true);
+
+    ASSERT_EQ(pos_ref.size(), pos_spm.size());
+    for (size_t i = 0; i < pos_ref.size(); i++) {
+        ASSERT_NEAR(pos_ref[i].x(), pos_spm[i].x(), 1e-3);
+        ASSERT_NEAR(pos_ref[i].y(), pos_spm[i].y(), 1e-3);
+        ASSERT_NEAR(pos_ref[i].z(), pos_spm[i].z(), 1e-3);
+    }
+}
@@ -0,0 +1,234 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Test for the closed-form Jacobians of SMC contact forces.
+// The stiffness and damping Jacobians of a sphere-sphere contact are calculated
+// analytically (default SMC force algorithm) and with finite differences (force
+// algorithm not providing Jacobians), for all combinations of normal force and
+// tangential displacement models. Force algorithms derived from the default one
+// must fall back to finite differences unless they opt in.
+// The closed-form Jacobians neglect the geometric stiffness due to the change in
+// the contact point moment arms, so the stiffness matrices are compared only for
+// the translational degrees of freedom.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChContactSMC.h"
+#include "chrono/physics/ChContactContainerSMC.h"
+
+using namespace chrono;
+
+// SMC force algorithm which does not provide contact force Jacobians (finite-difference approximation)
+class ContactForceNoJacobians : public ChDefaultContactForceTorqueSMC {
+  public:
+    virtual bool CalculateForceJacobians(const ChSystemSMC& sys,
+                                         const ChVector3d& normal_dir,
+                                         const ChVector3d& p1,
+                                         const ChVector3d& p2,
+                                         const ChVector3d& vel1,
+                                         const ChVector3d& vel2,
+                                         const ChContactMaterialCompositeSMC& mat,
+                                         double delta,
+                                         double eff_radius,
+                                         double mass1,
+                                         double mass2,
+                                         ChContactable* objA,
+                                         ChContactable* objB,
+                                         const ChVector3d& tdispl,
+                                         ChMatrix33<>& dF_dp,
+                                         ChMatrix33<>& dF_dv) const override {
+        return false;
+    }
+};
+
+// SMC force algorithm which scales the default contact force and only overrides the force calculation
+class ContactForceScaled : public ChDefaultContactForceTorqueSMC {
+  public:
+    virtual ChWrenchd CalculateForceTorqueWithHistory(const ChSystemSMC& sys,
+                                                      const ChVector3d& normal_dir,
+                                                      const ChVector3d& p1,
+                                                      const ChVector3d& p2,
+                                                      const ChVector3d& vel1,
+                                                      const ChVector3d& vel2,
+                                                      const ChContactMaterialCompositeSMC& mat,
+                                                      double delta,
+                                                      double eff_radius,
+                                                      double mass1,
+                                                      double mass2,
+                                                      ChContactable* objA,
+                                                      ChContactable* objB,
+                                                      ChVector3d& tdispl) const override {
+        auto w = ChDefaultContactForceTorqueSMC::CalculateForceTorqueWithHistory(
+            sys, normal_dir, p1, p2, vel1, vel2, mat, delta, eff_radius, mass1, mass2, objA, objB, tdispl);
+        return {2.0 * w.force, 2.0 * w.torque};
+    }
+};
+
+// SMC force algorithm which does not change the default contact force and opts in to the closed-form Jacobians
+class ContactForceOptIn : public ChDefaultContactForceTorqueSMC {
+  protected:
+    virtual bool UseClosedFormJacobians() const override { return true; }
+};
+
+static std::shared_ptr<ChBody> CreateSphere(ChSystemSMC& sys,
+                                            const ChVector3d& pos,
+                                            const ChVector3d& vel,
+                                            const ChVector3d& angvel) {
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetMass(500);
+    body->SetInertiaXX(ChVector3d(50, 50, 50));
+    body->SetPos(pos);
+    body->SetRot(QuatFromAngleY(0.3));
+    body->SetPosDt(vel);
+    body->SetAngVelParent(angvel);
+    sys.AddBody(body);
+    return body;
+}
+
+// Calculate the stiffness and damping Jacobians of a sphere-sphere contact, using the given SMC force algorithm
+static void CalculateJacobians(ChSystemSMC::ContactForceModel force_model,
+                               ChSystemSMC::TangentialDisplacementModel tdispl_model,
+                               bool use_mat_props,
+                               float friction,
+                               std::unique_ptr<ChSystemSMC::ChContactForceTorqueSMC>&& algorithm,
+                               ChMatrixDynamic<>& K,
+                               ChMatrixDynamic<>& R) {
+    ChSystemSMC sys;
+    sys.SetContactForceModel(force_model);
+    sys.SetTangentialDisplacementModel(tdispl_model);
+    sys.UseMaterialProperties(use_mat_props);
+    sys.SetStiffContact(true);
+    sys.SetContactForceTorqueAlgorithm(std::move(algorithm));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat->SetFriction(friction);
+    mat->SetRestitution(0.5f);
+    mat->SetYoungModulus(1e7f);
+    mat->SetKn(2e5f);
+    mat->SetKt(2e5f);
+    mat->SetGn(40);
+    mat->SetGt(20);
+
+    // Two overlapping spheres of radius 0.5, with relative sliding
+    auto sphereA = CreateSphere(sys, ChVector3d(0, 0, 0), ChVector3d(0, 0, 0.1), ChVector3d(0.2, 0, 0));
+    auto sphereB = CreateSphere(sys, ChVector3d(0, 0, 0.95), ChVector3d(1, 0.5, -0.2), ChVector3d(0, 1, 0.5));
+
+    ChCollisionInfo cinfo;
+    cinfo.vpA = ChVector3d(0, 0, 0.5);
+    cinfo.vpB = ChVector3d(0, 0, 0.45);
+    cinfo.vN = ChVector3d(0, 0, 1);
+    cinfo.distance = -0.05;
+    cinfo.eff_radius = 0.25;
+
+    ChContactMaterialCompositionStrategy strategy;
+    ChContactMaterialCompositeSMC cmat(&strategy, mat, mat);
+
+    auto container = static_cast<ChContactContainerSMC*>(sys.GetContactContainer().get());
+    using ContactBodyBody = ChContactSMC<ChContactable_1vars<6>, ChContactable_1vars<6>>;
+
+    ContactBodyBody contact(container, sphereA.get(), sphereB.get(), cinfo, cmat);
+    K = *contact.GetJacobianK();
+    R = *contact.GetJacobianR();
+}
+
+// Compare the Jacobians K and R against the reference Jacobians K_ref and R_ref (scaled by the given factor).
+// The stiffness matrices are compared only for the translational degrees of freedom.
+static void CompareJacobians(const ChMatrixDynamic<>& K,
+                             const ChMatrixDynamic<>& R,
+                             const ChMatrixDynamic<>& K_ref,
+                             const ChMatrixDynamic<>& R_ref,
+                             double scale = 1) {
+    ASSERT_EQ(K.rows(), 12);
+    ASSERT_EQ(K.cols(), 12);
+
+    double tolK = 1e-3 * scale * K_ref.cwiseAbs().maxCoeff();
+    double tolR = 1e-3 * scale * R_ref.cwiseAbs().maxCoeff();
+    ASSERT_GT(tolK, 0.0);
+    ASSERT_GT(tolR, 0.0);
+
+    for (int i = 0; i < 12; i++) {
+        for (int j = 0; j < 12; j++) {
+            ASSERT_NEAR(R(i, j), scale * R_ref(i, j), tolR);
+            if (j < 3 || (j >= 6 && j < 9))
+                ASSERT_NEAR(K(i, j), scale * K_ref(i, j), tolK);
+        }
+    }
+}
+
+// Compare the closed-form Jacobians (default SMC force algorithm) against finite differences
+static void CheckJacobians(ChSystemSMC::ContactForceModel force_model,
+                           ChSystemSMC::TangentialDisplacementModel tdispl_model,
+                           bool use_mat_props,
+                           float friction) {
+    ChMatrixDynamic<> K, R, K_fd, R_fd;
+    CalculateJacobians(force_model, tdispl_model, use_mat_props, friction,
+                       chrono_types::make_unique<ChDefaultContactForceTorqueSMC>(), K, R);
+    CalculateJacobians(force_model, tdispl_model, use_mat_props, friction,
+                       chrono_types::make_unique<ContactForceNoJacobians>(), K_fd, R_fd);
+    CompareJacobians(K, R, K_fd, R_fd);
+}
+
+TEST(ChContactSMC, jacobians_hooke) {
+    CheckJacobians(ChSystemSMC::Hooke, ChSystemSMC::OneStep, false, 0.5f);
+}
+
+TEST(ChContactSMC, jacobians_hooke_sliding) {
+    CheckJacobians(ChSystemSMC::Hooke, ChSystemSMC::OneStep, true, 0.1f);
+}
+
+TEST(ChContactSMC, jacobians_hertz) {
+    CheckJacobians(ChSystemSMC::Hertz, ChSystemSMC::OneStep, true, 0.5f);
+}
+
+TEST(ChContactSMC, jacobians_hertz_multistep) {
+    CheckJacobians(ChSystemSMC::Hertz, ChSystemSMC::MultiStep, false, 0.5f);
+}
+
+TEST(ChContactSMC, jacobians_flores) {
+    CheckJacobians(ChSystemSMC::Flores, ChSystemSMC::None, false, 0.5f);
+}
+
+TEST(ChContactSMC, jacobians_all_models) {
+    for (auto force_model : {ChSystemSMC::Hooke, ChSystemSMC::Hertz, ChSystemSMC::Flores}) {
+        for (auto tdispl_model : {ChSystemSMC::None, ChSystemSMC::OneStep, ChSystemSMC::MultiStep}) {
+            CheckJacobians(force_model, tdispl_model, false, 0.5f);  // sticking
+            CheckJacobians(force_model, tdispl_model, true, 0.1f);   // sliding
+        }
+    }
+}
+
+// A derived force algorithm which only overrides the force calculation must not use the closed-form Jacobians of the
+// default algorithm (its Jacobians are approximated with finite differences)
+TEST(ChContactSMC, jacobians_derived_force) {
+    ChMatrixDynamic<> K, R, K_fd, R_fd;
+    CalculateJacobians(ChSystemSMC::Hertz, ChSystemSMC::OneStep, true, 0.5f,
+                       chrono_types::make_unique<ContactForceScaled>(), K, R);
+    CalculateJacobians(ChSystemSMC::Hertz, ChSystemSMC::OneStep, true, 0.5f,
+                       chrono_types::make_unique<ContactForceNoJacobians>(), K_fd, R_fd);
+    CompareJacobians(K, R, K_fd, R_fd, 2.0);
+}
+
+// A derived force algorithm can opt in to the closed-form Jacobians if it does not change the contact force
+TEST(ChContactSMC, jacobians_derived_opt_in) {
+    ChMatrixDynamic<> K, R, K_ref, R_ref;
+    CalculateJacobians(ChSystemSMC::Hooke, ChSystemSMC::MultiStep, false, 0.5f,
+                       chrono_types::make_unique<ContactForceOptIn>(), K, R);
+    CalculateJacobians(ChSystemSMC::Hooke, ChSystemSMC::MultiStep, false, 0.5f,
+                       chrono_types::make_unique<ChDefaultContactForceTorqueSMC>(), K_ref, R_ref);
+    ASSERT_TRUE(K == K_ref);
+    ASSERT_TRUE(R == R_ref);
+}
@@ -0,0 +1,269 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Test for the binary data output of the Blender exporter.
+// The same scene (two bodies and a particle cloud) is exported once with ASCII
+// literals and once with binary data. The header of the .bin file (magic string,
+// version, block index) is checked against the layout expected by the
+// chrono_import.py add-on, the binary frames must match the body and particle
+// frames exactly, and must match the literals written in ASCII mode.
+//
+// =============================================================================
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChParticleCloud.h"
+#include "chrono/assets/ChVisualShapeBox.h"
+#include "chrono/assets/ChVisualShapeSphere.h"
+
+#include "chrono_postprocess/ChBlender.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+using namespace chrono;
+using namespace chrono::postprocess;
+
+static const std::string out_dir = GetChronoOutputPath() + "BLENDER_BINARY/";
+
+using FrameData = std::array<double, 7>;  // x, y, z, e0, e1, e2, e3
+
+// Frames of the exported items, keyed by item name, and of the particles in each particle cloud
+struct ExportedFrames {
+    std::map<std::string, FrameData> items;
+    std::map<std::string, std::vector<FrameData>> clouds;
+};
+
+// Contents of a binary data file
+struct BinaryData {
+    uint32_t version;
+    std::vector<std::array<uint64_t, 3>> index;  // offset, rows, columns
+    std::vector<std::vector<double>> blocks;
+    size_t file_size;
+};
+
+static std::string ReadText(const std::string& filename) {
+    std::ifstream file(filename);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+static void ReadBinary(const std::string& filename, BinaryData& bin) {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    ASSERT_TRUE(file.good());
+    bin.file_size = (size_t)file.tellg();
+    file.seekg(0);
+
+    char magic[8];
+    uint32_t num_blocks;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&bin.version), sizeof(bin.version));
+    file.read(reinterpret_cast<char*>(&num_blocks), sizeof(num_blocks));
+    ASSERT_TRUE(file.good());
+    ASSERT_EQ(std::string(magic, 8), std::string("CHBLBIN\0", 8));
+
+    bin.index.resize(num_blocks);
+    file.read(reinterpret_cast<char*>(bin.index.data()), num_blocks * 3 * sizeof(uint64_t));
+    ASSERT_TRUE(file.good());
+
+    bin.blocks.resize(num_blocks);
+    for (uint32_t ib = 0; ib < num_blocks; ib++) {
+        bin.blocks[ib].resize(bin.index[ib][1] * bin.index[ib][2]);
+        file.seekg(bin.index[ib][0]);
+        file.read(reinterpret_cast<char*>(bin.blocks[ib].data()), bin.blocks[ib].size() * sizeof(double));
+        ASSERT_TRUE(file.good());
+    }
+}
+
+// Extract the item name from a "make_chrono_object_...('name'," line
+static std::string ItemName(const std::string& line) {
+    auto start = line.find("('") + 2;
+    return line.substr(start, line.find("',", start) - start);
+}
+
+// Skip the list of visual shapes which follows the item frame
+static void SkipAssetList(std::istream& stream) {
+    std::string line;
+    while (std::getline(stream, line) && line != "],") {
+    }
+}
+
+// Parse the frames written as "(x,y,z),(e0,e1,e2,e3)" literals
+static bool ParseLiteral(const std::string& text, FrameData& frame) {
+    return std::sscanf(text.c_str(), "(%lf,%lf,%lf),(%lf,%lf,%lf,%lf)", &frame[0], &frame[1], &frame[2], &frame[3],
+                       &frame[4], &frame[5], &frame[6]) == 7;
+}
+
+static void ParseAscii(const std::string& text, ExportedFrames& frames) {
+    std::istringstream stream(text);
+    std::string line;
+    while (std::getline(stream, line)) {
+        bool clones = line.rfind("make_chrono_object_clones('", 0) == 0;
+        if (!clones && line.rfind("make_chrono_object_assetlist('", 0) != 0)
+            continue;
+        auto name = ItemName(line);
+        FrameData frame;
+        ASSERT_TRUE(ParseLiteral(line.substr(line.find("',(") + 2), frame));
+        frames.items[name] = frame;
+
+        if (!clones)
+            continue;
+        SkipAssetList(stream);
+        auto& particles = frames.clouds[name];
+        while (std::getline(stream, line) && line != "]") {
+            ASSERT_TRUE(ParseLiteral(line.substr(line.find("[(") + 1), frame));
+            particles.push_back(frame);
+        }
+    }
+}
+
+static void ParseBinary(const std::string& text, const BinaryData& bin, ExportedFrames& frames) {
+    std::istringstream stream(text);
+    std::string line;
+    while (std::getline(stream, line)) {
+        bool clones = line.rfind("make_chrono_object_clones('", 0) == 0;
+        if (!clones && line.rfind("make_chrono_object_assetlist('", 0) != 0)
+            continue;
+        auto name = ItemName(line);
+        size_t row;
+        auto ref = line.substr(line.find("chrono_bin_data[0]["));
+        ASSERT_EQ(std::sscanf(ref.c_str(), "chrono_bin_data[0][%zu,", &row), 1);
+        ASSERT_LT(row, bin.index[0][1]);
+        FrameData frame;
+        std::memcpy(frame.data(), &bin.blocks[0][7 * row], sizeof(frame));
+        frames.items[name] = frame;
+
+        if (!clones)
+            continue;
+        size_t block;
+        SkipAssetList(stream);
+        ASSERT_TRUE(std::getline(stream, line));
+        ASSERT_EQ(std::sscanf(line.c_str(), " chrono_bin_data[%zu]", &block), 1);
+        ASSERT_LT(block, bin.blocks.size());
+        ASSERT_EQ(bin.index[block][2], 7u);
+        auto& particles = frames.clouds[name];
+        for (size_t m = 0; m < bin.index[block][1]; m++) {
+            std::memcpy(frame.data(), &bin.blocks[block][7 * m], sizeof(frame));
+            particles.push_back(frame);
+        }
+    }
+}
+
+static FrameData ToData(const ChCoordsys<>& csys) {
+    return {csys.pos.x(), csys.pos.y(), csys.pos.z(), csys.rot.e0(), csys.rot.e1(), csys.rot.e2(), csys.rot.e3()};
+}
+
+static void Export(ChSystem& sys, bool binary, const std::string& path) {
+    ChBlender blender(&sys);
+    blender.SetBasePath(path);
+    blender.SetBlenderUp_is_ChronoZ();
+    blender.SetUseBinaryData(binary);
+    blender.AddAll();
+    blender.ExportScript();
+    blender.ExportData();
+}
+
+TEST(ChBlender, binary_data) {
+    ASSERT_TRUE(filesystem::create_directory(filesystem::path(GetChronoOutputPath())));
+    ASSERT_TRUE(filesystem::create_directory(filesystem::path(out_dir)));
+
+    ChSystemNSC sys;
+
+    auto body1 = chrono_types::make_shared<ChBody>();
+    body1->SetName("body1");
+    body1->SetPos(ChVector3d(0.123456789, -0.987654321, 0.5));
+    body1->SetRot(QuatFromAngleAxis(0.3, ChVector3d(1, 2, 3).GetNormalized()));
+    body1->AddVisualShape(chrono_types::make_shared<ChVisualShapeBox>(0.2, 0.1, 0.3));
+    sys.AddBody(body1);
+
+    auto body2 = chrono_types::make_shared<ChBody>();
+    body2->SetName("body2");
+    body2->SetPos(ChVector3d(-1.5, 0.25, 1.75));
+    body2->SetRot(QuatFromAngleZ(-1.2));
+    body2->AddVisualShape(chrono_types::make_shared<ChVisualShapeSphere>(0.1), ChFrame<>(ChVector3d(0, 0.2, 0)));
+    sys.AddBody(body2);
+
+    auto cloud = chrono_types::make_shared<ChParticleCloud>();
+    cloud->SetName("cloud");
+    for (int i = 0; i < 5; i++) {
+        cloud->AddParticle(ChCoordsys<>(ChVector3d(0.1 * i + 0.0123, -0.2 * i, 0.3 * i + 0.0456),
+                                        QuatFromAngleX(0.35 * i + 0.1)));
+    }
+    cloud->AddVisualShape(chrono_types::make_shared<ChVisualShapeSphere>(0.05));
+    sys.Add(cloud);
+
+    Export(sys, false, out_dir + "ascii");
+    Export(sys, true, out_dir + "binary");
+
+    std::string state = "/output/state00000";
+
+    // Check the header and block index of the binary data file
+    BinaryData bin;
+    ReadBinary(out_dir + "binary" + state + ".bin", bin);
+    ASSERT_EQ(bin.version, 1u);
+    ASSERT_EQ(bin.index.size(), 2u);  // item frames + one particle cloud
+    uint64_t offset = 8 + 2 * sizeof(uint32_t) + bin.index.size() * 3 * sizeof(uint64_t);
+    for (const auto& entry : bin.index) {
+        ASSERT_EQ(entry[0], offset);
+        ASSERT_EQ(entry[2], 7u);
+        offset += entry[1] * entry[2] * sizeof(double);
+    }
+    ASSERT_EQ(offset, bin.file_size);
+    ASSERT_EQ(bin.index[0][1], 3u);  // one row per exported item
+    ASSERT_EQ(bin.index[1][1], cloud->GetNumParticles());
+
+    ExportedFrames ascii_frames;
+    ExportedFrames binary_frames;
+    ParseAscii(ReadText(out_dir + "ascii" + state + ".py"), ascii_frames);
+    ParseBinary(ReadText(out_dir + "binary" + state + ".py"), bin, binary_frames);
+    ASSERT_EQ(ascii_frames.items.size(), 3u);
+    ASSERT_EQ(binary_frames.items.size(), 3u);
+    ASSERT_EQ(ascii_frames.clouds.size(), 1u);
+    ASSERT_EQ(binary_frames.clouds.size(), 1u);
+
+    // Binary frames must be exact
+    ASSERT_EQ(binary_frames.items["body1"], ToData(body1->GetCoordsys()));
+    ASSERT_EQ(binary_frames.items["body2"], ToData(body2->GetCoordsys()));
+    ASSERT_EQ(binary_frames.items["cloud"], ToData(CSYSNORM));
+    const auto& particles = binary_frames.clouds["cloud"];
+    ASSERT_EQ(particles.size(), cloud->GetNumParticles());
+    for (unsigned int m = 0; m < cloud->GetNumParticles(); m++)
+        ASSERT_EQ(particles[m], ToData(cloud->GetParticle(m).GetCoordsys()));
+
+    // ASCII literals must match the binary frames (up to the precision of the text output)
+    const double tol = 1e-5;
+    for (const auto& item : binary_frames.items) {
+        const auto& ascii = ascii_frames.items[item.first];
+        for (int k = 0; k < 7; k++)
+            ASSERT_NEAR(ascii[k], item.second[k], tol);
+    }
+    const auto& ascii_particles = ascii_frames.clouds["cloud"];
+    ASSERT_EQ(ascii_particles.size(), particles.size());
+    for (size_t m = 0; m < particles.size(); m++) {
+        for (int k = 0; k < 7; k++)
+            ASSERT_NEAR(ascii_particles[m][k], particles[m][k], tol);
+    }
+}
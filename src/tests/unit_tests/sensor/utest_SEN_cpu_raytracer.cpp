@@ -0,0 +1,145 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Asher Elmquist
+// =============================================================================
+//
+// Unit test for the CPU ray tracer and the CPU lidar and depth camera sensors
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+#include "chrono_sensor/cpu/ChCPURayTracer.h"
+#include "chrono_sensor/sensors/ChCPULidarSensor.h"
+#include "chrono_sensor/sensors/ChCPUDepthCamera.h"
+#include "chrono_sensor/ChSensorManager.h"
+#include "chrono_sensor/filters/ChFilterAccess.h"
+#include "chrono_sensor/filters/ChFilterPCfromDepth.h"
+
+using namespace chrono;
+using namespace chrono::sensor;
+
+const float ABS_ERR_F = 1e-4f;
+
+// trace single rays against analytic primitives and a triangle mesh
+TEST(ChCPURayTracer, primitives) {
+    ChCPURayTracer tracer;
+    tracer.SetNumThreads(2);
+    tracer.AddSphere({5, 0, 0}, 1.0);
+    tracer.AddBox(ChFrame<>({0, 5, 0}, QuatFromAngleZ(CH_PI_4)), {0.5, 0.5, 0.5});
+    tracer.AddCylinder(ChFrame<>(ChVector3d(0, 0, 5)), 0.5, 2.0);
+    tracer.AddTriangle({-5, -1, -1}, {-5, 1, -1}, {-5, 0, 1});
+    tracer.Build();
+
+    std::vector<ChVector3f> origins(5, ChVector3f(0, 0, 0));
+    std::vector<ChVector3f> directions = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {-1, 0, 0}, {0, -1, 0}};
+    std::vector<float> distances;
+    std::vector<float> cosines;
+    tracer.Trace(origins, directions, 1e-3f, 100.f, distances, cosines);
+
+    ASSERT_NEAR(distances[0], 4.f, ABS_ERR_F);                            // sphere
+    ASSERT_NEAR(distances[1], 5.f - 0.5f * (float)CH_SQRT_2, ABS_ERR_F);  // box edge
+    ASSERT_NEAR(distances[2], 4.f, ABS_ERR_F);                            // cylinder cap
+    ASSERT_NEAR(distances[3], 5.f, ABS_ERR_F);                            // triangle
+    ASSERT_FLOAT_EQ(distances[4], 0.f);                                   // miss
+    ASSERT_NEAR(cosines[0], 1.f, ABS_ERR_F);
+    ASSERT_NEAR(cosines[3], 1.f, ABS_ERR_F);
+    ASSERT_FLOAT_EQ(cosines[4], 0.f);
+
+    // ray range limits
+    tracer.Trace(origins, directions, 1e-3f, 3.f, distances, cosines);
+    ASSERT_FLOAT_EQ(distances[0], 0.f);
+
+    // a closed mesh gives the same result as the analytic box
+    ChTriangleMeshConnected box_mesh;
+    box_mesh.AddTriangle({0.5, -0.5, -0.5}, {0.5, 0.5, -0.5}, {0.5, 0.5, 0.5});
+    box_mesh.AddTriangle({0.5, -0.5, -0.5}, {0.5, 0.5, 0.5}, {0.5, -0.5, 0.5});
+    tracer.Clear();
+    tracer.AddMesh(box_mesh, ChFrame<>(ChVector3d(2, 0, 0)), {1, 1, 1});
+    tracer.Build();
+    tracer.Trace(origins, directions, 1e-3f, 100.f, distances, cosines);
+    ASSERT_NEAR(distances[0], 2.5f, ABS_ERR_F);
+    ASSERT_FLOAT_EQ(distances[1], 0.f);
+}
+
+// CPU lidar and depth camera attached to a body, seeing bodies added to the system
+TEST(ChCPUSensor, lidar_and_depth) {
+    ChSystemNSC sys;
+    auto body = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 100, false, false);
+    body->SetFixed(true);
+    sys.Add(body);
+
+    auto manager = chrono_types::make_shared<ChSensorManager>(&sys);
+
+    auto lidar = chrono_types::make_shared<ChCPULidarSensor>(body, 10, chrono::ChFrame<double>(), 1, 1, 0, 0, 0, 100);
+    lidar->SetLag(0.f);
+    lidar->PushFilter(chrono_types::make_shared<ChFilterDIAccess>());
+    lidar->PushFilter(chrono_types::make_shared<ChFilterPCfromDepth>());
+    lidar->PushFilter(chrono_types::make_shared<ChFilterXYZIAccess>());
+    manager->AddSensor(lidar);
+
+    auto depth = chrono_types::make_shared<ChCPUDepthCamera>(body, 10, chrono::ChFrame<double>(), 1, 1, 1.f);
+    depth->SetLag(0.f);
+    manager->AddSensor(depth);
+
+    // CPU sensors are not rendered by an OptiX engine
+    ASSERT_EQ(manager->GetSensorList().size(), 2);
+#ifdef CHRONO_HAS_OPTIX
+    ASSERT_EQ(manager->GetNumEngines(), 0);
+#endif
+
+    // nothing there to begin with
+    while (sys.GetChTime() < 0.05) {
+        manager->Update();
+        sys.DoStepDynamics(0.01);
+    }
+
+    auto di_buffer = lidar->GetMostRecentBuffer<UserDIBufferPtr>();
+    ASSERT_FLOAT_EQ(di_buffer->Buffer[0].intensity, 0.f);
+    auto pc_buffer = lidar->GetMostRecentBuffer<UserXYZIBufferPtr>();
+    ASSERT_EQ(pc_buffer->Width, 0);
+
+    // add box; the scene is rebuilt from the system at every launch
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 100, true, false);
+    box->SetPos({2.5, 0.0, 0.0});
+    box->SetFixed(true);
+    sys.Add(box);
+    while (sys.GetChTime() < 0.15) {
+        manager->Update();
+        sys.DoStepDynamics(0.01);
+    }
+
+    di_buffer = lidar->GetMostRecentBuffer<UserDIBufferPtr>();
+    ASSERT_GT(di_buffer->Buffer[0].intensity, 0.f);
+    ASSERT_NEAR(di_buffer->Buffer[0].range, 2.f, ABS_ERR_F);
+    pc_buffer = lidar->GetMostRecentBuffer<UserXYZIBufferPtr>();
+    ASSERT_EQ(pc_buffer->Width, 1);
+    ASSERT_NEAR(pc_buffer->Buffer[0].x, 2.f, ABS_ERR_F);
+    auto depth_buffer = depth->GetMostRecentBuffer<UserDepthBufferPtr>();
+    ASSERT_NEAR(depth_buffer->Buffer[0].depth, 2.f, ABS_ERR_F);
+
+    // move box
+    box->SetPos({4.0, 0.0, 0.0});
+    while (sys.GetChTime() < 0.25) {
+        manager->Update();
+        sys.DoStepDynamics(0.01);
+    }
+
+    di_buffer = lidar->GetMostRecentBuffer<UserDIBufferPtr>();
+    ASSERT_NEAR(di_buffer->Buffer[0].range, 3.5f, ABS_ERR_F);
+    depth_buffer = depth->GetMostRecentBuffer<UserDepthBufferPtr>();
+    ASSERT_NEAR(depth_buffer->Buffer[0].depth, 3.5f, ABS_ERR_F);
+}
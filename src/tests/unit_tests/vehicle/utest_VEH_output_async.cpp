@@ -0,0 +1,139 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the asynchronous (double-buffered) vehicle output.
+// - every frame written on the background thread must hold the snapshot taken
+//   on the simulation thread, even though the objects keep changing
+// - an exception thrown while writing a frame must be rethrown on the
+//   simulation thread
+//
+// =============================================================================
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChShaft.h"
+
+#include "chrono_vehicle/output/ChVehicleOutputAsync.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Output database which records the written frames and optionally fails at a given frame.
+class TestOutput : public ChVehicleOutputAsync {
+  public:
+    struct Entry {
+        int frame;
+        double time;
+        std::string section;
+        double body_x;
+        double shaft_pos;
+    };
+
+    TestOutput(int fail_frame = -1) : m_fail_frame(fail_frame) {}
+    ~TestOutput() { Stop(); }
+
+    std::vector<Entry> entries;
+
+  private:
+    virtual void WriteFrame(const Frame& frame) override {
+        // Slow writer, so that the simulation thread must wait for it
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        if (frame.frame == m_fail_frame)
+            throw std::runtime_error("write failure");
+
+        ASSERT_EQ(frame.num_sections, 1u);
+        const auto& section = frame.sections[0];
+        const auto& bodies = section.records[BODIES];
+        const auto& shafts = section.records[SHAFTS];
+        ASSERT_EQ(bodies.ids.size(), 1u);
+        ASSERT_EQ(bodies.data.size(), (size_t)GetNumFields(BODIES));
+        ASSERT_EQ(shafts.ids.size(), 1u);
+        entries.push_back({frame.frame, frame.time, section.name, bodies.data[0], shafts.data[0]});
+    }
+
+    int m_fail_frame;
+};
+
+TEST(ChVehicleOutputAsync, snapshots) {
+    auto body = chrono_types::make_shared<ChBody>();
+    auto shaft = chrono_types::make_shared<ChShaft>();
+
+    TestOutput output;
+    ChVehicleOutput& db = output;
+    int num_frames = 20;
+    for (int i = 0; i < num_frames; i++) {
+        body->SetPos(ChVector3d(i, 0, 0));
+        shaft->SetPos(-i);
+        db.WriteTime(i, 0.1 * i);
+        db.WriteSection("chassis");
+        db.WriteBodies({body});
+        db.WriteShafts({shaft});
+
+        // Objects change while the previous frame may still be written
+        body->SetPos(ChVector3d(-1, 0, 0));
+        shaft->SetPos(1);
+    }
+    output.Flush();
+
+    ASSERT_EQ(output.entries.size(), (size_t)num_frames);
+    for (int i = 0; i < num_frames; i++) {
+        const auto& entry = output.entries[i];
+        ASSERT_EQ(entry.frame, i);
+        ASSERT_DOUBLE_EQ(entry.time, 0.1 * i);
+        ASSERT_EQ(entry.section, "chassis");
+        ASSERT_EQ(entry.body_x, (double)i);
+        ASSERT_EQ(entry.shaft_pos, (double)-i);
+    }
+}
+
+TEST(ChVehicleOutputAsync, writer_exception) {
+    auto body = chrono_types::make_shared<ChBody>();
+    auto shaft = chrono_types::make_shared<ChShaft>();
+
+    TestOutput output(3);
+    ChVehicleOutput& db = output;
+    auto write = [&](int i) {
+        db.WriteTime(i, 0.1 * i);
+        db.WriteSection("chassis");
+        db.WriteBodies({body});
+        db.WriteShafts({shaft});
+    };
+
+    // Frame 3 fails on the writer thread; the error surfaces at a later submission or flush
+    bool thrown = false;
+    try {
+        for (int i = 0; i < 10; i++)
+            write(i);
+        output.Flush();
+    } catch (const std::runtime_error& e) {
+        thrown = true;
+        ASSERT_STREQ(e.what(), "write failure");
+    }
+    ASSERT_TRUE(thrown);
+
+    // The error is reported once; the output can be used afterwards
+    output.Flush();
+    write(10);
+    output.Flush();
+    ASSERT_EQ(output.entries.front().frame, 0);
+    ASSERT_EQ(output.entries.back().frame, 10);
+    for (const auto& entry : output.entries)
+        ASSERT_NE(entry.frame, 3);
+}
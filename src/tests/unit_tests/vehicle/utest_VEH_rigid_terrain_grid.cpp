@@ -0,0 +1,167 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the baked height grids of RigidTerrain mesh patches.
+// Terrain heights and normals obtained from the height grid are compared with
+// those obtained by ray casting into the patch mesh, for a mesh made of two
+// tilted planes meeting at a ridge:
+// - away from the ridge, the surface is planar and the results must match
+// - at locations outside the grid or below the surface, the grid query falls
+//   back on ray casting and the results must be identical
+// - batched queries must match individual queries
+//
+// =============================================================================
+
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/core/ChGlobal.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+static const std::string out_dir = GetChronoOutputPath() + "RIGID_TERRAIN_GRID/";
+
+// Surface height: slope 0.1 in x, ridge along y = 1
+static double SurfaceHeight(double x, double y) {
+    return 0.1 * x + 0.4 - 0.2 * std::abs(y - 1);
+}
+
+// Write the surface mesh (4 x 2, with a vertex row on the ridge) as a Wavefront OBJ file
+static void WriteMesh(const std::string& filename) {
+    int nx = 9;
+    int ny = 9;
+    std::ofstream file(filename);
+    for (int i = 0; i < nx; i++) {
+        for (int j = 0; j < ny; j++) {
+            double x = i * 0.5;
+            double y = j * 0.25;
+            file << "v " << x << " " << y << " " << SurfaceHeight(x, y) << "\n";
+        }
+    }
+    for (int i = 0; i < nx - 1; i++) {
+        for (int j = 0; j < ny - 1; j++) {
+            int v00 = i * ny + j + 1;  // OBJ indices are 1-based
+            int v10 = v00 + ny;
+            file << "f " << v00 << " " << v10 << " " << v10 + 1 << "\n";
+            file << "f " << v00 << " " << v10 + 1 << " " << v00 + 1 << "\n";
+        }
+    }
+}
+
+class TerrainGrid : public ::testing::Test {
+  protected:
+    TerrainGrid() {
+        filesystem::create_directory(filesystem::path(GetChronoOutputPath()));
+        filesystem::create_directory(filesystem::path(out_dir));
+        std::string mesh_file = out_dir + "ridge.obj";
+        WriteMesh(mesh_file);
+
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+        for (int k = 0; k < 2; k++) {
+            sys[k].SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+            sys[k].SetNumThreads(2);
+            terrain[k] = chrono_types::make_shared<RigidTerrain>(&sys[k]);
+            terrain[k]->AddPatch(mat, ChCoordsys<>(), mesh_file, true, 0, false);
+            terrain[k]->UseHeightGrid(k == 1, 0.05);
+            terrain[k]->Initialize();
+            sys[k].DoStepDynamics(1e-3);
+        }
+    }
+
+    ChSystemNSC sys[2];
+    std::shared_ptr<RigidTerrain> terrain[2];  // 0: ray casting, 1: height grid
+};
+
+TEST_F(TerrainGrid, planar_regions) {
+    for (double x = 0.13; x < 4; x += 0.31) {
+        for (double y = 0.07; y < 2; y += 0.17) {
+            if (std::abs(y - 1) < 0.1)
+                continue;
+            ChVector3d loc(x, y, 2);
+            double h_ray = terrain[0]->GetHeight(loc);
+            double h_grid = terrain[1]->GetHeight(loc);
+            ChVector3d n_ray = terrain[0]->GetNormal(loc);
+            ChVector3d n_grid = terrain[1]->GetNormal(loc);
+            ASSERT_NEAR(h_ray, SurfaceHeight(x, y), 1e-6);
+            ASSERT_NEAR(h_grid, h_ray, 1e-6);
+            ASSERT_NEAR((n_grid - n_ray).Length(), 0, 1e-6);
+        }
+    }
+}
+
+TEST_F(TerrainGrid, ridge) {
+    // Close to the ridge, bilinear interpolation cuts the corner by at most (grid spacing) x (slope change) / 4
+    for (double x = 0.13; x < 4; x += 0.31) {
+        ChVector3d loc(x, 1.01, 2);
+        double h_ray = terrain[0]->GetHeight(loc);
+        double h_grid = terrain[1]->GetHeight(loc);
+        ASSERT_NEAR(h_grid, h_ray, 0.05 * 0.4 / 4 + 1e-6);
+        ASSERT_GT(terrain[1]->GetNormal(loc).z(), 0.9);
+    }
+}
+
+TEST_F(TerrainGrid, fallback) {
+    std::vector<ChVector3d> locs = {
+        ChVector3d(-1, 1, 2),       // outside the patch (before the grid)
+        ChVector3d(5, 1, 2),        // outside the patch (after the grid)
+        ChVector3d(4.02, 0.5, 2),   // outside the mesh, within the grid margin
+        ChVector3d(2, -0.5, 2),     // outside the patch (lateral)
+        ChVector3d(2, 0.5, 0.1),    // below the surface
+        ChVector3d(3.9, 1.9, 0.2),  // below the surface, near the corner
+    };
+    for (const auto& loc : locs) {
+        double h_ray, h_grid;
+        ChVector3d n_ray, n_grid;
+        float f_ray, f_grid;
+        bool hit_ray = terrain[0]->FindPoint(loc, h_ray, n_ray, f_ray);
+        bool hit_grid = terrain[1]->FindPoint(loc, h_grid, n_grid, f_grid);
+        ASSERT_EQ(hit_grid, hit_ray);
+        ASSERT_FALSE(hit_grid);
+        ASSERT_EQ(terrain[1]->GetHeight(loc), terrain[0]->GetHeight(loc));
+        ASSERT_EQ(terrain[1]->GetNormal(loc), terrain[0]->GetNormal(loc));
+    }
+}
+
+TEST_F(TerrainGrid, batch) {
+    std::vector<ChVector3d> locs;
+    for (double x = -0.5; x < 4.5; x += 0.23)
+        for (double y = -0.5; y < 2.5; y += 0.19)
+            locs.push_back(ChVector3d(x, y, 2));
+
+    for (int k = 0; k < 2; k++) {
+        std::vector<double> height;
+        std::vector<ChVector3d> normal;
+        std::vector<float> friction;
+        terrain[k]->GetPropertiesBatch(locs, height, normal, friction);
+        ASSERT_EQ(height.size(), locs.size());
+        for (size_t i = 0; i < locs.size(); i++) {
+            double h;
+            ChVector3d n;
+            float f;
+            terrain[k]->GetProperties(locs[i], h, n, f);
+            ASSERT_EQ(height[i], h);
+            ASSERT_EQ(normal[i], n);
+            ASSERT_EQ(friction[i], f);
+        }
+    }
+}